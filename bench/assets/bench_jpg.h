@@ -0,0 +1,1041 @@
+
+// Generated by https://honeythecodewitch.com/gfx/converter
+// --------------------------------------------------------
+// Add #define BENCH_JPG_IMPLEMENTATION
+// to exactly one CPP file before including this file.
+// --------------------------------------------------------
+
+#ifndef BENCH_JPG_H
+#define BENCH_JPG_H
+#include <stdint.h>
+
+extern const uint8_t bench_jpg[];
+#endif
+
+#ifdef BENCH_JPG_IMPLEMENTATION
+
+const uint8_t bench_jpg[] = {
+	0xff,0xd8,0xff,0xe0,0x00,0x10,0x4a,0x46,0x49,0x46,0x00,0x01,0x01,0x00,0x00,0x01,
+	0x00,0x01,0x00,0x00,0xff,0xdb,0x00,0x84,0x00,0x06,0x04,0x05,0x06,0x05,0x04,0x06,
+	0x06,0x05,0x06,0x07,0x07,0x06,0x08,0x0a,0x10,0x0a,0x0a,0x09,0x09,0x0a,0x14,0x0e,
+	0x0f,0x0c,0x10,0x17,0x14,0x18,0x18,0x17,0x14,0x16,0x16,0x1a,0x1d,0x25,0x1f,0x1a,
+	0x1b,0x23,0x1c,0x16,0x16,0x20,0x2c,0x20,0x23,0x26,0x27,0x29,0x2a,0x29,0x19,0x1f,
+	0x2d,0x30,0x2d,0x28,0x30,0x25,0x28,0x29,0x28,0x01,0x07,0x07,0x07,0x0a,0x08,0x0a,
+	0x13,0x0a,0x0a,0x13,0x28,0x1a,0x16,0x1a,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,
+	0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,
+	0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,
+	0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0xff,0xc0,0x00,0x11,0x08,0x00,
+	0xf0,0x01,0x40,0x03,0x01,0x22,0x00,0x02,0x11,0x01,0x03,0x11,0x01,0xff,0xc4,0x01,
+	0xa2,0x00,0x00,0x01,0x05,0x01,0x01,0x01,0x01,0x01,0x01,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x01,0x02,0x03,0x04,0x05,0x06,0x07,0x08,0x09,0x0a,0x0b,0x10,0x00,
+	0x02,0x01,0x03,0x03,0x02,0x04,0x03,0x05,0x05,0x04,0x04,0x00,0x00,0x01,0x7d,0x01,
+	0x02,0x03,0x00,0x04,0x11,0x05,0x12,0x21,0x31,0x41,0x06,0x13,0x51,0x61,0x07,0x22,
+	0x71,0x14,0x32,0x81,0x91,0xa1,0x08,0x23,0x42,0xb1,0xc1,0x15,0x52,0xd1,0xf0,0x24,
+	0x33,0x62,0x72,0x82,0x09,0x0a,0x16,0x17,0x18,0x19,0x1a,0x25,0x26,0x27,0x28,0x29,
+	0x2a,0x34,0x35,0x36,0x37,0x38,0x39,0x3a,0x43,0x44,0x45,0x46,0x47,0x48,0x49,0x4a,
+	0x53,0x54,0x55,0x56,0x57,0x58,0x59,0x5a,0x63,0x64,0x65,0x66,0x67,0x68,0x69,0x6a,
+	0x73,0x74,0x75,0x76,0x77,0x78,0x79,0x7a,0x83,0x84,0x85,0x86,0x87,0x88,0x89,0x8a,
+	0x92,0x93,0x94,0x95,0x96,0x97,0x98,0x99,0x9a,0xa2,0xa3,0xa4,0xa5,0xa6,0xa7,0xa8,
+	0xa9,0xaa,0xb2,0xb3,0xb4,0xb5,0xb6,0xb7,0xb8,0xb9,0xba,0xc2,0xc3,0xc4,0xc5,0xc6,
+	0xc7,0xc8,0xc9,0xca,0xd2,0xd3,0xd4,0xd5,0xd6,0xd7,0xd8,0xd9,0xda,0xe1,0xe2,0xe3,
+	0xe4,0xe5,0xe6,0xe7,0xe8,0xe9,0xea,0xf1,0xf2,0xf3,0xf4,0xf5,0xf6,0xf7,0xf8,0xf9,
+	0xfa,0x01,0x00,0x03,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x01,0x02,0x03,0x04,0x05,0x06,0x07,0x08,0x09,0x0a,0x0b,0x11,0x00,
+	0x02,0x01,0x02,0x04,0x04,0x03,0x04,0x07,0x05,0x04,0x04,0x00,0x01,0x02,0x77,0x00,
+	0x01,0x02,0x03,0x11,0x04,0x05,0x21,0x31,0x06,0x12,0x41,0x51,0x07,0x61,0x71,0x13,
+	0x22,0x32,0x81,0x08,0x14,0x42,0x91,0xa1,0xb1,0xc1,0x09,0x23,0x33,0x52,0xf0,0x15,
+	0x62,0x72,0xd1,0x0a,0x16,0x24,0x34,0xe1,0x25,0xf1,0x17,0x18,0x19,0x1a,0x26,0x27,
+	0x28,0x29,0x2a,0x35,0x36,0x37,0x38,0x39,0x3a,0x43,0x44,0x45,0x46,0x47,0x48,0x49,
+	0x4a,0x53,0x54,0x55,0x56,0x57,0x58,0x59,0x5a,0x63,0x64,0x65,0x66,0x67,0x68,0x69,
+	0x6a,0x73,0x74,0x75,0x76,0x77,0x78,0x79,0x7a,0x82,0x83,0x84,0x85,0x86,0x87,0x88,
+	0x89,0x8a,0x92,0x93,0x94,0x95,0x96,0x97,0x98,0x99,0x9a,0xa2,0xa3,0xa4,0xa5,0xa6,
+	0xa7,0xa8,0xa9,0xaa,0xb2,0xb3,0xb4,0xb5,0xb6,0xb7,0xb8,0xb9,0xba,0xc2,0xc3,0xc4,
+	0xc5,0xc6,0xc7,0xc8,0xc9,0xca,0xd2,0xd3,0xd4,0xd5,0xd6,0xd7,0xd8,0xd9,0xda,0xe2,
+	0xe3,0xe4,0xe5,0xe6,0xe7,0xe8,0xe9,0xea,0xf2,0xf3,0xf4,0xf5,0xf6,0xf7,0xf8,0xf9,
+	0xfa,0xff,0xda,0x00,0x0c,0x03,0x01,0x00,0x02,0x11,0x03,0x11,0x00,0x3f,0x00,0xf1,
+	0x2b,0x75,0xe9,0x5a,0x30,0x2d,0x54,0x81,0x6b,0x42,0x05,0xaf,0x9f,0x93,0x3f,0x5b,
+	0xc1,0x4c,0xb5,0x12,0xd5,0xa4,0x5a,0x86,0x21,0x56,0x50,0x56,0x57,0x3e,0x8e,0x85,
+	0x4d,0x05,0x0b,0x4d,0x65,0xa9,0x40,0xa4,0x61,0x5a,0x41,0x9d,0x12,0xab,0xa1,0x52,
+	0x45,0xaa,0x73,0x2d,0x68,0x48,0x2a,0xa4,0xc2,0xbb,0xe8,0xb3,0xc8,0xc5,0xd4,0xd0,
+	0xcb,0x9d,0x7a,0xd6,0x7c,0xeb,0x5a,0xd3,0x2d,0x50,0x9d,0x2b,0xd6,0xa1,0x23,0xe4,
+	0xb1,0xd2,0xdc,0xc9,0x99,0x6a,0x94,0xa9,0x5a,0x93,0x25,0x54,0x91,0x2b,0xd6,0xa3,
+	0x23,0xe4,0xb1,0x6f,0x53,0x39,0x92,0x99,0xb2,0xae,0x34,0x74,0xcf,0x2e,0xbd,0x08,
+	0x4c,0xf1,0x67,0xb9,0x0a,0x25,0x59,0x89,0x29,0x52,0x3a,0xb1,0x14,0x75,0xaf,0x39,
+	0xad,0x1d,0xc9,0x60,0x5a,0xd1,0xb7,0x5e,0x95,0x5a,0x14,0xad,0x08,0x13,0xa5,0x67,
+	0x29,0x1f,0x43,0x83,0x65,0xbb,0x75,0xe9,0x5a,0x50,0x2d,0x53,0x81,0x6b,0x46,0x05,
+	0xae,0x79,0x48,0xfa,0xdc,0x14,0xcb,0x31,0x2d,0x5b,0x45,0xa8,0x22,0x15,0x69,0x05,
+	0x63,0x73,0xe9,0x28,0x54,0xd0,0x50,0xb4,0x8c,0xb5,0x28,0x14,0x8c,0x2b,0x48,0x33,
+	0xa6,0x55,0x74,0x2a,0x48,0xb5,0x52,0x65,0xab,0xf2,0x0a,0xa9,0x28,0xae,0xfa,0x4c,
+	0xf2,0x71,0x55,0x34,0x33,0x27,0x5e,0xb5,0x9f,0x3a,0xd6,0xb4,0xcb,0x59,0xf3,0x2d,
+	0x7a,0xb4,0x24,0x7c,0x9e,0x3a,0x5b,0x99,0x33,0x2d,0x52,0x95,0x2b,0x56,0x64,0xaa,
+	0x72,0x25,0x7a,0xf4,0x64,0x7c,0x8e,0x2d,0x99,0xce,0x94,0xcd,0x95,0x71,0xa3,0xa6,
+	0x79,0x75,0xe8,0x42,0x67,0x89,0x3d,0xc8,0x51,0x2a,0xc4,0x49,0x4a,0xb1,0xd5,0x88,
+	0xa3,0xad,0x79,0xcd,0x68,0xee,0x4b,0x02,0xd6,0x85,0xba,0xf4,0xaa,0xf0,0xa5,0x68,
+	0x40,0x9d,0x2b,0x39,0x48,0xfa,0x0c,0x1b,0x2d,0xdb,0xaf,0x4a,0xd1,0x81,0x7a,0x55,
+	0x48,0x16,0xb4,0x20,0x5e,0x95,0xcf,0x29,0x1f,0x5b,0x82,0x99,0x6a,0x15,0xab,0x68,
+	0xb5,0x04,0x42,0xad,0x20,0xac,0xae,0x7d,0x2d,0x0a,0x9a,0x1e,0x79,0x0a,0xd5,0xe8,
+	0x45,0x56,0x89,0x6a,0xdc,0x42,0xbf,0x9e,0xdb,0x3c,0x5c,0x35,0x5b,0x16,0xa3,0xab,
+	0x09,0x55,0xe3,0xa9,0x94,0xd4,0x9e,0xd5,0x2c,0x45,0x91,0x30,0xa4,0x34,0x80,0xd2,
+	0x13,0x5a,0xc1,0x1b,0x4b,0x13,0xa1,0x1b,0xd5,0x69,0x45,0x59,0x7a,0x82,0x41,0x5d,
+	0xb4,0x8f,0x37,0x11,0x5e,0xe5,0x19,0x96,0xa9,0x4c,0xb5,0xa3,0x22,0xd5,0x59,0x12,
+	0xbd,0x2a,0x32,0x3e,0x77,0x17,0x2b,0x99,0x72,0xa5,0x55,0x92,0x3a,0xd5,0x92,0x3a,
+	0xae,0xf1,0x7b,0x57,0xa5,0x4a,0x67,0xce,0xe2,0x23,0x73,0x31,0xa2,0xa6,0xf9,0x55,
+	0xa0,0x61,0xf6,0xa4,0xf2,0x7d,0xab,0xba,0x15,0x0f,0x32,0x54,0xb5,0x29,0x2c,0x55,
+	0x62,0x38,0xea,0x75,0x87,0xda,0xa6,0x48,0xbd,0xab,0x6f,0x68,0x5d,0x3a,0x76,0x63,
+	0x61,0x8e,0xaf,0x42,0x94,0xd8,0xe3,0xab,0x71,0x25,0x4b,0x99,0xec,0xe1,0xb4,0x26,
+	0x85,0x6a,0xfc,0x22,0xab,0x44,0xb5,0x6e,0x21,0x59,0xb6,0x7d,0x0e,0x1a,0xa5,0x8b,
+	0x51,0x55,0x84,0xaa,0xf1,0xd4,0xea,0x6a,0x4f,0x6e,0x96,0x22,0xc4,0xc2,0x90,0xd3,
+	0x41,0xa0,0x9a,0xd6,0x28,0xda,0x58,0x9d,0x08,0xde,0xab,0x4a,0x2a,0xcb,0x54,0x12,
+	0x0a,0xec,0xa4,0x79,0xd8,0x8a,0xf7,0x28,0xca,0xb5,0x4a,0x65,0xad,0x19,0x16,0xab,
+	0x48,0x95,0xe9,0x51,0x91,0xf3,0xd8,0xb9,0xdc,0xcb,0x95,0x2a,0xa4,0x91,0xd6,0xac,
+	0x91,0xd5,0x77,0x8a,0xbd,0x3a,0x53,0x3e,0x73,0x13,0x1b,0x99,0x6d,0x15,0x37,0xca,
+	0xad,0x13,0x0f,0xb5,0x27,0x93,0xed,0x5d,0xd0,0xa8,0x79,0x73,0xa5,0xa9,0x49,0x62,
+	0xa9,0xe3,0x8e,0xac,0x2c,0x3e,0xd5,0x32,0x45,0xed,0x5b,0x2a,0x85,0xd3,0xa7,0x66,
+	0x32,0x18,0xea,0xf4,0x29,0x4c,0x8e,0x3a,0xb7,0x12,0x54,0xb9,0x9e,0xc6,0x19,0x58,
+	0x9e,0x15,0xab,0xd0,0x8a,0xad,0x12,0xd5,0xc8,0x85,0x66,0xd9,0xf4,0x38,0x6a,0x96,
+	0x2d,0x45,0x56,0x52,0xab,0x47,0x53,0xa9,0xa9,0x3d,0xba,0x58,0x8b,0x23,0x86,0x45,
+	0xab,0x09,0x4c,0x55,0xa7,0xad,0x7f,0x3d,0x27,0x73,0xca,0xa7,0x57,0x94,0x99,0x4d,
+	0x4a,0xad,0x50,0x03,0x4e,0x0d,0x56,0x91,0xd5,0x1c,0x5d,0x89,0xf7,0x50,0x5a,0xa2,
+	0x0d,0x46,0xea,0xda,0x31,0x1b,0xc6,0x0f,0x63,0x51,0xb5,0x2e,0x69,0x0d,0x75,0x40,
+	0xc2,0x78,0x9b,0x90,0xb8,0xa8,0x5d,0x2a,0xd1,0x5a,0x69,0x4a,0xec,0x84,0xac,0x70,
+	0x54,0x9f,0x31,0x45,0xa3,0xa8,0x9a,0x2a,0xd1,0x31,0x52,0x79,0x35,0xd9,0x0a,0x87,
+	0x0d,0x4a,0x77,0x33,0x0c,0x34,0x79,0x3e,0xd5,0xa5,0xe4,0x52,0xf9,0x1e,0xd5,0xd3,
+	0x1a,0xa7,0x33,0xa0,0x67,0x08,0x7d,0xaa,0x45,0x8a,0xaf,0x08,0x3d,0xa9,0xc2,0x1a,
+	0xdd,0x55,0x1c,0x68,0x58,0xaa,0x91,0xd5,0x84,0x4a,0x94,0x45,0x52,0x2a,0x56,0x8a,
+	0x77,0x3a,0x61,0x1e,0x51,0x11,0x6a,0xc2,0x53,0x15,0x6a,0x45,0x15,0x49,0xdc,0xed,
+	0xa7,0x57,0x94,0x99,0x0d,0x48,0xad,0x50,0x03,0x57,0x74,0xcd,0x3e,0xfb,0x53,0x98,
+	0xc5,0xa7,0x5a,0x4f,0x74,0xe1,0x95,0x5b,0xca,0x42,0xc1,0x0b,0x74,0xdc,0x7a,0x28,
+	0x3c,0xf2,0x48,0x1c,0x1a,0xa6,0xe3,0x18,0xb9,0x49,0xd9,0x2e,0xa7,0x47,0xd7,0x63,
+	0x05,0x79,0x3b,0x0c,0x0d,0x41,0x6a,0xec,0xa3,0xf8,0x7b,0x71,0x6d,0x68,0x2e,0x35,
+	0xfd,0x63,0x4f,0xd2,0x23,0x7d,0xa1,0x3c,0xc3,0xbf,0xe6,0x20,0x92,0xac,0x49,0x50,
+	0x08,0xc7,0x62,0xd9,0xe7,0xd3,0x98,0x5a,0x4f,0x87,0x7a,0x78,0xf3,0x4d,0xe6,0xab,
+	0xab,0xe7,0xe5,0xf2,0x00,0x29,0xb7,0xbe,0xec,0xed,0x8f,0xd3,0x1f,0x78,0xf5,0xe9,
+	0xdc,0x71,0xd3,0xcd,0xa8,0x56,0x76,0xc2,0xc6,0x55,0x6d,0xbf,0x24,0x5c,0x97,0xfe,
+	0x05,0xa4,0x7f,0xf2,0x63,0x96,0xb6,0x77,0x4e,0x96,0xff,0x00,0x8d,0x97,0xe7,0xaf,
+	0xe0,0x72,0x24,0xd4,0x4d,0x5d,0x87,0xf6,0xe7,0xc3,0x9f,0xfa,0x01,0xea,0xff,0x00,
+	0xf7,0xf9,0xbf,0xf8,0xf5,0x1f,0xdb,0x9f,0x0e,0x7f,0xe8,0x05,0xab,0xff,0x00,0xdf,
+	0xd6,0xff,0x00,0xe3,0xd5,0xd7,0x1c,0xc2,0xba,0xff,0x00,0x98,0x3a,0xdf,0xf8,0x0c,
+	0x3f,0xf9,0x33,0x86,0x79,0xed,0x29,0x75,0x5f,0x7f,0xfc,0x03,0x8a,0x71,0x50,0xba,
+	0x57,0x78,0xb3,0xfc,0x39,0xd4,0xf3,0x87,0xd5,0x74,0x6f,0x2f,0xd7,0x2f,0xe6,0xe7,
+	0xfe,0xfe,0x63,0x18,0xf6,0xeb,0xdf,0xb4,0xe9,0xf0,0xfa,0x0d,0x56,0x16,0x9b,0xc3,
+	0x1e,0x20,0xb1,0xbf,0x5c,0x86,0xf2,0xa4,0xf9,0x5a,0x34,0x6c,0x95,0xde,0x57,0x27,
+	0x77,0x18,0xc1,0x55,0xef,0xd3,0x18,0xad,0x3f,0xb7,0xf0,0xf8,0x7d,0x71,0x70,0x9d,
+	0x15,0xde,0x70,0x69,0x7f,0xe0,0x4a,0xf1,0xfc,0x7f,0x1d,0x0c,0x96,0x3e,0x9d,0x7d,
+	0x22,0xef,0xe8,0xd3,0xff,0x00,0x83,0xf8,0x1e,0x6c,0xd1,0xd4,0x4d,0x15,0x74,0x1a,
+	0xb6,0x85,0xa9,0x69,0x0e,0x57,0x53,0xb1,0x9e,0xd8,0x6e,0x09,0xbd,0xd7,0x28,0x58,
+	0x8c,0x80,0x1c,0x65,0x49,0xc7,0x60,0x7b,0x1f,0x43,0x59,0xfe,0x4d,0x7d,0x16,0x1f,
+	0x13,0x4e,0xb4,0x15,0x4a,0x52,0x52,0x8b,0xea,0x9d,0xd7,0xde,0x8c,0xa5,0x15,0x3d,
+	0x8c,0xc3,0x0f,0xb5,0x27,0x93,0xed,0x5a,0x7e,0x45,0x1e,0x47,0xb5,0x77,0x46,0xa9,
+	0x83,0xa0,0x67,0x08,0x7d,0xaa,0x45,0x8a,0xaf,0x88,0x29,0xc2,0x1a,0xdd,0x55,0x05,
+	0x42,0xc5,0x44,0x8e,0xac,0x22,0x54,0xc2,0x2a,0x7a,0xc7,0x5a,0x29,0xdc,0xe9,0x84,
+	0x79,0x44,0x8d,0x6a,0xc2,0x53,0x15,0x6a,0x45,0x15,0x49,0xdc,0xed,0xa7,0x57,0x94,
+	0x99,0x0d,0x4a,0xad,0x55,0xc1,0xa7,0x83,0x5a,0x24,0x75,0x47,0x17,0x63,0x97,0xc5,
+	0x15,0x2b,0x2d,0x46,0xc2,0xbf,0x9d,0x60,0xee,0x73,0xce,0xb7,0x28,0x99,0xa3,0x75,
+	0x30,0x9a,0x69,0x35,0xd5,0x04,0x73,0x4b,0x17,0x62,0x5d,0xd4,0xe0,0xd5,0x06,0xea,
+	0x50,0x6b,0xa2,0x31,0x23,0xeb,0x84,0xe0,0xd3,0xc5,0x42,0xa6,0xa6,0x4a,0xd9,0x17,
+	0x1c,0x4d,0xc7,0x01,0x4f,0x09,0x4a,0x8b,0x53,0xa2,0x56,0x8a,0x56,0x3a,0x61,0x3e,
+	0x62,0x11,0x1d,0x38,0x45,0x56,0xd2,0x3a,0x95,0x61,0xad,0x15,0x43,0xa6,0x34,0xee,
+	0x51,0x10,0xfb,0x52,0xf9,0x3e,0xd5,0xa2,0x21,0xa7,0x88,0x2b,0x58,0xd5,0x34,0xfa,
+	0xb9,0x99,0xe4,0xfb,0x51,0xe4,0xd6,0x9f,0x91,0x4d,0x30,0xd7,0x44,0x2a,0x91,0x2a,
+	0x16,0x33,0xbc,0xaa,0x36,0x55,0xe6,0x8a,0xa2,0x64,0xae,0xa8,0x4e,0xe7,0x3c,0xe3,
+	0xca,0x55,0xdb,0x4b,0x1a,0x34,0x92,0xa4,0x71,0xab,0x3c,0x8e,0xc1,0x11,0x14,0x65,
+	0x99,0x8f,0x40,0x00,0xea,0x4f,0xa5,0x5a,0xb4,0xb3,0x9e,0xfa,0xee,0x2b,0x5b,0x38,
+	0x9a,0x6b,0x89,0x5b,0x6a,0x46,0xbd,0x58,0xff,0x00,0x4f,0x52,0x4f,0x00,0x02,0x4f,
+	0x15,0xde,0x3d,0xc6,0x9d,0xf0,0xf8,0x41,0x67,0x6b,0x69,0x16,0xb1,0xe2,0xd9,0xfa,
+	0x90,0x37,0x0b,0x72,0xca,0x42,0xaa,0xf1,0x9e,0x77,0x7d,0xd1,0x86,0x60,0x72,0x48,
+	0x05,0x45,0x15,0x71,0x4e,0x12,0x54,0x68,0xc7,0x9e,0xa4,0xaf,0x68,0xa6,0x96,0x8b,
+	0x76,0xdb,0xd2,0x31,0x5d,0x5b,0xf4,0x57,0x67,0x9f,0x5f,0x12,0xa9,0x2b,0xb7,0x6f,
+	0xeb,0xfa,0xd0,0xa9,0x63,0xe1,0x1b,0x0d,0x06,0xc7,0xfb,0x4f,0xc7,0x37,0x0b,0x0a,
+	0x85,0x7f,0x2f,0x4c,0x8e,0x41,0xe6,0x4a,0x46,0x00,0xf9,0x95,0xb9,0x3c,0xf4,0x5e,
+	0x06,0x41,0x2c,0x06,0x45,0x69,0xdb,0xea,0xfe,0x25,0xf1,0x3d,0xbf,0xd8,0xfc,0x19,
+	0xa6,0x45,0xa1,0xe8,0x83,0x72,0xad,0xcb,0x28,0x8f,0x20,0x97,0xce,0xd2,0x06,0x06,
+	0x4f,0x5d,0x80,0x95,0x6f,0xe2,0xe6,0xab,0x5c,0x58,0x59,0xf8,0x75,0x5b,0x5c,0xf1,
+	0xed,0xe2,0x6b,0x1a,0xe4,0x91,0x7e,0xe7,0x4c,0x91,0x83,0x84,0x2c,0x5b,0x8c,0x72,
+	0x36,0x8e,0x79,0xc6,0xd5,0x3b,0xb0,0x18,0xed,0xab,0x97,0xb6,0x1a,0xf7,0x8c,0x20,
+	0xfb,0x77,0x8a,0x6f,0x13,0xc3,0xbe,0x1f,0x46,0x20,0xda,0x96,0x31,0xb3,0x8d,0xe3,
+	0x1e,0x66,0xec,0x0c,0x9e,0x81,0x9b,0xb8,0x04,0x27,0x3c,0xf8,0x95,0x2a,0x42,0xa5,
+	0xb1,0x18,0x89,0x46,0x6a,0xf6,0x53,0x92,0x6e,0x9a,0x7d,0xa8,0xd1,0xf8,0xaa,0xb5,
+	0x7b,0x73,0xcb,0x47,0xdd,0xa3,0xcd,0x9d,0x4a,0x95,0x1d,0xb5,0xbf,0x65,0xbd,0xbf,
+	0xbd,0x2d,0xa2,0xbc,0x91,0x9b,0xa8,0xe9,0xbe,0x0b,0xd1,0x2e,0x66,0x7f,0x13,0x6a,
+	0xf7,0xbe,0x20,0xd5,0x82,0xed,0x96,0x35,0x76,0x24,0x9d,0xdb,0x7a,0x83,0xc3,0x28,
+	0x18,0x21,0x9f,0xa0,0xe9,0xd0,0x55,0xcd,0x17,0xc4,0x37,0x2c,0xa0,0x78,0x2b,0xc0,
+	0x89,0x11,0x75,0x31,0x5b,0xdf,0x48,0xb8,0x57,0x45,0x3c,0xef,0x7c,0x0c,0x93,0xb7,
+	0x9c,0xc9,0xf7,0xbb,0x93,0xd6,0xb6,0x95,0xac,0x68,0x5a,0x66,0xa0,0xb6,0x9e,0x01,
+	0xf0,0xf4,0xba,0xb6,0xa5,0xe5,0x85,0xfb,0x6c,0xdb,0xbe,0x53,0x80,0xa1,0xf9,0x19,
+	0x03,0x2e,0x43,0x7f,0xab,0x1e,0xf8,0xc6,0x36,0xe6,0xd3,0xfc,0x79,0xaa,0xc2,0xf3,
+	0x6a,0xfa,0xd5,0x96,0x85,0x60,0xca,0x5a,0x64,0x83,0x1b,0xe0,0x0b,0xdc,0x30,0xec,
+	0x76,0xe4,0xfe,0xf3,0xa1,0x3f,0x4a,0x31,0x72,0x4a,0x29,0x63,0x9b,0xb3,0xb3,0x5e,
+	0xde,0xa3,0x8f,0xfe,0x03,0x87,0xa5,0xaa,0x5d,0x93,0xdf,0x6d,0x2e,0x8c,0xe9,0xad,
+	0x7f,0x75,0xff,0x00,0x92,0xab,0xfd,0xf3,0x90,0xff,0x00,0xed,0x6f,0x89,0x5f,0xf4,
+	0x2f,0x69,0x7f,0xf7,0xf1,0x7f,0xf8,0xf5,0x1f,0xda,0xdf,0x12,0xbf,0xe8,0x5e,0xd2,
+	0xff,0x00,0xef,0xe2,0xff,0x00,0xf1,0xea,0xc7,0xfe,0xc7,0xff,0x00,0xaa,0xab,0xff,
+	0x00,0x93,0x5f,0xfd,0xba,0x8f,0xec,0x7f,0xfa,0xaa,0xbf,0xf9,0x35,0xff,0x00,0xdb,
+	0xab,0x97,0xd8,0xe0,0x7f,0x92,0x8f,0xfe,0x08,0xc4,0x7f,0x99,0x7c,0xd5,0x7b,0xcb,
+	0xff,0x00,0x02,0x81,0x67,0x56,0xf1,0x0e,0xb9,0x0c,0x3f,0xf1,0x56,0xf8,0x12,0xdf,
+	0x50,0x68,0x55,0xa5,0x59,0x91,0x43,0xc5,0x12,0x77,0xc9,0xc4,0x80,0x1f,0x94,0x93,
+	0xc8,0xe3,0x1c,0x77,0x38,0xf6,0xb0,0x7c,0x3e,0xd6,0x5a,0x23,0xa6,0xdd,0xde,0xf8,
+	0x7a,0xfe,0x36,0x63,0x0b,0x49,0x21,0x03,0x70,0x00,0xab,0x96,0x62,0xca,0x00,0x23,
+	0x8c,0x32,0x92,0x73,0xed,0x5d,0x0d,0xa6,0x93,0xe3,0x2b,0x3b,0x74,0xb8,0xf0,0xef,
+	0x8a,0x6d,0x75,0xab,0x1e,0x65,0xff,0x00,0x48,0x21,0x8c,0xcc,0x0e,0x0a,0x2b,0x1d,
+	0xdc,0x1d,0xb8,0xfb,0xeb,0xc9,0x3d,0x3a,0xd6,0x6e,0xb3,0xaf,0x5a,0x4f,0x79,0x6d,
+	0x69,0xf1,0x2b,0xc2,0xdf,0x67,0x9b,0xa2,0xde,0xc0,0x4e,0x0f,0x3d,0x01,0x53,0x92,
+	0x80,0x3e,0x48,0x0e,0xdc,0xf6,0xcf,0x4e,0xac,0x1c,0xa1,0x77,0x0c,0x0e,0xea,0xf7,
+	0x54,0x2a,0x49,0x4b,0xae,0xf4,0x2b,0x68,0xd2,0x7b,0xa5,0xdf,0xbe,0xd1,0x51,0x3d,
+	0xea,0xff,0x00,0xe4,0xc9,0x5b,0xff,0x00,0x02,0x89,0x66,0xe6,0xe3,0xc6,0x3e,0x0f,
+	0x86,0x68,0xf5,0x48,0x13,0xc4,0x9a,0x11,0x56,0x0e,0xed,0x96,0x70,0x9f,0x39,0x3b,
+	0xc9,0x05,0x80,0xc7,0x2d,0xb8,0x32,0x81,0x80,0x0d,0x50,0x97,0x43,0xd1,0x3c,0x59,
+	0x6b,0x25,0xff,0x00,0x83,0x26,0x5b,0x6b,0xc4,0x57,0x69,0x34,0xa9,0x88,0x56,0x72,
+	0x18,0x72,0x06,0xe3,0xb0,0x73,0xc6,0x32,0x9c,0xa8,0xf9,0x79,0xab,0x3a,0x76,0x8b,
+	0xa8,0xe8,0x56,0xcf,0xac,0x7c,0x3d,0xd5,0xd3,0x56,0xd3,0x02,0x96,0x92,0xc2,0x62,
+	0x5c,0x92,0x55,0x73,0xf2,0xae,0x32,0xfd,0xf1,0x85,0x60,0x00,0x1c,0xe7,0x05,0x82,
+	0x0d,0x33,0xc6,0xb7,0x06,0xe7,0x49,0x97,0xfe,0x11,0x9f,0x17,0x5b,0xc9,0x22,0xbc,
+	0x1b,0xb6,0x34,0xad,0x86,0x27,0x91,0xb4,0x93,0xd7,0x73,0x01,0xb8,0x7c,0xc0,0x82,
+	0x36,0x9a,0xaa,0x55,0x95,0x19,0x3c,0x5d,0x09,0x28,0x35,0xf1,0x54,0x84,0x5c,0x52,
+	0x7d,0xab,0xd0,0xdd,0x5f,0xf9,0xe3,0xb3,0xd6,0xe5,0xc2,0x73,0x83,0x51,0x5f,0x24,
+	0xdd,0xff,0x00,0xf0,0x19,0x75,0xf4,0x67,0x17,0x73,0x65,0x2d,0xa5,0xdc,0xd6,0xb7,
+	0x51,0x34,0x37,0x30,0x9d,0xb2,0x44,0xdd,0x54,0xff,0x00,0x87,0x70,0x7a,0x11,0xc8,
+	0xc8,0xa6,0x79,0x3e,0xd5,0xdc,0xda,0xea,0xd6,0xfe,0x24,0xbb,0x3e,0x1f,0xf1,0x7d,
+	0xa2,0x69,0xbe,0x25,0x89,0x44,0x31,0x5f,0xed,0x19,0x91,0xc1,0x38,0x53,0xd3,0x83,
+	0x90,0x76,0xe7,0x6b,0x64,0x95,0xda,0x76,0xd6,0x0d,0xfe,0x99,0x71,0xa7,0x5e,0xcb,
+	0x67,0x7b,0x1f,0x97,0x71,0x1f,0x50,0x0e,0x43,0x03,0xd1,0x94,0xf7,0x53,0x83,0x83,
+	0xec,0x41,0xc1,0x04,0x0f,0xb4,0xcb,0xb3,0x69,0x56,0x97,0xd5,0xf1,0x31,0xe4,0xaa,
+	0x92,0x76,0x4e,0xf1,0x94,0x5f,0xdb,0x83,0xeb,0x17,0xf7,0xad,0x99,0xeb,0xe1,0x2a,
+	0xc3,0x10,0xb4,0xdf,0xfa,0xd3,0xc9,0xff,0x00,0x48,0xc5,0xf2,0x7d,0xa8,0xf2,0x7d,
+	0xab,0x4b,0xc8,0xa4,0x30,0xd7,0xbb,0x0a,0xa7,0x54,0xa8,0x58,0xce,0xf2,0xa9,0x36,
+	0x55,0xe6,0x8a,0xa3,0x68,0xeb,0xaa,0x13,0xb9,0xcd,0x38,0xf2,0x95,0x76,0xd2,0x54,
+	0xcc,0xb5,0x13,0x0a,0xea,0x83,0xb9,0xc9,0x3a,0xbc,0xa2,0x66,0x8d,0xd4,0xc3,0x4d,
+	0x26,0xba,0xe0,0x8e,0x59,0x62,0xec,0x65,0xc8,0xb5,0x5d,0xea,0xec,0xab,0x55,0x25,
+	0x15,0xfc,0xdd,0x49,0x9d,0x98,0x9a,0xb6,0x2b,0x31,0xa8,0xc9,0xa7,0xbd,0x44,0xd5,
+	0xe8,0x53,0x3c,0x5a,0xb8,0x9b,0x0b,0xba,0x9c,0xa6,0xa2,0xa7,0xad,0x74,0xc5,0x1c,
+	0xeb,0x15,0xa9,0x61,0x0d,0x58,0x8e,0xab,0x47,0x56,0xe2,0x15,0x47,0x75,0x0a,0xf7,
+	0x2c,0x44,0x2a,0xdc,0x49,0x50,0xc2,0xb5,0x7a,0x14,0xa9,0x72,0x3d,0xdc,0x34,0xee,
+	0x3e,0x38,0xea,0xc2,0x45,0x4f,0x8a,0x3a,0xb7,0x1c,0x55,0x1c,0xe7,0xbb,0x42,0x37,
+	0x20,0x58,0x69,0xe2,0x1f,0x6a,0xb8,0x91,0x54,0x82,0x2a,0x6a,0xa1,0xe8,0x46,0x96,
+	0x86,0x71,0x86,0x98,0xd1,0x56,0x99,0x8a,0xa2,0x78,0xab,0xa6,0x9d,0x43,0x2a,0xb4,
+	0xec,0x8c,0xa7,0x8e,0xaa,0xcf,0xb6,0x34,0x67,0x72,0x02,0x8e,0xa4,0xd6,0xb4,0x91,
+	0xd6,0xe7,0x83,0x6c,0x6d,0x61,0x6b,0xcf,0x11,0x6a,0x8c,0x45,0x86,0x90,0x37,0x2a,
+	0x7c,0xa4,0x4b,0x36,0xdc,0x81,0xf3,0x77,0x19,0x52,0xbd,0x32,0xcc,0xb8,0x39,0x5a,
+	0xea,0x96,0x26,0x34,0x29,0xba,0x92,0x57,0xb7,0x45,0xbb,0x6f,0x44,0x96,0xfa,0xb6,
+	0xd2,0xdb,0x4d,0xde,0x87,0x85,0x8d,0x97,0xb3,0x8d,0xff,0x00,0xaf,0xe9,0x6e,0x4d,
+	0x93,0xe0,0x2d,0x01,0x91,0x44,0x52,0x78,0xc3,0x53,0xc2,0xdb,0xc5,0x1c,0x7e,0x6b,
+	0xc3,0x19,0x20,0x05,0xeb,0x8e,0xa0,0xf4,0xfb,0xcd,0x81,0x86,0x0b,0x9a,0x9a,0xd2,
+	0x48,0xbe,0x1f,0x68,0xc8,0xf7,0x10,0xfd,0xbb,0xc6,0xba,0xae,0x4f,0x97,0xbc,0xca,
+	0xf9,0x66,0xe0,0x12,0x39,0xc6,0x71,0x9c,0x72,0xed,0x90,0x09,0x03,0x2b,0x0e,0x8f,
+	0x7c,0xb1,0xdb,0xde,0xfc,0x44,0xf1,0x01,0x96,0x59,0x8c,0x8f,0x0e,0x99,0x69,0xe6,
+	0xa8,0x01,0x49,0x2a,0x14,0x1e,0xf8,0xcb,0x8e,0x9d,0x15,0xdb,0x04,0x9a,0x66,0x99,
+	0x3a,0xf8,0x77,0x4e,0xbc,0xf1,0x9f,0x88,0x9a,0xde,0x4d,0x73,0x55,0x52,0xfa,0x74,
+	0x07,0x2e,0x50,0x30,0xe0,0x8f,0x9b,0x85,0xc1,0x5e,0xf9,0x55,0x00,0x67,0x2d,0xb6,
+	0xb9,0x25,0x45,0xca,0x32,0xa3,0x55,0x73,0xb7,0x24,0xa6,0xa3,0xa3,0xab,0x55,0x7f,
+	0xcb,0x98,0xb5,0xaa,0xa5,0x49,0x6b,0x37,0xae,0xa9,0xf5,0x3e,0x69,0xd4,0x72,0x97,
+	0x3d,0xed,0xa5,0xd5,0xfa,0x47,0xf9,0xbf,0xc4,0xfa,0x03,0xc7,0xa7,0x78,0x3d,0xa3,
+	0xd6,0xbc,0x64,0x5f,0x55,0xf1,0x65,0xd3,0x7d,0xa2,0x38,0x15,0x81,0x10,0x10,0x08,
+	0x5c,0xff,0x00,0x08,0x19,0xc0,0xce,0x08,0x04,0x0d,0x83,0xe5,0x26,0x9f,0x73,0xa3,
+	0x5c,0x6a,0x51,0x45,0xe2,0x0f,0x89,0xda,0x8f,0xd9,0x6c,0x57,0x1f,0x67,0xb1,0x8c,
+	0x15,0x2b,0xb9,0xb3,0xb0,0xa8,0x19,0x19,0x03,0xa0,0xcb,0xe3,0xa9,0x1b,0x6a,0x6d,
+	0x2f,0xec,0xfe,0x11,0xd2,0xdb,0xc5,0x7e,0x2d,0xf3,0x6e,0x7c,0x4b,0x7f,0xb8,0xc3,
+	0x04,0xb8,0x0e,0xbd,0x80,0x03,0xf8,0x7e,0x5c,0x64,0xe3,0xe5,0x04,0x28,0x03,0xa3,
+	0x56,0x7d,0x3e,0xda,0x27,0x8f,0xc5,0x3f,0x12,0xee,0x1f,0xed,0x73,0xb6,0xeb,0x4d,
+	0x31,0x57,0x23,0x6a,0x82,0x42,0x14,0xf4,0xe4,0x7c,0xa4,0x80,0x09,0x1b,0xc9,0x2c,
+	0x45,0x52,0xab,0x27,0x37,0x56,0x32,0x6e,0x57,0xe4,0xe7,0x82,0xbc,0xa4,0xd6,0xf4,
+	0xf0,0xd1,0xda,0x10,0x8a,0xba,0x75,0x3a,0xee,0x4f,0x2a,0xb5,0x9a,0xd3,0x7b,0x3d,
+	0x97,0x9c,0xdf,0x56,0xfb,0x16,0x74,0xbd,0x5f,0xc4,0xba,0xe5,0xbc,0x16,0x7e,0x06,
+	0xd3,0x22,0xd1,0x74,0x48,0x3e,0x58,0xee,0x6e,0x14,0x1d,0xc0,0x17,0xee,0xc0,0x83,
+	0x92,0x39,0xda,0x18,0x86,0xea,0xdc,0xd5,0x0d,0x5b,0x45,0xf0,0xb6,0x9f,0x37,0x9b,
+	0xe2,0xcf,0x15,0x5e,0xeb,0x37,0xf0,0xb3,0x28,0x8a,0x37,0xdc,0xc4,0x27,0x3e,0x53,
+	0x0f,0x98,0xa9,0xc9,0x23,0x96,0x5e,0xa7,0xa6,0x09,0xae,0x73,0xc5,0x1e,0x3d,0xd6,
+	0xbc,0x41,0xe6,0x44,0xd3,0x7d,0x8a,0xc5,0xb2,0x3e,0xcf,0x6e,0x48,0xdc,0xbc,0x8c,
+	0x3b,0x75,0x6e,0x0e,0x08,0xe1,0x4e,0x3a,0x57,0x2c,0x80,0x0e,0x82,0xbd,0x8c,0x16,
+	0x4f,0x5e,0x2f,0x9d,0xc9,0x50,0x4f,0x75,0x4e,0xce,0x6f,0xfc,0x75,0xa4,0x9c,0x9b,
+	0xff,0x00,0x0a,0xb7,0xe6,0x70,0xd5,0xc7,0xd2,0xf8,0x57,0xbf,0xe6,0xf6,0xf9,0x45,
+	0x68,0x7a,0x07,0xf6,0x9f,0xc3,0x7f,0xfa,0x17,0x35,0x6f,0xfb,0xed,0xbf,0xf8,0xf5,
+	0x2f,0xf6,0x87,0xc3,0x9c,0xe3,0xfe,0x11,0xad,0x5f,0xf0,0x76,0xff,0x00,0xe3,0xd5,
+	0xc3,0x47,0x56,0xe2,0x15,0xe8,0x7f,0x64,0xc7,0xfe,0x7f,0xd6,0xff,0x00,0xc1,0xb3,
+	0xff,0x00,0x32,0xa9,0xe2,0x14,0xfe,0xcc,0x7f,0xf0,0x14,0x76,0x96,0x3a,0x77,0x82,
+	0x75,0x19,0xda,0xe7,0x42,0xd7,0xaf,0x7c,0x3b,0xa8,0x80,0x59,0x12,0x79,0x36,0x08,
+	0x70,0x76,0x9f,0x98,0x9e,0x49,0x19,0xe0,0x49,0x9f,0x9b,0xd0,0x11,0x5b,0x57,0xf7,
+	0x9e,0x32,0xf0,0xa2,0x4a,0x9a,0xbd,0xbc,0x5e,0x24,0xd0,0xfc,0xb2,0x8c,0xfb,0x46,
+	0xe1,0x18,0x56,0x1f,0x3e,0x06,0x46,0x40,0x05,0x8b,0x06,0x1d,0xb7,0x64,0x93,0x5e,
+	0x78,0x91,0x24,0x80,0x09,0x15,0x58,0x75,0xc3,0x0c,0xd6,0xde,0x85,0xac,0x6b,0x3e,
+	0x1f,0x4c,0x68,0xf7,0x65,0xad,0xd4,0x1f,0xf4,0x2b,0x8c,0xbc,0x47,0xaf,0xdd,0xe7,
+	0x2b,0xc9,0x27,0x82,0x32,0x71,0x9a,0xe0,0xc6,0xe4,0xf5,0x6a,0xad,0x26,0xab,0x2f,
+	0xe5,0xab,0xab,0xff,0x00,0xb7,0x6a,0xc5,0x29,0xc5,0xf6,0xbd,0xfb,0xb7,0xbb,0x7d,
+	0xf4,0xe0,0xed,0x78,0x2b,0x7f,0x87,0xf5,0x8b,0xd1,0xff,0x00,0x56,0x36,0x6c,0x34,
+	0x2b,0x6b,0xc0,0x75,0xcf,0x85,0xda,0x93,0xdb,0x5e,0x44,0xbb,0x67,0xb2,0x9d,0xbe,
+	0xe8,0x29,0x9d,0x9f,0x30,0x3c,0x92,0x3f,0x88,0x95,0x27,0x90,0xc3,0x6d,0x01,0xf4,
+	0xbf,0x1e,0xcc,0xc8,0x63,0x7d,0x13,0xc6,0xf6,0xea,0x08,0x90,0xee,0x45,0x92,0x48,
+	0xf3,0xc0,0xe7,0x39,0x18,0x1d,0x46,0xf5,0xc0,0xc6,0xe0,0xa6,0x9f,0x2d,0x85,0x8f,
+	0x89,0xee,0xe4,0xd6,0xbc,0x25,0x3b,0xe9,0x9e,0x2e,0xb7,0x02,0x79,0xac,0x49,0x0a,
+	0x19,0xb9,0x0c,0x46,0x46,0x0e,0xec,0x8f,0x98,0x7c,0xa7,0x23,0x70,0x1b,0x89,0xab,
+	0x33,0x3d,0xb7,0xc4,0x2d,0x25,0xdd,0x23,0x7d,0x3b,0xc6,0x7a,0x52,0x92,0x23,0x4f,
+	0x91,0xf7,0x29,0xe8,0x32,0x41,0xda,0x5b,0xd4,0xe5,0x18,0xfb,0xfc,0xde,0x34,0xeb,
+	0x4a,0x12,0x55,0x6a,0x4a,0x49,0xc2,0xd1,0x73,0x7f,0xc4,0xa5,0x7d,0x95,0x5e,0x95,
+	0xa8,0xc9,0xed,0x2d,0xad,0x7e,0xbb,0xcf,0x27,0xd9,0x49,0x6b,0xd3,0xa4,0xbd,0x3f,
+	0x96,0x4b,0xb0,0x25,0xc4,0x7e,0x36,0xd3,0xae,0x3c,0x37,0xe2,0x78,0x12,0xd3,0xc5,
+	0x96,0x4a,0xde,0x43,0xbf,0xc9,0xbd,0xc0,0xce,0xe0,0x40,0x3c,0x1e,0x0b,0x28,0xc8,
+	0x23,0xe6,0x5e,0x9f,0x2c,0x5a,0x3d,0xcd,0xcf,0x88,0xb4,0xd9,0xfc,0x35,0xaf,0x48,
+	0x96,0xfe,0x2c,0xd3,0xd8,0xfd,0x92,0x5b,0x95,0x39,0x75,0x00,0x12,0xa5,0x81,0xf9,
+	0xb2,0x07,0x27,0xba,0xed,0x71,0xb8,0xae,0x6a,0x07,0x12,0x78,0xf7,0x41,0x8f,0xcb,
+	0x64,0xb6,0xf1,0xbe,0x90,0xdf,0x38,0x65,0xf2,0x64,0x90,0x2b,0x1e,0x01,0xc8,0xc1,
+	0xce,0x0e,0x7f,0x85,0xf2,0x30,0xa1,0xb3,0x45,0xfd,0xeb,0x78,0xb7,0xc3,0xa3,0xc5,
+	0xba,0x53,0xbd,0x97,0x89,0x34,0x55,0xc4,0xc9,0x13,0x82,0xac,0x83,0xe6,0x24,0x02,
+	0x78,0x5c,0x17,0x23,0x3d,0x70,0xea,0x77,0x70,0x68,0x8d,0x2f,0x65,0xfb,0xa4,0xbd,
+	0x9f,0x2c,0xfe,0x54,0x6a,0xbf,0x85,0xc6,0xfa,0xfb,0x0a,0xdd,0x55,0xad,0xe6,0x38,
+	0xd4,0x92,0x92,0xa9,0x17,0x77,0x6f,0x9c,0x92,0xdf,0xfe,0xde,0x89,0x9c,0x10,0x17,
+	0x95,0x08,0xdb,0x24,0x52,0x34,0x52,0x26,0x41,0x28,0xea,0x70,0xca,0x71,0xc6,0x41,
+	0xa4,0x68,0xab,0xa1,0xd5,0x27,0xb6,0xd7,0xb4,0xcb,0x4f,0x15,0x58,0x66,0x24,0x98,
+	0xad,0xb5,0xed,0xb6,0x54,0xf9,0x72,0x67,0x6a,0xb9,0x23,0x92,0xd9,0x2a,0xbe,0xa5,
+	0x59,0x0e,0x00,0x5a,0xcc,0x78,0xab,0xec,0xf2,0xcc,0xc1,0xe2,0xe8,0xf3,0xc9,0x72,
+	0xcd,0x37,0x19,0x47,0xf9,0x64,0xb7,0x5f,0xaa,0xf2,0x69,0x9f,0x57,0x86,0xac,0xb1,
+	0x34,0xb9,0xd6,0xff,0x00,0xd6,0xbf,0x3f,0xf3,0x32,0x9e,0x3a,0xaf,0x22,0x56,0xac,
+	0x91,0xd5,0x39,0x52,0xbd,0xda,0x53,0x38,0xf1,0x2a,0xc6,0x6c,0x8b,0x55,0xdc,0x55,
+	0xe9,0x56,0xa9,0xca,0x2b,0xd2,0xa4,0xcf,0x9e,0xc4,0xd5,0xb1,0x59,0xea,0x22,0x6a,
+	0x59,0x2a,0x06,0xaf,0x42,0x99,0xe1,0xd6,0xc4,0xd8,0x64,0xcb,0x54,0x65,0x15,0xa9,
+	0x3a,0xd5,0x09,0x96,0xbf,0x9a,0x28,0xc8,0xfa,0x1c,0x6c,0xec,0x67,0xc8,0x2a,0x06,
+	0xab,0x72,0x2d,0x57,0x65,0xaf,0x4e,0x9b,0x3e,0x6a,0xbd,0x5d,0x48,0x6a,0x44,0xa4,
+	0xdb,0x52,0x22,0xd7,0x52,0x67,0x24,0x6b,0x6a,0x4b,0x10,0xab,0xb0,0x8a,0xad,0x12,
+	0xd5,0xd8,0x16,0x86,0xcf,0x57,0x0b,0x57,0x52,0xdc,0x0b,0x5a,0x30,0x2f,0x4a,0xa9,
+	0x6e,0xbd,0x2b,0x4a,0xdd,0x3a,0x56,0x12,0x91,0xf5,0x38,0x29,0x5c,0xb3,0x0a,0x55,
+	0xd8,0xa3,0xa8,0xa0,0x4a,0xbf,0x12,0x56,0x0e,0x67,0xd5,0x61,0x44,0x48,0xea,0x51,
+	0x1d,0x4c,0x89,0x52,0x84,0xa4,0xa6,0x7a,0xf1,0x5a,0x14,0xda,0x3a,0x82,0x48,0xeb,
+	0x45,0x92,0xa0,0x91,0x2b,0xaa,0x9c,0xcc,0x2b,0xec,0x64,0xdc,0x29,0x03,0xe5,0x46,
+	0x76,0x3c,0x2a,0x20,0xcb,0x31,0x3c,0x05,0x03,0xb9,0x27,0x80,0x3d,0x4d,0x6d,0xf8,
+	0xb6,0xd2,0xe5,0xa3,0xf0,0xcf,0x80,0xec,0xcf,0x97,0x2c,0xea,0xb7,0x17,0xb2,0xa1,
+	0x25,0x58,0xe5,0x8b,0x11,0x96,0x1b,0x86,0xe1,0x23,0x95,0x20,0x74,0x5c,0x63,0xa5,
+	0x3b,0xc3,0x76,0x7f,0x6d,0xf1,0x4e,0x9b,0x09,0x4d,0xf1,0xc6,0xe6,0xe6,0x41,0x9c,
+	0x61,0x50,0x65,0x5b,0xf0,0x90,0xc5,0xc0,0xfe,0x59,0xa7,0x78,0x5b,0x56,0x8a,0x5d,
+	0x73,0xc6,0x9e,0x32,0x90,0x6e,0x82,0x08,0xfc,0x9b,0x66,0xe6,0x28,0xe6,0x51,0xf7,
+	0x57,0x2c,0x33,0xbc,0x88,0xe2,0xfc,0x5f,0xa7,0x20,0x57,0x4b,0xab,0x38,0x4b,0xdb,
+	0x53,0x8f,0x33,0xa5,0x1e,0x64,0xba,0x3a,0x93,0x7e,0xce,0x92,0xf5,0x4d,0xca,0x5f,
+	0x25,0xf2,0xf8,0x9c,0xde,0x6a,0x75,0x15,0x26,0xec,0x9e,0x8f,0xd3,0x79,0x7e,0x16,
+	0x44,0xd7,0x16,0x9f,0xf0,0x92,0x7c,0x40,0xb6,0xd0,0xa0,0x1f,0xf1,0x4d,0xf8,0x7e,
+	0x38,0xcb,0xc4,0x1f,0x7c,0x6e,0xea,0x38,0x56,0xc8,0x20,0x9c,0xe1,0x0a,0xb1,0x3c,
+	0x23,0xf2,0x09,0x35,0x5b,0x4e,0xbc,0x83,0xc5,0x1e,0x2d,0xbf,0xf1,0x36,0xaf,0x70,
+	0xf1,0xf8,0x73,0x44,0x61,0xf6,0x42,0xcc,0xca,0x9b,0xc1,0x1b,0x58,0x0d,0xa3,0x24,
+	0xe3,0x71,0x5f,0xbd,0x96,0x45,0xe4,0x71,0x59,0x56,0xb2,0x7f,0x62,0xfc,0x23,0xbe,
+	0xd5,0x0c,0xd2,0xc9,0xa8,0xeb,0xf3,0x98,0x5e,0x52,0x37,0x1c,0x6e,0x70,0x43,0x6e,
+	0x27,0x39,0x55,0x94,0xee,0xc6,0x72,0xe3,0xd3,0x35,0xa5,0xe2,0x5d,0x2e,0xe2,0x0d,
+	0x3f,0xc2,0xde,0x02,0xb2,0xb9,0xfd,0xf4,0xf9,0x9a,0xf1,0x86,0x4e,0x06,0x4b,0x12,
+	0x3e,0xe8,0x64,0x07,0xcd,0x60,0xa7,0x9f,0x91,0x7b,0xf5,0xd7,0xd8,0x42,0x13,0xf6,
+	0x11,0x9d,0x92,0xe6,0xa4,0xa5,0xb3,0x8c,0x60,0xb9,0xb1,0x35,0x7a,0xfb,0xd2,0x7e,
+	0xea,0x7e,0x7f,0x23,0xc8,0xe6,0x6d,0x73,0x35,0xda,0x56,0xee,0xde,0x90,0x8f,0xa2,
+	0xdc,0x34,0x6b,0x88,0xae,0xef,0x2e,0x7e,0x20,0xf8,0xb0,0x45,0x1d,0x90,0xfd,0xde,
+	0x9d,0x6b,0xb8,0xc8,0xdb,0x94,0xe0,0x6c,0x04,0xe3,0x20,0xab,0x60,0x7f,0x78,0xb3,
+	0xe1,0x40,0x06,0xbc,0xe7,0x5e,0xd5,0xaf,0x75,0xdd,0x4e,0x5b,0xfd,0x4e,0x5d,0xf3,
+	0xbf,0x01,0x47,0x0b,0x1a,0xf6,0x55,0x1d,0x80,0xff,0x00,0x12,0x72,0x49,0x35,0xd8,
+	0x7c,0x53,0xd5,0x22,0x9f,0x52,0xb6,0xd0,0xb4,0xe3,0xb7,0x4d,0xd2,0x23,0x11,0x6d,
+	0x57,0x2c,0x0c,0x98,0x03,0x19,0xc9,0xce,0xd5,0xc2,0xf3,0xc8,0x3b,0xab,0x84,0x65,
+	0xaf,0x6f,0x27,0xa4,0x9c,0x16,0x32,0x51,0xe5,0x73,0x49,0x46,0x3f,0xc9,0x4d,0x7c,
+	0x11,0x5d,0x6e,0xd5,0xa5,0x27,0x7d,0x5b,0xf2,0x3c,0x5c,0xd3,0x14,0xe2,0xfd,0x84,
+	0x5e,0xdb,0xbe,0xef,0xaf,0xfc,0x02,0x1a,0x7a,0xd1,0xb6,0x9e,0x8b,0x5e,0xf4,0x59,
+	0xe2,0x2a,0xda,0x92,0xc6,0x2a,0xe4,0x22,0xab,0xc4,0xb5,0x76,0x05,0xa1,0xb3,0xd3,
+	0xc3,0x55,0xd4,0xb7,0x02,0xd6,0x84,0x0b,0xd2,0xaa,0xdb,0xad,0x69,0x5b,0xa7,0x4a,
+	0xc6,0x52,0x3e,0xa7,0x05,0x3b,0x8d,0x7b,0x59,0xbc,0xf8,0x6f,0x34,0xf9,0x8d,0xae,
+	0xa3,0x6e,0x77,0x43,0x3a,0xf6,0xf6,0x3e,0xa0,0xf2,0x31,0xee,0x7a,0xe4,0x83,0xb5,
+	0xac,0x31,0xd7,0x2c,0xed,0xbc,0x5d,0xa0,0xfd,0x9e,0x1f,0x10,0x68,0xfc,0xea,0x76,
+	0xe3,0x28,0x5b,0x68,0xe7,0x38,0x6e,0x57,0x0a,0xc3,0xaf,0xcc,0xa4,0x8c,0xe5,0x76,
+	0xd4,0x10,0x25,0x5a,0xd2,0x6f,0xbf,0xe1,0x1f,0xf1,0x2d,0xae,0xa0,0x5b,0x6d,0x85,
+	0xde,0x2d,0x2f,0x79,0xc2,0xae,0x4f,0xee,0xe5,0x3c,0x80,0x30,0x78,0x2c,0x4f,0x0a,
+	0x70,0x3a,0xd7,0x91,0x99,0x52,0x9c,0xe3,0xf5,0x8a,0x2a,0xf5,0x69,0xa7,0x65,0xfc,
+	0xf1,0x7f,0x15,0x39,0x77,0x52,0x57,0xb2,0xe9,0x2b,0x34,0x7a,0x18,0xbc,0x24,0x65,
+	0x4f,0xda,0x2d,0x3b,0xfe,0x92,0xf5,0x5d,0x7c,0x88,0x7c,0x45,0xa8,0x2a,0x36,0x97,
+	0xf1,0x03,0xc3,0xa5,0xc9,0x91,0x92,0x1d,0x52,0x08,0xe4,0x24,0x03,0x85,0x1b,0x1b,
+	0x2b,0xc0,0xe3,0x69,0x24,0x63,0x3e,0x5b,0x01,0x93,0x9a,0xbf,0xaa,0xcf,0xff,0x00,
+	0x08,0xe7,0x8e,0x34,0xbf,0x10,0xe9,0xb2,0x63,0x41,0xd7,0xb6,0x2d,0xcf,0x3e,0x5c,
+	0x7b,0x98,0x70,0xed,0x95,0xc2,0xf0,0xc1,0xf9,0xf9,0x89,0x12,0x72,0x01,0x34,0xcd,
+	0x03,0x4e,0x5d,0x13,0xc6,0x5a,0xe7,0x84,0x2e,0x25,0x74,0xd2,0x75,0x7b,0x67,0x92,
+	0xd4,0x29,0x25,0x80,0x20,0x8c,0x2f,0x2c,0x01,0x0b,0xbc,0x12,0xdc,0x9f,0x2d,0x4f,
+	0xa0,0x39,0x5a,0x5d,0x97,0xf6,0x87,0xc3,0xcf,0x12,0xf8,0x7e,0xfe,0x4c,0xdd,0x78,
+	0x7e,0x79,0x26,0x8a,0x45,0x5c,0xa2,0xed,0xde,0x70,0xbd,0x09,0xc9,0x59,0x47,0xcc,
+	0x38,0xde,0x0f,0x6c,0x0f,0x05,0x47,0x0d,0x68,0xc6,0xfc,0xd4,0x92,0x8c,0x6e,0xf5,
+	0x72,0xa1,0x5b,0x48,0x5f,0xce,0x8c,0xec,0x97,0x55,0xea,0xac,0x79,0x17,0x9e,0xaf,
+	0x69,0x6a,0xfd,0x25,0x1d,0xff,0x00,0xf0,0x24,0x6a,0xf8,0x76,0xd1,0x7c,0x3d,0xe3,
+	0xad,0x53,0xc2,0x57,0x31,0xbc,0x9a,0x36,0xb1,0x13,0xc9,0x6f,0x1e,0xe3,0x85,0x52,
+	0xad,0x91,0xf7,0xb2,0x06,0xd0,0xe8,0x4f,0xde,0x25,0x14,0xf0,0x2a,0xbc,0x70,0xcd,
+	0x12,0xb5,0xbd,0xdf,0xfc,0x7d,0xdb,0xb1,0x86,0x6e,0x31,0x97,0x1d,0x58,0x0e,0x38,
+	0x3c,0x30,0xe0,0x64,0x30,0x3d,0xea,0xaf,0x88,0x75,0x29,0x35,0x0f,0x00,0xf8,0x57,
+	0xc4,0xb0,0xef,0x9a,0xff,0x00,0x49,0xb9,0x58,0xe5,0x0c,0xfe,0x6a,0x82,0x31,0x96,
+	0x94,0xf5,0x05,0x8c,0x71,0x9e,0x48,0xfb,0xfd,0xf2,0x0d,0x74,0x3e,0x20,0xf2,0x64,
+	0xd6,0xd2,0xf2,0xd7,0x9b,0x4d,0x4e,0xd2,0x3b,0xa8,0x9f,0x9f,0xde,0x30,0xf9,0x59,
+	0xb0,0x79,0x1f,0x21,0x83,0x83,0x8f,0xcf,0x75,0x7a,0x39,0x5d,0x7a,0xd4,0xf1,0x71,
+	0x75,0xfe,0x2a,0x8a,0x50,0x9f,0xfd,0x7d,0xa2,0xec,0xdf,0xfd,0xbf,0x06,0xa4,0xed,
+	0xbd,0xaf,0xaa,0x5a,0x7a,0xb9,0x4d,0x65,0x4e,0xa3,0xa7,0x1f,0x85,0xea,0xbd,0x1e,
+	0xab,0xee,0x77,0x5f,0x33,0x0a,0x54,0xaa,0x53,0x25,0x6b,0x4c,0x95,0x42,0x74,0xaf,
+	0xb7,0xa3,0x23,0xb3,0x1a,0xec,0x64,0xcc,0xb5,0x46,0x61,0x5a,0x93,0xaf,0x5a,0xa1,
+	0x32,0xd7,0xad,0x46,0x47,0xc8,0x63,0x67,0x63,0x3a,0x41,0x55,0xda,0xae,0x4a,0xb5,
+	0x5d,0xd6,0xbd,0x4a,0x4c,0xf9,0x9c,0x45,0x5d,0x49,0xa7,0x5e,0xb5,0x9f,0x32,0xd6,
+	0xbc,0xe9,0x54,0x26,0x4a,0xfe,0x62,0xa3,0x23,0xec,0x31,0xb2,0x32,0xa4,0x5a,0xae,
+	0xcb,0x5a,0x32,0x25,0x40,0xd1,0xd7,0xa9,0x4e,0x47,0xcc,0xe2,0x1e,0xa5,0x3d,0xb4,
+	0xf4,0x5a,0x9b,0xcb,0xa9,0x12,0x3a,0xeb,0x53,0x39,0x23,0xb8,0x44,0xb5,0x76,0x05,
+	0xe9,0x51,0x44,0x95,0x7a,0x14,0xa4,0xe4,0x7a,0xb8,0x57,0xa9,0x66,0xdd,0x6b,0x4a,
+	0xdd,0x7a,0x55,0x48,0x12,0xb4,0x60,0x5e,0x95,0x84,0xe4,0x7d,0x5e,0x0a,0x45,0xb8,
+	0x17,0xa5,0x5f,0x89,0x6a,0xb4,0x0b,0x57,0xa2,0x15,0xcf,0x26,0x7d,0x5e,0x12,0xa6,
+	0x84,0xa8,0xb5,0x28,0x5a,0x10,0x54,0x80,0x52,0x4c,0xf6,0x21,0x53,0x42,0x16,0x5a,
+	0x82,0x45,0xab,0x8c,0x2a,0x09,0x05,0x74,0xd3,0x66,0x15,0xea,0x68,0x4d,0xe1,0xc9,
+	0x5a,0xcd,0xfc,0x41,0xaa,0x44,0x01,0xb8,0xd3,0xb4,0xd2,0xf1,0x2b,0x7d,0xd6,0x2d,
+	0xbd,0x8e,0xe1,0xd4,0xf3,0x0a,0xf4,0x23,0xa9,0xf6,0xc7,0x36,0xe6,0x3d,0x33,0xe0,
+	0x6c,0x7e,0x5a,0xbb,0xb6,0xab,0x79,0xf3,0x96,0x6c,0x08,0xc8,0x73,0xc8,0x18,0xe9,
+	0x88,0x00,0xc7,0xa9,0x27,0x3d,0xab,0xa2,0xd3,0x46,0x34,0x9f,0x1a,0x7f,0xd8,0x29,
+	0x7f,0xf4,0x1b,0x8a,0xe6,0xb5,0xcf,0xf9,0x21,0xfe,0x1e,0xff,0x00,0xaf,0xe6,0xff,
+	0x00,0xd0,0xa7,0xaf,0x63,0x03,0x15,0x2c,0x4c,0x53,0xd9,0xd7,0xa0,0xbe,0x4a,0x94,
+	0xa6,0xbf,0xf2,0x6d,0x7d,0x4f,0x81,0xcc,0xa4,0xdd,0x49,0xbf,0xee,0xcb,0xf3,0x4b,
+	0xf2,0xd0,0xe9,0x35,0xdb,0x2c,0xf8,0xe3,0xc0,0x9e,0x1d,0xf3,0x3f,0xe4,0x1b,0x02,
+	0xcd,0xf6,0x8d,0xbf,0xeb,0x36,0x0c,0xe3,0x6f,0x6c,0xf9,0x1e,0xa7,0xef,0x7b,0x72,
+	0xfd,0x26,0xf2,0x3b,0x8f,0x88,0xde,0x2c,0xd7,0xe7,0x0f,0x2d,0x9e,0x8d,0x6c,0x61,
+	0x08,0xe3,0x74,0x88,0x54,0x61,0xbc,0xb0,0x78,0x00,0xf9,0x72,0xf7,0x1f,0x7f,0xdc,
+	0xd5,0x9d,0x73,0xfe,0x4b,0x87,0x87,0xbf,0xeb,0xc5,0xbf,0xf4,0x19,0xeb,0x1f,0x41,
+	0xff,0x00,0x9a,0xab,0xff,0x00,0x6d,0xbf,0xf6,0xe2,0xb8,0x20,0xb9,0xf0,0x51,0x72,
+	0xeb,0x42,0x1f,0xf9,0x57,0x10,0xd4,0xdf,0xcf,0xee,0x5d,0x0c,0x9e,0x95,0x1f,0xf8,
+	0x9f,0xfe,0x4b,0x0d,0x0f,0x3a,0x79,0x26,0xba,0x69,0x2e,0xae,0x9b,0x75,0xc5,0xc3,
+	0xb4,0xd2,0x36,0x00,0xdc,0xcc,0x72,0x4e,0x07,0x03,0xf0,0xa8,0x19,0x6a,0xec,0x51,
+	0xe2,0xde,0x20,0x71,0x9d,0x83,0xa7,0x3d,0xa9,0x8d,0x1d,0x7d,0xd3,0x9a,0xe7,0x76,
+	0xda,0xe7,0xc4,0x62,0x64,0xdc,0x9b,0x65,0x2d,0xb5,0x22,0x2d,0x4d,0xe5,0xd3,0xd6,
+	0x3a,0xd9,0x4c,0xe2,0x5b,0x89,0x12,0xd5,0xe8,0x16,0xa2,0x89,0x2a,0xec,0x29,0x4d,
+	0xc8,0xf5,0x30,0xaf,0x52,0xcd,0xba,0xf4,0xad,0x2b,0x75,0xe9,0x55,0x20,0x4a,0xd2,
+	0x81,0x7a,0x57,0x3c,0xe4,0x7d,0x56,0x0a,0x45,0xb8,0x16,0x97,0x57,0xb2,0xfb,0x76,
+	0x8f,0x77,0x6e,0x13,0x7b,0xbc,0x67,0x62,0xe7,0x19,0x61,0xca,0xf3,0xf5,0x02,0xa5,
+	0x81,0x6a,0xf4,0x42,0xb1,0x55,0x1c,0x24,0xa4,0xb7,0x47,0xd4,0xd0,0xe5,0xa9,0x07,
+	0x09,0x6c,0xd5,0x8c,0x8f,0x11,0xea,0xad,0x36,0x93,0xe0,0x7f,0x18,0xb1,0x70,0xd0,
+	0x4a,0x21,0xbb,0x91,0x14,0x24,0xd2,0x90,0x7e,0x60,0x31,0x80,0x54,0xf9,0x72,0xf1,
+	0x90,0x3e,0x7e,0x9c,0x9c,0x6d,0xff,0x00,0xc8,0x2f,0xe3,0x87,0xfc,0xf5,0xfe,0xd6,
+	0xb1,0xff,0x00,0x77,0xca,0xda,0xbf,0x8e,0xef,0xf5,0x1e,0xdf,0x7b,0xdb,0x9e,0x47,
+	0xc4,0x08,0x63,0xf8,0x27,0xa0,0xa3,0x15,0x25,0x6f,0xdc,0x1d,0xac,0x18,0x7d,0xe9,
+	0xfa,0x11,0xc1,0xae,0xbb,0x5c,0xff,0x00,0x92,0xe1,0xe1,0xef,0xfa,0xf1,0x6f,0xfd,
+	0x06,0x7a,0xf9,0x3c,0x45,0x18,0x42,0x9d,0x4a,0x51,0x5e,0xea,0x86,0x32,0x0b,0xfc,
+	0x30,0x92,0x94,0x57,0xc9,0xff,0x00,0x96,0xc7,0xcd,0x46,0x4d,0xc9,0x37,0xbd,0xe9,
+	0xbf,0x9b,0x56,0x67,0x3d,0xe1,0xdb,0x38,0xff,0x00,0xe1,0x0a,0xf1,0xe7,0x87,0xa5,
+	0x2e,0xcb,0xa6,0xcb,0x24,0xc2,0x75,0x3b,0x4c,0x85,0x73,0x8f,0x97,0x9c,0x0c,0xc0,
+	0x33,0xc9,0xe1,0xb1,0xc6,0x33,0x5a,0x76,0x33,0xb5,0xe7,0x82,0xfc,0x21,0x7f,0x28,
+	0x51,0x32,0xf9,0x96,0x00,0x2f,0xdd,0xf2,0xc2,0xb7,0x3f,0xef,0x7f,0xa3,0xa7,0xb7,
+	0x2d,0xc7,0x4c,0x55,0xd0,0x7f,0xe6,0xaa,0xff,0x00,0xdb,0x6f,0xfd,0xb8,0xa9,0xb4,
+	0x2f,0xf9,0x27,0x1e,0x11,0xff,0x00,0xaf,0xe9,0xbf,0xf4,0x1b,0x9a,0xee,0x94,0x9f,
+	0xd6,0xf9,0xfa,0xfb,0x6a,0x6f,0xe7,0x3c,0x3b,0x72,0xfb,0xff,0x00,0xe1,0x8d,0x30,
+	0x4f,0x96,0xa4,0x2d,0xdb,0xf2,0x9e,0x84,0xb3,0x2d,0x50,0x9d,0x6b,0x52,0x51,0x54,
+	0x66,0x5a,0xfb,0x7a,0x32,0x3d,0x3c,0x6c,0xcc,0x99,0xd7,0xad,0x67,0xcc,0xb5,0xaf,
+	0x3a,0xd5,0x09,0x92,0xbd,0x7a,0x12,0x3e,0x3f,0x1d,0x2d,0xcc,0xa9,0x56,0xab,0x3a,
+	0xd6,0x94,0xa9,0x55,0xda,0x3a,0xf5,0x29,0x48,0xf9,0x8c,0x43,0xd4,0x96,0x65,0xaa,
+	0x52,0xa5,0x6a,0xca,0x95,0x56,0x48,0xeb,0xf9,0x82,0x94,0xcf,0xb7,0xc5,0x6a,0x65,
+	0x49,0x1d,0x40,0xd1,0xd6,0xa3,0xc5,0x51,0x18,0xab,0xd1,0xa7,0x50,0xf0,0x6b,0x42,
+	0xec,0xce,0xf2,0xa9,0xeb,0x1d,0x5d,0xf2,0xa9,0xeb,0x15,0x75,0x46,0xa1,0xce,0xa9,
+	0xea,0x57,0x8e,0x3a,0xb9,0x0a,0x53,0x92,0x2a,0xb5,0x14,0x74,0xdc,0xcf,0x43,0x0f,
+	0x1b,0x0f,0x81,0x2a,0xfc,0x0b,0x50,0x44,0x95,0x76,0x25,0xac,0xdc,0x8f,0xa0,0xc2,
+	0xca,0xc5,0x98,0x45,0x5c,0x8a,0xab,0x44,0x2a,0xd4,0x75,0x9b,0x3e,0x87,0x0f,0x5e,
+	0xc5,0x84,0xa9,0x05,0x44,0xa6,0x9e,0x0d,0x34,0x7a,0x51,0xc4,0xe8,0x29,0xa8,0x5e,
+	0xa5,0x26,0xa2,0x7a,0xe9,0xa6,0x63,0x57,0x11,0x74,0x3f,0x4e,0xff,0x00,0x90,0x57,
+	0x8d,0x3f,0xec,0x14,0xbf,0xfa,0x0d,0xc5,0x73,0x3a,0xe7,0xfc,0x90,0xff,0x00,0x0f,
+	0x7f,0xd7,0xf3,0x7f,0xe8,0x53,0xd7,0x5d,0xe1,0x95,0x8a,0x6d,0x76,0x7b,0x1b,0x9c,
+	0x7d,0x93,0x50,0xb2,0x92,0x19,0x50,0x9c,0x79,0xa5,0x48,0xda,0xa0,0xf5,0xce,0xd7,
+	0x98,0xf1,0xce,0x32,0x7b,0x71,0xcb,0xe8,0xe2,0x5d,0x47,0xe1,0x1e,0xbd,0xa5,0x4d,
+	0x1e,0xfb,0xed,0x26,0x7f,0x35,0x61,0x92,0x30,0xad,0x6e,0x9b,0x83,0x31,0xc9,0x03,
+	0x9e,0x26,0xf7,0xea,0x3b,0x81,0x5e,0xb6,0x0a,0xa7,0x25,0x65,0x51,0xed,0x1a,0xd4,
+	0x24,0xfc,0xa2,0xe3,0x2a,0x57,0xf9,0x4b,0x7e,0x96,0xb6,0xb7,0xd0,0xf9,0x5c,0x62,
+	0xe6,0x94,0x97,0x78,0xc9,0x7e,0x2a,0x5f,0x91,0xd5,0x6b,0x9f,0xf2,0x5c,0x3c,0x3d,
+	0xff,0x00,0x5e,0x2d,0xff,0x00,0xa0,0xcf,0x58,0xfa,0x0f,0xfc,0xd5,0x5f,0xfb,0x6d,
+	0xff,0x00,0xb7,0x15,0x0e,0xbb,0xa8,0xff,0x00,0xc4,0x8f,0xc0,0x9e,0x2c,0x0d,0x2f,
+	0xfa,0x2c,0x8b,0x6f,0x75,0x26,0x7f,0x7f,0x2e,0xde,0x18,0x67,0x3f,0x30,0x3e,0x5c,
+	0xbd,0x4f,0xf1,0xfb,0x9a,0xde,0x9b,0xfe,0x24,0x9f,0x19,0xd2,0xe2,0x7e,0x60,0xd6,
+	0x6d,0x3c,0xa5,0x91,0xfe,0x45,0x47,0x01,0x46,0xd0,0x4f,0x0c,0x73,0x1a,0xf1,0xc7,
+	0xfa,0xc1,0xed,0x9e,0x5e,0x49,0x52,0xc3,0x2a,0x2d,0x7b,0xca,0x93,0x8d,0xbb,0xcb,
+	0x0f,0x5b,0x9e,0x4b,0xe7,0x1d,0x7c,0xbb,0x37,0xa1,0x17,0x52,0x9f,0x37,0x4e,0x6b,
+	0xfc,0xa7,0x1b,0x2f,0xc4,0xf3,0x0b,0x45,0x0d,0x65,0x01,0x52,0x08,0xd8,0x3a,0x7d,
+	0x28,0x68,0xeb,0x4a,0x7d,0x38,0xe9,0x5a,0xa6,0xa3,0xa5,0x30,0x61,0xf6,0x39,0xd9,
+	0x63,0xdc,0x41,0x63,0x13,0x7c,0xc8,0xc4,0x8e,0x32,0x41,0xcf,0xf4,0x14,0xc6,0x8a,
+	0xbe,0xb5,0xd6,0x8c,0xa5,0xcf,0x07,0x78,0xcb,0x54,0xfb,0xa7,0xaa,0x7f,0x34,0xcf,
+	0x8f,0xc4,0xd1,0x71,0x93,0x8b,0xdd,0x19,0xde,0x55,0x3d,0x63,0xab,0x9e,0x55,0x3d,
+	0x62,0xad,0xa3,0x50,0xe4,0x54,0xf5,0x2b,0xc7,0x1d,0x5c,0x85,0x29,0xc9,0x15,0x59,
+	0x8a,0x3a,0x6e,0x67,0x7d,0x08,0xd8,0x7c,0x29,0x5a,0x10,0x2d,0x41,0x12,0x55,0xd8,
+	0x96,0xa2,0x52,0x3e,0x83,0x0b,0x2b,0x16,0x21,0x15,0x6c,0x3a,0x45,0x1b,0x3c,0x8c,
+	0xa8,0x8a,0x0b,0x33,0x31,0xc0,0x00,0x75,0x24,0xd4,0x11,0x0a,0xa7,0xe2,0x49,0x24,
+	0x1a,0x43,0xdb,0x5b,0x2a,0xbd,0xd5,0xeb,0x2d,0xa4,0x28,0x7f,0x8d,0x9c,0xed,0xc6,
+	0x7a,0x0e,0x33,0xc9,0xe2,0xa6,0x09,0x4a,0x49,0x37,0x64,0x7b,0xd4,0xf1,0x3e,0xce,
+	0x0e,0x5d,0x8c,0x6d,0x73,0xfe,0x48,0x7f,0x87,0xbf,0xeb,0xf9,0xbf,0xf4,0x29,0xeb,
+	0xb0,0xd7,0x3f,0xe4,0xb8,0x78,0x7b,0xfe,0xbc,0x5b,0xff,0x00,0x41,0x9e,0xab,0x6b,
+	0x96,0x71,0xdd,0x78,0xfb,0xc2,0x1e,0x1e,0xb1,0x2e,0xd1,0x68,0xb1,0x2c,0xf2,0x4d,
+	0x9f,0x31,0x94,0x2e,0xd2,0x15,0xc0,0xc6,0xd2,0x7c,0xb4,0xe7,0xfe,0x9a,0x0e,0x3a,
+	0x64,0xd2,0x6f,0x23,0xb8,0xf8,0x8d,0xe2,0xcd,0x7e,0x70,0xf2,0xd9,0xe8,0xd6,0xc6,
+	0x10,0x8e,0x37,0x48,0x85,0x46,0x1b,0xcb,0x07,0x80,0x0f,0x97,0x2f,0x71,0xf7,0xfd,
+	0xcd,0x7c,0x9d,0x5a,0xfe,0xda,0x8c,0xeb,0x25,0xf1,0x53,0xaf,0x3b,0x7f,0xd8,0x44,
+	0xd4,0x29,0xaf,0x57,0xbf,0xe8,0xba,0xf9,0x91,0x8f,0x2c,0x94,0x7b,0x38,0xaf,0xfc,
+	0x01,0x5d,0x94,0x34,0x1f,0xf9,0xaa,0xbf,0xf6,0xdb,0xff,0x00,0x6e,0x2a,0x7d,0x07,
+	0xfe,0x49,0xcf,0x84,0x7f,0xeb,0xfa,0x6f,0xfd,0x06,0xe6,0xb1,0xb4,0xcb,0x99,0x74,
+	0xcf,0x84,0x1a,0xc5,0xfd,0xc3,0xec,0xbd,0xd5,0xee,0xcc,0x51,0xce,0xc0,0x3b,0xce,
+	0xa7,0x01,0x83,0x1e,0x4f,0x41,0x37,0xde,0xf7,0x23,0x92,0x33,0xd3,0x0b,0x61,0x65,
+	0xa4,0xf8,0x57,0x4d,0x58,0xda,0x21,0x05,0x93,0x5d,0x4d,0x03,0x67,0x74,0x73,0x30,
+	0x50,0x0b,0x67,0x91,0x92,0xf3,0x8c,0x1e,0x3a,0xf1,0xf2,0xf1,0xe8,0xb8,0x37,0x8c,
+	0xe4,0x5f,0xf3,0xf9,0x25,0xff,0x00,0x70,0x68,0x72,0xc9,0xfd,0xee,0xcb,0xce,0xe9,
+	0xd9,0x95,0x85,0x7e,0xf4,0x5f,0x95,0xfe,0xf9,0xdd,0x7e,0x01,0x28,0xaa,0x53,0x2d,
+	0x5f,0x92,0xaa,0xc8,0x2b,0xec,0xa9,0x33,0x7c,0x55,0x5b,0x99,0xb3,0x2d,0x52,0x95,
+	0x2b,0x56,0x55,0xaa,0xb2,0x47,0x5e,0x9d,0x19,0x9f,0x33,0x8b,0x77,0x32,0x64,0x8e,
+	0xa0,0x68,0xeb,0x51,0xe2,0xa8,0x9a,0x2a,0xf4,0x69,0xd4,0x3c,0x1a,0xd0,0xbb,0x22,
+	0x74,0xa8,0x5e,0x3a,0xbe,0x52,0x9a,0x63,0xaf,0xe6,0x2a,0x73,0xb1,0xf6,0x75,0x57,
+	0x31,0x9a,0xd1,0x7b,0x53,0x0c,0x3e,0xd5,0xa6,0x62,0xa4,0xf2,0x7d,0xab,0xae,0x15,
+	0x4e,0x19,0xd1,0xb9,0x99,0xe4,0xfb,0x53,0x84,0x3e,0xd5,0xa3,0xe4,0xfb,0x53,0x84,
+	0x3e,0xd5,0xd1,0x1a,0xa6,0x7e,0xc0,0xa2,0xb1,0x7b,0x54,0xe9,0x1f,0xb5,0x59,0x10,
+	0xd4,0x8b,0x1d,0x6a,0xaa,0x1b,0x42,0x9d,0x88,0xa3,0x4a,0xb3,0x1a,0xd0,0xa9,0x52,
+	0xaa,0xd5,0x29,0x5c,0xee,0xa7,0x2e,0x51,0xe9,0x53,0xa1,0xa8,0x56,0xa4,0x06,0xad,
+	0x1d,0xd0,0xc4,0x58,0xb0,0xa6,0x9c,0x1a,0xa0,0x0d,0x4e,0xdd,0x5a,0x45,0x1b,0xac,
+	0x61,0x29,0x34,0xc6,0x34,0xdd,0xd4,0x13,0x5d,0x10,0x44,0x4f,0x17,0x71,0xa9,0x74,
+	0x34,0xfb,0xfb,0x2d,0x41,0xb0,0x16,0xd2,0x61,0x23,0x96,0x04,0x81,0x19,0x05,0x24,
+	0x38,0x1c,0x9c,0x23,0x31,0x18,0xee,0x07,0x5e,0x86,0xed,0xbf,0xd9,0xf4,0x0f,0x8a,
+	0xfa,0x8e,0x9d,0x75,0xe5,0x0d,0x3b,0x5f,0x80,0x48,0x22,0x6c,0x32,0xb4,0x87,0x3f,
+	0x7f,0x77,0xf7,0x98,0x4a,0x36,0x8c,0x83,0xbd,0x46,0x3d,0x29,0x1a,0x66,0xbd,0x66,
+	0xda,0xbf,0x80,0xa2,0x7b,0x56,0x31,0x6a,0xde,0x1a,0x20,0xa3,0x23,0x6d,0x63,0x08,
+	0x03,0x0c,0x3e,0x61,0x8f,0x95,0x54,0xee,0xc7,0xde,0x89,0x82,0x8a,0xe9,0x8c,0x29,
+	0xd4,0x92,0xa7,0x55,0xda,0x35,0x17,0xb3,0x6f,0xb7,0x33,0xbc,0x25,0xff,0x00,0x6e,
+	0xd4,0x4b,0x5f,0xef,0x74,0xeb,0xc9,0x2a,0xae,0x5a,0xc7,0x75,0xaf,0xdd,0xba,0xf9,
+	0xaf,0xc8,0x6f,0x86,0xb4,0xbb,0x89,0xf4,0xff,0x00,0x14,0xf8,0x0a,0xf6,0xe7,0xf7,
+	0xd0,0x62,0x6b,0x36,0x39,0x19,0x19,0x0c,0x09,0xfb,0xc1,0x50,0x9f,0x29,0x8a,0x8e,
+	0x7e,0x76,0xef,0xd2,0x9a,0x43,0x71,0xe2,0x7f,0x87,0xf6,0xf1,0x5a,0x8b,0xa1,0xe2,
+	0x5f,0x0d,0x48,0x17,0xcb,0x08,0x52,0x40,0xb9,0x20,0x2a,0xe0,0x8e,0x42,0xa2,0xf6,
+	0xdd,0x98,0xc8,0xc7,0x39,0x36,0x75,0x9b,0xc1,0x73,0x63,0xa3,0x7c,0x43,0xd2,0xc2,
+	0x7d,0xb2,0xd5,0x92,0x1d,0x46,0xdd,0x02,0x28,0x3d,0x51,0xbd,0x48,0x27,0x76,0xd1,
+	0x9c,0x9d,0xac,0x87,0x8c,0x54,0xda,0xcc,0xc3,0x43,0xd6,0x6c,0x3c,0x75,0xa0,0xa3,
+	0xc9,0xa4,0xea,0x4a,0x05,0xfc,0x6b,0x1a,0x37,0x96,0x18,0xae,0xee,0x87,0x86,0x24,
+	0x73,0xcf,0x0e,0xbc,0x93,0xbb,0x15,0xdf,0x1a,0x95,0xa5,0x51,0x54,0x8d,0x95,0x59,
+	0x4b,0x99,0x5f,0x44,0xb1,0x10,0x8f,0x2d,0x5a,0x6f,0xca,0xac,0x35,0x5a,0xea,0xda,
+	0x33,0x6a,0x29,0x59,0xfc,0x29,0x5b,0xfe,0xdc,0x6e,0xe9,0xff,0x00,0xdb,0xac,0x67,
+	0x89,0xa5,0xff,0x00,0x84,0x8b,0xc3,0x9a,0x5f,0x8b,0xec,0x61,0x32,0x5c,0x5b,0xc6,
+	0x6d,0xf5,0x18,0x62,0x19,0x2a,0xa3,0x92,0x71,0xb8,0xe0,0x2b,0x7c,0xc0,0x75,0x2a,
+	0xe0,0x92,0x00,0xac,0x65,0x8c,0x3a,0x86,0x42,0x19,0x58,0x64,0x11,0xc8,0x22,0xb7,
+	0x25,0x75,0xf0,0x7e,0xb2,0x3c,0x53,0xa0,0x46,0x97,0x7e,0x13,0xd4,0x95,0x44,0xf1,
+	0x5b,0x64,0x08,0x09,0x23,0x9d,0xb9,0xc0,0x3b,0xb3,0x8c,0xe0,0x02,0x59,0x3e,0x5c,
+	0x83,0x54,0x75,0x2d,0x18,0x68,0xeb,0x1e,0xa5,0xa1,0x19,0x35,0x0f,0x0b,0x5d,0x03,
+	0x22,0xb4,0x40,0xbb,0x59,0xf5,0x27,0x3d,0xf6,0x0c,0x1c,0x93,0xc8,0xc1,0x07,0x91,
+	0xf3,0x6b,0x82,0xab,0x4e,0x10,0x8d,0x18,0x3b,0x53,0x77,0xf6,0x6d,0xe8,0xd3,0xd5,
+	0xca,0x8c,0xbb,0x4e,0x0f,0xe1,0xbf,0xc5,0x1d,0xb6,0x49,0xf1,0x63,0xb0,0xce,0xab,
+	0xf6,0x9f,0x69,0x6f,0xe7,0xda,0x4b,0xc9,0xfe,0x05,0x1f,0x27,0xda,0x9c,0x21,0xf6,
+	0xab,0xf0,0x88,0xe6,0x8c,0x49,0x0b,0xa4,0x91,0x9e,0x8c,0x87,0x20,0xfe,0x35,0x20,
+	0x87,0xda,0xbd,0x05,0x51,0xa7,0x66,0x79,0x5e,0xc0,0xa2,0x91,0x7b,0x54,0xe9,0x1d,
+	0x5a,0x10,0xd3,0xd6,0x2a,0xd1,0x54,0x36,0x85,0x3b,0x11,0x46,0x95,0x66,0x35,0xa5,
+	0x54,0xa7,0xb1,0x58,0xd1,0x9e,0x46,0x0a,0x8a,0x32,0xcc,0xc7,0x00,0x0f,0x53,0x56,
+	0xa5,0x73,0xba,0x9c,0xb9,0x49,0x10,0x53,0x3c,0x39,0x24,0x4d,0x7b,0x7b,0xe2,0xad,
+	0x41,0x5d,0x34,0x9d,0x26,0x29,0x23,0xb4,0x62,0x40,0xf3,0xe4,0x39,0x0e,0xe8,0x72,
+	0x33,0xd0,0x20,0x07,0x20,0x96,0xe0,0x82,0x08,0xaa,0x50,0x59,0x5c,0xf8,0x9e,0x57,
+	0x8a,0x29,0x1e,0xcb,0xc3,0xd1,0x29,0x7b,0xbd,0x45,0xbe,0x55,0x95,0x46,0x77,0x2c,
+	0x6c,0x78,0x23,0x83,0x96,0xe8,0x30,0x73,0xc7,0x0c,0xe9,0x02,0x78,0xe7,0x50,0xb4,
+	0xb7,0xb3,0x4f,0xb2,0x78,0x2b,0x43,0xc0,0x79,0xa6,0x76,0x55,0x98,0x28,0x1c,0x72,
+	0x47,0xf0,0x8c,0x02,0x79,0x55,0x24,0x93,0x96,0x0b,0x5e,0x76,0x63,0x5a,0x12,0x84,
+	0xf0,0xce,0x56,0x8d,0xbf,0x7b,0x25,0xf6,0x22,0xfe,0xca,0xef,0x52,0xa7,0xc2,0xa3,
+	0xab,0x49,0xb6,0xd1,0xdf,0x4e,0x72,0x69,0x34,0xbd,0x17,0x77,0xdf,0xd1,0x6f,0x72,
+	0x1d,0x16,0xee,0xe3,0x46,0xd0,0x35,0xbf,0x1a,0x6b,0x46,0x58,0xb5,0x5d,0x5b,0x74,
+	0x36,0x1f,0x21,0x6c,0x6e,0x05,0x94,0x80,0xc4,0x8d,0x99,0x03,0x1b,0xba,0x2c,0x63,
+	0x19,0xdc,0x01,0x65,0xf5,0x9d,0xe7,0x87,0x3e,0x1b,0x69,0xba,0x1d,0xb9,0x75,0xd5,
+	0xf5,0xfb,0x90,0x5e,0x12,0x4a,0xb0,0x0c,0x14,0x14,0x04,0xe3,0x69,0xff,0x00,0x54,
+	0xac,0x1b,0xfb,0xcd,0xdb,0xa5,0xcb,0x75,0x87,0xc7,0x3e,0x2a,0x5b,0xa6,0x54,0x83,
+	0xc1,0xfa,0x12,0xfe,0xe4,0xb4,0x2b,0x1c,0x6e,0x54,0x29,0x2a,0x77,0x7f,0x09,0xdb,
+	0x92,0x31,0x80,0x8a,0x01,0x0a,0x5b,0x34,0x69,0x17,0x96,0xfe,0x21,0xd7,0xb5,0x3f,
+	0x1c,0xea,0xa1,0xe3,0xd2,0x74,0x95,0xf2,0xec,0xe1,0x71,0x19,0x2c,0x55,0x49,0xc1,
+	0xcf,0xf1,0x65,0x83,0x01,0xfd,0xe7,0x50,0x1b,0xe5,0xae,0x39,0xd5,0x94,0x26,0xea,
+	0xd5,0x8e,0xb1,0x71,0x9c,0xe3,0x6d,0xa4,0x97,0x2e,0x1e,0x82,0x5b,0xdd,0x5f,0x9a,
+	0x4b,0xa3,0xbe,0xdb,0x89,0x24,0xd7,0x2c,0x5e,0xf7,0x49,0xf9,0x6f,0x39,0x7e,0x88,
+	0x7f,0x89,0x6c,0xad,0xee,0x35,0x9f,0x08,0xf8,0x1e,0xda,0x48,0xa4,0x82,0xd7,0x6c,
+	0xb7,0xaa,0x14,0x22,0xc9,0xb5,0x72,0x7e,0xee,0x59,0x5c,0xa8,0x90,0xe3,0x8f,0xf5,
+	0x80,0xe7,0xb8,0xd7,0xd4,0x6e,0x05,0xee,0xbf,0xa8,0xdd,0x2e,0x0c,0x68,0xcb,0x69,
+	0x19,0x03,0x19,0x58,0xf3,0xbb,0x20,0xf7,0x12,0x34,0x8b,0xe9,0x85,0x18,0xf5,0x38,
+	0xde,0x08,0x92,0xe6,0x1d,0x37,0x56,0xf1,0x95,0xf6,0xc7,0xd5,0x75,0x49,0x0d,0xbd,
+	0x92,0x31,0x25,0x79,0x6c,0x74,0xdd,0x9d,0x81,0x87,0x23,0xaa,0xa4,0x44,0x8e,0x2a,
+	0xfd,0xa4,0x2b,0x6b,0x69,0x05,0xbc,0x65,0x8a,0x42,0x8b,0x1a,0x96,0xea,0x40,0x18,
+	0x19,0xae,0xdc,0xaf,0x0b,0xcb,0x88,0x69,0xbe,0x6f,0x62,0x9c,0x1b,0xe9,0x2a,0x92,
+	0x7c,0xf5,0x65,0xf2,0x7c,0xb1,0xf9,0x3e,0xc8,0xaf,0x6a,0xa2,0xb9,0xb6,0xe6,0xd7,
+	0xd1,0x2d,0x23,0xf8,0x5d,0x8f,0x6a,0x85,0xc5,0x4e,0x69,0x84,0x57,0xd4,0xd3,0x76,
+	0x39,0x6a,0xd6,0xe6,0x2a,0x3a,0x54,0x2f,0x1d,0x5f,0x29,0x4c,0x31,0xd7,0x6d,0x39,
+	0xd8,0xf3,0x6a,0xfb,0xc6,0x6b,0x45,0xed,0x4c,0x30,0xfb,0x56,0x99,0x8a,0x93,0xc9,
+	0xf6,0xae,0xc8,0x55,0x38,0x67,0x46,0xe6,0x50,0x4a,0x51,0x15,0x4e,0x89,0x53,0x2c,
+	0x75,0xfc,0xca,0xa7,0x63,0xe9,0xa2,0xb9,0x8a,0x82,0x1f,0x6a,0xbd,0x71,0xa2,0x6a,
+	0x16,0xd0,0xb4,0xb7,0x16,0x17,0x71,0x44,0xbd,0x5e,0x48,0x59,0x54,0x76,0xea,0x45,
+	0x75,0x7f,0x0e,0x6c,0x6d,0xee,0x75,0xa9,0xd2,0xee,0xde,0x29,0xe3,0x16,0xec,0x42,
+	0xca,0x81,0x80,0x3b,0x97,0x9c,0x1a,0x5f,0x09,0xdc,0xdd,0xea,0x1a,0xfd,0xad,0xb6,
+	0xa1,0x73,0x3d,0xd5,0xab,0xef,0xdf,0x0c,0xf2,0x19,0x11,0xb0,0x84,0x8c,0xa9,0xe0,
+	0xf2,0x01,0xfc,0x2b,0xd4,0xa1,0x42,0x32,0x8c,0x1c,0x9e,0xb3,0x76,0x5e,0xba,0x2d,
+	0x7e,0xf3,0x4f,0x65,0xb9,0xc7,0xd9,0xe9,0x77,0x77,0x9b,0xfe,0xc7,0x6b,0x3c,0xfb,
+	0x31,0xbb,0xca,0x8c,0xb6,0xdc,0xf4,0xce,0x3e,0x86,0x99,0x3d,0x94,0xd6,0xd3,0x34,
+	0x57,0x11,0x49,0x14,0xab,0xd5,0x1d,0x4a,0xb0,0xef,0xc8,0x35,0xe9,0x7e,0x3c,0x4f,
+	0xec,0xaf,0xb0,0xff,0x00,0x64,0x7f,0xa0,0xf9,0xbe,0x67,0x99,0xf6,0x5f,0xdd,0x6f,
+	0xc6,0xdc,0x67,0x6e,0x33,0x8c,0x9f,0xcc,0xd6,0xb7,0x85,0x6c,0x2d,0x6f,0xf4,0x0b,
+	0x5b,0x9d,0x42,0xd6,0x0b,0xab,0xa7,0xdd,0xbe,0x69,0xe3,0x0e,0xed,0x87,0x20,0x65,
+	0x8f,0x27,0x80,0x07,0xe1,0x5e,0x85,0x3c,0xbf,0x9a,0xbc,0xb0,0xca,0x5e,0xf4,0x55,
+	0xdb,0xe9,0xd3,0xe7,0xd4,0x97,0x4d,0x5b,0x98,0xf2,0x7b,0x8d,0x17,0x50,0xb6,0x85,
+	0xa5,0xb8,0xb0,0xbb,0x8a,0x25,0xea,0xef,0x0b,0x2a,0x8e,0xdd,0x48,0xa8,0xed,0x34,
+	0xcb,0xbb,0xcd,0xff,0x00,0x63,0xb5,0x9e,0xe3,0x66,0x37,0x79,0x51,0x97,0xdb,0x9e,
+	0x99,0xc7,0xd0,0xd7,0x5f,0xe1,0x5b,0x9b,0xab,0xfd,0x7e,0xd6,0xdb,0x50,0xb9,0x9e,
+	0xea,0xd5,0xf7,0xef,0x86,0x79,0x0b,0xa3,0x61,0x09,0x19,0x53,0xc1,0xe4,0x03,0xf8,
+	0x56,0xaf,0x8f,0xd7,0xfb,0x23,0xec,0x1f,0xd9,0x1f,0xe8,0x1e,0x6f,0x99,0xe6,0x7d,
+	0x97,0xf7,0x5b,0xf1,0xb7,0x19,0xdb,0x8c,0xe3,0x27,0xf3,0x34,0xe9,0xd0,0x84,0xe8,
+	0xbc,0x42,0x6f,0x95,0x69,0xe7,0xd3,0xfc,0xc9,0x95,0x3b,0x1e,0x71,0x71,0x6b,0x35,
+	0xb4,0xcd,0x15,0xc4,0x52,0x45,0x2a,0xf5,0x49,0x14,0xab,0x0e,0xfc,0x83,0x56,0x2e,
+	0x34,0x8d,0x46,0xda,0x16,0x96,0xe2,0xc2,0xee,0x28,0x97,0xab,0xc9,0x0b,0x2a,0x8e,
+	0xdc,0x92,0x2b,0xd5,0x7c,0x25,0x61,0x69,0xa8,0xf8,0x7a,0xd2,0xeb,0x51,0xb5,0x82,
+	0xee,0xea,0x4d,0xfb,0xe6,0x9e,0x31,0x23,0xb6,0x1d,0x80,0xcb,0x1e,0x4f,0x00,0x0f,
+	0xc2,0xb8,0xdf,0x08,0x5e,0xdd,0xea,0x3e,0x23,0xb4,0xb4,0xd4,0x6e,0xa7,0xbb,0xb5,
+	0x93,0x7e,0xf8,0x67,0x90,0xc8,0x8d,0x84,0x62,0x32,0xa7,0x83,0x82,0x01,0xfc,0x2b,
+	0xa7,0xea,0xaa,0x3c,0x97,0x7f,0x1e,0xdf,0xf0,0x7e,0xf3,0x29,0x69,0x6f,0x33,0x98,
+	0xb3,0xb0,0xbb,0xbd,0xdf,0xf6,0x3b,0x59,0xee,0x36,0x63,0x77,0x95,0x19,0x7d,0xb9,
+	0xe9,0x9c,0x7d,0x0d,0x47,0x71,0x0c,0xd6,0xd3,0x34,0x37,0x31,0x49,0x0c,0xab,0xf7,
+	0x92,0x45,0x2a,0xc3,0xbf,0x20,0xd7,0xa0,0xfc,0x46,0xff,0x00,0x89,0x2f,0xf6,0x7f,
+	0xf6,0x3f,0xfc,0x4b,0xfc,0xef,0x33,0xcc,0xfb,0x2f,0xee,0xb7,0xe3,0x6e,0x33,0xb7,
+	0x19,0xc6,0x4f,0x5f,0x53,0x5b,0x3e,0x0d,0xb1,0xb4,0xd4,0xfc,0x37,0x67,0x77,0xa8,
+	0xda,0xc1,0x77,0x75,0x26,0xfd,0xf3,0x4f,0x18,0x91,0xdb,0x0e,0xc0,0x65,0x8f,0x27,
+	0x00,0x01,0xf8,0x57,0x44,0x30,0x77,0xa8,0xe9,0x27,0xaa,0xfb,0x8c,0xee,0xdc,0xdc,
+	0x13,0xd4,0xf2,0xfb,0x8d,0x2f,0x51,0xb6,0x85,0xa6,0xb9,0xb0,0xbb,0x86,0x25,0xfb,
+	0xcf,0x24,0x2c,0xaa,0x3b,0x72,0x48,0xa8,0xec,0xec,0xee,0xef,0x77,0xfd,0x8e,0xd6,
+	0x7b,0x8d,0x98,0xdd,0xe5,0x46,0x5f,0x6e,0x7a,0x67,0x1f,0x43,0x5b,0xde,0x0c,0xd4,
+	0x2e,0xf5,0x3f,0x12,0xd9,0xd9,0xea,0x37,0x53,0xdd,0xda,0x49,0xbf,0x7c,0x33,0xc8,
+	0x64,0x46,0xc2,0x31,0x19,0x52,0x70,0x70,0x40,0x3f,0x85,0x6d,0xfc,0x48,0x3f,0xd8,
+	0x9f,0xd9,0xdf,0xd8,0xdf,0xf1,0x2f,0xf3,0xbc,0xcf,0x33,0xec,0xbf,0xba,0xdf,0x8d,
+	0xb8,0xdd,0xb7,0x19,0xc6,0x4e,0x33,0xea,0x6a,0xe1,0x42,0x2e,0x0e,0xa2,0xd9,0x18,
+	0xaa,0xd7,0x83,0xa8,0x9e,0x88,0xe0,0xee,0x22,0x9a,0xda,0x66,0x86,0xe6,0x29,0x21,
+	0x95,0x7e,0xf2,0x48,0xa5,0x58,0x77,0xe4,0x1a,0xb5,0x71,0xa5,0xea,0x36,0xd0,0xb4,
+	0xb7,0x36,0x17,0x71,0x44,0xbd,0x5e,0x48,0x59,0x54,0x76,0xe4,0x91,0x5e,0x9b,0xe0,
+	0xcb,0x1b,0x4d,0x4f,0xc3,0x56,0x77,0x7a,0x8d,0xac,0x17,0x77,0x52,0x6f,0xdf,0x34,
+	0xf1,0x89,0x1d,0xb0,0xec,0x06,0x58,0xf2,0x70,0x00,0x1f,0x85,0x71,0x9e,0x0d,0xbf,
+	0xbb,0xd4,0xfc,0x47,0x67,0x69,0xa8,0xdd,0x4f,0x77,0x6b,0x26,0xfd,0xf0,0xcf,0x21,
+	0x91,0x1b,0x08,0xc4,0x65,0x4f,0x07,0x04,0x03,0xf8,0x56,0xfe,0xc1,0x46,0xda,0xef,
+	0xb0,0xdc,0xed,0xcb,0x77,0xf1,0x6c,0x61,0x59,0xd8,0xdd,0xde,0xef,0xfb,0x1d,0xac,
+	0xf3,0xec,0xc6,0xef,0x2a,0x32,0xdb,0x73,0xd3,0x38,0xfa,0x1a,0x23,0xb8,0xbc,0xf0,
+	0xf6,0xaa,0x97,0x9e,0x4d,0xd0,0x31,0x0d,0xb7,0x56,0x8a,0xa1,0x5a,0x68,0xcf,0x4e,
+	0x1b,0xf8,0x97,0x3b,0x97,0xd7,0x91,0xfc,0x46,0xbb,0xaf,0x88,0x5f,0xf1,0x26,0xfe,
+	0xcf,0xfe,0xc8,0xff,0x00,0x40,0xf3,0x7c,0xcf,0x33,0xec,0xbf,0xba,0xdf,0x8d,0xb8,
+	0xce,0xdc,0x67,0x19,0x3f,0x99,0xac,0x2d,0x6c,0x79,0xde,0x1e,0xd0,0xee,0xa5,0xf9,
+	0xee,0xa6,0xf3,0xfc,0xd9,0x9b,0x97,0x93,0x0e,0x00,0xdc,0xdd,0x4e,0x07,0x03,0x35,
+	0x52,0xa5,0x0b,0x4a,0x9c,0xd5,0xd5,0xb5,0x5d,0x1a,0x7f,0xd6,0xfb,0xad,0xd6,0xa5,
+	0xaa,0x8e,0x9c,0xb4,0x7a,0xa3,0x9b,0xba,0x75,0xf0,0x47,0x89,0x04,0xa1,0xbe,0xd1,
+	0xe0,0xad,0x6b,0x2f,0x22,0x88,0x96,0x48,0x63,0x67,0x07,0x85,0x0b,0xc6,0x31,0x8e,
+	0xdc,0xa6,0x46,0x18,0xae,0x6a,0x18,0xc2,0x78,0x1b,0x50,0xbb,0xb7,0xbc,0x4f,0xb5,
+	0xf8,0x2b,0x5c,0xc8,0x49,0xa1,0x76,0x65,0x84,0x30,0x3c,0x70,0x4f,0xf0,0x9c,0x12,
+	0x39,0x65,0x00,0x83,0x95,0x2b,0x5a,0x56,0x8b,0x66,0x34,0xbb,0xdd,0x1f,0x57,0xf3,
+	0x0e,0x8d,0x7a,0xe5,0xda,0x41,0x21,0xcd,0xab,0x92,0x1b,0x77,0x3d,0x13,0x70,0xdd,
+	0xe8,0xa7,0x24,0x82,0xa4,0xed,0xcd,0xb6,0xbe,0xff,0x00,0x84,0x32,0x29,0x7c,0x29,
+	0xe3,0x3b,0x5f,0xb6,0x68,0x33,0xe7,0xec,0xb7,0x51,0xc7,0xc1,0x52,0xd9,0x39,0x1d,
+	0x78,0x27,0x77,0x19,0x65,0x3d,0x32,0x0a,0x90,0xe9,0xb9,0x56,0x4e,0x93,0x8b,0x9c,
+	0xda,0x4a,0x51,0x5a,0x3a,0xb0,0x8e,0xb1,0xa9,0x07,0xff,0x00,0x3f,0xa9,0xe9,0x75,
+	0xf6,0x96,0xbb,0x33,0xb6,0x32,0x8b,0x4a,0x69,0xd9,0x74,0xfe,0xeb,0x7b,0xa7,0xfd,
+	0xd6,0x3e,0x2b,0xc9,0xfe,0x1e,0xb1,0xb4,0xbe,0x0f,0xac,0x78,0x32,0xfd,0x58,0xdb,
+	0x4a,0xa1,0x64,0x29,0xb8,0x13,0xb3,0x9f,0x94,0x82,0x3a,0x8e,0x8c,0x3e,0x61,0xfc,
+	0x42,0x9f,0x05,0x86,0xab,0xe1,0x8c,0x6b,0x3e,0x06,0x9b,0xfb,0x57,0xc3,0x57,0x52,
+	0x2c,0xcd,0x60,0xb9,0x77,0xe7,0x2a,0x42,0xf0,0x4f,0x1c,0x0c,0x8f,0x98,0x60,0x06,
+	0x07,0x69,0x34,0xc0,0xfa,0xa7,0x80,0xa1,0x64,0x31,0xa6,0xb7,0xe0,0x8b,0x86,0x04,
+	0x48,0x76,0xbb,0x47,0x1c,0x99,0xe0,0x73,0x8c,0x1c,0x8e,0xa3,0x63,0x64,0x63,0x69,
+	0x63,0x45,0x86,0x85,0x73,0x66,0x4e,0xb9,0xf0,0xbb,0x52,0x4b,0x9b,0x39,0x5b,0x6c,
+	0xf6,0x53,0xb7,0xde,0x21,0xf3,0xb3,0xe6,0x03,0x80,0x0f,0xf1,0x10,0xc0,0x72,0x18,
+	0xee,0xaa,0x9c,0xa9,0xca,0x2e,0xac,0xa5,0x07,0x1a,0xb6,0x4e,0x52,0x5f,0xba,0xab,
+	0xe5,0x51,0x7f,0xcb,0x9a,0xc9,0x7d,0xae,0xf7,0x65,0x24,0xd3,0xe5,0x49,0xdd,0x74,
+	0x5f,0x14,0x7d,0x3f,0x9a,0x3e,0x42,0x69,0xf6,0x9e,0x1e,0xf1,0x0b,0xb4,0xde,0x0d,
+	0xd4,0x8e,0x93,0xa8,0xb9,0x2e,0x74,0xdb,0x91,0xfb,0xb9,0x0f,0xcc,0x78,0x4c,0xf1,
+	0x9d,0xa3,0x26,0x32,0x76,0xa8,0xe8,0x2a,0x3b,0xf1,0xac,0x68,0xc8,0xed,0xac,0x68,
+	0x77,0x46,0x34,0x0c,0x7e,0xd1,0x65,0x89,0xa3,0x21,0x7e,0xf3,0x9e,0xe8,0xbd,0xc6,
+	0xee,0xd9,0xf4,0x35,0x56,0xe6,0xeb,0xc2,0x5e,0x22,0xbc,0x8a,0xdf,0xc5,0x1a,0x7d,
+	0xd7,0x87,0xb5,0xc3,0x83,0x71,0x2c,0x69,0xe5,0x23,0xb9,0x3d,0xf2,0x0e,0x37,0x6e,
+	0xdd,0xb9,0x94,0x63,0xbb,0x10,0x39,0xde,0xb4,0xd2,0x7c,0x65,0x67,0x6e,0x97,0x1e,
+	0x1d,0xf1,0x4d,0xae,0xb5,0x63,0xcc,0xbf,0xe9,0x04,0x31,0x99,0x81,0xc1,0x45,0x63,
+	0xbb,0x83,0xb7,0x1f,0x7d,0x79,0x27,0xa7,0x5a,0xda,0xa6,0x22,0x78,0x49,0x28,0xd5,
+	0x9f,0x2a,0x7b,0x2a,0xd7,0xff,0x00,0xc9,0x2b,0xc1,0x38,0xc9,0x76,0xe7,0x5b,0x7d,
+	0xeb,0x3f,0x63,0x1a,0xba,0xa5,0x77,0xde,0x3f,0xac,0x5e,0xdf,0x23,0x9f,0xff,0x00,
+	0x84,0x9f,0x44,0xff,0x00,0x9f,0xdf,0xfc,0x84,0xff,0x00,0xfc,0x4d,0x3e,0x4f,0x12,
+	0xe8,0xb1,0xc8,0xc8,0xd7,0xaa,0x4a,0x92,0x0e,0xd8,0xdc,0x8f,0xc0,0x81,0x83,0x5d,
+	0x1f,0xf6,0xb7,0xc4,0xaf,0xfa,0x17,0xb4,0xbf,0xfb,0xf8,0xbf,0xfc,0x7a,0x8f,0xed,
+	0x6f,0x89,0x5f,0xf4,0x2f,0x69,0x7f,0xf7,0xf1,0x7f,0xf8,0xf5,0x68,0xb3,0x1a,0x6b,
+	0xa5,0x2f,0xfc,0x29,0xa7,0xff,0x00,0xc8,0x19,0xfd,0x53,0xfc,0x5f,0xf8,0x03,0xff,
+	0x00,0x33,0x0e,0xc6,0xf2,0xff,0x00,0x56,0x5d,0xda,0x16,0x89,0x7d,0x78,0x9c,0x95,
+	0x9a,0x4c,0x41,0x0b,0xa8,0x38,0x25,0x5d,0xb8,0x27,0x3d,0xba,0xf5,0xf4,0x35,0x6b,
+	0x53,0xd2,0x74,0xdd,0x26,0x1f,0x3b,0xc7,0xba,0xc2,0x4c,0xe5,0x77,0x26,0x95,0x62,
+	0x59,0x55,0xfe,0xf6,0x33,0x8f,0x9d,0x81,0x2a,0x08,0x27,0x68,0x0c,0x31,0x9c,0x55,
+	0xf9,0xb4,0xff,0x00,0x1e,0x6a,0xb0,0xbc,0xda,0xbe,0xb5,0x65,0xa1,0x58,0x32,0x96,
+	0x99,0x20,0xc6,0xf8,0x02,0xf7,0x0c,0x3b,0x1d,0xb9,0x3f,0xbc,0xe8,0x4f,0xd2,0xb9,
+	0xef,0xf8,0xa2,0xb4,0x0d,0x43,0xfe,0x5e,0xbc,0x57,0xad,0x4d,0xf4,0x96,0x36,0x98,
+	0x8f,0xc9,0xb7,0x96,0xff,0x00,0xa6,0x84,0x11,0xea,0x39,0x51,0xc6,0xd4,0xc5,0x49,
+	0xd3,0xa3,0x3b,0xdb,0xec,0xd0,0xbc,0xe5,0xff,0x00,0x6f,0x56,0x92,0x50,0x85,0xba,
+	0xb8,0xa4,0xfb,0x37,0x74,0x5a,0xa1,0x1a,0x4a,0xf2,0x5f,0x39,0x68,0xbe,0x51,0x5a,
+	0xbf,0x99,0xa5,0x25,0xbe,0xb1,0xe3,0x74,0x63,0x31,0xfe,0xc1,0xf0,0x54,0x1b,0x08,
+	0x89,0xd4,0x44,0xd2,0x44,0xab,0xb8,0x30,0xe3,0x18,0xc6,0x3b,0xec,0x1c,0x63,0x71,
+	0x53,0x4c,0x7d,0x4e,0x4f,0x16,0xac,0x7e,0x16,0xf0,0x3c,0x2f,0x61,0xa1,0xc2,0xbb,
+	0x6e,0xee,0xd9,0x30,0x3c,0xbc,0x9e,0x07,0x39,0xc3,0x72,0x79,0xc3,0x39,0x27,0x38,
+	0x01,0x89,0x2f,0x74,0x8d,0x73,0xc4,0x96,0xdf,0xda,0x7e,0x3f,0xbd,0x4d,0x27,0x42,
+	0xb7,0x53,0x30,0xb5,0x87,0x0a,0xc0,0x95,0x00,0x1c,0x61,0xb0,0x4e,0x4f,0x0d,0x96,
+	0xce,0x54,0x28,0xdd,0x40,0xba,0xd4,0x7c,0x5b,0x0b,0x68,0x3e,0x0c,0xb6,0x4d,0x3b,
+	0xc2,0xb0,0xb0,0xb7,0x96,0xf0,0x82,0x19,0x97,0x92,0xd8,0xc9,0xc9,0x07,0xd3,0xef,
+	0x1c,0x8d,0xc4,0x06,0x22,0xb9,0xa2,0xa9,0xa8,0xa7,0x17,0x0b,0x52,0xd6,0xeb,0x5a,
+	0x34,0x9e,0xdc,0xd2,0x93,0xfe,0x35,0x6d,0xac,0xbb,0x9a,0xbb,0xdf,0x5b,0xfb,0xdf,
+	0xf8,0x14,0xbc,0x92,0xfb,0x31,0x21,0xbc,0x8d,0x7c,0x48,0xb6,0xde,0x0b,0xf0,0x71,
+	0x71,0xa2,0x58,0xb0,0x6b,0xcd,0x41,0x98,0xb2,0xb1,0xc9,0x3d,0xb0,0x18,0x16,0x24,
+	0x81,0xd1,0x98,0x71,0x85,0x5c,0xd4,0xd7,0x82,0x3f,0x16,0xeb,0x36,0xde,0x15,0xf0,
+	0xdb,0x3c,0x1e,0x15,0xb0,0x51,0xf6,0xb9,0x6d,0x97,0xe5,0x62,0x09,0x38,0xdc,0x4f,
+	0xcc,0x09,0x03,0x07,0x9c,0xb6,0xe6,0xc3,0x00,0x0d,0x32,0x7d,0x52,0xde,0x7b,0x33,
+	0xe0,0x9f,0x87,0xb6,0xde,0x6f,0x99,0xba,0x3b,0xab,0xe7,0xc1,0x42,0x84,0x00,0xef,
+	0xbb,0xbe,0x73,0x82,0xd8,0xec,0x02,0x83,0x95,0xc5,0xe7,0xb4,0xb2,0xd2,0x34,0x19,
+	0x3c,0x33,0xa5,0x49,0x24,0xb0,0x97,0x27,0x50,0xbb,0xdc,0x54,0xca,0xfc,0x06,0x45,
+	0xc1,0xe3,0xee,0x85,0x6e,0xc0,0x02,0xbc,0xb1,0x62,0xba,0xd3,0x85,0x5e,0x68,0x42,
+	0x9c,0x5c,0x67,0x76,0xe0,0xa5,0xac,0x97,0x37,0xc5,0x88,0xaa,0xbf,0x9d,0xff,0x00,
+	0xcb,0xb8,0xbb,0x59,0xec,0x8c,0xaa,0xd5,0x85,0x38,0xb9,0xcd,0xe9,0xd6,0xdb,0x3b,
+	0x6d,0x08,0xf9,0x77,0x64,0xf7,0xf7,0xa3,0x53,0xd4,0x43,0xdb,0x29,0x87,0x4b,0xb3,
+	0x06,0x0b,0x38,0x17,0x6f,0x96,0xd8,0xe0,0xcc,0xa0,0x76,0x23,0xe5,0x5f,0xf6,0x72,
+	0x47,0xdf,0xc5,0x20,0x35,0x08,0x6a,0x7a,0x9a,0xfa,0x8c,0x1e,0x12,0x9e,0x12,0x8c,
+	0x68,0x52,0x56,0x51,0xfe,0x9b,0x7e,0x6d,0xea,0xfc,0xcf,0x0a,0xa6,0x3d,0xd5,0x9b,
+	0x9b,0xea,0x4a,0x29,0xc0,0x53,0x56,0xa5,0x41,0x5d,0xcb,0x41,0xc6,0xb7,0x30,0xd0,
+	0x94,0xe1,0x1d,0x4e,0x89,0x53,0x2c,0x75,0xa2,0x9d,0x8d,0xe3,0xef,0x15,0x04,0x3e,
+	0xd4,0xa2,0x0f,0x6a,0xbe,0xb1,0x54,0x82,0x1f,0x6a,0xd6,0x35,0x4d,0x95,0x1b,0x9c,
+	0xb4,0x69,0x56,0x63,0x8e,0x92,0x14,0xab,0xb1,0x47,0x5f,0xcd,0x8e,0x67,0xa5,0x87,
+	0xd4,0x9f,0x4a,0xbb,0xba,0xd3,0x67,0x69,0xac,0xa5,0xf2,0xa4,0x65,0xd8,0x4e,0xd0,
+	0x78,0xc8,0x3d,0xc7,0xb0,0xae,0xf3,0x57,0xd2,0x2c,0xb4,0x5d,0x3a,0x5b,0xfd,0x2e,
+	0x0f,0x22,0xf2,0x1c,0x6c,0x93,0x73,0x36,0x32,0x42,0x9e,0x18,0x91,0xd0,0x9e,0xd5,
+	0xce,0x78,0x5f,0x4a,0x87,0x53,0xbd,0x78,0x6e,0x1a,0x45,0x45,0x8c,0xb8,0x28,0x40,
+	0x39,0xc8,0x1d,0xc1,0xf5,0xad,0xab,0x5d,0x52,0xe3,0x5d,0x99,0x74,0xeb,0xc4,0x89,
+	0x20,0x9b,0x3b,0x9a,0x20,0x43,0x0c,0x0d,0xc3,0x19,0x24,0x75,0x03,0xb5,0x7d,0x06,
+	0x59,0x51,0x42,0x83,0x8d,0x5d,0x5c,0xf4,0xa7,0xe5,0x2d,0xae,0xbf,0x97,0x57,0x1d,
+	0x57,0xe8,0x77,0x38,0x5d,0xdd,0x6c,0xb7,0xf4,0x1b,0xe1,0xe4,0xff,0x00,0x84,0x8f,
+	0xed,0x1f,0xdb,0x9f,0xe9,0x5f,0x67,0xdb,0xe5,0x7f,0x06,0xdd,0xd9,0xcf,0xdd,0xc6,
+	0x7e,0xe8,0xeb,0xe9,0x54,0xf5,0x8d,0x46,0xf7,0x46,0xd4,0x25,0xb0,0xd2,0xe6,0xf2,
+	0x2c,0xe2,0xc6,0xc8,0xf6,0xab,0x63,0x20,0x31,0xe5,0x81,0x3d,0x49,0xad,0x5b,0xc4,
+	0xff,0x00,0x84,0x63,0x67,0xf6,0x7f,0xef,0x3e,0xd1,0x9d,0xfe,0x7f,0x38,0xdb,0xd3,
+	0x18,0xc7,0xf7,0x8d,0x49,0x6f,0xa3,0xdb,0xeb,0x90,0xae,0xa1,0x78,0xd2,0xa4,0xf3,
+	0x67,0x72,0xc4,0x40,0x51,0x83,0xb4,0x63,0x20,0x9e,0x80,0x77,0xaf,0x43,0x96,0xb4,
+	0xe0,0xb0,0xb4,0xdf,0xfb,0x44,0x75,0x93,0xbe,0xad,0x7f,0x8b,0x77,0xbc,0x74,0xff,
+	0x00,0x20,0x6a,0x2b,0xf7,0x8f,0xe0,0x7b,0x7f,0xc3,0x7d,0xe3,0x75,0x9d,0x22,0xcb,
+	0x45,0xd3,0x66,0xd4,0x34,0xb8,0x7c,0x8b,0xc8,0x71,0xe5,0xc9,0xb9,0x9b,0x19,0x21,
+	0x4f,0x0c,0x48,0xe8,0x4f,0x6a,0xa1,0xe1,0xc4,0xff,0x00,0x84,0x9b,0xed,0x3f,0xdb,
+	0xbf,0xe9,0x5f,0x67,0xdb,0xe5,0x7f,0x06,0xdd,0xd9,0xdd,0xf7,0x71,0x9f,0xba,0x3a,
+	0xfa,0x54,0xb6,0xfa,0xa5,0xc6,0xbb,0x3a,0xe9,0xb7,0x89,0x12,0x5b,0xcf,0x9d,0xcd,
+	0x10,0x21,0x86,0xd1,0xb8,0x63,0x24,0x8e,0xa0,0x76,0xa3,0x51,0x1f,0xf0,0x88,0xec,
+	0x3a,0x67,0xef,0x7e,0xd5,0x9d,0xff,0x00,0x68,0xf9,0xb1,0xb7,0x18,0xc6,0x31,0xfd,
+	0xe3,0x5d,0x2a,0xb5,0x2a,0x92,0x58,0x9a,0x4a,0xd4,0x16,0x92,0x56,0xd2,0xff,0x00,
+	0xe1,0xd9,0xee,0xb5,0xff,0x00,0x23,0x9e,0x71,0x71,0xf7,0x65,0xb9,0x8f,0xaf,0x6a,
+	0xd7,0xfa,0x0e,0xa7,0x36,0x9d,0xa4,0xcf,0xf6,0x7b,0x28,0x76,0xf9,0x71,0xec,0x57,
+	0xdb,0x95,0x0c,0x79,0x60,0x4f,0x52,0x7b,0xd6,0xd7,0x88,0x34,0x6b,0x0d,0x03,0x49,
+	0x9f,0x53,0xd2,0x20,0xfb,0x3d,0xf4,0x1b,0x7c,0xb9,0x77,0xb3,0xed,0xdc,0xc1,0x4f,
+	0x0c,0x48,0x3c,0x12,0x3a,0x51,0x6b,0xa0,0xda,0xf8,0x92,0xdd,0x35,0x4b,0xe7,0x9a,
+	0x3b,0x8b,0x8c,0xee,0x58,0x48,0x0a,0x36,0x9d,0xa3,0x00,0x82,0x7a,0x28,0xef,0x59,
+	0x76,0x7a,0xed,0xd7,0x89,0xee,0xd3,0x46,0xd4,0x23,0x86,0x3b,0x5b,0x9c,0xef,0x68,
+	0x01,0x0e,0x36,0x8d,0xc3,0x04,0x92,0x3a,0xa8,0xed,0x5b,0xc1,0xf2,0xdf,0x9f,0xed,
+	0xfc,0x1e,0x5d,0xad,0xdb,0x75,0xfd,0x23,0x82,0xab,0xb6,0x8f,0x77,0xb0,0xbe,0x13,
+	0x1f,0xf0,0x97,0xfd,0xaf,0xfe,0x12,0x2f,0xf4,0xcf,0xb2,0xec,0xf2,0x7f,0xe5,0x9e,
+	0xdd,0xdb,0xb7,0x7d,0xcc,0x67,0x3b,0x57,0xaf,0xa5,0x64,0xf8,0x8f,0x5c,0xd4,0x7c,
+	0x39,0xac,0x5c,0x69,0x5a,0x35,0xc7,0xd9,0xac,0x2d,0xf6,0xf9,0x71,0x6c,0x57,0xdb,
+	0xb9,0x43,0x1e,0x58,0x12,0x79,0x62,0x79,0x35,0xad,0xac,0x9f,0xf8,0x40,0xbc,0xa3,
+	0xa3,0xfe,0xfb,0xed,0xb9,0xf3,0x3e,0xd5,0xf3,0x63,0x66,0x31,0x8d,0xbb,0x7f,0xbe,
+	0x7d,0x7b,0x54,0xba,0x7f,0x86,0xec,0xfc,0x5d,0x67,0x1e,0xb7,0xa9,0x49,0x71,0x15,
+	0xdd,0xd6,0x77,0xa5,0xbb,0x05,0x41,0xb4,0x94,0x18,0x04,0x13,0xd1,0x47,0x7a,0xe8,
+	0x8c,0x66,0xe3,0xec,0x97,0xf1,0x16,0xef,0xcb,0xd7,0xee,0x3c,0xfa,0x8e,0x73,0x5e,
+	0xc6,0x9f,0xf1,0x16,0xaf,0xd3,0xd7,0xe6,0x8b,0x1e,0x24,0xd1,0x34,0xef,0x0d,0xe8,
+	0xb7,0x1a,0xb6,0x8b,0x6f,0xf6,0x6d,0x42,0xdf,0x6f,0x95,0x2e,0xf6,0x7d,0xbb,0x98,
+	0x29,0xe1,0x89,0x07,0x86,0x23,0x91,0xde,0xb3,0x3c,0x18,0x7f,0xe1,0x33,0xfb,0x67,
+	0xfc,0x24,0xbf,0xe9,0xbf,0x64,0xd9,0xe4,0xff,0x00,0xcb,0x3d,0x9b,0xf7,0x6e,0xfb,
+	0x98,0xce,0x76,0xaf,0x5f,0x4a,0xab,0xa7,0x78,0x96,0xf3,0xc6,0x17,0xb1,0xe8,0x5a,
+	0x94,0x76,0xf1,0x5a,0x5d,0xe7,0x7b,0xdb,0xa9,0x57,0x1b,0x41,0x71,0x82,0x49,0x1d,
+	0x54,0x76,0xe9,0x56,0x35,0xaf,0xf8,0xb7,0x7e,0x4f,0xf6,0x2f,0xef,0xfe,0xdf,0xbb,
+	0xcd,0xfb,0x5f,0xcd,0x8d,0x98,0xc6,0xdd,0xbb,0x7f,0xbe,0x73,0x9c,0xf6,0xad,0xd3,
+	0x8b,0x7c,0xf1,0xf8,0x3a,0xaf,0xf8,0x1f,0x71,0x84,0xb1,0x34,0xe5,0x2f,0xac,0x43,
+	0xf8,0x2b,0x46,0xbc,0xfd,0x3a,0xee,0x8a,0x1e,0x22,0xd7,0x35,0x1f,0x0e,0x6b,0x57,
+	0x1a,0x4e,0x8d,0x71,0xf6,0x6b,0x0b,0x7d,0xbe,0x54,0x5b,0x15,0xf6,0xee,0x50,0xc7,
+	0x96,0x04,0x9e,0x58,0x9e,0x4d,0x74,0xfe,0x20,0xd1,0x34,0xff,0x00,0x0e,0xe8,0xf7,
+	0x1a,0xa6,0x8d,0x6f,0xf6,0x6b,0xf8,0x36,0xf9,0x72,0xef,0x67,0xdb,0xb9,0x82,0x9e,
+	0x18,0x90,0x78,0x62,0x39,0x15,0x4b,0x4c,0xf0,0xdd,0x9f,0x8b,0xec,0xa3,0xd7,0x75,
+	0x29,0x2e,0x22,0xbb,0xbb,0xce,0xf4,0xb7,0x60,0xa8,0x36,0x92,0x83,0x00,0x82,0x7a,
+	0x28,0xef,0xd6,0xa8,0x69,0x9e,0x24,0xbc,0xf1,0x6d,0xe4,0x7a,0x26,0xa5,0x1d,0xbc,
+	0x56,0xb7,0x59,0xde,0xf6,0xea,0x55,0xc6,0xd0,0x5c,0x60,0x92,0x47,0x55,0x1d,0xaa,
+	0xd6,0x97,0xbf,0x5d,0xbf,0xae,0x83,0x8d,0x5e,0x5b,0xf3,0xfd,0xbf,0xe1,0xf9,0x76,
+	0xf4,0xdd,0x17,0x7c,0x22,0x4f,0x8b,0xbe,0xd5,0xff,0x00,0x09,0x0f,0xfa,0x67,0xd9,
+	0x76,0x79,0x3f,0xf2,0xcf,0x6e,0xec,0xee,0xfb,0x98,0xce,0x76,0xaf,0x5f,0x4a,0xc7,
+	0xf1,0x7a,0xfd,0x9f,0x56,0x6d,0x36,0x0f,0x96,0xca,0xcf,0x1e,0x44,0x7d,0x76,0x6f,
+	0x55,0x66,0xe4,0xf2,0x72,0x79,0xe4,0xd6,0xd6,0xa6,0xbf,0xf0,0x82,0x79,0x43,0x48,
+	0xfd,0xf7,0xdb,0x73,0xe6,0x7d,0xab,0xe6,0xc6,0xcc,0x63,0x1b,0x76,0xff,0x00,0x7c,
+	0xfa,0xf6,0xac,0x8d,0x7c,0x7d,0xb2,0xda,0xc3,0x57,0x97,0x8b,0x9b,0xef,0x33,0xcd,
+	0x55,0xfb,0x83,0x61,0x0a,0x36,0x8e,0xbd,0x07,0x39,0x26,0xb3,0xa8,0xed,0x0e,0x57,
+	0xf1,0x2d,0xff,0x00,0xaf,0xb8,0xdf,0x9e,0xd0,0xf6,0x72,0xf8,0xd6,0xfe,0x9e,0xbf,
+	0x34,0x63,0xc6,0x94,0xfc,0xc6,0x96,0x49,0xa7,0x6a,0x5a,0x72,0xea,0x7a,0x2b,0x36,
+	0x36,0x11,0x99,0x2d,0x06,0xd2,0x32,0x83,0xab,0x01,0x9e,0x02,0x90,0xcb,0x93,0xb7,
+	0x23,0x0a,0xb2,0xc2,0x95,0x76,0x28,0xeb,0x8a,0x7c,0xb2,0x56,0x97,0xe6,0xd3,0x4f,
+	0xa3,0x4d,0x6a,0x9a,0xe8,0xfe,0x4e,0xe9,0xb4,0xfb,0xb0,0xb2,0x6b,0x54,0x72,0x91,
+	0xda,0x6a,0x9e,0x0d,0xb4,0x96,0xef,0x48,0x99,0x3c,0x4d,0xe1,0x19,0x22,0x93,0xcd,
+	0x80,0xc8,0xac,0xb1,0x2e,0xe2,0x0e,0x3a,0x82,0x39,0x3b,0x8a,0x8c,0x1f,0x9b,0x72,
+	0x8c,0x03,0x55,0xad,0x2c,0x74,0x7d,0x76,0xfd,0x35,0x0f,0x87,0xfa,0xb7,0xf6,0x1e,
+	0xb1,0xce,0xeb,0x19,0x89,0x41,0x2f,0xcf,0xbb,0x80,0x09,0x18,0xc2,0x92,0x55,0x77,
+	0x2e,0x02,0x82,0x17,0x9a,0xec,0xa1,0xb0,0x96,0xd6,0xe8,0xdd,0x69,0x37,0x1f,0x64,
+	0x95,0xb7,0x17,0x8b,0x6e,0xe8,0x25,0x2c,0x46,0x59,0xe3,0x04,0x65,0xb8,0xfb,0xc0,
+	0x83,0xea,0x48,0xe2,0xb1,0x7c,0x4b,0xe1,0xfd,0x0f,0x59,0x12,0x49,0xab,0xe9,0xf2,
+	0xe8,0xda,0x83,0x64,0xfd,0xb6,0xd1,0x4c,0xb0,0x31,0x39,0x25,0x9c,0x85,0xc6,0x01,
+	0x60,0x59,0x9d,0x50,0xf1,0xc3,0x10,0x09,0xae,0xba,0x78,0xb7,0xed,0x1c,0xea,0x37,
+	0xcd,0x2d,0xe7,0x04,0x9f,0x32,0xed,0x56,0x8f,0xc3,0x53,0x4f,0xb5,0x0b,0x3b,0x6a,
+	0xec,0xd1,0xdc,0xe9,0x3e,0x5f,0x75,0x68,0xba,0x3e,0x9f,0xe1,0x96,0xeb,0xd1,0xe8,
+	0x53,0xd5,0x75,0x9d,0x4e,0xcf,0x75,0xb7,0xc4,0x2f,0x0c,0x45,0xa8,0x58,0xc5,0x19,
+	0x41,0xa8,0x5b,0x43,0xbb,0x68,0x39,0x52,0xc1,0xba,0x02,0xc4,0x2f,0x42,0x84,0x70,
+	0x71,0xd0,0x56,0x3d,0xa5,0x9f,0x81,0xef,0xee,0x12,0xe3,0x42,0xd7,0xaf,0xfc,0x3f,
+	0xa8,0xbe,0x7c,0xa5,0x95,0x88,0x58,0x30,0x30,0x72,0xdf,0xed,0x28,0x3f,0xf2,0xd3,
+	0xf8,0xbf,0xe0,0x35,0xd3,0xc3,0x69,0xe3,0xcd,0x1a,0x14,0x7d,0x23,0x52,0xb2,0xf1,
+	0x15,0x83,0x28,0xf2,0x7c,0xf2,0x37,0x90,0xdf,0x36,0xf2,0xc4,0x8c,0x8e,0xc3,0xe7,
+	0x6e,0x08,0xe3,0xd3,0x12,0xef,0x5f,0xd3,0x1e,0xdd,0xdb,0xc6,0x3e,0x02,0x96,0xcd,
+	0x26,0xc7,0x99,0x77,0x15,0xbf,0x96,0xd2,0x4d,0x9d,0xc7,0x04,0x84,0x23,0x38,0x63,
+	0xf7,0xc9,0xed,0xcf,0x26,0xb6,0xc1,0x49,0xb8,0xbf,0xa9,0xfc,0xfd,0x85,0x45,0x6f,
+	0x9d,0x0a,0xbd,0x5f,0x58,0xad,0xf5,0x5a,0x6a,0xdc,0x54,0x5a,0xfe,0xf3,0xff,0x00,
+	0x26,0x5f,0xfb,0x74,0x7f,0x32,0x6f,0xec,0x7f,0xfa,0xaa,0xbf,0xf9,0x35,0xff,0x00,
+	0xdb,0xa8,0xfe,0xc7,0xff,0x00,0xaa,0xab,0xff,0x00,0x93,0x5f,0xfd,0xba,0xb1,0xff,
+	0x00,0xb5,0xbe,0x1a,0xff,0x00,0xd0,0xbd,0xaa,0x7f,0xdf,0xc6,0xff,0x00,0xe3,0xd4,
+	0x7f,0x6b,0x7c,0x35,0xff,0x00,0xa1,0x7b,0x54,0xff,0x00,0xbf,0x8d,0xff,0x00,0xc7,
+	0xab,0xb7,0xd8,0xe3,0xbf,0x92,0xb7,0xfe,0x08,0xc3,0xff,0x00,0x99,0x9f,0x35,0x2e,
+	0xf1,0xff,0x00,0xc0,0xa6,0x59,0xbf,0xd3,0xbc,0x23,0x6f,0x30,0x9b,0xc4,0xbe,0x2c,
+	0xbd,0xd7,0x6f,0x23,0x5d,0xe8,0x20,0x62,0xea,0xe8,0x39,0x11,0xee,0x1b,0xb0,0x49,
+	0xdd,0xfc,0x6b,0xf7,0xbb,0x75,0xab,0xfa,0x46,0xbf,0xfe,0xaa,0x3f,0x86,0xfe,0x0f,
+	0xf5,0x8d,0xef,0x2e,0xa2,0xfa,0xb3,0x21,0x7d,0xdf,0xee,0x9f,0x99,0xfd,0x06,0x3a,
+	0x55,0x6b,0x0d,0x6f,0xc3,0x7e,0x49,0x8b,0xc2,0xfe,0x03,0xb8,0xd5,0x15,0x5b,0x74,
+	0xc6,0x78,0x7c,0xc6,0x8c,0x9f,0xbb,0xce,0x24,0x38,0x38,0x3c,0x70,0x38,0xef,0x93,
+	0x5b,0xd0,0x8f,0x88,0x7e,0x21,0x85,0x04,0xcd,0x65,0xa0,0xdb,0x32,0x8d,0xec,0x8b,
+	0xfb,0xd7,0x47,0xea,0x40,0x25,0x99,0x59,0x47,0x6c,0xa1,0xc9,0xeb,0xe9,0xc7,0x8c,
+	0x94,0xa3,0x0b,0x63,0x6e,0xa2,0xba,0x57,0xa9,0x18,0xc7,0xff,0x00,0x04,0xd1,0xd5,
+	0xfa,0x79,0xf6,0x77,0x5a,0x53,0x49,0xbf,0xdd,0xef,0xfd,0xd4,0xdb,0xff,0x00,0xc0,
+	0xa4,0x63,0xea,0xda,0x44,0x16,0x57,0x7f,0x6f,0xf8,0x9b,0xaf,0xa5,0xfc,0xaa,0xac,
+	0x61,0xd3,0xad,0x99,0xbe,0x6c,0xae,0x01,0x00,0x6d,0xda,0x0e,0xc2,0x38,0x0a,0x09,
+	0x03,0x2d,0xd4,0x54,0xdb,0xf5,0x4f,0x1a,0x58,0x88,0xb4,0xa8,0xd3,0xc3,0x3e,0x0f,
+	0x85,0x66,0xdf,0x30,0xda,0x82,0x50,0x33,0x9c,0xa8,0x2b,0xf2,0xf2,0x72,0x3e,0xee,
+	0x77,0xe5,0x98,0x80,0x28,0xd3,0x34,0x5f,0x0c,0xe9,0x72,0x49,0x70,0xe6,0x6f,0x14,
+	0x6a,0xae,0xc5,0x8c,0xd2,0x2f,0xfa,0x39,0x63,0xbb,0x2d,0xb8,0xe5,0x18,0x72,0x03,
+	0x73,0x23,0x02,0x32,0x06,0x41,0x02,0xe6,0xb1,0x75,0x79,0xac,0xc8,0x1b,0x53,0x90,
+	0x7d,0x9c,0x02,0x05,0x9c,0x59,0xf2,0x79,0x20,0x8d,0xe0,0xff,0x00,0xac,0x61,0x81,
+	0xc9,0xc0,0xe3,0x21,0x41,0xad,0x69,0xd3,0xab,0x88,0x9c,0x3d,0x92,0x6f,0x93,0x69,
+	0xce,0x2a,0x30,0x87,0x9d,0x2a,0x1d,0xf5,0xd2,0x53,0xfb,0xb6,0x38,0x71,0x59,0x86,
+	0x1f,0x09,0x17,0xed,0x1e,0xaf,0xec,0xa7,0x76,0xff,0x00,0xc5,0x2f,0xd1,0x0b,0x1d,
+	0xd5,0x9e,0x99,0x68,0xfa,0x57,0x85,0xad,0x85,0xbd,0x96,0xc5,0x59,0x35,0x30,0xc3,
+	0xcd,0xb9,0xc6,0xec,0xed,0x20,0x67,0xbf,0xdf,0xcf,0x42,0x76,0x00,0x36,0xb0,0xa8,
+	0x81,0x63,0x45,0x48,0xd4,0x2a,0x28,0xc2,0xa8,0x18,0x00,0x7a,0x0a,0x56,0x34,0xdc,
+	0xd7,0xbf,0x82,0xc1,0x53,0xc2,0xc5,0xf2,0x5d,0xca,0x5a,0xca,0x4d,0xde,0x52,0x7d,
+	0xdb,0x7f,0xf0,0xcb,0xa2,0x47,0xc6,0x63,0xb3,0x7a,0x98,0xa9,0xde,0x5a,0x25,0xb2,
+	0x5b,0x22,0x55,0x35,0x2a,0x55,0x75,0x35,0x3c,0x75,0xe8,0xa4,0x73,0x53,0xc5,0x5c,
+	0xb3,0x1d,0x59,0x8d,0x6a,0xbc,0x55,0x76,0x11,0x49,0xb3,0xd5,0xc3,0xd6,0xb9,0x2c,
+	0x69,0x56,0xa3,0x8e,0x9b,0x0a,0xd5,0xd8,0x92,0xa5,0xcc,0xf7,0x70,0xfa,0x8d,0x48,
+	0xaa,0x65,0x86,0xac,0x47,0x1d,0x58,0x48,0xaa,0x7d,0xa1,0xec,0x52,0xa7,0x73,0x85,
+	0x81,0x2a,0xfc,0x31,0xd5,0x7b,0x75,0xad,0x18,0x12,0xbf,0x9c,0xe5,0x22,0x70,0x6e,
+	0xe6,0xa6,0x81,0x7b,0xfd,0x99,0x74,0xd3,0x79,0x5e,0x6e,0xe4,0x29,0x8d,0xdb,0x7b,
+	0x83,0xe9,0xed,0x5b,0xc9,0xa4,0x7f,0x62,0x9f,0xb7,0x89,0xbc,0xff,0x00,0x27,0xfe,
+	0x59,0xec,0xdb,0x9c,0xfc,0xbd,0x72,0x7d,0x6b,0x17,0x4a,0xd3,0xe4,0xbe,0x98,0xc7,
+	0x11,0x45,0x60,0xbb,0xbe,0x62,0x40,0xc6,0x47,0xf8,0xd7,0x4b,0x3d,0xfc,0x5a,0xac,
+	0x2d,0x67,0x6e,0xb2,0x2c,0x92,0x63,0x05,0xc0,0x03,0x83,0x9e,0xc4,0xfa,0x57,0xd0,
+	0xe5,0x4e,0x32,0xc3,0xb7,0x5b,0xe2,0x5f,0xc2,0xff,0x00,0x17,0x5b,0x77,0xd7,0x97,
+	0x47,0x75,0xf8,0x9e,0xac,0xaf,0xcc,0xb9,0x76,0xfb,0x5e,0x9f,0xd5,0xca,0xec,0xbf,
+	0xf0,0x91,0xe3,0x3f,0xe8,0xdf,0x67,0xff,0x00,0x81,0xee,0xdd,0xf9,0x63,0xee,0xd0,
+	0x35,0x2f,0xec,0x61,0xf6,0x01,0x0f,0x9d,0xe5,0x7f,0x1e,0xed,0xb9,0xcf,0xcd,0xd3,
+	0x07,0xd6,0xa5,0xb3,0x5f,0xec,0x4d,0xff,0x00,0x6a,0xf9,0xfc,0xec,0x6d,0xf2,0xf9,
+	0xc6,0x3d,0x73,0x8f,0x5a,0x8a,0xe7,0x4e,0x97,0x54,0x99,0xaf,0x20,0x64,0x58,0xe4,
+	0xe8,0x1c,0x90,0x78,0x18,0xec,0x0f,0xa5,0x7a,0x3c,0xf8,0x85,0x4d,0x54,0xa5,0xfe,
+	0xf6,0xfe,0x3e,0xfc,0xbd,0x34,0xf8,0x57,0xd9,0xd9,0x7e,0xa0,0xd4,0x2f,0x69,0x7f,
+	0x0f,0xa7,0xaf,0xe7,0xdc,0x8b,0xfb,0x23,0xfb,0x10,0xff,0x00,0x68,0x89,0xbc,0xff,
+	0x00,0x27,0xfe,0x59,0xed,0xdb,0x9c,0xfc,0xbd,0x72,0x7d,0x7d,0x2a,0x39,0x13,0xfe,
+	0x12,0xce,0x0f,0xfa,0x27,0xd9,0x7f,0xed,0xa6,0xed,0xdf,0x96,0x31,0xb7,0xf5,0xab,
+	0xf7,0x77,0xf1,0x6a,0xd0,0x35,0x8d,0xba,0xba,0xcb,0x2e,0x30,0x64,0x00,0x2f,0x07,
+	0x3c,0xe0,0x9f,0x4a,0xab,0x67,0x8f,0x0d,0x79,0x86,0xfb,0xf7,0x9f,0x68,0xc6,0xdf,
+	0x27,0x9c,0x6d,0xeb,0x9c,0xe3,0xfb,0xc2,0xba,0x97,0xb0,0x53,0x50,0xa1,0xfe,0xed,
+	0xf6,0xbb,0x73,0x7a,0xef,0xfc,0xbb,0x33,0x8e,0xa7,0x35,0xaf,0x53,0xe2,0xfd,0x0a,
+	0x8d,0xae,0x7f,0xc2,0x36,0x3f,0xb2,0xfe,0xcd,0xf6,0x9f,0x23,0xfe,0x5a,0xef,0xd9,
+	0xbb,0x77,0xcd,0xd3,0x07,0x1f,0x7b,0x1d,0x6a,0xb3,0x68,0x1f,0xf0,0x8b,0x9f,0xed,
+	0xaf,0xb4,0xfd,0xab,0xec,0xdf,0xf2,0xc7,0xcb,0xd9,0xbb,0x77,0xc9,0xf7,0xb2,0x71,
+	0xf7,0xb3,0xd3,0xb5,0x4b,0xa8,0x68,0xb7,0x1a,0xfd,0xc3,0xea,0x36,0x6f,0x12,0x43,
+	0x36,0x36,0xac,0xa4,0x86,0x1b,0x46,0xd3,0x9c,0x02,0x3a,0x8f,0x5a,0x9b,0x51,0xd6,
+	0x6d,0xfc,0x47,0x69,0x26,0x91,0x64,0x93,0x47,0x73,0x71,0x8d,0xad,0x30,0x01,0x06,
+	0xd3,0xb8,0xe4,0x82,0x4f,0x45,0x3d,0xab,0xaa,0x9b,0xbd,0xfd,0xa7,0x4f,0xe1,0x7e,
+	0x96,0xef,0xf6,0x77,0xb9,0xe5,0x56,0x7b,0xdf,0x7f,0xb3,0xeb,0xfd,0x58,0xce,0x91,
+	0x3f,0xe1,0x60,0x71,0x9f,0xec,0xff,0x00,0xb0,0xff,0x00,0xdb,0x5d,0xfb,0xff,0x00,
+	0xef,0x9c,0x63,0x67,0xbf,0x5a,0x89,0xbc,0x4f,0xff,0x00,0x08,0x6f,0xfc,0x48,0xbe,
+	0xc7,0xf6,0xcf,0xb2,0x7f,0xcb,0x7f,0x37,0xcb,0xdd,0xbb,0xe7,0xfb,0xb8,0x38,0xc6,
+	0xec,0x75,0xed,0x56,0x34,0xc2,0x3c,0x0d,0xe6,0x9d,0x5b,0xf7,0xdf,0x6d,0xc7,0x97,
+	0xf6,0x6f,0x9b,0x1b,0x33,0x9c,0xee,0xdb,0xfd,0xf1,0xeb,0xde,0xb3,0xf5,0x3f,0x0d,
+	0xde,0x78,0xb6,0xf2,0x4d,0x6b,0x4e,0x92,0xde,0x2b,0x5b,0x9c,0x6c,0x49,0xd8,0xab,
+	0x8d,0xa0,0x21,0xc8,0x00,0x8e,0xaa,0x7b,0xd7,0x54,0x1c,0xf9,0x54,0x97,0xf1,0x7a,
+	0xfa,0x7a,0x6d,0xd8,0xf2,0x2b,0xce,0xb2,0x8f,0x35,0x0f,0xe3,0xf5,0xef,0x6f,0x4d,
+	0xbb,0x12,0x1f,0x0b,0xff,0x00,0xc2,0x17,0xff,0x00,0x15,0x07,0xdb,0x3e,0xdb,0xf6,
+	0x4f,0xf9,0x61,0xe5,0x79,0x7b,0xf7,0xfc,0x9f,0x7b,0x27,0x18,0xdd,0x9e,0x9d,0xa9,
+	0x3f,0xe4,0xa5,0x7f,0xd4,0x33,0xfb,0x3f,0xfe,0xdb,0x79,0x9e,0x67,0xfd,0xf3,0x8c,
+	0x6c,0xf7,0xeb,0x56,0xf5,0x3f,0x12,0x59,0xf8,0xbe,0xca,0x4d,0x0b,0x4d,0x8e,0xe2,
+	0x2b,0xbb,0xac,0x6c,0x7b,0x85,0x0a,0x83,0x69,0x0e,0x72,0x41,0x27,0xa2,0x9e,0xdd,
+	0x6a,0xae,0x8a,0x3f,0xe1,0x5d,0xf9,0xdf,0xdb,0x5f,0xbf,0xfb,0x7e,0xdf,0x2b,0xec,
+	0x9f,0x36,0x36,0x67,0x3b,0xb7,0x6d,0xfe,0xf8,0xc6,0x33,0xde,0xba,0x57,0x25,0xed,
+	0x0f,0x83,0xaf,0xaf,0xf5,0x63,0x96,0x72,0xa2,0xaa,0x28,0x52,0xff,0x00,0x75,0xfb,
+	0x7d,0xb9,0xba,0x6b,0xba,0xfb,0x3b,0x3f,0xd4,0x51,0xe2,0x7f,0xf8,0x43,0x3f,0xe2,
+	0x41,0xf6,0x3f,0xb6,0xfd,0x93,0xfe,0x5b,0xf9,0xbe,0x5e,0xfd,0xff,0x00,0x3f,0xdd,
+	0xc1,0xc6,0x37,0x63,0xaf,0x6a,0x7a,0x78,0x5f,0xfe,0x10,0xef,0xf8,0x9e,0x7d,0xb3,
+	0xed,0x9f,0x65,0xff,0x00,0x96,0x1e,0x57,0x97,0xbb,0x77,0xc9,0xf7,0xb2,0x71,0x8d,
+	0xd9,0xe9,0xda,0xa9,0xea,0x3e,0x1a,0xbc,0xf1,0x7d,0xec,0x9a,0xee,0x9b,0x25,0xbc,
+	0x56,0x97,0x58,0xd8,0x97,0x0c,0x55,0xc6,0xd0,0x10,0xe4,0x00,0x47,0x55,0x3d,0xfa,
+	0x56,0xbd,0xff,0x00,0x88,0xed,0x3c,0x59,0x67,0x26,0x8b,0xa7,0x47,0x71,0x15,0xd5,
+	0xce,0x36,0x34,0xea,0x15,0x06,0xd2,0x1c,0xe4,0x82,0x4f,0x45,0x3d,0xaa,0xbb,0xdf,
+	0xfe,0xdd,0xfe,0xbe,0xe1,0xd3,0x9d,0xdc,0xbd,0xb7,0x4f,0xe0,0xf9,0xf6,0xb7,0x7f,
+	0xb3,0xbd,0xff,0x00,0x32,0x35,0x3f,0xf0,0x9f,0xf3,0x8f,0xec,0xff,0x00,0xb0,0xff,
+	0x00,0xdb,0x5d,0xfb,0xff,0x00,0xef,0x9c,0x63,0x67,0xbf,0x5a,0xcb,0xf1,0x0a,0xfd,
+	0x8f,0xec,0xba,0x3f,0xdf,0xfb,0x06,0xef,0xdf,0x74,0xf3,0x37,0xe1,0xfe,0xef,0x6c,
+	0x67,0x1d,0x4d,0x6a,0xe8,0xc8,0x7c,0x0f,0xe6,0x8d,0x57,0xf7,0xdf,0x6c,0xc7,0x97,
+	0xf6,0x6f,0x9b,0x1b,0x33,0x9c,0xee,0xdb,0xfd,0xf1,0xfa,0xd6,0x77,0x88,0xc7,0xda,
+	0xee,0xd3,0x55,0x8f,0x8b,0x7b,0xdc,0xf9,0x6a,0xdf,0x7c,0x6c,0x01,0x4e,0x47,0x4e,
+	0xa3,0xd4,0xd6,0x35,0x9f,0xb9,0x77,0xf1,0x75,0xf4,0xfe,0xac,0x75,0xf3,0x3f,0x65,
+	0xcd,0x3f,0xe2,0xfd,0xaf,0x4e,0x9a,0x6d,0xdb,0x63,0x3a,0x04,0xad,0x08,0x63,0xaa,
+	0xd6,0xeb,0x5a,0x50,0x25,0x79,0xb2,0x91,0xea,0xe0,0xdd,0xc9,0x22,0x8e,0xac,0xa4,
+	0x74,0xb1,0x25,0x5a,0x44,0xac,0xb9,0xcf,0xa2,0xa0,0xb4,0x31,0xe4,0xd0,0x2c,0x1a,
+	0x57,0x96,0x28,0x9e,0xda,0x59,0x18,0xb4,0x8f,0x69,0x33,0xdb,0x99,0x49,0xee,0xe6,
+	0x32,0xbb,0x8f,0x5e,0xb9,0xea,0x7d,0x4d,0x1f,0x62,0xd5,0xa0,0xf9,0xad,0xf5,0xa9,
+	0x26,0x73,0xc1,0x5b,0xdb,0x68,0xdd,0x31,0xea,0x04,0x62,0x33,0x9f,0xc4,0x8e,0xbc,
+	0x74,0x23,0x74,0x25,0x23,0x25,0x69,0x29,0x2a,0xdf,0xc5,0x4a,0x5f,0xe2,0x49,0xfd,
+	0xd7,0x4e,0xdf,0x23,0x69,0x52,0x8a,0xd5,0x69,0xe9,0xa7,0xe4,0x60,0xb7,0xfc,0x24,
+	0x03,0xfe,0x62,0x1a,0x5f,0xfe,0x0b,0xe4,0xff,0x00,0xe3,0xd5,0x13,0xcd,0xaf,0xaf,
+	0xfc,0xbf,0x69,0x7f,0xf8,0x01,0x27,0xff,0x00,0x1e,0xad,0xc9,0x12,0xaa,0x4c,0x95,
+	0xa5,0x3c,0x1e,0x16,0x5b,0xd2,0x8f,0xfe,0x02,0xbf,0xc8,0xf3,0xf1,0x13,0x94,0x3e,
+	0x16,0xfe,0xf3,0x12,0x79,0x75,0xa9,0x71,0xe7,0x6a,0xab,0x06,0xde,0x9f,0x63,0xb5,
+	0x54,0xcf,0xfb,0xde,0x61,0x93,0x3e,0xd8,0xc7,0x7c,0xe7,0x8c,0x65,0x5d,0xe9,0xd1,
+	0x5c,0x67,0xed,0xef,0x3d,0xf6,0x4e,0xe2,0xb7,0x52,0xb4,0xa9,0xbb,0xfb,0xc1,0x09,
+	0xd8,0xa7,0xaf,0xdd,0x03,0x19,0x20,0x60,0x71,0x5d,0x0c,0xeb,0x59,0xf3,0xad,0x7b,
+	0x58,0x3a,0x34,0x68,0x59,0xd1,0x84,0x62,0xfb,0xa4,0x93,0xfb,0xd2,0xb9,0xf3,0x18,
+	0xfc,0x55,0x59,0x26,0x9c,0x9f,0xde,0x65,0xcc,0xb5,0x52,0x41,0x5a,0x13,0x2d,0x52,
+	0x94,0x57,0xb7,0x45,0x9f,0x1b,0x8b,0xab,0x62,0xab,0x0a,0x65,0x4a,0xc2,0x99,0x8a,
+	0xf4,0x20,0xcf,0x16,0x75,0x9d,0xc5,0x51,0x53,0xc6,0x2a,0x25,0x15,0x62,0x21,0x5a,
+	0xdc,0xd2,0x8d,0x6d,0x4b,0x30,0x8a,0xbf,0x02,0xd5,0x58,0x56,0xb4,0x2d,0xd7,0xa5,
+	0x44,0x99,0xef,0xe0,0xea,0x5c,0xb7,0x02,0x55,0xf8,0x63,0xaa,0xf6,0xeb,0xd2,0xb4,
+	0x60,0x4a,0xe7,0x94,0x8f,0xac,0xc1,0xbb,0x92,0xc5,0x1d,0x59,0x48,0xe9,0x62,0x4a,
+	0xb4,0x89,0x59,0x73,0x9f,0x47,0x41,0x68,0x79,0xdd,0xba,0x74,0xad,0x18,0x16,0xaa,
+	0x40,0xb5,0xa3,0x02,0xd7,0xf3,0xcc,0xa4,0x79,0xb8,0x29,0x9b,0x7e,0x1c,0x9e,0x2b,
+	0x4b,0xb7,0x79,0xdb,0x6a,0x98,0xca,0x83,0x82,0x79,0xc8,0xf4,0xfa,0x55,0xdd,0x3e,
+	0xca,0x6b,0x1b,0x94,0xb8,0xba,0x4d,0x91,0x26,0x77,0x36,0x41,0xc6,0x46,0x3b,0x7d,
+	0x6b,0x22,0xd6,0x17,0x94,0xed,0x89,0x19,0xc8,0x19,0xc2,0x8c,0xd7,0x57,0xa8,0xcb,
+	0x1c,0xf6,0x52,0x47,0x0c,0x89,0x24,0x87,0x18,0x54,0x60,0x49,0xe4,0x76,0x15,0xf4,
+	0x59,0x4a,0x55,0xf0,0xee,0xa5,0x4d,0x1d,0x0f,0x7a,0x1f,0xde,0x96,0xf6,0x7d,0xf5,
+	0x8a,0xd1,0x59,0xeb,0xe8,0x7b,0x1c,0xf6,0x76,0x5f,0x6b,0x47,0xe9,0xfd,0x32,0xa6,
+	0xa4,0x3f,0xb4,0xbc,0xbf,0xb1,0xfe,0xf3,0xcb,0xce,0xee,0xd8,0xce,0x31,0xd7,0xe8,
+	0x6a,0x7b,0x2b,0x98,0x6c,0xad,0x92,0xde,0xe5,0xf6,0x4a,0x99,0xdc,0xb8,0x27,0x19,
+	0x39,0xed,0xf5,0xa8,0xf4,0x61,0xf6,0x6f,0x3b,0xed,0x1f,0xba,0xdd,0x8c,0x6f,0xf9,
+	0x73,0xd7,0xd6,0xaa,0xea,0x70,0xc9,0x3d,0xe4,0x92,0x43,0x1b,0xc8,0x87,0x18,0x64,
+	0x19,0x07,0x81,0xde,0xbd,0x2f,0xad,0x55,0xa3,0x4d,0x66,0x90,0x57,0xaf,0x53,0xdd,
+	0x94,0x7a,0x25,0xde,0xdf,0x12,0xf8,0x56,0xef,0xaf,0x9a,0x29,0xa8,0xcb,0xf7,0x0f,
+	0xe1,0x5a,0xa7,0xfd,0x69,0xd5,0x91,0xd9,0x59,0xcd,0x61,0x79,0x1d,0xd5,0xd2,0x79,
+	0x70,0x47,0x9d,0xcd,0x90,0x71,0x90,0x40,0xe0,0x73,0xd4,0xd1,0xae,0xa1,0xd6,0x84,
+	0x23,0x4d,0xfd,0xf7,0x93,0xbb,0x7f,0xf0,0xe3,0x38,0xc7,0x5c,0x7a,0x1a,0xd3,0xd5,
+	0xa5,0x8e,0xe3,0x4f,0x96,0x28,0x24,0x49,0x24,0x6c,0x61,0x10,0x82,0x4f,0x23,0xb0,
+	0xaa,0x3e,0x1f,0xc5,0x91,0xb8,0xfb,0x67,0xfa,0x3e,0xfd,0xbb,0x7c,0xdf,0x97,0x76,
+	0x33,0x9c,0x67,0xea,0x2b,0xad,0x50,0xa7,0x42,0xa2,0xcb,0xa9,0xbb,0xd1,0x9e,0xae,
+	0x5d,0x53,0xed,0x7d,0xbe,0xca,0xdd,0x75,0x38,0xea,0xcd,0xd4,0xf7,0xa5,0xb8,0x69,
+	0x9a,0x8d,0xa6,0x93,0x61,0x15,0x9d,0xfc,0xbe,0x55,0xc4,0x59,0xdc,0x9b,0x4b,0x63,
+	0x24,0x91,0xc8,0x04,0x74,0x22,0xb9,0xfd,0x27,0x4b,0xbb,0xd1,0x75,0x48,0x75,0x0d,
+	0x4a,0x2f,0x26,0xce,0x1d,0xdb,0xe4,0xdc,0x1b,0x19,0x52,0xa3,0x80,0x49,0xea,0x47,
+	0x6a,0x9f,0xc4,0x36,0xb3,0xdd,0xea,0x93,0xcd,0x6b,0x0c,0xb3,0xc2,0xdb,0x76,0xbc,
+	0x68,0x59,0x4e,0x14,0x0e,0x08,0xf7,0xad,0xaf,0x13,0x5c,0xc1,0x7b,0xa2,0x5c,0xdb,
+	0x59,0xcd,0x15,0xc5,0xc3,0xed,0xdb,0x14,0x4e,0x1d,0x9b,0x0c,0x09,0xc0,0x1c,0x9e,
+	0x01,0x35,0xd3,0x4d,0xfb,0x4e,0x65,0x3d,0x3d,0x8f,0xc1,0xfd,0xeb,0x6d,0x7e,0xfb,
+	0x2d,0xad,0xb9,0xe4,0x57,0x7c,0xd7,0x93,0xde,0x3a,0xaf,0x3f,0xea,0xdd,0x0c,0x2f,
+	0x16,0xa1,0xf1,0x50,0xb5,0x1a,0x17,0xfa,0x57,0xd9,0xb7,0x79,0xbf,0xc1,0xb7,0x76,
+	0x31,0xf7,0xb1,0x9f,0xba,0x7a,0x7a,0x55,0xbd,0x07,0x59,0xb0,0xf0,0xf6,0x91,0x06,
+	0x99,0xab,0xcf,0xf6,0x7b,0xd8,0x37,0x79,0x91,0xec,0x67,0xdb,0xb9,0x8b,0x0e,0x54,
+	0x11,0xd0,0x83,0xd6,0xa1,0xf0,0x40,0x1a,0x49,0xbe,0xfe,0xd3,0xff,0x00,0x42,0xf3,
+	0x76,0x6c,0xfb,0x47,0xee,0xf7,0xe3,0x76,0x71,0xbb,0x19,0xc6,0x47,0xe7,0x58,0x1e,
+	0x30,0xb0,0xba,0xd4,0x7c,0x41,0x75,0x75,0x61,0x6d,0x3d,0xd5,0xb4,0x9b,0x36,0x4b,
+	0x0c,0x65,0xd1,0xb0,0x80,0x1c,0x11,0xc1,0xe4,0x11,0xf8,0x57,0x5c,0x6a,0xc9,0x45,
+	0x62,0x52,0xf7,0xe5,0xa3,0x5f,0xf0,0x37,0xe8,0x8f,0x1e,0xbe,0x22,0xa5,0x08,0x7d,
+	0x7a,0x9a,0xbd,0x59,0x68,0xd7,0x44,0xbb,0xdb,0x7e,0x8b,0xaf,0x51,0xbe,0x1e,0xd0,
+	0xf5,0x0f,0x0e,0x6b,0x36,0xfa,0xae,0xb1,0x6f,0xf6,0x7b,0x0b,0x7d,0xde,0x64,0xbb,
+	0xd5,0xf6,0xee,0x52,0xa3,0x85,0x24,0x9e,0x58,0x0e,0x05,0x68,0xf8,0xc8,0x7f,0xc2,
+	0x65,0xf6,0x3f,0xf8,0x47,0x3f,0xd3,0x3e,0xc9,0xbf,0xce,0xff,0x00,0x96,0x7b,0x37,
+	0xed,0xdb,0xf7,0xf1,0x9c,0xed,0x6e,0x9e,0x95,0xbd,0xe3,0x1b,0xcb,0x5d,0x4b,0xc3,
+	0x97,0x76,0x9a,0x7d,0xcc,0x17,0x57,0x52,0x6c,0xd9,0x0c,0x12,0x07,0x76,0xc3,0xa9,
+	0x38,0x51,0xc9,0xe0,0x13,0xf8,0x56,0x2f,0xc3,0x95,0xfe,0xc5,0xfe,0xd0,0xfe,0xd7,
+	0xff,0x00,0x40,0xf3,0xbc,0xbf,0x2f,0xed,0x5f,0xba,0xdf,0x8d,0xd9,0xc6,0xec,0x67,
+	0x19,0x1f,0x98,0xae,0x95,0x18,0xc1,0xfb,0x18,0xbf,0x75,0xeb,0x7f,0xeb,0xd0,0xe4,
+	0x9e,0x1e,0x9d,0x2a,0x8b,0x2c,0x83,0xbd,0x19,0xfb,0xd2,0x97,0x54,0xfb,0x5f,0x65,
+	0xf0,0xad,0xd7,0x5f,0x42,0xff,0x00,0x86,0xf5,0x9d,0x3f,0xc3,0xba,0x35,0xbe,0x95,
+	0xac,0x5c,0x7d,0x9e,0xfe,0xdf,0x77,0x99,0x16,0xc6,0x7d,0xbb,0x98,0xb0,0xe5,0x41,
+	0x07,0x86,0x07,0x83,0x58,0x1e,0x1c,0xd1,0x2f,0xfc,0x3d,0xab,0xc1,0xa9,0xea,0xf6,
+	0xff,0x00,0x67,0xb2,0x83,0x77,0x99,0x26,0xf5,0x7d,0xbb,0x94,0xa8,0xe1,0x49,0x3d,
+	0x48,0x1d,0x2a,0x0f,0x17,0x69,0xf7,0x5a,0x97,0x88,0xee,0xee,0xf4,0xfb,0x69,0xee,
+	0xad,0x64,0xd9,0xb2,0x68,0x23,0x2e,0x8d,0x84,0x50,0x70,0xc3,0x83,0xc8,0x23,0xf0,
+	0xae,0xd7,0xc5,0x77,0x96,0xba,0x8e,0x81,0x75,0x6b,0x61,0x73,0x05,0xd5,0xcc,0x9b,
+	0x36,0x45,0x0c,0x81,0xdd,0xb0,0xe0,0x9c,0x01,0xc9,0xe0,0x13,0xf8,0x55,0x5f,0x9a,
+	0xf7,0xfb,0x3b,0x79,0xff,0x00,0x56,0x1d,0x27,0xed,0xb9,0x95,0x4d,0x3e,0xaf,0xfc,
+	0x3f,0xef,0x5b,0x6b,0xf7,0xf8,0x57,0xc3,0x6d,0xfd,0x0c,0xbf,0x12,0xe3,0xc5,0x26,
+	0xd4,0xe8,0x5f,0xe9,0x5f,0x66,0xdd,0xe6,0xff,0x00,0x06,0xdd,0xd8,0xc7,0xde,0xc6,
+	0x7e,0xe9,0xe9,0xe9,0x59,0xda,0xa2,0xf9,0x1a,0x6e,0x99,0xa7,0xcd,0xf2,0xdd,0xda,
+	0xf9,0x9e,0x6c,0x7d,0x76,0xee,0x60,0xcb,0xcf,0x43,0xc7,0xa5,0x69,0x78,0x0d,0x4e,
+	0x94,0x2f,0x7f,0xb4,0xc7,0xd8,0xfc,0xdd,0x9b,0x3e,0xd1,0xfb,0xbd,0xf8,0xdd,0x9c,
+	0x67,0x19,0xc6,0x47,0xe7,0x54,0xfc,0x4a,0xbe,0x6e,0xb7,0x35,0xc4,0x7f,0x34,0x12,
+	0xed,0xf2,0xe4,0x5e,0x55,0xf0,0xa0,0x1c,0x1e,0x87,0x07,0x8a,0xc2,0xbb,0xbd,0x3f,
+	0x68,0xf7,0x7a,0x3f,0xeb,0xe4,0x8e,0xb7,0x2e,0x7a,0x3f,0x5a,0x97,0xc7,0x3d,0x1a,
+	0xec,0x97,0x96,0xeb,0x65,0xbf,0x72,0x8d,0xba,0x74,0xad,0x28,0x12,0xaa,0x5b,0xad,
+	0x68,0xc0,0xb5,0xe5,0x4a,0x47,0xa9,0x82,0x99,0x66,0x25,0xab,0x48,0xb5,0x14,0x42,
+	0xad,0x20,0xac,0xae,0x7d,0x25,0x0a,0x9a,0x00,0x5a,0x46,0x5a,0x98,0x0a,0x6b,0x0a,
+	0xb8,0x33,0xaa,0x55,0x34,0x2a,0x48,0xb5,0x4e,0x65,0xad,0x19,0x05,0x54,0x98,0x57,
+	0x7d,0x26,0x79,0x18,0xa9,0xe8,0x65,0x4e,0xbd,0x6b,0x3e,0x74,0xad,0x69,0xd6,0xb3,
+	0xe7,0x5a,0xf5,0xa8,0x48,0xf9,0x2c,0x74,0xb7,0x32,0x66,0x4a,0xa5,0x2a,0x56,0xa4,
+	0xc9,0x54,0xe4,0x4a,0xf5,0xe8,0xc8,0xf9,0x1c,0x5b,0x33,0x9d,0x29,0x9b,0x2a,0xe3,
+	0x25,0x33,0x65,0x7a,0x10,0x91,0xe1,0xd4,0x6e,0xe4,0x28,0x95,0x66,0x24,0xa1,0x52,
+	0xac,0x44,0x95,0xaf,0x31,0xa5,0x17,0xa9,0x34,0x09,0x5a,0x16,0xe9,0xd2,0xab,0x42,
+	0x95,0xa3,0x02,0xf4,0xac,0xe5,0x23,0xe8,0xb0,0x72,0x2d,0xdb,0xa5,0x68,0xc0,0xbd,
+	0x2a,0xa5,0xba,0xd6,0x8c,0x0b,0x5c,0xd2,0x91,0xf5,0xd8,0x29,0x96,0xa1,0x5a,0xb4,
+	0x8b,0x51,0x44,0x2a,0xd2,0x0a,0xc9,0xb3,0xe9,0x68,0x54,0xd0,0xf3,0xa8,0x16,0xaf,
+	0xc2,0x2a,0xb4,0x2b,0x57,0x22,0x15,0xfc,0xf6,0xd9,0xe2,0xe1,0x6a,0x58,0xdf,0xf0,
+	0xc0,0xff,0x00,0x4d,0x7f,0xfa,0xe6,0x7f,0x98,0xa3,0x46,0xff,0x00,0x90,0x84,0x5f,
+	0x8f,0xf2,0x35,0x97,0x1d,0x6d,0x5d,0x6a,0xbf,0x69,0xb7,0x78,0xbc,0x9d,0xbb,0xb1,
+	0xce,0xec,0xf7,0xcf,0xa5,0x7b,0x58,0x1c,0x5d,0x0f,0x65,0x4d,0xd5,0x97,0x2b,0xa2,
+	0xdc,0x92,0xb3,0x7c,0xed,0xd9,0xda,0xeb,0xe1,0xf8,0x52,0xbb,0xbe,0xfe,0x47,0xb3,
+	0x0a,0xba,0x3f,0x32,0xce,0xbf,0xff,0x00,0x2c,0x3f,0xe0,0x5f,0xd2,0xad,0xe9,0x3f,
+	0xf2,0x0f,0x8b,0xf1,0xfe,0x66,0xb1,0xf4,0xfb,0xdf,0xb2,0x79,0x9f,0xbb,0xdf,0xbb,
+	0x1f,0xc5,0x8c,0x63,0x3f,0xe3,0x50,0x5e,0x4f,0xf6,0x8b,0x87,0x97,0x6e,0xdd,0xd8,
+	0xe3,0x39,0xed,0x8a,0xf5,0x69,0xe7,0x54,0x29,0x62,0x25,0x99,0x47,0x59,0xcd,0x59,
+	0xc3,0x55,0xca,0xb4,0xd7,0x9a,0xd6,0x7f,0x0a,0xd2,0xdd,0x7c,0x8a,0x94,0xfd,0xc5,
+	0x0e,0x88,0x7e,0x91,0xff,0x00,0x21,0x38,0x7f,0xe0,0x5f,0xfa,0x09,0xa9,0xbc,0x5a,
+	0x32,0x2d,0x7f,0xe0,0x7f,0xd2,0x8b,0xfd,0x57,0xed,0x36,0xaf,0x0f,0x93,0xb7,0x76,
+	0x39,0xdd,0x9e,0xf9,0xf4,0xaa,0x7a,0x6e,0xa3,0xfd,0x9f,0xe6,0xfe,0xeb,0xcc,0xdf,
+	0x8f,0xe2,0xc6,0x31,0x9f,0x6f,0x7a,0xaa,0x38,0x9c,0x2d,0x1a,0x0f,0x2f,0x8d,0x4b,
+	0xc2,0x6e,0xee,0x76,0x6a,0xcf,0x4d,0x39,0x77,0x7b,0x2d,0x6f,0xd7,0xc8,0xe5,0xaf,
+	0x59,0x3d,0xd9,0xb9,0xe1,0xde,0x34,0x7b,0x7f,0xf8,0x17,0xfe,0x84,0x6b,0x8e,0xf0,
+	0xba,0xe3,0xc4,0x36,0xa7,0xfd,0xff,0x00,0xfd,0x00,0xd4,0x9a,0xad,0xc7,0xdb,0x2f,
+	0x24,0x9f,0x66,0xcd,0xf8,0xf9,0x73,0x9c,0x60,0x01,0xfd,0x2a,0xde,0xaf,0xaf,0xfd,
+	0xba,0xc2,0x5b,0x6f,0xb2,0xec,0xdf,0x8f,0x9b,0xcc,0xce,0x30,0x41,0xe9,0x8f,0x6a,
+	0xef,0x8e,0x3a,0x85,0x5e,0x44,0xe5,0x6f,0x63,0xb6,0x8f,0xdf,0xb5,0xbf,0xf0,0x1b,
+	0xd9,0x6f,0x7d,0xfc,0x8f,0x23,0x11,0x88,0xa6,0xda,0x6d,0xdb,0x93,0x6f,0x3f,0xf2,
+	0xd8,0x6f,0xc4,0x95,0xdc,0x34,0xff,0x00,0xfb,0x69,0xff,0x00,0xb2,0xd6,0xd7,0x82,
+	0x86,0x3c,0x33,0x66,0x3f,0xdf,0xff,0x00,0xd0,0xda,0xb9,0x6d,0x0b,0x57,0xfe,0xc7,
+	0x37,0x1f,0xe8,0xfe,0x77,0x9b,0xb7,0xf8,0xf6,0xe3,0x19,0xf6,0x3e,0xb5,0x97,0xae,
+	0x5c,0xff,0x00,0x69,0x6a,0x53,0x5d,0xf9,0x7e,0x5f,0x99,0x8f,0x97,0x76,0x71,0x80,
+	0x07,0x5f,0xc2,0xbb,0x69,0xe6,0x14,0xd5,0x47,0x89,0x5a,0xca,0x5a,0x72,0xf6,0xf3,
+	0xbf,0x5d,0xbf,0x13,0xcc,0x96,0x63,0x4e,0x85,0x67,0x8c,0x5a,0xca,0x5a,0x72,0xed,
+	0x6d,0xb5,0xe6,0xb5,0x9e,0xdb,0x5b,0xaf,0x90,0xdf,0x03,0x26,0x3c,0x57,0x62,0x7f,
+	0xdf,0xff,0x00,0xd1,0x6d,0x5b,0xbf,0x14,0xd7,0x77,0xf6,0x5f,0xfd,0xb5,0xff,0x00,
+	0xd9,0x2a,0x3d,0x73,0xc5,0x07,0x53,0xd3,0x26,0xb3,0xfb,0x17,0x95,0xe6,0x6d,0xf9,
+	0xfc,0xdd,0xd8,0xc3,0x03,0xd3,0x1e,0xd5,0x43,0xc3,0x3a,0xc9,0xd0,0xfe,0xd3,0x8b,
+	0x6f,0x3f,0xce,0xdb,0xfc,0x7b,0x71,0x8c,0xfb,0x1f,0x5a,0xda,0x15,0xe9,0x46,0x1e,
+	0xc1,0x4a,0xe9,0xeb,0x7b,0x3d,0x3e,0x5f,0x2f,0xc4,0xf3,0x15,0x6c,0x35,0x2a,0x12,
+	0xcb,0xd5,0x4b,0xc2,0x6e,0xee,0x76,0x7a,0x3d,0x34,0xe5,0xdd,0xfc,0x2b,0x5b,0xf5,
+	0xf2,0x3b,0x2f,0x02,0x0d,0xbe,0x15,0xb1,0x1f,0xef,0xff,0x00,0xe8,0x6d,0x5c,0x47,
+	0x81,0xd3,0x1e,0x26,0xb3,0x3f,0xef,0xff,0x00,0xe8,0x0d,0x50,0x6b,0x37,0x5f,0xda,
+	0x7a,0xa4,0xd7,0x9e,0x57,0x95,0xe6,0x6d,0xf9,0x37,0x6e,0xc6,0x14,0x0e,0xb8,0x1e,
+	0x95,0xd0,0x6a,0xde,0x26,0x3a,0x9e,0x9d,0x2d,0xaf,0xd8,0xfc,0xbf,0x33,0x1f,0x37,
+	0x9b,0xbb,0x18,0x20,0xf4,0xc7,0xb5,0x6a,0xf1,0x34,0xe5,0x6b,0xbf,0x83,0x6f,0x3f,
+	0xf2,0xdb,0xf1,0x36,0xfa,0xed,0x0a,0xde,0xcd,0x39,0x5b,0xd8,0x7c,0x3a,0x3f,0x7e,
+	0xd6,0xf2,0xf7,0x6f,0xca,0xb7,0xbe,0xfe,0x45,0xcf,0x88,0x2b,0xb8,0xe9,0xff,0x00,
+	0xf6,0xd3,0xff,0x00,0x65,0xaa,0x17,0x6b,0xff,0x00,0x12,0x1d,0x1c,0x7a,0x79,0xdf,
+	0xfa,0x18,0xa8,0xfc,0x39,0xaa,0xff,0x00,0x64,0x89,0xff,0x00,0x71,0xe6,0xf9,0xbb,
+	0x7f,0x8f,0x6e,0x31,0x9f,0x63,0xeb,0x4b,0x7f,0x73,0xf6,0xfb,0xf9,0x2e,0x76,0x79,
+	0x7b,0xf1,0xf2,0xe7,0x38,0xc0,0x03,0xaf,0xe1,0x59,0x57,0xaf,0x09,0xa7,0x34,0xf5,
+	0x96,0x96,0xed,0xf3,0xf9,0x7e,0x27,0x5c,0xb1,0x34,0xeb,0x39,0x57,0x4f,0xde,0x9d,
+	0x93,0x8f,0x6b,0x5b,0x5b,0xf5,0xdb,0xf1,0xf2,0x19,0x02,0xd5,0xf8,0x45,0x55,0x85,
+	0x6a,0xec,0x42,0xbc,0xe6,0xce,0xfc,0x2d,0x4b,0x16,0xa2,0x15,0x65,0x2a,0xb4,0x75,
+	0x61,0x4d,0x41,0xee,0xd1,0xc4,0x59,0x12,0x8a,0x43,0x40,0x34,0x84,0xd6,0xb0,0x37,
+	0x96,0x27,0x42,0x37,0x15,0x56,0x51,0x56,0x9e,0xab,0xc9,0x5d,0xb4,0x8f,0x37,0x11,
+	0x5e,0xe5,0x09,0x96,0xa8,0xcc,0x95,0xa7,0x28,0xaa,0x72,0xa5,0x7a,0x74,0x64,0x7c,
+	0xde,0x2e,0x77,0x32,0xe5,0x4a,0xa9,0x24,0x75,0xab,0x24,0x75,0x59,0xe3,0xaf,0x4e,
+	0x94,0xcf,0x9a,0xc4,0xc6,0xe6,0x5b,0x45,0x4d,0xf2,0xab,0x41,0xa2,0xa6,0xf9,0x55,
+	0xdd,0x0a,0x87,0x93,0x3a,0x7a,0x95,0x16,0x2a,0x9e,0x38,0xea,0x75,0x8a,0xa6,0x8e,
+	0x2a,0xdb,0xda,0x17,0x4a,0x9e,0xa2,0x43,0x1d,0x5f,0x81,0x2a,0x38,0xa3,0xab,0x91,
+	0x25,0x4b,0x99,0xed,0x61,0x74,0x27,0x81,0x6b,0x42,0x11,0x55,0x61,0x5a,0xbb,0x10,
+	0xac,0xa4,0xcf,0xa5,0xc2,0xd4,0xb1,0x6a,0x21,0x56,0x52,0xab,0x47,0x56,0x10,0xd4,
+	0x1e,0xed,0x1c,0x45,0x91,0xc2,0x46,0xb5,0x66,0x3a,0x8d,0x56,0xa5,0x5a,0xfe,0x7a,
+	0xbd,0xcf,0x22,0x95,0x5e,0x52,0x74,0x35,0x2a,0x9a,0xae,0xa6,0x9e,0x1a,0xad,0x23,
+	0xb6,0x38,0xab,0x16,0x03,0x50,0x4d,0x42,0x1a,0x97,0x75,0x6d,0x14,0x53,0xc6,0x0a,
+	0xc6,0xa2,0x7a,0x79,0x34,0xc3,0x5d,0x50,0x39,0x6a,0x62,0x6e,0x40,0xe2,0xab,0xba,
+	0x55,0xc2,0x29,0x85,0x2b,0xb6,0x9c,0xac,0x79,0xd5,0xa7,0xcc,0x67,0xbc,0x75,0x13,
+	0x45,0xed,0x5a,0x26,0x3a,0x69,0x8b,0xda,0xbb,0x69,0xd4,0x3c,0xca,0xb4,0xee,0x66,
+	0x18,0x7d,0xa9,0x3c,0x9f,0x6a,0xd2,0xf2,0x7d,0xa8,0xf2,0x3d,0xab,0xae,0x35,0x4e,
+	0x47,0x40,0xcf,0x58,0x7d,0xaa,0x54,0x8b,0xda,0xae,0x88,0x7d,0xa9,0xeb,0x0f,0xb5,
+	0x6c,0xaa,0x95,0x1a,0x36,0x2b,0xc7,0x1d,0x58,0x8d,0x2a,0x45,0x8a,0xa5,0x54,0xab,
+	0xe7,0xb9,0xd9,0x49,0x72,0x8b,0x1a,0xd5,0x98,0xc5,0x46,0xab,0x52,0xad,0x3b,0xdc,
+	0xf4,0x69,0x55,0xe5,0x27,0x43,0x52,0xa9,0xaa,0xea,0x6a,0x40,0xd5,0x69,0x1d,0xb0,
+	0xc5,0x58,0x9c,0x35,0x04,0xd4,0x41,0xa8,0xdd,0x5b,0x45,0x16,0xf1,0x83,0x98,0xd4,
+	0x4f,0x4e,0x26,0x9a,0x6b,0xaa,0x07,0x2d,0x4c,0x4d,0xc8,0x1c,0x54,0x0e,0x95,0x6c,
+	0x8a,0x8c,0xa5,0x76,0xd3,0x95,0x8f,0x36,0xb4,0xf9,0x8a,0x0f,0x1d,0x42,0xd1,0x7b,
+	0x56,0x91,0x8e,0x9a,0x62,0xf6,0xae,0xda,0x75,0x0f,0x36,0xac,0x2e,0x66,0x18,0x7d,
+	0xa9,0x3c,0x9f,0x6a,0xd2,0xf2,0x7d,0xa8,0xf2,0x3d,0xab,0xae,0x15,0x4e,0x49,0x50,
+	0x33,0xc4,0x3e,0xd5,0x22,0x45,0xed,0x57,0x84,0x3e,0xd4,0xe5,0x87,0xda,0xb6,0x55,
+	0x47,0x1a,0x36,0x2b,0xa4,0x75,0x62,0x34,0xa9,0x56,0x2f,0x6a,0x95,0x52,0xaf,0x9e,
+	0xe7,0x65,0x28,0xf2,0x84,0x6b,0x56,0x63,0x15,0x1a,0xad,0x4a,0xb4,0xef,0x73,0xd0,
+	0xa5,0x57,0x94,0x9d,0x2a,0x65,0x35,0x5d,0x4d,0x3c,0x35,0x5a,0x47,0x74,0x31,0x56,
+	0x3f,0xff,0xd9
+};
+
+#endif
@@ -0,0 +1,443 @@
+//////////////////////////////////
+// htcw_gfx_bench
+// Times the draw:: primitives,
+// canvas rendering, SVG and TVG,
+// and the image decoders across
+// destination pixel formats and
+// sizes, and writes the results
+// as JSON
+//////////////////////////////////
+// usage: htcw_gfx_bench [--time <ms>] [--filter <text>] [--out <file>]
+//   --time    the minimum time to spend on each case (default 100)
+//   --filter  only run cases whose name or format contains text
+//   --out     write the JSON there instead of to stdout
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <gfx.hpp>
+
+#ifndef PROGMEM
+#define PROGMEM
+#endif
+#define SHARETECH_REGULAR_TTF_IMPLEMENTATION
+#include "assets/ShareTech_Regular_ttf.h"
+#define VGA_8X8_IMPLEMENTATION
+#include "assets/vga_8x8.h"
+#define SVG_SVG_IMPLEMENTATION
+#include "assets/svg_svg.h"
+#define CAT_PNG_IMPLEMENTATION
+#include "assets/cat_png.h"
+#define BENCH_JPG_IMPLEMENTATION
+#include "assets/bench_jpg.h"
+
+#ifndef HTCW_GFX_BENCH_VERSION
+#define HTCW_GFX_BENCH_VERSION "unknown"
+#endif
+
+using namespace gfx;
+
+// counts what goes through the allocators handed to the library.
+// each block is prefixed with its size so it can be accounted for when freed
+typedef struct {
+    size_t allocations;
+    size_t current;
+    size_t peak;
+} bench_heap_t;
+static bench_heap_t bench_heap = {0, 0, 0};
+constexpr static const size_t bench_header_size = 16;
+static void* bench_allocate(size_t size) {
+    uint8_t* p = (uint8_t*)::malloc(size + bench_header_size);
+    if (p == nullptr) {
+        return nullptr;
+    }
+    *(size_t*)p = size;
+    ++bench_heap.allocations;
+    bench_heap.current += size;
+    if (bench_heap.current > bench_heap.peak) {
+        bench_heap.peak = bench_heap.current;
+    }
+    return p + bench_header_size;
+}
+static void bench_deallocate(void* ptr) {
+    if (ptr == nullptr) {
+        return;
+    }
+    uint8_t* p = ((uint8_t*)ptr) - bench_header_size;
+    bench_heap.current -= *(size_t*)p;
+    ::free(p);
+}
+static void* bench_reallocate(void* ptr, size_t size) {
+    if (ptr == nullptr) {
+        return bench_allocate(size);
+    }
+    uint8_t* p = ((uint8_t*)ptr) - bench_header_size;
+    const size_t old_size = *(size_t*)p;
+    p = (uint8_t*)::realloc(p, size + bench_header_size);
+    if (p == nullptr) {
+        return nullptr;
+    }
+    *(size_t*)p = size;
+    ++bench_heap.allocations;
+    bench_heap.current = bench_heap.current - old_size + size;
+    if (bench_heap.current > bench_heap.peak) {
+        bench_heap.peak = bench_heap.current;
+    }
+    return p + bench_header_size;
+}
+
+// the shared inputs, set up once
+typedef struct {
+    const_buffer_stream ttf_stream;
+    const_buffer_stream win_stream;
+    const_buffer_stream vlw_stream;
+    const_buffer_stream svg_stream;
+    const_buffer_stream tvg_stream;
+    const_buffer_stream png_stream;
+    const_buffer_stream jpg_stream;
+    tt_font ttf;
+    win_font win;
+    vlw_font vlw;
+    png_image png;
+    jpg_image jpg;
+    sizef svg_size;
+    sizef tvg_size;
+    bitmap<rgb_pixel<16>> source;
+    uint8_t* vlw_data;
+    uint8_t* tvg_data;
+} bench_assets_t;
+static bench_assets_t assets;
+
+static const char* bench_text = "The quick brown fox jumps over the lazy dog. 0123456789 !@#$%^&*() Pack my box with five dozen liquor jugs.";
+
+static void write_uint32_be(uint8_t* p, uint32_t value) {
+    p[0] = (uint8_t)(value >> 24);
+    p[1] = (uint8_t)(value >> 16);
+    p[2] = (uint8_t)(value >> 8);
+    p[3] = (uint8_t)value;
+}
+// there's no VLW font to hand, so one is made from the TrueType font: each glyph is a full
+// line high cell holding the glyph's coverage
+static gfx_result build_vlw(const font& source, uint8_t** out_data, size_t* out_size) {
+    constexpr static const int first = 33, last = 126, count = last - first + 1;
+    const uint16_t height = source.line_height();
+    uint16_t widths[count];
+    size_t size = 24 + 28 * count;
+    for (int i = 0; i < count; ++i) {
+        const char sz[2] = {(char)(first + i), 0};
+        size16 area;
+        gfx_result res = source.measure(uint16_t(-1), sz, &area);
+        if (res != gfx_result::success) {
+            return res;
+        }
+        widths[i] = area.width;
+        size += area.width * height;
+    }
+    uint8_t* data = (uint8_t*)::malloc(size);
+    if (data == nullptr) {
+        return gfx_result::out_of_memory;
+    }
+    write_uint32_be(data, count);
+    write_uint32_be(data + 4, 11);
+    write_uint32_be(data + 8, height);
+    write_uint32_be(data + 12, 0);
+    write_uint32_be(data + 16, source.base_line());
+    write_uint32_be(data + 20, height - source.base_line());
+    uint8_t* glyph = data + 24;
+    uint8_t* pixels = data + 24 + 28 * count;
+    for (int i = 0; i < count; ++i) {
+        write_uint32_be(glyph, first + i);
+        write_uint32_be(glyph + 4, height);
+        write_uint32_be(glyph + 8, widths[i]);
+        write_uint32_be(glyph + 12, widths[i]);
+        write_uint32_be(glyph + 16, height);
+        write_uint32_be(glyph + 20, 0);
+        write_uint32_be(glyph + 24, 0);
+        glyph += 28;
+        bitmap<gsc_pixel<8>> cell(size16(widths[i], height), pixels);
+        cell.fill(cell.bounds(), color<gsc_pixel<8>>::black);
+        const char sz[2] = {(char)(first + i), 0};
+        draw::text(cell, (srect16)cell.bounds(), text_info(sz, source), color<gsc_pixel<8>>::white);
+        pixels += widths[i] * height;
+    }
+    *out_data = data;
+    *out_size = size;
+    return gfx_result::success;
+}
+static gfx_result load_assets() {
+    assets.ttf_stream.set(ShareTech_Regular_ttf, sizeof(ShareTech_Regular_ttf));
+    assets.win_stream.set(vga_8x8, sizeof(vga_8x8));
+    assets.svg_stream.set(svg_svg, sizeof(svg_svg));
+    assets.png_stream.set(cat_png, sizeof(cat_png));
+    assets.jpg_stream.set(bench_jpg, sizeof(bench_jpg));
+    // glyphs are rendered through the font's allocators, so they count toward the text cases
+    assets.ttf = tt_font(assets.ttf_stream, 20, font_size_units::px, false, bench_allocate, bench_reallocate, bench_deallocate);
+    gfx_result res = assets.ttf.initialize();
+    if (res != gfx_result::success) {
+        return res;
+    }
+    assets.win = win_font(assets.win_stream);
+    res = assets.win.initialize();
+    if (res != gfx_result::success) {
+        return res;
+    }
+    size_t vlw_size;
+    res = build_vlw(assets.ttf, &assets.vlw_data, &vlw_size);
+    if (res != gfx_result::success) {
+        return res;
+    }
+    assets.vlw_stream.set(assets.vlw_data, vlw_size);
+    assets.vlw = vlw_font(assets.vlw_stream);
+    res = assets.vlw.initialize();
+    if (res != gfx_result::success) {
+        return res;
+    }
+    res = canvas::svg_dimensions(assets.svg_stream, &assets.svg_size);
+    if (res != gfx_result::success) {
+        return res;
+    }
+    // the TVG is converted from the SVG
+    constexpr static const size_t tvg_capacity = 256 * 1024;
+    assets.tvg_data = (uint8_t*)::malloc(tvg_capacity);
+    if (assets.tvg_data == nullptr) {
+        return gfx_result::out_of_memory;
+    }
+    buffer_stream tvg_out(assets.tvg_data, tvg_capacity);
+    assets.svg_stream.seek(0);
+    res = svg_to_tvg(assets.svg_stream, tvg_out);
+    if (res != gfx_result::success) {
+        return res;
+    }
+    assets.tvg_stream.set(assets.tvg_data, (size_t)tvg_out.seek(0, seek_origin::current));
+    res = canvas::tvg_dimensions(assets.tvg_stream, &assets.tvg_size);
+    if (res != gfx_result::success) {
+        return res;
+    }
+    assets.png = png_image(assets.png_stream, false, bench_allocate, bench_reallocate, bench_deallocate);
+    res = assets.png.initialize();
+    if (res != gfx_result::success) {
+        return res;
+    }
+    assets.jpg = jpg_image(assets.jpg_stream, jpg_scale::scale_1_1, false, bench_allocate, bench_reallocate, bench_deallocate);
+    res = assets.jpg.initialize();
+    if (res != gfx_result::success) {
+        return res;
+    }
+    // the source for bitmap copies and resizes
+    const size16 source_size(128, 128);
+    assets.source = bitmap<rgb_pixel<16>>(source_size, ::malloc(bitmap<rgb_pixel<16>>::sizeof_buffer(source_size)));
+    if (assets.source.begin() == nullptr) {
+        return gfx_result::out_of_memory;
+    }
+    for (int y = 0; y < source_size.height; ++y) {
+        for (int x = 0; x < source_size.width; ++x) {
+            assets.source.point(point16(x, y), rgb_pixel<16>(x >> 2, (x + y) >> 2, y >> 2));
+        }
+    }
+    return gfx_result::success;
+}
+static void free_assets() {
+    ::free(assets.source.begin());
+    ::free(assets.vlw_data);
+    ::free(assets.tvg_data);
+}
+
+static double bench_min_ms = 100;
+static const char* bench_filter = nullptr;
+static FILE* bench_out = stdout;
+static bool bench_first = true;
+static size_t bench_failures = 0;
+
+static double now_ms() {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+// runs callback until enough time has passed, and writes a result.
+// pixels is the number of destination pixels one call covers
+template <typename Callback>
+static void run(const char* name, const char* format, size16 size, size_t pixels, Callback callback) {
+    if (bench_filter != nullptr && strstr(name, bench_filter) == nullptr && strstr(format, bench_filter) == nullptr) {
+        return;
+    }
+    // warm up, which also fills any caches
+    gfx_result res = callback();
+    const size_t start_allocations = bench_heap.allocations;
+    const size_t start_bytes = bench_heap.current;
+    bench_heap.peak = bench_heap.current;
+    size_t iterations = 0;
+    const double start = now_ms();
+    double elapsed = 0;
+    while (res == gfx_result::success && (iterations == 0 || elapsed < bench_min_ms)) {
+        res = callback();
+        ++iterations;
+        elapsed = now_ms() - start;
+    }
+    fprintf(bench_out, "%s\n    {\"name\": \"%s\", \"format\": \"%s\", \"width\": %d, \"height\": %d, ",
+            bench_first ? "" : ",", name, format, (int)size.width, (int)size.height);
+    bench_first = false;
+    if (res != gfx_result::success) {
+        ++bench_failures;
+        fprintf(bench_out, "\"error\": %d}", (int)res);
+        return;
+    }
+    const double ms = elapsed / iterations;
+    fprintf(bench_out, "\"iterations\": %d, \"ms\": %.4f, \"mpixels_per_sec\": %.3f, \"allocations\": %.1f, \"peak_bytes\": %d}",
+            (int)iterations, ms, pixels / (ms * 1000.0), (double)(bench_heap.allocations - start_allocations) / iterations,
+            (int)(bench_heap.peak - start_bytes));
+}
+static gfx_result render_document(canvas& cvs, stream& document, sizef document_size, bool tvg) {
+    const sizef dim = (sizef)cvs.dimensions();
+    const float scale = math::min_(dim.width / document_size.width, dim.height / document_size.height);
+    const matrix transform = matrix::create_scale(scale, scale);
+    document.seek(0);
+    if (tvg) {
+        return cvs.render_tvg(document, transform, bench_allocate, bench_reallocate, bench_deallocate);
+    }
+    return cvs.render_svg(document, transform, 96.f, bench_allocate, bench_reallocate, bench_deallocate);
+}
+template <typename Bitmap>
+static void bench_size(Bitmap& bmp, const char* format) {
+    using color_t = color<rgba_pixel<32>>;
+    using vcolor_t = color<vector_pixel>;
+    const size16 size = bmp.dimensions();
+    const int16_t w = size.width, h = size.height;
+    const srect16 full = (srect16)bmp.bounds();
+    const srect16 inner = full.inflate(-w / 8, -h / 8);
+    const size_t area = size.area(), inner_area = inner.area();
+    mask_draw_cache cache(bench_allocate, bench_reallocate, bench_deallocate);
+    // a five pointed star across the inner area
+    spoint16 star[10];
+    const spoint16 center((inner.x1 + inner.x2) / 2, (inner.y1 + inner.y2) / 2);
+    for (int i = 0; i < 10; ++i) {
+        const float radius = ((i & 1) ? .4f : 1.f) * inner.height() / 2;
+        const float angle = math::pi * 2 * i / 10 - math::pi / 2;
+        star[i] = spoint16(center.x + radius * cosf(angle), center.y + radius * sinf(angle));
+    }
+    const spath16 star_path(10, star);
+    run("filled_rectangle", format, size, area, [&] { return draw::filled_rectangle(bmp, full, color_t::dark_slate_gray); });
+    run("filled_rectangle_alpha", format, size, inner_area, [&] { return draw::filled_rectangle(bmp, inner, color_t::red.opacity(.5f)); });
+    run("filled_polygon", format, size, inner_area, [&] { return draw::filled_polygon(bmp, star_path, color_t::gold); });
+    run("aa_filled_polygon", format, size, inner_area, [&] { return draw::aa_filled_polygon(bmp, star_path, vcolor_t::gold, fill_rule::non_zero, &cache); });
+    run("aa_polygon", format, size, inner_area, [&] { return draw::aa_polygon(bmp, star_path, vcolor_t::white, 3, line_join::miter, 4, &cache); });
+    run("aa_line", format, size, area, [&] { return draw::aa_line(bmp, full, vcolor_t::white, 4, line_cap::round, &cache); });
+    run("aa_arc", format, size, inner_area, [&] { return draw::aa_arc(bmp, inner, vcolor_t::cyan, 30, 300, 8, line_cap::round, &cache); });
+    run("aa_filled_arc", format, size, inner_area, [&] { return draw::aa_filled_arc(bmp, inner, vcolor_t::cyan, 30, 300, &cache); });
+    run("filled_rounded_rectangle", format, size, inner_area, [&] { return draw::filled_rounded_rectangle(bmp, inner, .2f, color_t::green); });
+    run("aa_rounded_rectangle", format, size, inner_area, [&] { return draw::aa_rounded_rectangle(bmp, inner, vcolor_t::green, h / 8, 3, &cache); });
+    run("aa_filled_rounded_rectangle", format, size, inner_area, [&] { return draw::aa_filled_rounded_rectangle(bmp, inner, vcolor_t::green, h / 8, &cache); });
+    // text blends in the destination's pixel format, so it can't draw to indexed formats
+    if constexpr (!Bitmap::pixel_type::template has_channel_names<channel_name::index>::value) {
+        run("text_tt_font", format, size, area, [&] { return draw::text(bmp, full, text_info(bench_text, assets.ttf), color_t::white, nullptr, bench_allocate, bench_reallocate, bench_deallocate); });
+        run("text_vlw_font", format, size, area, [&] { return draw::text(bmp, full, text_info(bench_text, assets.vlw), color_t::white, nullptr, bench_allocate, bench_reallocate, bench_deallocate); });
+        run("text_win_font", format, size, area, [&] { return draw::text(bmp, full, text_info(bench_text, assets.win), color_t::white, nullptr, bench_allocate, bench_reallocate, bench_deallocate); });
+    }
+    const srect16 copy_rect = srect16(spoint16::zero(), (ssize16)assets.source.dimensions()).crop(full);
+    run("bitmap_copy", format, size, copy_rect.area(), [&] { return draw::bitmap(bmp, copy_rect, assets.source, assets.source.bounds()); });
+    run("bitmap_resize_fast", format, size, area, [&] { return draw::bitmap(bmp, full, assets.source, assets.source.bounds(), bitmap_resize::resize_fast); });
+    run("bitmap_resize_bilinear", format, size, area, [&] { return draw::bitmap(bmp, full, assets.source, assets.source.bounds(), bitmap_resize::resize_bilinear); });
+    canvas cvs(size, bench_allocate, bench_reallocate, bench_deallocate);
+    if (cvs.initialize() != gfx_result::success || draw::canvas(bmp, cvs) != gfx_result::success) {
+        ++bench_failures;
+        fprintf(stderr, "Unable to bind a canvas for %s\n", format);
+        return;
+    }
+    const rectf inner_f = (rectf)inner;
+    run("canvas_fill", format, size, inner_area, [&] {
+        cvs.fill_paint_type(paint_type::solid);
+        cvs.stroke_paint_type(paint_type::none);
+        cvs.fill_color(vcolor_t::purple.opacity(.8f));
+        cvs.ellipse({(inner_f.x1 + inner_f.x2) / 2, (inner_f.y1 + inner_f.y2) / 2}, {inner_f.width() / 2, inner_f.height() / 2});
+        return cvs.render(false, bench_allocate, bench_reallocate, bench_deallocate);
+    });
+    run("canvas_stroke", format, size, inner_area, [&] {
+        cvs.fill_paint_type(paint_type::none);
+        cvs.stroke_paint_type(paint_type::solid);
+        cvs.stroke_color(vcolor_t::orange);
+        cvs.stroke_width(5);
+        cvs.stroke_line_join(line_join::round);
+        cvs.rounded_rectangle(inner_f, {inner_f.height() / 6, inner_f.height() / 6});
+        return cvs.render(false, bench_allocate, bench_reallocate, bench_deallocate);
+    });
+    gradient_stop stops[] = {{0, vcolor_t::red}, {.5f, vcolor_t::yellow}, {1, vcolor_t::blue}};
+    gradient grad;
+    grad.type = gradient_type::linear;
+    grad.spread = spread_method::pad;
+    grad.transform = matrix::create_identity();
+    grad.linear.x1 = inner_f.x1;
+    grad.linear.y1 = inner_f.y1;
+    grad.linear.x2 = inner_f.x2;
+    grad.linear.y2 = inner_f.y2;
+    grad.stops = stops;
+    grad.stops_size = 3;
+    run("canvas_gradient", format, size, inner_area, [&] {
+        cvs.fill_paint_type(paint_type::gradient);
+        cvs.stroke_paint_type(paint_type::none);
+        cvs.fill_gradient(grad);
+        cvs.rectangle(inner_f);
+        return cvs.render(false, bench_allocate, bench_reallocate, bench_deallocate);
+    });
+    cvs.fill_paint_type(paint_type::solid);
+    run("svg_render", format, size, area, [&] { return render_document(cvs, assets.svg_stream, assets.svg_size, false); });
+    run("tvg_render", format, size, area, [&] { return render_document(cvs, assets.tvg_stream, assets.tvg_size, true); });
+    const size_t png_area = ((srect16)assets.png.dimensions().bounds()).crop(full).area();
+    run("png_decode", format, size, png_area, [&] { assets.png_stream.seek(0); return draw::image(bmp, full, assets.png); });
+    const size_t jpg_area = ((srect16)assets.jpg.dimensions().bounds()).crop(full).area();
+    run("jpg_decode", format, size, jpg_area, [&] { assets.jpg_stream.seek(0); return draw::image(bmp, full, assets.jpg); });
+}
+template <typename PixelType, typename PaletteType = palette<PixelType, PixelType>>
+static void bench_format(const char* format, const PaletteType* pal = nullptr) {
+    const size16 sizes[] = {{128, 128}, {320, 240}, {800, 480}};
+    for (const size16& size : sizes) {
+        using bmp_t = bitmap<PixelType, PaletteType>;
+        bmp_t bmp(size, ::malloc(bmp_t::sizeof_buffer(size)), pal);
+        if (bmp.begin() == nullptr) {
+            ++bench_failures;
+            fprintf(stderr, "Out of memory for %s %dx%d\n", format, (int)size.width, (int)size.height);
+            continue;
+        }
+        bmp.clear(bmp.bounds());
+        bench_size(bmp, format);
+        ::free(bmp.begin());
+    }
+}
+int main(int argc, char** argv) {
+    const char* out_path = nullptr;
+    for (int i = 1; i < argc; ++i) {
+        if (0 == strcmp(argv[i], "--time") && i + 1 < argc) {
+            bench_min_ms = atof(argv[++i]);
+        } else if (0 == strcmp(argv[i], "--filter") && i + 1 < argc) {
+            bench_filter = argv[++i];
+        } else if (0 == strcmp(argv[i], "--out") && i + 1 < argc) {
+            out_path = argv[++i];
+        } else {
+            fprintf(stderr, "Usage: %s [--time <ms>] [--filter <text>] [--out <file>]\n", argv[0]);
+            return 1;
+        }
+    }
+    const gfx_result res = load_assets();
+    if (res != gfx_result::success) {
+        fprintf(stderr, "Unable to load the assets (%d)\n", (int)res);
+        return 1;
+    }
+    if (out_path != nullptr) {
+        bench_out = fopen(out_path, "w");
+        if (bench_out == nullptr) {
+            fprintf(stderr, "Unable to open %s\n", out_path);
+            return 1;
+        }
+    }
+    fprintf(bench_out, "{\n  \"library\": \"htcw_gfx\",\n  \"version\": \"%s\",\n  \"min_ms\": %.1f,\n  \"results\": [", HTCW_GFX_BENCH_VERSION, bench_min_ms);
+    bench_format<rgb_pixel<16>>("rgb565");
+    bench_format<rgb_pixel<24>>("rgb888");
+    bench_format<rgba_pixel<32>>("rgba8888");
+    bench_format<gsc_pixel<8>>("gsc8");
+    const ega_palette<rgb_pixel<24>> ega;
+    bench_format<indexed_pixel<4>>("indexed4_ega", &ega);
+    bench_format<gsc_pixel<1>>("mono");
+    fprintf(bench_out, "\n  ]\n}\n");
+    if (bench_out != stdout) {
+        fclose(bench_out);
+    }
+    free_assets();
+    return bench_failures == 0 ? 0 : 2;
+}
@@ -0,0 +1,159 @@
+//////////////////////////////////
+// EXAMPLE
+// Uses htcw_gfx on Linux to
+// show how much heap a frame
+// takes, and what for
+// usage: allocation_tracker
+//   [font.ttf] [image.jpg]
+//   [document.svg]
+//////////////////////////////////
+
+// the size of the frame
+#define WIDTH 320
+#define HEIGHT 240
+
+#include <stdio.h>
+#include <stdlib.h>
+// graphics library codewitch-honey-crisis/htcw_gfx
+#include <gfx.hpp>
+
+// import the htcw_gfx graphics library namespace
+using namespace gfx;
+
+using bitmap_t = bitmap<rgb_pixel<16>>;
+using color_t = color<rgb_pixel<16>>;
+using vcolor_t = color<vector_pixel>;
+
+// shorthand for a tag's allocator triple
+#define TRACKED(tag) \
+    allocation_tracker::allocator(allocation_tag::tag), \
+    allocation_tracker::reallocator(allocation_tag::tag), \
+    allocation_tracker::deallocator(allocation_tag::tag)
+
+static gfx_result draw_text(bitmap_t& frame, const char* path) {
+    file_stream file(path);
+    if (!file.caps().read) {
+        printf("Unable to open %s\n", path);
+        return gfx_result::success;
+    }
+    tt_font font(file, 24, font_size_units::px, false, TRACKED(font));
+    gfx_result res = font.initialize();
+    if (res != gfx_result::success) {
+        return res;
+    }
+    // the draw cache holds rendered glyphs, so it counts as raster memory
+    font_draw_cache cache(TRACKED(raster));
+    res = cache.initialize();
+    if (res != gfx_result::success) {
+        return res;
+    }
+    text_info ti("Hello world!", font);
+    ti.draw_cache = &cache;
+    // glyphs that miss the cache are rendered into a scratch buffer
+    res = draw::text(frame, frame.bounds().offset(10, 10), ti, color_t::white, nullptr, TRACKED(raster));
+    if (res != gfx_result::success) {
+        return res;
+    }
+    return draw::text(frame, frame.bounds().offset(10, 40), ti, color_t::yellow, nullptr, TRACKED(raster));
+}
+static gfx_result draw_jpg(bitmap_t& frame, const char* path) {
+    file_stream file(path);
+    if (!file.caps().read) {
+        printf("Unable to open %s\n", path);
+        return gfx_result::success;
+    }
+    jpg_image img(file, jpg_scale::scale_1_1, false, TRACKED(image));
+    const gfx_result res = img.initialize();
+    if (res != gfx_result::success) {
+        return res;
+    }
+    return draw::image(frame, frame.bounds(), img);
+}
+static gfx_result draw_svg(bitmap_t& frame, const char* path) {
+    file_stream file(path);
+    if (!file.caps().read) {
+        printf("Unable to open %s\n", path);
+        return gfx_result::success;
+    }
+    canvas cvs((size16)frame.dimensions(), TRACKED(canvas));
+    gfx_result res = cvs.initialize();
+    if (res != gfx_result::success) {
+        return res;
+    }
+    res = draw::canvas(frame, cvs);
+    if (res != gfx_result::success) {
+        return res;
+    }
+    sizef dim;
+    res = canvas::svg_dimensions(file, &dim);
+    if (res != gfx_result::success) {
+        return res;
+    }
+    // compile the document so the display list is charged to svg
+    svg_document doc(TRACKED(svg));
+    res = doc.compile(file);
+    if (res != gfx_result::success) {
+        return res;
+    }
+    const matrix fit = matrix::create_fit_to(dim, (rectf)frame.bounds());
+    return doc.render(cvs, fit, TRACKED(svg));
+}
+static gfx_result draw_shapes(bitmap_t& frame) {
+    canvas cvs((size16)frame.dimensions(), TRACKED(canvas));
+    gfx_result res = cvs.initialize();
+    if (res != gfx_result::success) {
+        return res;
+    }
+    res = draw::canvas(frame, cvs);
+    if (res != gfx_result::success) {
+        return res;
+    }
+    canvas_style si = cvs.style();
+    si.fill_paint_type = paint_type::solid;
+    si.stroke_paint_type = paint_type::solid;
+    si.fill_color = vcolor_t::purple;
+    si.stroke_color = vcolor_t::white;
+    si.stroke_width = 3;
+    cvs.style(si);
+    res = cvs.circle(pointf(WIDTH / 2, HEIGHT / 2), HEIGHT / 3);
+    if (res != gfx_result::success) {
+        return res;
+    }
+    return cvs.render();
+}
+int main(int argc, char** argv) {
+    // the frame buffer is raster memory too
+    bitmap_t frame = create_bitmap<rgb_pixel<16>>({WIDTH, HEIGHT}, allocation_tracker::allocator(allocation_tag::raster));
+    if (frame.begin() == nullptr) {
+        puts("Out of memory");
+        return 1;
+    }
+    gfx_result res = draw::filled_rectangle(frame, frame.bounds(), color_t::black);
+    if (res == gfx_result::success) {
+        res = draw_shapes(frame);
+    }
+    if (res == gfx_result::success && argc > 1) {
+        res = draw_text(frame, argv[1]);
+    }
+    if (res == gfx_result::success && argc > 2) {
+        res = draw_jpg(frame, argv[2]);
+    }
+    if (res == gfx_result::success && argc > 3) {
+        res = draw_svg(frame, argv[3]);
+    }
+    if (res != gfx_result::success) {
+        printf("Drawing failed with %d\n", (int)res);
+        return 1;
+    }
+    allocation_tracker::deallocator(allocation_tag::raster)(frame.begin());
+    // everything has been freed by now, so current should read 0 and peak
+    // shows the most each part needed at once
+    static uint8_t text[4096];
+    buffer_stream out(text, sizeof(text));
+    if (allocation_tracker::dump(out) != gfx_result::success) {
+        puts("The dump didn't fit");
+        return 1;
+    }
+    fwrite(text, 1, (size_t)out.seek(0, seek_origin::current), stdout);
+    return 0;
+}
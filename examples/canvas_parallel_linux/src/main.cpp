@@ -0,0 +1,149 @@
+//////////////////////////////////
+// EXAMPLE
+// Uses htcw_gfx on Linux to
+// benchmark multithreaded canvas
+// rendering across band and
+// thread counts, and checks the
+// result against a single canvas
+//////////////////////////////////
+
+// the size of the frame
+#define WIDTH 1280
+#define HEIGHT 800
+// the number of paths in the scene
+#define PATH_COUNT 60
+// the number of frames to average
+#define FRAMES 5
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+// graphics library codewitch-honey-crisis/htcw_gfx
+#include <gfx.hpp>
+
+// import the htcw_gfx graphics library namespace
+using namespace gfx;
+
+using frame_t = bitmap<rgb_pixel<16>>;
+
+// the scene is shared by every band, and only read
+typedef struct {
+    canvas_path paths[PATH_COUNT];
+    vector_pixel fills[PATH_COUNT];
+    vector_pixel strokes[PATH_COUNT];
+    float widths[PATH_COUNT];
+} scene_t;
+
+static scene_t scene;
+
+static float rand_float(float min, float max) {
+    return min + (max - min) * (rand() / (float)RAND_MAX);
+}
+static vector_pixel rand_color(uint8_t alpha) {
+    return vector_pixel(alpha, rand() & 255, rand() & 255, rand() & 255);
+}
+static gfx_result build_scene() {
+    srand(1);
+    for (int i = 0; i < PATH_COUNT; ++i) {
+        canvas_path& path = scene.paths[i];
+        gfx_result res = path.initialize();
+        if (res != gfx_result::success) {
+            return res;
+        }
+        path.move_to({rand_float(-100, WIDTH + 100), rand_float(-100, HEIGHT + 100)});
+        const int count = 2 + rand() % 6;
+        for (int j = 0; j < count; ++j) {
+            path.cubic_to({rand_float(-100, WIDTH + 100), rand_float(-100, HEIGHT + 100)},
+                          {rand_float(-100, WIDTH + 100), rand_float(-100, HEIGHT + 100)},
+                          {rand_float(-100, WIDTH + 100), rand_float(-100, HEIGHT + 100)});
+        }
+        path.close();
+        scene.fills[i] = rand_color(160);
+        scene.strokes[i] = rand_color(230);
+        scene.widths[i] = rand_float(1, 9);
+    }
+    return gfx_result::success;
+}
+// called once per band. the canvas is clipped to the band
+static gfx_result draw_scene(canvas& cvs, const srect16& band, void* state) {
+    const scene_t& s = *(const scene_t*)state;
+    cvs.fill_paint_type(paint_type::solid);
+    cvs.stroke_paint_type(paint_type::none);
+    cvs.fill_color(color<vector_pixel>::black);
+    cvs.rectangle(rectf(0, 0, WIDTH, HEIGHT));
+    gfx_result res = cvs.render();
+    if (res != gfx_result::success) {
+        return res;
+    }
+    cvs.stroke_paint_type(paint_type::solid);
+    for (int i = 0; i < PATH_COUNT; ++i) {
+        cvs.fill_color(s.fills[i]);
+        cvs.stroke_color(s.strokes[i]);
+        cvs.stroke_width(s.widths[i]);
+        cvs.path(s.paths[i]);
+        res = cvs.render();
+        if (res != gfx_result::success) {
+            return res;
+        }
+    }
+    return gfx_result::success;
+}
+static double now_ms() {
+    return std::chrono::duration<double, std::milli>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+int main(int argc, char** argv) {
+    const size16 size(WIDTH, HEIGHT);
+    frame_t reference(size, malloc(frame_t::sizeof_buffer(size)));
+    frame_t frame(size, malloc(frame_t::sizeof_buffer(size)));
+    if (reference.begin() == nullptr || frame.begin() == nullptr) {
+        puts("Out of memory");
+        return 1;
+    }
+    if (build_scene() != gfx_result::success) {
+        puts("Unable to build the scene");
+        return 1;
+    }
+    // render with a single canvas for reference
+    canvas cvs(size);
+    if (cvs.initialize() != gfx_result::success ||
+        draw::canvas(reference, cvs) != gfx_result::success) {
+        puts("Unable to initialize the canvas");
+        return 1;
+    }
+    double start = now_ms();
+    for (int i = 0; i < FRAMES; ++i) {
+        draw_scene(cvs, (srect16)cvs.bounds(), &scene);
+    }
+    const double single = (now_ms() - start) / FRAMES;
+    printf("%dx%d, %d paths, %d cores\n", WIDTH, HEIGHT, PATH_COUNT, (int)canvas_thread_count());
+    printf("single canvas: %.2f ms\n", single);
+    printf("bands threads       ms speedup exact\n");
+    const size_t band_counts[] = {1, 2, 4, 8, 16, 32};
+    const size_t thread_counts[] = {1, 2, 4, 8};
+    for (size_t bands : band_counts) {
+        for (size_t threads : thread_counts) {
+            if (threads > bands) {
+                continue;
+            }
+            memset(frame.begin(), 0, frame.size_bytes());
+            gfx_result res = gfx_result::success;
+            start = now_ms();
+            for (int i = 0; res == gfx_result::success && i < FRAMES; ++i) {
+                res = draw::canvas_parallel(frame, size, spoint16::zero(), bands, draw_scene, &scene, threads);
+            }
+            const double ms = (now_ms() - start) / FRAMES;
+            if (res != gfx_result::success) {
+                printf("%5d %7d failed with %d\n", (int)bands, (int)threads, (int)res);
+                continue;
+            }
+            const bool exact = 0 == memcmp(reference.begin(), frame.begin(), frame.size_bytes());
+            printf("%5d %7d %8.2f %6.2fx %s\n", (int)bands, (int)threads, ms, single / ms, exact ? "yes" : "NO");
+        }
+    }
+    free(reference.begin());
+    free(frame.begin());
+    return 0;
+}
@@ -0,0 +1,110 @@
+//////////////////////////////////
+// EXAMPLE
+// Uses htcw_gfx on Linux to
+// benchmark a flush_pipeline over
+// a simulated SPI bus across
+// buffer counts and strip sizes,
+// and checks what arrives
+//////////////////////////////////
+
+// the size of the display
+#define WIDTH 320
+#define HEIGHT 240
+// the simulated bus: 40MHz SPI
+#define BUS_BYTES_PER_SECOND (40000000 / 8)
+#define BUS_LATENCY_US 20
+// the number of frames to average
+#define FRAMES 10
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+// graphics library codewitch-honey-crisis/htcw_gfx
+#include <gfx.hpp>
+
+// import the htcw_gfx graphics library namespace
+using namespace gfx;
+
+using frame_t = bitmap<rgb_pixel<16>>;
+
+// what the "display" received
+static frame_t display;
+
+// renders a strip of the scene into a transfer buffer
+static gfx_result render_strip(const rect16& bounds, void* buffer, void* state) {
+    frame_t strip((size16)bounds.dimensions(), buffer);
+    gfx_result res = strip.fill(strip.bounds(), color<rgb_pixel<16>>::black);
+    if (res != gfx_result::success) {
+        return res;
+    }
+    // offset so the strip sees its part of the scene
+    const srect16 sb = (srect16)bounds;
+    for (int i = 0; i < 24; ++i) {
+        const srect16 r = srect16(spoint16(i * 13, i * 9), ssize16(60, 40)).offset(-sb.x1, -sb.y1);
+        res = draw::filled_ellipse(strip, r, rgb_pixel<16>(i * 5 & 31, i * 7 & 63, 31 - i));
+        if (res != gfx_result::success) {
+            return res;
+        }
+        res = draw::aa_line(strip, srect16(0, i * 10 - sb.y1, WIDTH - 1, HEIGHT - 1 - i * 10 - sb.y1), color<rgb_pixel<16>>::white, 2);
+        if (res != gfx_result::success) {
+            return res;
+        }
+    }
+    return gfx_result::success;
+}
+// called on the bus thread with each strip's data
+static void receive_strip(const rect16& bounds, const void* buffer, size_t size, void* state) {
+    memcpy(display.begin() + bounds.y1 * WIDTH * 2, buffer, size);
+}
+static double now_ms() {
+    return std::chrono::duration<double, std::milli>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+int main(int argc, char** argv) {
+    const size16 size(WIDTH, HEIGHT);
+    frame_t reference(size, malloc(frame_t::sizeof_buffer(size)));
+    display = frame_t(size, malloc(frame_t::sizeof_buffer(size)));
+    if (reference.begin() == nullptr || display.begin() == nullptr) {
+        puts("Out of memory");
+        return 1;
+    }
+    // render the whole frame at once for reference
+    if (render_strip(reference.bounds(), reference.begin(), nullptr) != gfx_result::success) {
+        puts("Unable to render the frame");
+        return 1;
+    }
+    printf("%dx%d, %d bytes/s bus, %dus latency\n", WIDTH, HEIGHT, BUS_BYTES_PER_SECOND, BUS_LATENCY_US);
+    printf("rows buffers       ms exact\n");
+    const size_t strip_rows[] = {4, 10, 24, 60};
+    const size_t buffer_counts[] = {1, 2, 3, 4};
+    for (size_t rows : strip_rows) {
+        for (size_t buffers : buffer_counts) {
+            flush_pipeline pipeline;
+            flush_mock_transport bus;
+            if (pipeline.initialize(WIDTH * rows * 2, buffers, flush_mock_transport::transfer, &bus) != gfx_result::success ||
+                bus.initialize(pipeline, BUS_BYTES_PER_SECOND, BUS_LATENCY_US, receive_strip) != gfx_result::success) {
+                puts("Unable to initialize the pipeline");
+                return 1;
+            }
+            memset(display.begin(), 0, display.size_bytes());
+            gfx_result res = gfx_result::success;
+            const double start = now_ms();
+            for (int i = 0; res == gfx_result::success && i < FRAMES; ++i) {
+                res = pipeline.flush(display.bounds(), 16, render_strip);
+            }
+            pipeline.wait_all();
+            const double ms = (now_ms() - start) / FRAMES;
+            if (res != gfx_result::success) {
+                printf("%4d %7d failed with %d\n", (int)rows, (int)buffers, (int)res);
+                continue;
+            }
+            const bool exact = 0 == memcmp(reference.begin(), display.begin(), display.size_bytes());
+            printf("%4d %7d %8.2f %s\n", (int)rows, (int)buffers, ms, exact ? "yes" : "NO");
+        }
+    }
+    free(reference.begin());
+    free(display.begin());
+    return 0;
+}
@@ -0,0 +1,111 @@
+//////////////////////////////////
+// EXAMPLE
+// Uses htcw_gfx on Linux to
+// measure what each drawing
+// operation would send over a
+// 40MHz SPI bus to an ILI9341
+// style display
+//////////////////////////////////
+
+// the size of the display
+#define WIDTH 320
+#define HEIGHT 240
+
+#include <stdio.h>
+#include <stdlib.h>
+// graphics library codewitch-honey-crisis/htcw_gfx
+#include <gfx.hpp>
+
+// import the htcw_gfx graphics library namespace
+using namespace gfx;
+
+using display_t = mock_display<rgb_pixel<16>>;
+using color_t = color<rgb_pixel<16>>;
+using vcolor_t = color<vector_pixel>;
+
+static display_t display({WIDTH, HEIGHT}, mock_bus_cost::spi(40000000));
+static const srect16 area(20, 20, 299, 219);
+static uint8_t tile_buffer[bitmap<rgb_pixel<16>>::sizeof_buffer(64, 64)];
+static bitmap<rgb_pixel<16>> tile({64, 64}, tile_buffer);
+
+typedef gfx_result (*test_callback)();
+typedef struct {
+    const char* name;
+    test_callback callback;
+} test_t;
+
+static const test_t tests[] = {
+    {"point x 1000", [] {
+         for (int i = 0; i < 1000; ++i) {
+             gfx_result res = draw::point(display, spoint16(i % WIDTH, i / WIDTH), color_t::white);
+             if (res != gfx_result::success) {
+                 return res;
+             }
+         }
+         return gfx_result::success;
+     }},
+    {"filled_rectangle", [] { return draw::filled_rectangle(display, area, color_t::blue); }},
+    {"filled_rectangle 50% alpha", [] { return draw::filled_rectangle(display, area, vcolor_t::red.opacity(.5f)); }},
+    {"rectangle", [] { return draw::rectangle(display, area, color_t::white); }},
+    {"line", [] { return draw::line(display, area, color_t::white); }},
+    {"ellipse", [] { return draw::ellipse(display, area, color_t::yellow); }},
+    {"filled_ellipse", [] { return draw::filled_ellipse(display, area, color_t::yellow); }},
+    {"filled_rounded_rectangle", [] { return draw::filled_rounded_rectangle(display, area, .2f, color_t::green); }},
+    {"aa_line", [] { return draw::aa_line(display, area, vcolor_t::white, 3); }},
+    {"aa_filled_rounded_rectangle", [] { return draw::aa_filled_rounded_rectangle(display, area, vcolor_t::purple, 24); }},
+    {"aa_polygon", [] {
+         const spoint16 points[] = {{160, 20}, {299, 219}, {20, 219}};
+         return draw::aa_polygon(display, spath16(3, (spoint16*)points), vcolor_t::orange, 4);
+     }},
+    {"bitmap 64x64", [] { return draw::bitmap(display, srect16(spoint16(128, 88), (ssize16)tile.dimensions()), tile, tile.bounds()); }},
+    {"bitmap 64x64 resized 2x", [] { return draw::bitmap(display, srect16(spoint16(96, 56), ssize16(128, 128)), tile, tile.bounds(), bitmap_resize::resize_bilinear); }},
+    {"batch 64x64", [] {
+         gfx_result res = display.begin_batch(rect16(point16(128, 88), tile.dimensions()));
+         for (int y = 0; res == gfx_result::success && y < 64; ++y) {
+             for (int x = 0; res == gfx_result::success && x < 64; ++x) {
+                 rgb_pixel<16> px;
+                 tile.point(point16(x, y), &px);
+                 res = display.write_batch(px);
+             }
+         }
+         return res == gfx_result::success ? display.commit_batch() : res;
+     }},
+    {"canvas", [] {
+         canvas cvs((size16)area.dimensions());
+         gfx_result res = cvs.initialize();
+         if (res != gfx_result::success) {
+             return res;
+         }
+         res = draw::canvas(display, cvs, area.point1());
+         if (res != gfx_result::success) {
+             return res;
+         }
+         cvs.fill_color(vcolor_t::cyan.opacity(.75f));
+         cvs.ellipse({area.width() / 2.f, area.height() / 2.f}, {area.width() / 2.f, area.height() / 2.f});
+         return cvs.render();
+     }},
+};
+int main(int argc, char** argv) {
+    if (display.initialize() != gfx_result::success) {
+        puts("Out of memory");
+        return 1;
+    }
+    for (int y = 0; y < 64; ++y) {
+        for (int x = 0; x < 64; ++x) {
+            tile.point(point16(x, y), rgb_pixel<16>(x >> 1, y, (x + y) >> 2));
+        }
+    }
+    printf("%-28s %8s %8s %9s %9s %9s\n", "operation", "commands", "windows", "KB sent", "KB read", "bus ms");
+    for (const test_t& test : tests) {
+        display.reset_stats();
+        const gfx_result res = test.callback();
+        if (res != gfx_result::success) {
+            printf("%-28s failed with %d\n", test.name, (int)res);
+            continue;
+        }
+        const mock_bus_stats& stats = display.stats();
+        printf("%-28s %8d %8d %9.1f %9.1f %9.2f\n", test.name, (int)stats.commands, (int)stats.windows,
+               stats.bytes_written / 1024.0, stats.bytes_read / 1024.0, stats.time_ns / 1000000.0);
+    }
+    return 0;
+}
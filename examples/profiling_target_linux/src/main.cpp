@@ -0,0 +1,104 @@
+//////////////////////////////////
+// EXAMPLE
+// Uses htcw_gfx on Linux to
+// show how each draw:: call
+// reaches a bitmap and a mock
+// display, and where it falls
+// back to drawing points
+//////////////////////////////////
+
+// the size of the frame
+#define WIDTH 320
+#define HEIGHT 240
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+// graphics library codewitch-honey-crisis/htcw_gfx
+// HTCW_GFX_PROFILE is defined in platformio.ini
+#include <gfx.hpp>
+
+// import the htcw_gfx graphics library namespace
+using namespace gfx;
+
+using bitmap_t = bitmap<rgb_pixel<16>>;
+using display_t = mock_display<rgb_pixel<16>>;
+using color_t = color<rgb_pixel<16>>;
+using vcolor_t = color<vector_pixel>;
+
+static uint8_t frame_buffer[bitmap_t::sizeof_buffer(WIDTH, HEIGHT)];
+static bitmap_t frame({WIDTH, HEIGHT}, frame_buffer);
+static display_t display({WIDTH, HEIGHT});
+static uint8_t tile_buffer[bitmap_t::sizeof_buffer(64, 64)];
+static bitmap_t tile({64, 64}, tile_buffer);
+static const srect16 area(20, 20, 299, 219);
+
+// nanoseconds since some point in the past
+static uint64_t clock_ns(void* state) {
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+template <typename Destination>
+static gfx_result draw_scene(Destination& destination) {
+    gfx_result res = draw::filled_rectangle(destination, destination.bounds(), color_t::black);
+    if (res != gfx_result::success) {
+        return res;
+    }
+    res = draw::filled_rectangle(destination, area, vcolor_t::red.opacity(.5f));
+    if (res != gfx_result::success) {
+        return res;
+    }
+    res = draw::rectangle(destination, area, color_t::white);
+    if (res != gfx_result::success) {
+        return res;
+    }
+    res = draw::filled_ellipse(destination, area, color_t::yellow);
+    if (res != gfx_result::success) {
+        return res;
+    }
+    res = draw::aa_line(destination, area, vcolor_t::white, 3);
+    if (res != gfx_result::success) {
+        return res;
+    }
+    res = draw::aa_filled_rounded_rectangle(destination, area.inflate(-40, -40), vcolor_t::purple, 24);
+    if (res != gfx_result::success) {
+        return res;
+    }
+    return draw::bitmap(destination, srect16(spoint16(128, 88), (ssize16)tile.dimensions()), tile, tile.bounds());
+}
+template <typename Destination>
+static int profile(const char* name, Destination& destination) {
+    profiling_target<Destination> target(destination, clock_ns);
+    const gfx_result res = draw_scene(target);
+    if (res != gfx_result::success) {
+        printf("%s failed with %d\n", name, (int)res);
+        return 1;
+    }
+    static uint8_t text[8192];
+    buffer_stream out(text, sizeof(text));
+    if (target.dump(out) != gfx_result::success) {
+        printf("%s: the dump didn't fit\n", name);
+        return 1;
+    }
+    printf("%s (time is in ns)\n", name);
+    fwrite(text, 1, (size_t)out.seek(0, seek_origin::current), stdout);
+    puts("");
+    return 0;
+}
+int main(int argc, char** argv) {
+    if (display.initialize() != gfx_result::success) {
+        puts("Out of memory");
+        return 1;
+    }
+    for (int y = 0; y < 64; ++y) {
+        for (int x = 0; x < 64; ++x) {
+            tile.point(point16(x, y), rgb_pixel<16>(x >> 1, y, (x + y) >> 2));
+        }
+    }
+    // a bitmap has span access, so most primitives use that.
+    // the display only has fill and copy_from, so some fall back to points
+    if (profile("bitmap", frame) != 0) {
+        return 1;
+    }
+    return profile("mock display", display);
+}
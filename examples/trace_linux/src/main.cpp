@@ -0,0 +1,132 @@
+//////////////////////////////////
+// EXAMPLE
+// Uses htcw_gfx on Linux to
+// record a timeline of a frame
+// sent over a simulated bus, and
+// save it for Perfetto
+// usage: trace [document.svg]
+//   [image.jpg] [font.ttf]
+//////////////////////////////////
+
+// the size of the display
+#define WIDTH 320
+#define HEIGHT 240
+// the rows in each strip
+#define STRIP_ROWS 24
+// the simulated bus: 40MHz SPI
+#define BUS_BYTES_PER_SECOND (40000000 / 8)
+#define BUS_LATENCY_US 20
+// where the trace is written
+#define TRACE_PATH "trace.json"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+// graphics library codewitch-honey-crisis/htcw_gfx
+// HTCW_GFX_TRACE is defined in platformio.ini
+#include <gfx.hpp>
+
+// import the htcw_gfx graphics library namespace
+using namespace gfx;
+
+using strip_t = bitmap<rgb_pixel<16>>;
+using color_t = color<rgb_pixel<16>>;
+using vcolor_t = color<vector_pixel>;
+
+typedef struct {
+    stream* svg;
+    sizef svg_size;
+    jpg_image* jpg;
+    font* text_font;
+} scene_t;
+
+// nanoseconds since some point in the past
+static uint64_t clock_ns(void* state) {
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+// renders a strip of the scene into a transfer buffer
+static gfx_result render_strip(const rect16& bounds, void* buffer, void* state) {
+    const scene_t& scene = *(const scene_t*)state;
+    strip_t strip((size16)bounds.dimensions(), buffer);
+    // offset so the strip sees its part of the scene
+    const spoint16 offset(-bounds.x1, -bounds.y1);
+    const srect16 frame = srect16(0, 0, WIDTH - 1, HEIGHT - 1).offset(offset);
+    gfx_result res = draw::filled_rectangle(strip, strip.bounds(), color_t::white);
+    if (res != gfx_result::success) {
+        return res;
+    }
+    if (scene.jpg != nullptr) {
+        res = draw::image(strip, frame, *scene.jpg);
+        if (res != gfx_result::success) {
+            return res;
+        }
+    }
+    canvas cvs({WIDTH, HEIGHT});
+    res = cvs.initialize();
+    if (res != gfx_result::success) {
+        return res;
+    }
+    res = draw::canvas(strip, cvs, offset);
+    if (res != gfx_result::success) {
+        return res;
+    }
+    if (scene.svg != nullptr) {
+        scene.svg->seek(0);
+        res = cvs.render_svg(*scene.svg, matrix::create_fit_to(scene.svg_size, rectf(0, 0, WIDTH - 1, HEIGHT - 1)));
+    } else {
+        cvs.fill_color(vcolor_t::purple.opacity(.8f));
+        cvs.stroke_color(vcolor_t::black);
+        cvs.stroke_width(4);
+        cvs.ellipse({WIDTH / 2, HEIGHT / 2}, {WIDTH / 3, HEIGHT / 3});
+        res = cvs.render();
+    }
+    if (res != gfx_result::success) {
+        return res;
+    }
+    if (scene.text_font != nullptr) {
+        res = draw::text(strip, frame.offset(10, 10), text_info("Hello world!", *scene.text_font), color_t::black);
+    }
+    return res;
+}
+int main(int argc, char** argv) {
+    scene_t scene = {nullptr, {0, 0}, nullptr, nullptr};
+    file_stream svg_file(argc > 1 ? argv[1] : "");
+    if (argc > 1 && svg_file.caps().read && canvas::svg_dimensions(svg_file, &scene.svg_size) == gfx_result::success) {
+        scene.svg = &svg_file;
+    }
+    file_stream jpg_file(argc > 2 ? argv[2] : "");
+    jpg_image jpg(jpg_file);
+    if (argc > 2 && jpg_file.caps().read && jpg.initialize() == gfx_result::success) {
+        scene.jpg = &jpg;
+    }
+    file_stream ttf_file(argc > 3 ? argv[3] : "");
+    tt_font ttf(ttf_file, 32, font_size_units::px);
+    if (argc > 3 && ttf_file.caps().read && ttf.initialize() == gfx_result::success) {
+        scene.text_font = &ttf;
+    }
+    trace_buffer trace;
+    flush_pipeline pipeline;
+    flush_mock_transport bus;
+    if (trace.initialize(64 * 1024, clock_ns) != gfx_result::success ||
+        pipeline.initialize(WIDTH * STRIP_ROWS * 2, 2, flush_mock_transport::transfer, &bus) != gfx_result::success ||
+        bus.initialize(pipeline, BUS_BYTES_PER_SECOND, BUS_LATENCY_US) != gfx_result::success) {
+        puts("Out of memory");
+        return 1;
+    }
+    // record one frame, and everything the bus does for it
+    trace.start();
+    gfx_result res = pipeline.flush(rect16(0, 0, WIDTH - 1, HEIGHT - 1), 16, render_strip, &scene);
+    pipeline.wait_all();
+    trace.stop();
+    if (res != gfx_result::success) {
+        printf("Rendering failed with %d\n", (int)res);
+        return 1;
+    }
+    file_stream out(TRACE_PATH, io::file_mode::write);
+    if (!out.caps().write || trace.dump(out) != gfx_result::success) {
+        puts("Unable to write " TRACE_PATH);
+        return 1;
+    }
+    printf("Wrote %d events to " TRACE_PATH " (%d dropped). Open it at https://ui.perfetto.dev\n", (int)trace.count(), (int)trace.dropped());
+    return 0;
+}
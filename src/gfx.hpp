@@ -13,10 +13,20 @@
 #include "gfx_win_font.hpp"
 #include "gfx_vlw_font.hpp"
 #include "gfx_tt_font.hpp"
+#include "gfx_packed_font.hpp"
+#include "gfx_sdf_font.hpp"
+#include "gfx_text_layout.hpp"
 #include "gfx_image.hpp"
 #include "gfx_bitmap.hpp"
+#include "gfx_damage_tracker.hpp"
+#include "gfx_mock_display.hpp"
+#include "gfx_profiling_target.hpp"
+#include "gfx_allocation_tracker.hpp"
+#include "gfx_trace.hpp"
 #include "gfx_sprite.hpp"
 #include "gfx_jpg_image.hpp"
 #include "gfx_png_image.hpp"
 #include "gfx_draw.hpp"
+#include "gfx_draw_list.hpp"
+#include "gfx_flush_pipeline.hpp"
 #endif // HTCW_GFX
\ No newline at end of file
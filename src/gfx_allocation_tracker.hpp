@@ -0,0 +1,63 @@
+#ifndef HTCW_GFX_ALLOCATION_TRACKER_HPP
+#define HTCW_GFX_ALLOCATION_TRACKER_HPP
+#include <stdlib.h>
+#include "gfx_core.hpp"
+namespace gfx {
+// what a tracked allocation is for. Each tag has its own allocators and statistics
+enum struct allocation_tag {
+    canvas = 0,
+    font,
+    image,
+    svg,
+    tvg,
+    // bitmaps, masks and draw caches
+    raster
+};
+constexpr static const size_t allocation_tag_count = 6;
+// bucket 0 counts requests of up to 16 bytes, each bucket after that twice as many, and the last one everything larger
+constexpr static const size_t allocation_histogram_buckets = 12;
+// what the allocators for one tag have done
+struct allocation_stats {
+    // the bytes in use now, and the most that were at once
+    size_t current;
+    size_t peak;
+    size_t allocations;
+    size_t reallocations;
+    size_t deallocations;
+    // the requests the backing allocator refused
+    size_t failures;
+    // the requested sizes of allocations and reallocations
+    size_t histogram[allocation_histogram_buckets];
+};
+// Supplies an allocator, reallocator and deallocator for each allocation_tag
+// that record the bytes in use, the high water mark, the number of calls and
+// the sizes requested. Pass them wherever GFX takes allocators, such as
+// canvas, svg_document or jpg_image, to see where the heap goes. Each block
+// carries a small header with its size and tag, so it must be freed by one of
+// these deallocators, though any tag's will do. The memory comes from the
+// backing allocators, which are the C heap unless set otherwise. The
+// statistics are safe to update from more than one thread.
+class allocation_tracker final {
+    allocation_tracker() = delete;
+
+   public:
+    static void* (*allocator(allocation_tag tag))(size_t);
+    static void* (*reallocator(allocation_tag tag))(void*, size_t);
+    static void (*deallocator(allocation_tag tag))(void*);
+    // sets where the memory comes from. Only change it while no tracked block is allocated
+    static void backing(void* (*allocator)(size_t) = ::malloc, void* (*reallocator)(void*, size_t) = ::realloc, void (*deallocator)(void*) = ::free);
+    // the bytes each block takes on top of what was requested
+    static size_t overhead();
+    static allocation_stats stats(allocation_tag tag);
+    // all tags together. The peak is the most in use across every tag at once
+    static allocation_stats total();
+    // clears the counts and histogram of a tag, and lowers its peak to what is in use now
+    static void reset(allocation_tag tag);
+    // resets every tag and the total
+    static void reset();
+    static const char* name(allocation_tag tag);
+    // writes a table of the statistics, one tag per line, followed by the histograms
+    static gfx_result dump(stream& out);
+};
+}  // namespace gfx
+#endif
@@ -6,6 +6,7 @@
 #include "gfx_positioning.hpp"
 #include "gfx_draw_common.hpp"
 #include "gfx_palette.hpp"
+#include "gfx_convert_span.hpp"
 
 namespace gfx {
 
@@ -50,12 +51,74 @@ namespace gfx {
         virtual gfx_span span(point16 location) const = 0;
     };
     namespace helpers {
+        // copies the rows of a bitmap into the spans of a destination of a different pixel type with convert_span().
+        // Returns not_supported when it can't, and the copy is done a pixel at a time instead
+        template<typename Source,typename Destination, int Kind>
+        struct bmp_convert_span_helper {
+            inline static gfx_result copy_to(const Source& src,const rect16& srcr,Destination& dst,const rect16& dstr) {
+                (void)src;(void)srcr;(void)dst;(void)dstr;
+                return gfx_result::not_supported;
+            }
+        };
+        template<typename Source,typename Destination>
+        struct bmp_convert_span_helper<Source,Destination,1> {
+            static gfx_result copy_to(const Source& src,const rect16& srcr,Destination& dst,const rect16& dstr) {
+                using src_t = typename Source::pixel_type;
+                using dst_t = typename Destination::pixel_type;
+                const size_t w = dstr.width();
+                for(size_t dy=0;dy<dstr.height();++dy) {
+                    const gfx_span dsp = dst.span(point16(dstr.left(),uint16_t(dstr.top()+dy)));
+                    if(dsp.data==nullptr || dsp.length<w*dst_t::packed_size) {
+                        return gfx_result::not_supported;
+                    }
+                    convert_span<src_t,dst_t>(src.cbegin()+((srcr.top()+dy)*src.dimensions().width+srcr.left())*src_t::packed_size,dsp.data,w);
+                }
+                return gfx_result::success;
+            }
+        };
+        template<typename Source,typename Destination>
+        struct bmp_convert_span_helper<Source,Destination,2> {
+            static gfx_result copy_to(const Source& src,const rect16& srcr,Destination& dst,const rect16& dstr) {
+                using src_t = typename Source::pixel_type;
+                using dst_t = typename Destination::pixel_type;
+                constexpr static const size_t lut_size = size_t(1)<<src_t::bit_depth;
+                const size_t w = dstr.width();
+                // building the table costs a conversion per entry
+                if(w*dstr.height()<lut_size) {
+                    return gfx_result::not_supported;
+                }
+                dst_t lut[lut_size];
+                if(gfx_result::success!=convert_span_lut(dst,src,lut)) {
+                    return gfx_result::not_supported;
+                }
+                for(size_t dy=0;dy<dstr.height();++dy) {
+                    const gfx_span dsp = dst.span(point16(dstr.left(),uint16_t(dstr.top()+dy)));
+                    if(dsp.data==nullptr || dsp.length<w*dst_t::packed_size) {
+                        return gfx_result::not_supported;
+                    }
+                    convert_span<src_t,dst_t>(src.cbegin(),dsp.data,w,lut,(srcr.top()+dy)*src.dimensions().width+srcr.left());
+                }
+                return gfx_result::success;
+            }
+        };
+        template<typename Source,typename Destination, bool AllowBlt>
+        struct bmp_convert_span_kind {
+            constexpr static const int value = 0;
+        };
+        template<typename Source,typename Destination>
+        struct bmp_convert_span_kind<Source,Destination,true> {
+            constexpr static const int value = Destination::caps::blt_spans?span_conversion_kind<typename Source::pixel_type,typename Destination::pixel_type>::value:0;
+        };
         template<typename Source,typename Destination, bool AllowBlt=true>
         struct bmp_copy_to_helper {
             static inline gfx_result copy_to(const Source& src,const rect16& srcr,Destination& dst,const rect16& dstr) {
+                // a source with alpha is blended, so only opaque sources can be converted a row at a time
+                gfx_result r = bmp_convert_span_helper<Source,Destination,bmp_convert_span_kind<Source,Destination,AllowBlt>::value>::copy_to(src,srcr,dst,dstr);
+                if(gfx_result::not_supported!=r) {
+                    return r;
+                }
                 size_t dy=0,dye=dstr.height();
                 size_t dx,dxe = dstr.width();
-                gfx_result r;
                 // if(gfx_result::success!=r) {
                 //     return r;
                 // }
@@ -49,8 +49,11 @@ struct canvas_text_info final {
     }
 };
 class canvas;
+class svg_document;
 class canvas_path {
     friend class canvas;
+    friend class canvas_shape;
+    friend class svg_document;
     void* m_info;
     void*(*m_allocator)(size_t);
     void*(*m_reallocator)(void*,size_t);
@@ -116,11 +119,21 @@ class canvas final {
     vector_on_read_callback_type m_read_callback;
     void* m_callback_state;
     void(*m_free_callback_state)(void*);
+    void* m_scratch;
+    size_t m_scratch_size;
     void*(*m_allocator)(size_t);
     void*(*m_reallocator)(void*, size_t);
     void(*m_deallocator)(void*);
     canvas(const canvas& rhs)=delete;
     canvas& operator=(const canvas& rhs)=delete;
+    gfx_result apply_fill_paint();
+    gfx_result apply_stroke_paint();
+    void apply_stroke_style();
+    void* scratch_begin(void*(*&allocator)(size_t), void*(*&reallocator)(void*,size_t), void(*&deallocator)(void*));
+    void scratch_end(void* previous);
+    gfx_result render_impl(bool preserve,void*(*allocator)(size_t),void*(*reallocator)(void*,size_t),void(*deallocator)(void*));
+    gfx_result render_mask_impl(bitmap<alpha_pixel<8>>& destination, spoint16 location, bool preserve,void*(*allocator)(size_t),void*(*reallocator)(void*,size_t),void(*deallocator)(void*));
+    friend class canvas_shape;
 public:
     canvas(void*(*allocator)(size_t)=::malloc, void*(*reallocator)(void*,size_t)=::realloc, void(*deallocator)(void*)=::free);
     canvas(size16 dimensions,void*(*allocator)(size_t)=::malloc, void*(*reallocator)(void*,size_t)=::realloc, void(*deallocator)(void*)=::free);
@@ -133,9 +146,14 @@ public:
     vector_on_write_callback_type on_write_callback() const;
     vector_on_read_callback_type on_read_callback() const;
     void* callback_state() const;
+    // the allocators the canvas was constructed with
+    void*(*allocator() const)(size_t);
+    void*(*reallocator() const)(void*,size_t);
+    void(*deallocator() const)(void*);
     blt_span*  direct() const;
     gfx_result callbacks(size16 dimensions, spoint16 offset,vector_on_read_callback_type read_callback, vector_on_write_callback_type write_callback, void* callback_state, void(*free_callback_state)(void*)=nullptr);
-    gfx_result direct(blt_span* target,size16 dimensions, spoint16 offset,on_direct_read_callback_type on_read,on_direct_write_callback_type on_write);
+    // binds the canvas to a target whose top left is at offset in canvas coordinates. clip limits the part of the target that is written, in target coordinates
+    gfx_result direct(blt_span* target,size16 dimensions, spoint16 offset,on_direct_read_callback_type on_read,on_direct_write_callback_type on_write, const srect16* clip = nullptr);
     size16 dimensions() const;
     void dimensions(size16 value);
     rect16 bounds() const;
@@ -200,12 +218,139 @@ public:
     gfx_result arc(pointf center, float radius, float start_angle, float end_angle, bool direction);
     gfx_result text(pointf location, const canvas_text_info& info);
     gfx_result path(const canvas_path& value);
+    // the initial size in bytes of the scratch arena that holds the transient memory of each render(), or 0 to use the heap (the default).
+    // while an arena is in use it takes the place of the allocators passed to render()
+    size_t scratch_size() const;
+    void scratch_size(size_t value);
+    // the most scratch memory a single render has used
+    size_t scratch_high_water() const;
     gfx_result render(bool preserve=false,void*(*allocator)(size_t)=nullptr,void*(*reallocator)(void*,size_t)=nullptr,void(*deallocator)(void*)=nullptr);
+    // rasterizes the current path as render() would, but writes its coverage to destination instead of painting it.
+    // the fill and the stroke are included unless their paint type is none, and their paint and opacity are ignored.
+    // location is where the top left of destination lies on the canvas. the clip path is honored
+    gfx_result render_mask(bitmap<alpha_pixel<8>>& destination, spoint16 location = spoint16::zero(), bool preserve=false,void*(*allocator)(size_t)=nullptr,void*(*reallocator)(void*,size_t)=nullptr,void(*deallocator)(void*)=nullptr);
     gfx_result render_svg(stream& document, const matrix& transform=matrix::create_identity(), float dpi = 96.f,void*(*allocator)(size_t)=nullptr,void*(*reallocator)(void*,size_t)=nullptr,void(*deallocator)(void*)=nullptr);
     static gfx_result svg_dimensions(stream& document, sizef* out_dimensions, float dpi= 96.f);
+    // renders a TinyVG document. A seekable document is left positioned just past it. Others are read no further than they need to be
     gfx_result render_tvg(stream& document, const matrix& transform=matrix::create_identity(),void*(*allocator)(size_t)=nullptr,void*(*reallocator)(void*,size_t)=nullptr,void(*deallocator)(void*)=nullptr);
+    // reads the size of a TinyVG document. A seekable document is left where it was. Others are left just past the header
     static gfx_result tvg_dimensions(stream& document, sizef* out_dimensions);
 };
+// Runs work for every index from 0 to count-1 and returns once all of the
+// calls have finished. The calls may run concurrently. This is how
+// draw::canvas_parallel() hands work to a thread pool.
+typedef gfx_result(*canvas_dispatch_callback)(size_t count, void(*work)(size_t index, void* state), void* state, void* dispatch_state);
+// the number of threads canvas_thread_dispatch() can run at once, or 1 where threads are not available
+size_t canvas_thread_count();
+#ifdef HTCW_GFX_THREADS
+// runs the indices on their own threads, using the calling thread for one of them. If a thread can't be
+// started its indices run on a thread that did start. dispatch_state is unused
+gfx_result canvas_thread_dispatch(size_t count, void(*work)(size_t index, void* state), void* state, void* dispatch_state = nullptr);
+#endif
+// A path whose coverage is rasterized once and kept, so it can be drawn
+// again with a different paint, opacity or whole pixel offset without being
+// rasterized again. The fill rule and stroke geometry (width, caps, joins,
+// miter limit and dash) are captured from the canvas when the shape is
+// initialized. The paint and opacity come from the destination each time it
+// is rendered. If the destination's transform differs from the one the
+// coverage was produced under by anything other than a whole pixel
+// translation, the path is rasterized again under the new transform.
+// Rendering rasterizes on demand and updates the shape, so it isn't safe to
+// render one shape from several threads at once. Once it has been rendered
+// with every paint it needs (fill, stroke or both) under the transform it
+// will be used with, later renders under that transform, or a whole pixel
+// translation of it, only read it. Render it once that way before sharing it
+// between draw::canvas_parallel() bands.
+class canvas_shape final {
+    void* m_path;
+    void* m_spans;
+    gfx::fill_rule m_fill_rule;
+    float m_stroke_width;
+    line_cap m_stroke_line_cap;
+    line_join m_stroke_line_join;
+    float m_stroke_miter_limit;
+    float m_dash_offset;
+    float* m_dash;
+    size_t m_dash_size;
+    matrix m_transform;
+    bool m_fill_valid;
+    bool m_stroke_valid;
+    void*(*m_allocator)(size_t);
+    void*(*m_reallocator)(void*,size_t);
+    void(*m_deallocator)(void*);
+    canvas_shape(const canvas_shape& rhs)=delete;
+    canvas_shape& operator=(const canvas_shape& rhs)=delete;
+    gfx_result rasterize(bool stroke, const matrix& transform, void*(*allocator)(size_t), void*(*reallocator)(void*,size_t), void(*deallocator)(void*));
+    gfx_result render_impl(canvas& destination, spoint16 offset, void*(*allocator)(size_t), void*(*reallocator)(void*,size_t), void(*deallocator)(void*));
+public:
+    canvas_shape(void*(*allocator)(size_t)=::malloc, void*(*reallocator)(void*,size_t)=::realloc, void(*deallocator)(void*)=::free);
+    canvas_shape(canvas_shape&& rhs);
+    ~canvas_shape();
+    canvas_shape& operator=(canvas_shape&& rhs);
+    // copies the path and captures the geometry style of the source
+    gfx_result initialize(const canvas_path& path, const canvas& source);
+    bool initialized() const;
+    void deinitialize();
+    // discards the coverage so that the next render rasterizes again
+    void invalidate();
+    // true if the coverage for the fill or stroke is currently held
+    bool fill_valid() const;
+    bool stroke_valid() const;
+    // draws the shape with the destination's current fill and stroke paint, offset by whole pixels
+    gfx_result render(canvas& destination, spoint16 offset = spoint16::zero(), void*(*allocator)(size_t)=nullptr, void*(*reallocator)(void*,size_t)=nullptr, void(*deallocator)(void*)=nullptr);
+};
+// Options for svg_to_tvg()
+struct svg_to_tvg_options final {
+    float dpi;
+    // the largest coordinate step in pixels the output may use
+    float precision;
+    // the coordinate size in bits (8, 16 or 32) or 0 to pick the smallest that fits
+    uint8_t coordinate_bits;
+    // the fractional bits of each coordinate (0-15) or -1 to pick the finest that fits
+    int8_t scale;
+    inline svg_to_tvg_options() : dpi(96.f), precision(1.f/16.f), coordinate_bits(0), scale(-1) {}
+};
+// Transcodes an SVG document to TinyVG. Colors are deduplicated into the
+// palette and coordinates are flattened to document space at the chosen
+// precision. TinyVG gradients have two colors, so only the first and last
+// stop of an SVG gradient survive. Dashes, line caps and line joins have no
+// TinyVG equivalent and are dropped, and fills use the even-odd rule.
+gfx_result svg_to_tvg(stream& input, stream& output, const svg_to_tvg_options& options = svg_to_tvg_options(), void*(*allocator)(size_t)=::malloc, void*(*reallocator)(void*,size_t)=::realloc, void(*deallocator)(void*)=::free);
+// An SVG document compiled into a display list of paths, resolved styles and
+// gradient stops held in a single allocation. Compiling parses the XML once;
+// rendering replays the list without touching the parser, so static SVGs can
+// be drawn every frame under any transform. Each path and group keeps its
+// bounds, so whatever falls outside the destination's clip is skipped. The
+// compiled form can be written to a stream and read back, so it can be
+// produced offline.
+class svg_document final {
+    void* m_data;
+    size_t m_size;
+    void*(*m_allocator)(size_t);
+    void*(*m_reallocator)(void*,size_t);
+    void(*m_deallocator)(void*);
+    svg_document(const svg_document& rhs)=delete;
+    svg_document& operator=(const svg_document& rhs)=delete;
+    static gfx_result record(void* state, const canvas_path& path, const canvas_style& style, const matrix& transform);
+    friend gfx_result svg_to_tvg(stream& input, stream& output, const svg_to_tvg_options& options, void*(*allocator)(size_t), void*(*reallocator)(void*,size_t), void(*deallocator)(void*));
+public:
+    svg_document(void*(*allocator)(size_t)=::malloc, void*(*reallocator)(void*,size_t)=::realloc, void(*deallocator)(void*)=::free);
+    svg_document(svg_document&& rhs);
+    ~svg_document();
+    svg_document& operator=(svg_document&& rhs);
+    // parses an SVG document into the display list
+    gfx_result compile(stream& document, float dpi = 96.f);
+    // loads a display list previously saved with write()
+    gfx_result read(stream& input);
+    gfx_result write(stream& output) const;
+    bool initialized() const;
+    void deinitialize();
+    sizef dimensions() const;
+    // the size of the display list in bytes
+    size_t memory_size() const;
+    // the transform is applied the same way canvas::render_svg() applies it
+    gfx_result render(canvas& destination, const matrix& transform=matrix::create_identity(), void*(*allocator)(size_t)=nullptr, void*(*reallocator)(void*,size_t)=nullptr, void(*deallocator)(void*)=nullptr) const;
+};
 
 };
 #endif
\ No newline at end of file
@@ -0,0 +1,226 @@
+#ifndef HTCW_GFX_CONVERT_SPAN_HPP
+#define HTCW_GFX_CONVERT_SPAN_HPP
+#include <string.h>
+#include "gfx_core.hpp"
+#include "gfx_pixel.hpp"
+#include "gfx_palette.hpp"
+namespace gfx {
+namespace helpers {
+// reads a pixel stored the way bitmaps store them
+template <typename PixelType>
+inline PixelType span_load(const uint8_t* data) {
+    typename PixelType::int_type result = 0;
+    memcpy(&result, data, PixelType::packed_size);
+#ifndef HTCW_GFX_NO_SWAP
+    result = bits::swap(result);
+#endif
+    return PixelType(typename PixelType::int_type(result & PixelType::mask), true);
+}
+// writes a pixel the way bitmaps store them
+template <typename PixelType>
+inline void span_store(uint8_t* data, PixelType pixel) {
+#ifndef HTCW_GFX_NO_SWAP
+    const typename PixelType::int_type value = pixel.swapped();
+#else
+    const typename PixelType::int_type value = pixel.native_value;
+#endif
+    memcpy(data, &value, PixelType::packed_size);
+}
+template <typename PixelType, int Index>
+constexpr inline uint32_t span_channel(typename PixelType::int_type native_value) {
+    return (uint32_t)get_channel_direct_unchecked<PixelType, Index>(native_value);
+}
+template <typename PixelType, int Index>
+constexpr inline typename PixelType::int_type span_channel_bits(uint32_t value) {
+    return typename PixelType::int_type(typename PixelType::int_type(value) << PixelType::template channel_by_index_unchecked<Index>::total_bits_to_right);
+}
+// rescales a channel, rounding to nearest. This is what convert() does for
+// the 5, 6 and 8 bit channels the specializations below use
+template <uint32_t MaxFrom, uint32_t MaxTo>
+constexpr inline uint32_t span_rescale(uint32_t value) {
+    return (value * MaxTo + (MaxFrom / 2)) / MaxFrom;
+}
+// any two byte aligned, non-indexed pixel types, one pixel at a time
+template <typename SrcPixel, typename DstPixel>
+struct span_converter {
+    static void convert(const uint8_t* src, uint8_t* dst, size_t count) {
+        while (count--) {
+            DstPixel px;
+            gfx::convert(span_load<SrcPixel>(src), &px);
+            span_store(dst, px);
+            src += SrcPixel::packed_size;
+            dst += DstPixel::packed_size;
+        }
+    }
+};
+template <typename PixelType>
+struct span_converter<PixelType, PixelType> {
+    inline static void convert(const uint8_t* src, uint8_t* dst, size_t count) {
+        memcpy(dst, src, count * PixelType::packed_size);
+    }
+};
+template <>
+struct span_converter<rgb_pixel<24>, rgb_pixel<16>> {
+    static void convert(const uint8_t* src, uint8_t* dst, size_t count) {
+        using src_t = rgb_pixel<24>;
+        using dst_t = rgb_pixel<16>;
+        while (count--) {
+            const src_t::int_type s = span_load<src_t>(src).native_value;
+            span_store(dst, dst_t(dst_t::int_type(span_channel_bits<dst_t, 0>(span_rescale<255, 31>(span_channel<src_t, 0>(s))) |
+                                                  span_channel_bits<dst_t, 1>(span_rescale<255, 63>(span_channel<src_t, 1>(s))) |
+                                                  span_channel_bits<dst_t, 2>(span_rescale<255, 31>(span_channel<src_t, 2>(s)))),
+                                  true));
+            src += 3;
+            dst += 2;
+        }
+    }
+};
+// the alpha channel is dropped. Callers that blend check for opaque pixels first
+template <>
+struct span_converter<rgba_pixel<32>, rgb_pixel<16>> {
+    static void convert(const uint8_t* src, uint8_t* dst, size_t count) {
+        using src_t = rgba_pixel<32>;
+        using dst_t = rgb_pixel<16>;
+        while (count--) {
+            const src_t::int_type s = span_load<src_t>(src).native_value;
+            span_store(dst, dst_t(dst_t::int_type(span_channel_bits<dst_t, 0>(span_rescale<255, 31>(span_channel<src_t, 0>(s))) |
+                                                  span_channel_bits<dst_t, 1>(span_rescale<255, 63>(span_channel<src_t, 1>(s))) |
+                                                  span_channel_bits<dst_t, 2>(span_rescale<255, 31>(span_channel<src_t, 2>(s)))),
+                                  true));
+            src += 4;
+            dst += 2;
+        }
+    }
+};
+template <>
+struct span_converter<rgb_pixel<16>, rgb_pixel<24>> {
+    static void convert(const uint8_t* src, uint8_t* dst, size_t count) {
+        using src_t = rgb_pixel<16>;
+        using dst_t = rgb_pixel<24>;
+        while (count--) {
+            const src_t::int_type s = span_load<src_t>(src).native_value;
+            span_store(dst, dst_t(dst_t::int_type(span_channel_bits<dst_t, 0>(span_rescale<31, 255>(span_channel<src_t, 0>(s))) |
+                                                  span_channel_bits<dst_t, 1>(span_rescale<63, 255>(span_channel<src_t, 1>(s))) |
+                                                  span_channel_bits<dst_t, 2>(span_rescale<31, 255>(span_channel<src_t, 2>(s)))),
+                                  true));
+            src += 2;
+            dst += 3;
+        }
+    }
+};
+// grayscale to RGB goes through a table built with convert(), so it matches it exactly
+template <>
+struct span_converter<gsc_pixel<8>, rgb_pixel<16>> {
+    struct table {
+        rgb_pixel<16> entries[256];
+        table() {
+            for (int i = 0; i < 256; ++i) {
+                gfx::convert(gsc_pixel<8>(i), &entries[i]);
+            }
+        }
+    };
+    static void convert(const uint8_t* src, uint8_t* dst, size_t count) {
+        static const table lut;
+        while (count--) {
+            span_store(dst, lut.entries[*src++]);
+            dst += 2;
+        }
+    }
+};
+// luma from the Q16 weight of each channel value, summed and rounded the way convert() does
+template <>
+struct span_converter<rgb_pixel<16>, gsc_pixel<8>> {
+    struct table {
+        uint32_t r[32];
+        uint32_t g[64];
+        uint32_t b[32];
+        table() {
+            for (int i = 0; i < 64; ++i) {
+                if (i < 32) {
+                    r[i] = channel_to_fp16(i, 5, 31) * 19595u;
+                    b[i] = channel_to_fp16(i, 5, 31) * 7471u;
+                }
+                g[i] = channel_to_fp16(i, 6, 63) * 38470u;
+            }
+        }
+    };
+    static void convert(const uint8_t* src, uint8_t* dst, size_t count) {
+        using src_t = rgb_pixel<16>;
+        using ch_t = gsc_pixel<8>::channel_by_index_unchecked<0>;
+        static const table lut;
+        while (count--) {
+            const src_t::int_type s = span_load<src_t>(src).native_value;
+            const uint32_t l = (uint32_t)(((uint64_t)lut.r[span_channel<src_t, 0>(s)] + lut.g[span_channel<src_t, 1>(s)] + lut.b[span_channel<src_t, 2>(s)]) >> 16);
+            *dst++ = fp16_to_channel<ch_t>(l);
+            src += 2;
+        }
+    }
+};
+}  // namespace helpers
+// indicates whether convert_span() can convert between the pixel types
+template <typename SrcPixel, typename DstPixel>
+struct span_convertible {
+    constexpr static const bool value = SrcPixel::byte_aligned && DstPixel::byte_aligned &&
+                                        !SrcPixel::template has_channel_names<channel_name::index>::value &&
+                                        !DstPixel::template has_channel_names<channel_name::index>::value;
+};
+// indicates whether convert_span() can convert the pixel types through a lookup table
+template <typename SrcPixel, typename DstPixel>
+struct span_lut_convertible {
+    constexpr static const bool value = SrcPixel::template has_channel_names<channel_name::index>::value &&
+                                        SrcPixel::channels == 1 && 0 == (8 % SrcPixel::bit_depth) &&
+                                        DstPixel::byte_aligned &&
+                                        !DstPixel::template has_channel_names<channel_name::index>::value;
+};
+namespace helpers {
+// 0 when convert_span() can't convert between the pixel types, 1 when it can directly, and 2 when it needs a lookup table
+template <typename SrcPixel, typename DstPixel>
+struct span_conversion_kind {
+    constexpr static const int value = span_convertible<SrcPixel, DstPixel>::value ? 1 : span_lut_convertible<SrcPixel, DstPixel>::value ? 2 : 0;
+};
+}  // namespace helpers
+// converts count pixels at src to count pixels at dst, both stored the way
+// bitmaps store them. The result is the same as convert() on each pixel, and
+// the common pairs between RGB565, RGB888, RGBA8888 and 8-bit grayscale have
+// faster specializations. Alpha is dropped, not blended
+template <typename SrcPixel, typename DstPixel>
+inline void convert_span(const void* src, void* dst, size_t count) {
+    static_assert(span_convertible<SrcPixel, DstPixel>::value, "The pixels must be byte aligned and not indexed");
+    helpers::span_converter<SrcPixel, DstPixel>::convert((const uint8_t*)src, (uint8_t*)dst, count);
+}
+// converts count indexed pixels at src to count pixels at dst by looking each
+// one up in lut, which has an entry for every index. src_offset is how many
+// pixels into src to start, for pixels smaller than a byte
+template <typename SrcPixel, typename DstPixel>
+inline void convert_span(const void* src, void* dst, size_t count, const DstPixel* lut, size_t src_offset = 0) {
+    static_assert(span_lut_convertible<SrcPixel, DstPixel>::value, "The source must be indexed, at most 8 bits, and the destination byte aligned and not indexed");
+    constexpr static const size_t bit_depth = SrcPixel::bit_depth;
+    constexpr static const uint8_t mask = uint8_t((1 << bit_depth) - 1);
+    const uint8_t* psrc = (const uint8_t*)src;
+    uint8_t* pdst = (uint8_t*)dst;
+    size_t bit = src_offset * bit_depth;
+    while (count--) {
+        // pixels fill each byte from the most significant bit
+        const uint8_t index = (psrc[bit / 8] >> (8 - bit_depth - (bit % 8))) & mask;
+        helpers::span_store(pdst, lut[index]);
+        pdst += DstPixel::packed_size;
+        bit += bit_depth;
+    }
+}
+// fills lut with the destination pixel for every index of the source, for convert_span()
+template <typename Destination, typename Source>
+gfx_result convert_span_lut(Destination& destination, const Source& source, typename Destination::pixel_type* lut) {
+    using src_t = typename Source::pixel_type;
+    static_assert(span_lut_convertible<src_t, typename Destination::pixel_type>::value, "The source must be indexed, at most 8 bits, and the destination byte aligned and not indexed");
+    for (size_t i = 0; i < (size_t(1) << src_t::bit_depth); ++i) {
+        src_t px;
+        px.template channel<0>(typename src_t::template channel_by_index<0>::int_type(i));
+        const gfx_result r = convert_palette(destination, source, px, &lut[i]);
+        if (r != gfx_result::success) {
+            return r;
+        }
+    }
+    return gfx_result::success;
+}
+}  // namespace gfx
+#endif
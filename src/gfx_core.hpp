@@ -8,6 +8,10 @@
 #endif
 #endif
 //#define HTCW_GFX_NO_SWAP
+//#define HTCW_GFX_NO_THREADS
+#if !defined(HTCW_GFX_NO_THREADS) && !defined(ARDUINO) && !defined(ESP_PLATFORM) && (defined(__linux__) || defined(__APPLE__) || defined(_WIN32))
+    #define HTCW_GFX_THREADS
+#endif
 #ifdef GFX_BIG_ENDIAN
     #define HTCW_BIG_ENDIAN
 #endif
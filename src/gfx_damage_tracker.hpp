@@ -0,0 +1,255 @@
+#ifndef HTCW_GFX_DAMAGE_TRACKER_HPP
+#define HTCW_GFX_DAMAGE_TRACKER_HPP
+#include "gfx_core.hpp"
+#include "gfx_positioning.hpp"
+#include "gfx_bitmap.hpp"
+namespace gfx {
+namespace helpers {
+// the draw destination side of damage_tracker, plus the dirty rectangle set
+template <typename Destination, size_t MaxRects>
+class damage_tracker_base {
+    static_assert(MaxRects > 0, "MaxRects must be at least 1");
+
+   public:
+    using type = damage_tracker_base;
+    using pixel_type = typename Destination::pixel_type;
+    using palette_type = typename Destination::palette_type;
+    // a separate rectangle costs about as much to flush as this many extra pixels,
+    // so nearby rectangles are merged if that wastes no more than this
+    constexpr static const size_t merge_slack = 64;
+
+   protected:
+    Destination* m_destination;
+    // written by span(), which is const
+    mutable rect16 m_rects[MaxRects];
+    mutable size_t m_count;
+    mutable bool m_batching;
+    mutable rect16 m_batch;
+    // removes the rectangle at index, not preserving order
+    void remove_at(size_t index) const {
+        m_rects[index] = m_rects[--m_count];
+    }
+    // adds r to the set, merging it with any rectangle it touches or that it can share a window with for little waste
+    void mark(const rect16& rect) const {
+        const rect16 b = bounds();
+        rect16 r = rect.normalize();
+        if (!r.intersects(b)) {
+            return;
+        }
+        r = r.crop(b);
+        // successive draws usually land in the last rectangle touched
+        if (m_count > 0 && m_rects[m_count - 1].contains(r)) {
+            return;
+        }
+        bool merged = true;
+        while (merged) {
+            merged = false;
+            const size_t ra = r.area();
+            for (size_t i = 0; i < m_count; ++i) {
+                const rect16& e = m_rects[i];
+                if (e.contains(r)) {
+                    return;
+                }
+                const rect16 u = e.merge(r);
+                const size_t ea = e.area();
+                if (r.intersects(e) || u.area() <= ea + ra + ((ea + ra) >> 2) + merge_slack) {
+                    // the union can reach other rectangles, so start over
+                    r = u;
+                    remove_at(i);
+                    merged = true;
+                    break;
+                }
+            }
+            if (!merged && m_count == MaxRects) {
+                // full: fold r into the rectangle whose union grows the least
+                size_t best = 0;
+                size_t best_growth = (size_t)-1;
+                for (size_t i = 0; i < m_count; ++i) {
+                    const size_t g = m_rects[i].merge(r).area() - m_rects[i].area();
+                    if (g < best_growth) {
+                        best_growth = g;
+                        best = i;
+                    }
+                }
+                r = m_rects[best].merge(r);
+                remove_at(best);
+                merged = true;
+            }
+        }
+        m_rects[m_count++] = r;
+    }
+
+   public:
+    damage_tracker_base(Destination& destination) : m_destination(&destination), m_count(0), m_batching(false) {
+    }
+    // the wrapped draw target
+    inline Destination& destination() const {
+        return *m_destination;
+    }
+    inline size16 dimensions() const {
+        return m_destination->dimensions();
+    }
+    inline rect16 bounds() const {
+        return dimensions().bounds();
+    }
+    inline const palette_type* palette() const {
+        return m_destination->palette();
+    }
+    // indicates the number of dirty rectangles
+    inline size_t count() const {
+        return m_count;
+    }
+    // retrieves the dirty rectangle at index. The rectangles never overlap
+    inline const rect16& operator[](size_t index) const {
+        return m_rects[index];
+    }
+    // indicates whether anything was drawn since the last flush
+    inline bool dirty() const {
+        return m_count != 0;
+    }
+    // indicates the total number of dirty pixels
+    size_t dirty_area() const {
+        size_t result = 0;
+        for (size_t i = 0; i < m_count; ++i) {
+            result += m_rects[i].area();
+        }
+        return result;
+    }
+    // marks a region as changed, for writes made around the tracker
+    inline void invalidate(const rect16& bounds) {
+        mark(bounds);
+    }
+    // marks the whole target as changed
+    inline void invalidate() {
+        m_rects[0] = bounds();
+        m_count = 1;
+    }
+    // forgets all changes without flushing them
+    inline void clear_damage() {
+        m_count = 0;
+    }
+    // calls flush for every dirty rectangle, then forgets them.
+    // if flush fails, the rectangles not yet flushed are kept and the error is returned
+    gfx_result flush(gfx_result (*flush)(Destination& destination, const rect16& bounds, void* state), void* state = nullptr) {
+        if (flush == nullptr) {
+            return gfx_result::invalid_argument;
+        }
+        while (m_count > 0) {
+            const gfx_result r = flush(*m_destination, m_rects[m_count - 1], state);
+            if (r != gfx_result::success) {
+                return r;
+            }
+            --m_count;
+        }
+        return gfx_result::success;
+    }
+    gfx_result point(point16 location, pixel_type* out_pixel) const {
+        return m_destination->point(location, out_pixel);
+    }
+    gfx_result point(point16 location, pixel_type color) {
+        const gfx_result r = m_destination->point(location, color);
+        if (r == gfx_result::success) {
+            mark(rect16(location, location));
+        }
+        return r;
+    }
+    gfx_result fill(const rect16& bounds, pixel_type color) {
+        const gfx_result r = m_destination->fill(bounds, color);
+        if (r == gfx_result::success) {
+            mark(bounds);
+        }
+        return r;
+    }
+    gfx_result clear(const rect16& bounds) {
+        const gfx_result r = m_destination->clear(bounds);
+        if (r == gfx_result::success) {
+            mark(bounds);
+        }
+        return r;
+    }
+    template <typename Source>
+    gfx_result copy_from(const rect16& src_rect, const Source& src, point16 location) {
+        const gfx_result r = m_destination->copy_from(src_rect, src, location);
+        if (r == gfx_result::success) {
+            mark(rect16(location, src_rect.dimensions()));
+        }
+        return r;
+    }
+    template <typename Target>
+    inline gfx_result copy_to(const rect16& src_rect, Target& dst, point16 location) const {
+        return m_destination->copy_to(src_rect, dst, location);
+    }
+    // the window is marked when the batch is committed
+    gfx_result begin_batch(const rect16& bounds) {
+        const gfx_result r = m_destination->begin_batch(bounds);
+        if (r == gfx_result::success) {
+            m_batching = true;
+            m_batch = bounds;
+        }
+        return r;
+    }
+    inline gfx_result write_batch(pixel_type color) {
+        return m_destination->write_batch(color);
+    }
+    gfx_result commit_batch() {
+        const gfx_result r = m_destination->commit_batch();
+        if (m_batching) {
+            m_batching = false;
+            mark(m_batch);
+        }
+        return r;
+    }
+    inline gfx_result suspend() {
+        return m_destination->suspend();
+    }
+    inline gfx_result resume(bool force = false) {
+        return m_destination->resume(force);
+    }
+};
+template <typename Destination, size_t MaxRects, bool BltSpans>
+class damage_tracker_impl : public damage_tracker_base<Destination, MaxRects> {
+   public:
+    damage_tracker_impl(Destination& destination) : damage_tracker_base<Destination, MaxRects>(destination) {
+    }
+};
+// span access is passed through. The tracker can't see how much of a span gets written,
+// so the row is marked from location to its right edge
+template <typename Destination, size_t MaxRects>
+class damage_tracker_impl<Destination, MaxRects, true> : public damage_tracker_base<Destination, MaxRects>, public blt_span {
+   public:
+    damage_tracker_impl(Destination& destination) : damage_tracker_base<Destination, MaxRects>(destination) {
+    }
+    virtual size16 span_dimensions() const override {
+        return this->m_destination->span_dimensions();
+    }
+    virtual size_t pixel_width() const override {
+        return this->m_destination->pixel_width();
+    }
+    virtual gfx_span span(point16 location) const override {
+        const gfx_span result = this->m_destination->span(location);
+        if (result.length != 0) {
+            this->mark(rect16(location.x, location.y, this->dimensions().width - 1, location.y));
+        }
+        return result;
+    }
+    virtual const gfx_cspan cspan(point16 location) const override {
+        return this->m_destination->cspan(location);
+    }
+};
+}  // namespace helpers
+// wraps a draw destination and records which parts of it are drawn to, as a set of at most MaxRects
+// non-overlapping rectangles. Use it in place of the destination, then flush() to send just the changes
+template <typename Destination, size_t MaxRects = 8>
+class damage_tracker final : public helpers::damage_tracker_impl<Destination, MaxRects, Destination::caps::blt_spans> {
+    using base_type = helpers::damage_tracker_impl<Destination, MaxRects, Destination::caps::blt_spans>;
+
+   public:
+    using type = damage_tracker;
+    using pixel_type = typename Destination::pixel_type;
+    using palette_type = typename Destination::palette_type;
+    using caps = gfx::gfx_caps<false, Destination::caps::blt_spans, Destination::caps::copy_from, Destination::caps::copy_to>;
+    damage_tracker(Destination& destination) : base_type(destination) {
+    }
+};
+}  // namespace gfx
+#endif
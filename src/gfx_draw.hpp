@@ -23,6 +23,7 @@
 #include "gfx_draw_aa_polygon.hpp"
 #include "gfx_draw_aa_rounded_rectangle.hpp"
 #include "gfx_draw_aa_filled_rounded_rectangle.hpp"
+#include "gfx_draw_mask.hpp"
 #include "gfx_draw_canvas.hpp"
 namespace gfx {
 struct draw : public helpers::xdraw_point, 
@@ -47,6 +48,7 @@ struct draw : public helpers::xdraw_point,
             public helpers::xdraw_aa_polygon,
             public helpers::xdraw_aa_rounded_rectangle,
             public helpers::xdraw_aa_filled_rounded_rectangle,
+            public helpers::xdraw_mask,
             public helpers::xdraw_canvas
 {};
 }
@@ -322,6 +322,7 @@ public:
     // cache: optional draw cache to reuse across calls.
     template <typename Destination, typename PixelType>
     inline static gfx_result aa_arc(Destination& destination, const rect16& rect, PixelType color, int16_t start_angle, int16_t end_angle, int16_t width, line_cap cap = line_cap::butt, mask_draw_cache* cache = nullptr,const srect16* clip = nullptr) {
+        HTCW_GFX_PROFILE_SCOPE("aa_arc");
         return aa_arc_impl(destination, (srect16)rect, color, start_angle, end_angle, width, cap, cache, clip);
     }
     // draws an anti-aliased circular arc whose outer edge sits at the largest
@@ -332,6 +333,7 @@ public:
     // cache: optional draw cache to reuse across calls.
     template <typename Destination, typename PixelType>
     inline static gfx_result aa_arc(Destination& destination, const srect16& rect, PixelType color, int16_t start_angle, int16_t end_angle, int16_t width, line_cap cap = line_cap::butt, mask_draw_cache* cache = nullptr, const srect16* clip = nullptr) {
+        HTCW_GFX_PROFILE_SCOPE("aa_arc");
         return aa_arc_impl(destination, rect, color, start_angle, end_angle, width, cap, cache, clip);
     }
 };
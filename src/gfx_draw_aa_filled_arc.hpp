@@ -252,6 +252,7 @@ public:
     // cache: optional draw cache to reuse across calls.
     template <typename Destination, typename PixelType>
     inline static gfx_result aa_filled_arc(Destination& destination, const rect16& bounds, PixelType color, int16_t start_angle, int16_t end_angle, mask_draw_cache* cache = nullptr, const srect16* clip = nullptr) {
+        HTCW_GFX_PROFILE_SCOPE("aa_filled_arc");
         return aa_filled_arc_impl(destination, (srect16)bounds, color, start_angle, end_angle, cache, clip);
     }
     // draws an anti-aliased filled arc (pie wedge) inscribed in the largest
@@ -261,6 +262,7 @@ public:
     // cache: optional draw cache to reuse across calls.
     template <typename Destination, typename PixelType>
     inline static gfx_result aa_filled_arc(Destination& destination, const srect16& bounds, PixelType color, int16_t start_angle, int16_t end_angle, mask_draw_cache* cache = nullptr, const srect16* clip = nullptr) {
+        HTCW_GFX_PROFILE_SCOPE("aa_filled_arc");
         return aa_filled_arc_impl(destination, bounds, color, start_angle, end_angle, cache, clip);
     }
 };
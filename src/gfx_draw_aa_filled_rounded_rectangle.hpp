@@ -221,6 +221,7 @@ public:
     // clip: optional clipping rectangle. cache: optional draw cache to reuse.
     template <typename Destination, typename PixelType>
     inline static gfx_result aa_filled_rounded_rectangle(Destination& destination, const rect16& rect, PixelType color, int16_t radius, mask_draw_cache* cache = nullptr, const srect16* clip = nullptr) {
+        HTCW_GFX_PROFILE_SCOPE("aa_filled_rounded_rectangle");
         return aa_filled_rounded_rectangle_impl(destination, (srect16)rect, color, radius, cache, clip);
     }
     // draws an anti-aliased filled rounded rectangle with a uniform circular corner
@@ -228,6 +229,7 @@ public:
     // clip: optional clipping rectangle. cache: optional draw cache to reuse.
     template <typename Destination, typename PixelType>
     inline static gfx_result aa_filled_rounded_rectangle(Destination& destination, const srect16& rect, PixelType color, int16_t radius, mask_draw_cache* cache = nullptr, const srect16* clip = nullptr) {
+        HTCW_GFX_PROFILE_SCOPE("aa_filled_rounded_rectangle");
         return aa_filled_rounded_rectangle_impl(destination, rect, color, radius, cache, clip);
     }
 };
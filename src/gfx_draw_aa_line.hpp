@@ -224,6 +224,7 @@ class xdraw_aa_line {
     // cache: optional draw cache to reuse across calls.
     template <typename Destination, typename PixelType>
     inline static gfx_result aa_line(Destination& destination, const rect16& rect, PixelType color, int16_t width, line_cap cap = line_cap::butt, mask_draw_cache* cache = nullptr, const srect16* clip = nullptr) {
+        HTCW_GFX_PROFILE_SCOPE("aa_line");
         return aa_line_impl(destination, (srect16)rect, color, width, cap, cache, clip);
     }
     // draws an anti-aliased line of the given width (>= 0), color and end cap.
@@ -231,6 +232,7 @@ class xdraw_aa_line {
     // cache: optional draw cache to reuse across calls.
     template <typename Destination, typename PixelType>
     inline static gfx_result aa_line(Destination& destination, const srect16& rect, PixelType color, int16_t width, line_cap cap = line_cap::butt, mask_draw_cache* cache = nullptr, const srect16* clip = nullptr) {
+        HTCW_GFX_PROFILE_SCOPE("aa_line");
         return aa_line_impl(destination, rect, color, width, cap, cache, clip);
     }
 };
@@ -371,6 +371,7 @@ public:
                                         int16_t miter_limit = 4,
                                         mask_draw_cache* cache = nullptr,
                                         const srect16* clip = nullptr) {
+        HTCW_GFX_PROFILE_SCOPE("aa_polygon");
         return aa_polygon_impl(destination, (spath16)path, color, width, join, miter_limit, cache, clip);
     }
     // draws an anti-aliased closed polygon outline of the given width (>= 0),
@@ -386,6 +387,7 @@ public:
                                         int16_t miter_limit = 4,
                                         mask_draw_cache* cache = nullptr,
                                         const srect16* clip = nullptr) {
+        HTCW_GFX_PROFILE_SCOPE("aa_polygon");
         return aa_polygon_impl(destination, path, color, width, join, miter_limit, cache, clip);
     }
 };
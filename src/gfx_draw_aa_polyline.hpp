@@ -390,6 +390,7 @@ public:
                                          int16_t miter_limit = 4,
                                          mask_draw_cache* cache = nullptr,
                                          const srect16* clip = nullptr) {
+        HTCW_GFX_PROFILE_SCOPE("aa_polyline");
         return aa_polyline_impl(destination, path, color, width, cap, join, miter_limit, cache, clip);
     }
 };
@@ -174,6 +174,7 @@ public:
     // clip: optional clipping rectangle. cache: optional draw cache to reuse.
     template <typename Destination, typename PixelType>
     inline static gfx_result aa_rounded_rectangle(Destination& destination, const rect16& rect, PixelType color, int16_t radius, int16_t width, mask_draw_cache* cache = nullptr, const srect16* clip = nullptr) {
+        HTCW_GFX_PROFILE_SCOPE("aa_rounded_rectangle");
         return aa_rounded_rectangle_impl(destination, (srect16)rect, color, radius, width, cache, clip);
     }
     // draws an anti-aliased hollow rounded rectangle with a uniform circular corner
@@ -183,6 +184,7 @@ public:
     // clip: optional clipping rectangle. cache: optional draw cache to reuse.
     template <typename Destination, typename PixelType>
     inline static gfx_result aa_rounded_rectangle(Destination& destination, const srect16& rect, PixelType color, int16_t radius, int16_t width, mask_draw_cache* cache = nullptr, const srect16* clip = nullptr) {
+        HTCW_GFX_PROFILE_SCOPE("aa_rounded_rectangle");
         return aa_rounded_rectangle_impl(destination, rect, color, radius, width, cache, clip);
     }
 };
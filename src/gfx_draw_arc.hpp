@@ -203,21 +203,25 @@ public:
     // draws an arc with the specified dimensions and of the specified color, with an optional clipping rectangle
     template <typename Destination, typename PixelType>
     inline static gfx_result arc(Destination& destination, const srect16& rect, PixelType color, const srect16* clip = nullptr) {
+        HTCW_GFX_PROFILE_SCOPE("arc");
         return arc_impl(destination, rect, color, clip, false);
     }
     // draws an arc with the specified dimensions and of the specified color, with an optional clipping rectangle
     template <typename Destination, typename PixelType>
     inline static gfx_result arc(Destination& destination, const rect16& rect, PixelType color, const srect16* clip = nullptr) {
+        HTCW_GFX_PROFILE_SCOPE("arc");
         return arc(destination, (srect16)rect, color, clip);
     }
     // draws a arc with the specified dimensions and of the specified color, with an optional clipping rectangle
     template <typename Destination, typename PixelType>
     inline static gfx_result filled_arc(Destination& destination, const srect16& rect, PixelType color, const srect16* clip = nullptr) {
+        HTCW_GFX_PROFILE_SCOPE("filled_arc");
         return arc_impl(destination, rect, color, clip, true);
     }
     // draws a arc with the specified dimensions and of the specified color, with an optional clipping rectangle
     template <typename Destination, typename PixelType>
     inline static gfx_result filled_arc(Destination& destination, const rect16& rect, PixelType color, const srect16* clip = nullptr) {
+        HTCW_GFX_PROFILE_SCOPE("filled_arc");
         return filled_arc(destination, rect, color, clip);
     }
 
@@ -20,30 +20,27 @@ class xdraw_bitmap {
         point16 dst_loc;
     };
     static bool venn_rects(size16 dst_dim, const srect16& dst_rect, size16 src_dim, const rect16& src_rect, const srect16* clip,rect_info* out_result) {
-        srect16 dstr = dst_rect.normalize();
+        const srect16 dr = dst_rect.normalize();
         rect16 srcr = src_rect.normalize().crop(src_dim.bounds());
-        if(!srcr.intersects(src_dim.bounds()) || !dstr.intersects((srect16)dst_dim.bounds())) {
+        if(!srcr.intersects(src_dim.bounds()) || !dr.intersects((srect16)dst_dim.bounds())) {
             return false;
         }
-        int sofx = srcr.x1,sofy=srcr.y1;
-        if(dstr.x1<0) {
-            sofx+=-dstr.x1;
-            dstr.x1 = 0;
-        }
-        if(dstr.y1<0) {
-            sofy+=-dstr.y1;
-            dstr.y1 = 0;
-        }
+        srect16 dstr = dr.crop((srect16)dst_dim.bounds());
         if(clip!=nullptr) {
+            if(!dstr.intersects(*clip)) {
+                return false;
+            }
             dstr=dstr.crop(*clip);
         }
-        if(!dstr.intersects((srect16)dst_dim.bounds())) {
+        // whatever was cropped off the top left of the destination is skipped in the source
+        const int sofx = srcr.x1+(dstr.x1-dr.x1),sofy=srcr.y1+(dstr.y1-dr.y1);
+        if(sofx>srcr.x2 || sofy>srcr.y2) {
             return false;
         }
         out_result->dst_loc = (point16)dstr.point1();
         out_result->src_loc = point16(sofx,sofy);
-        out_result->width = math::min_(dstr.x2-dstr.x1+1,srcr.width()-sofx);
-        out_result->height = math::min_(dstr.y2-dstr.y1+1,srcr.height()-sofx);
+        out_result->width = math::min_(dstr.x2-dstr.x1+1,srcr.x2-sofx+1);
+        out_result->height = math::min_(dstr.y2-dstr.y1+1,srcr.y2-sofy+1);
         return true;
     }
     template <typename Destination, typename Source, bool CopyFrom, bool CopyTo, bool BltDst, bool BltSrc>
@@ -347,11 +344,84 @@ class xdraw_bitmap {
         }
     };
     
+    // converts the rows of a crop between bitmaps of different pixel types with convert_span()
+    template<typename Destination, typename Source, int Kind>
+    struct bmp_convert_span_helper {
+        static gfx_result draw_bitmap(Destination& destination, const rect_info& ri, Source& source) {
+            (void)destination;(void)ri;(void)source;
+            return gfx_result::not_supported;
+        }
+    };
+    template<typename Destination, typename Source>
+    struct bmp_convert_span_helper<Destination,Source,1> {
+        static gfx_result draw_bitmap(Destination& destination, const rect_info& ri, Source& source) {
+            using src_t = typename Source::pixel_type;
+            using dst_t = typename Destination::pixel_type;
+            blt_span& dst = destination;
+            const const_blt_span& src = source;
+            for (int y = 0; y < ri.height; ++y) {
+                const point16 dpt(ri.dst_loc.x,ri.dst_loc.y+y);
+                const point16 spt(ri.src_loc.x,ri.src_loc.y+y);
+                gfx_span dst_sp = dst.span(dpt);
+                gfx_cspan src_csp = src.cspan(spt);
+                bool direct = dst_sp.data!=nullptr && src_csp.cdata!=nullptr &&
+                    dst_sp.length>=ri.width*dst_t::packed_size && src_csp.length>=ri.width*src_t::packed_size;
+                // pixels that aren't opaque are blended, so those rows are drawn a pixel at a time
+                for (int x = 0; src_t::has_alpha && direct && x < ri.width; ++x) {
+                    direct = helpers::span_load<src_t>(src_csp.cdata+x*src_t::packed_size).opacity8()==255;
+                }
+                if(direct) {
+                    convert_span<src_t,dst_t>(src_csp.cdata,dst_sp.data,ri.width);
+                } else {
+                    const gfx_result r = bmp_helper<Destination, Source, dst_t, src_t>::draw_bitmap(destination, srect16((spoint16)dpt,ssize16(ri.width,1)), source, rect16(spt,size16(ri.width,1)), bitmap_resize::crop, nullptr, nullptr);
+                    if(r!=gfx_result::success) {
+                        return r;
+                    }
+                }
+            }
+            return gfx_result::success;
+        }
+    };
+    template<typename Destination, typename Source>
+    struct bmp_convert_span_helper<Destination,Source,2> {
+        static gfx_result draw_bitmap(Destination& destination, const rect_info& ri, Source& source) {
+            using src_t = typename Source::pixel_type;
+            using dst_t = typename Destination::pixel_type;
+            constexpr static const size_t lut_size = size_t(1)<<src_t::bit_depth;
+            // building the table costs a conversion per entry
+            if((size_t)ri.width*ri.height<lut_size) {
+                return gfx_result::not_supported;
+            }
+            dst_t lut[lut_size];
+            gfx_result r = convert_span_lut(destination,source,lut);
+            if(r!=gfx_result::success) {
+                return r;
+            }
+            blt_span& dst = destination;
+            const const_blt_span& src = source;
+            for (int y = 0; y < ri.height; ++y) {
+                const point16 dpt(ri.dst_loc.x,ri.dst_loc.y+y);
+                const point16 spt(ri.src_loc.x,ri.src_loc.y+y);
+                gfx_span dst_sp = dst.span(dpt);
+                gfx_cspan src_csp = src.cspan(spt);
+                if(dst_sp.data!=nullptr && src_csp.cdata!=nullptr &&
+                    dst_sp.length>=ri.width*dst_t::packed_size && src_csp.length>=ri.width*src_t::packed_size) {
+                    convert_span<src_t,dst_t>(src_csp.cdata,dst_sp.data,ri.width,lut);
+                } else {
+                    r = bmp_helper<Destination, Source, dst_t, src_t>::draw_bitmap(destination, srect16((spoint16)dpt,ssize16(ri.width,1)), source, rect16(spt,size16(ri.width,1)), bitmap_resize::crop, nullptr, nullptr);
+                    if(r!=gfx_result::success) {
+                        return r;
+                    }
+                }
+            }
+            return gfx_result::success;
+        }
+    };
     template<typename Destination, typename Source>
     struct bmp_blt_span_helper<Destination,Source,true,true> {
         static gfx_result draw_bitmap(Destination& destination, const srect16& dest_rect, Source& source, const rect16& source_rect, bitmap_resize resize_type, const typename Source::pixel_type* transparent_color, const srect16* clip) {
             // rule out optimization
-            if(resize_type!=bitmap_resize::crop || transparent_color!=nullptr) {
+            if(resize_type!=bitmap_resize::crop || transparent_color!=nullptr || dest_rect.orientation()!=rect_orientation::normalized) {
                 return bmp_helper<Destination, Source, typename Destination::pixel_type, typename Source::pixel_type>::draw_bitmap(destination, dest_rect, source, source_rect, resize_type, transparent_color, clip);
             }
             rect_info ri;
@@ -379,6 +449,10 @@ class xdraw_bitmap {
                     ++sy;
                 }
             } else {
+                const gfx_result r = bmp_convert_span_helper<Destination,Source,helpers::span_conversion_kind<typename Source::pixel_type,typename Destination::pixel_type>::value>::draw_bitmap(destination,ri,source);
+                if(r!=gfx_result::not_supported) {
+                    return r;
+                }
                 return bmp_blt_span_helper<Destination, Source, false,false>::draw_bitmap(destination, dest_rect, source, source_rect, resize_type, transparent_color, clip); 
             }
             return gfx_result::success;
@@ -388,12 +462,14 @@ class xdraw_bitmap {
     // draws a portion of a bitmap or display buffer to the specified rectangle with an optional clipping rentangle
     template <typename Destination, typename Source>
     static inline gfx_result bitmap(Destination& destination, const srect16& dest_rect, Source& source, const rect16& source_rect, bitmap_resize resize_type = bitmap_resize::crop, const typename Source::pixel_type* transparent_color = nullptr, const srect16* clip = nullptr) {
+        HTCW_GFX_PROFILE_SCOPE("bitmap");
         return bmp_blt_span_helper<Destination, Source, Destination::caps::blt_spans,Source::caps::blt_spans>::draw_bitmap(destination, dest_rect, source, source_rect, resize_type, transparent_color, clip);
         //return bmp_helper<Destination,Source,typename Destination::pixel_type,typename Source::pixel_type>::draw_bitmap(destination, dest_rect, source, source_rect, resize_type, transparent_color, clip);
     }
     // draws a portion of a bitmap or display buffer to the specified rectangle with an optional clipping rentangle
     template <typename Destination, typename Source>
     static inline gfx_result bitmap(Destination& destination, const rect16& dest_rect, Source& source, const rect16& source_rect, bitmap_resize resize_type = bitmap_resize::crop, const typename Source::pixel_type* transparent_color = nullptr, const srect16* clip = nullptr) {
+        HTCW_GFX_PROFILE_SCOPE("bitmap");
         return bitmap(destination,(srect16)dest_rect,source,source_rect,resize_type,transparent_color,clip);
     }
     
@@ -11,6 +11,7 @@ template <typename Destination>
 struct xdraw_canvas_state {
     Destination* dest;
     rect16 bounds;
+    spoint16 location;
 };
 // CALLBACK MODE WRITE
 template <typename Destination>
@@ -20,10 +21,11 @@ static gfx_result xdraw_canvas_write_callback(const rect16& bounds,
     st_t& s = *(st_t*)state;
     typename Destination::pixel_type col;
     convert_palette_from(*s.dest, color, &col);
-    if(!bounds.intersects(s.bounds)) {
+    srect16 sb = ((srect16)bounds).offset(s.location);
+    if(!sb.intersects((srect16)s.bounds)) {
         return gfx_result::success;
     }
-    rect16 b = bounds.crop(s.bounds);
+    rect16 b = (rect16)sb.crop((srect16)s.bounds);
     return s.dest->fill(b, col);
 }
 // CALLBACK MODE READ
@@ -33,7 +35,7 @@ static gfx_result xdraw_canvas_read_callback(point16 location,
                                              void* state) {
     using st_t = xdraw_canvas_state<Destination>;
     st_t& s = *(st_t*)state;
-    spoint16 pt = ((spoint16)location);
+    spoint16 pt = ((spoint16)location).offset(s.location);
     if (((srect16)s.bounds).intersects(pt)) {
         typename Destination::pixel_type col;
         s.dest->point((point16)pt, &col);
@@ -71,15 +73,15 @@ struct xdraw_canvas_binder {
             return gfx_result::success;
         }
         using st_t = xdraw_canvas_state<Destination>;
-        st_t* st = (st_t*)malloc(sizeof(st_t));
+        // the canvas frees this with the callbacks
+        st_t* st = (st_t*)in_canvas.allocator()(sizeof(st_t));
         if (st == nullptr) {
             return gfx_result::out_of_memory;
         }
-        size16 dim = (size16)b.dimensions();
-
         st->dest = &destination;
-        st->bounds = (rect16)b;
-        in_canvas.callbacks(dim,spoint16(-b.x1,-b.y1),xdraw_canvas_read_callback<Destination>,xdraw_canvas_write_callback<Destination>,st,::free);
+        st->bounds = (rect16)b.crop((srect16)destination.bounds());
+        st->location = location;
+        in_canvas.callbacks((size16)destination.dimensions(),location,xdraw_canvas_read_callback<Destination>,xdraw_canvas_write_callback<Destination>,st,in_canvas.deallocator());
         return gfx_result::success;
     }
 };
@@ -108,38 +110,190 @@ struct xdraw_canvas_binder<Destination,true> {
             in_canvas.direct(nullptr, {0, 0}, {0, 0}, nullptr, nullptr);
             return gfx_result::success;
         }
+        const spoint16 offset(-location.x,-location.y);
+        const srect16* bclip = clip==nullptr?nullptr:&b;
         if(helpers::is_same<pixel_t,rgba_pixel<32>>::value) {
             return in_canvas.direct(&destination,
-                                (size16)b.dimensions(), spoint16(-b.x1,-b.y1),
-                                helpers::xread_callback_rgba32p, helpers::xwrite_callback_rgba32);
+                                (size16)destination.dimensions(), offset,
+                                helpers::xread_callback_rgba32p, helpers::xwrite_callback_rgba32, bclip);
         } else if(helpers::is_same<pixel_t,rgb_pixel<16>>::value) {
             return in_canvas.direct(&destination,
-                            (size16)b.dimensions(), spoint16(-b.x1,-b.y1),
-                            helpers::xread_callback_rgb16, helpers::xwrite_callback_rgb16);    
+                            (size16)destination.dimensions(), offset,
+                            helpers::xread_callback_rgb16, helpers::xwrite_callback_rgb16, bclip);    
         } else if(helpers::is_same<pixel_t,gsc_pixel<8>>::value) {
             return in_canvas.direct(&destination,
-                            (size16)b.dimensions(), spoint16(-b.x1,-b.y1),
-                            helpers::xread_callback_gsc8, helpers::xwrite_callback_gsc8);    
+                            (size16)destination.dimensions(), offset,
+                            helpers::xread_callback_gsc8, helpers::xwrite_callback_gsc8, bclip);    
         } 
         return in_canvas.direct(&destination,
-                        (size16)b.dimensions(), spoint16(-b.x1,-b.y1),
-                        helpers::xread_callback_any<Destination>, helpers::xwrite_callback_any<Destination>);    
+                        (size16)destination.dimensions(), offset,
+                        helpers::xread_callback_any<Destination>, helpers::xwrite_callback_any<Destination>, bclip);    
     }
 };
 
+template <typename Destination>
+struct xdraw_canvas_parallel_state {
+    Destination* destination;
+    size16 dimensions;
+    spoint16 location;
+    size_t bands;
+    size_t workers;
+    int band_height;
+    gfx_result(*scene)(::gfx::canvas& destination, const srect16& band, void* state);
+    void* state;
+    gfx_result* results;
+    void*(*allocator)(size_t);
+    void*(*reallocator)(void*,size_t);
+    void(*deallocator)(void*);
+};
 class xdraw_canvas {
+    // each worker has its own canvas and renders every band from its index on, stepping by the number of workers
+    template <typename Destination>
+    static void canvas_parallel_work(size_t index, void* state) {
+        using st_t = xdraw_canvas_parallel_state<Destination>;
+        st_t& s = *(st_t*)state;
+        ::gfx::canvas cvs(s.dimensions, s.allocator, s.reallocator, s.deallocator);
+        gfx_result res = cvs.initialize();
+        for (size_t band = index; res == gfx_result::success && band < s.bands; band += s.workers) {
+            const int y = (int)band * s.band_height;
+            if (y >= s.dimensions.height) {
+                break;
+            }
+            const int y2 = y + s.band_height < s.dimensions.height ? y + s.band_height : s.dimensions.height;
+            const srect16 r(0, y, s.dimensions.width - 1, y2 - 1);
+            const srect16 clip = r.offset(s.location);
+            res = canvas(*s.destination, cvs, s.location, &clip);
+            if (res == gfx_result::success) {
+                res = s.scene(cvs, r, s.state);
+            }
+        }
+        s.results[index] = res;
+    }
+
    public:
     template <typename Destination>
     static gfx_result canvas(Destination& destination,
                              ::gfx::canvas& in_canvas, spoint16 canvas_location = spoint16::zero(),const srect16* clip = nullptr) {
+        HTCW_GFX_PROFILE_SCOPE("canvas");
         using binder_t = xdraw_canvas_binder<Destination,Destination::caps::blt_spans>;
         return binder_t::canvas(destination, in_canvas, canvas_location,clip);
     }
     template <typename Destination>
     static gfx_result canvas(Destination& destination,
                              ::gfx::canvas& in_canvas, point16 canvas_location, const srect16* clip = nullptr) {
+        HTCW_GFX_PROFILE_SCOPE("canvas");
         return canvas(destination, in_canvas, (spoint16)canvas_location,clip);
     }
+    // Renders a canvas taller than the available buffer one band at a time.
+    // Each band is as tall as band_buffer. For every band the canvas is bound
+    // so band_buffer covers that band, scene is called to draw the frame, and
+    // flush is called with the finished buffer and the band's bounds in canvas
+    // coordinates. scene must draw the same frame every time it is called.
+    // Geometry outside the current band is not rasterized.
+    template <typename Destination>
+    static gfx_result canvas_bands(Destination& band_buffer, ::gfx::canvas& in_canvas,
+                            gfx_result(*scene)(::gfx::canvas& destination, const srect16& band, void* state),
+                            gfx_result(*flush)(Destination& band_buffer, const srect16& band, void* state),
+                            void* state = nullptr) {
+        HTCW_GFX_PROFILE_SCOPE("canvas_bands");
+        if (!in_canvas.initialized()) {
+            return gfx_result::invalid_state;
+        }
+        if (scene == nullptr || band_buffer.dimensions().height == 0) {
+            return gfx_result::invalid_argument;
+        }
+        const int band_height = band_buffer.dimensions().height;
+        const int height = in_canvas.dimensions().height;
+        for (int y = 0; y < height; y += band_height) {
+            const srect16 band(0, y, in_canvas.dimensions().width - 1,
+                               (y + band_height < height ? y + band_height : height) - 1);
+            gfx_result res = canvas(band_buffer, in_canvas, spoint16(0, -y));
+            if (res != gfx_result::success) {
+                return res;
+            }
+            res = scene(in_canvas, band, state);
+            if (res != gfx_result::success) {
+                return res;
+            }
+            if (flush != nullptr) {
+                res = flush(band_buffer, band, state);
+                if (res != gfx_result::success) {
+                    return res;
+                }
+            }
+        }
+        return gfx_result::success;
+    }
+    // Renders a canvas of the given dimensions at location on destination
+    // using several threads. The canvas is split into bands of rows, and each
+    // worker renders its share of them with its own canvas, bound so it only
+    // writes inside the band. scene is called once per band, from any of the
+    // workers at once, and must draw the same frame every time. It may read
+    // shared paths and documents but must not change them. A shared
+    // canvas_shape must be rendered once beforehand, under the transform the
+    // scene uses, so the workers only read it. The output
+    // is identical to rendering the frame with a single canvas. threads is the
+    // number of workers, or 0 for canvas_thread_count(). dispatch runs the
+    // workers, and defaults to canvas_thread_dispatch() where threads are
+    // available and to running them in turn otherwise. Each worker's canvas
+    // and the per-worker results come from the allocators.
+    template <typename Destination>
+    static gfx_result canvas_parallel(Destination& destination, size16 dimensions, spoint16 location, size_t bands,
+                            gfx_result(*scene)(::gfx::canvas& destination, const srect16& band, void* state),
+                            void* state = nullptr, size_t threads = 0,
+                            canvas_dispatch_callback dispatch = nullptr, void* dispatch_state = nullptr,
+                            void*(*allocator)(size_t) = ::malloc, void*(*reallocator)(void*,size_t) = ::realloc, void(*deallocator)(void*) = ::free) {
+        HTCW_GFX_PROFILE_SCOPE("canvas_parallel");
+        static_assert(Destination::caps::blt_spans && (Destination::pixel_type::bit_depth % 8) == 0,
+                      "The destination must be a bitmap with whole byte pixels so bands can be written at once");
+        if (scene == nullptr || bands == 0 || dimensions.height == 0 || allocator == nullptr || deallocator == nullptr) {
+            return gfx_result::invalid_argument;
+        }
+        if (bands > dimensions.height) {
+            bands = dimensions.height;
+        }
+        if (threads == 0) {
+            threads = canvas_thread_count();
+        }
+        if (threads > bands) {
+            threads = bands;
+        }
+        using st_t = xdraw_canvas_parallel_state<Destination>;
+        st_t st;
+        st.destination = &destination;
+        st.dimensions = dimensions;
+        st.location = location;
+        st.bands = bands;
+        st.workers = threads;
+        st.band_height = (dimensions.height + (int)bands - 1) / (int)bands;
+        st.scene = scene;
+        st.state = state;
+        st.allocator = allocator;
+        st.reallocator = reallocator;
+        st.deallocator = deallocator;
+        st.results = (gfx_result*)allocator(sizeof(gfx_result) * threads);
+        if (st.results == nullptr) {
+            return gfx_result::out_of_memory;
+        }
+        gfx_result res = gfx_result::success;
+#ifdef HTCW_GFX_THREADS
+        if (dispatch == nullptr) {
+            dispatch = canvas_thread_dispatch;
+        }
+#endif
+        if (dispatch != nullptr) {
+            res = dispatch(threads, canvas_parallel_work<Destination>, &st, dispatch_state);
+        } else {
+            for (size_t i = 0; i < threads; ++i) {
+                canvas_parallel_work<Destination>(i, &st);
+            }
+        }
+        for (size_t i = 0; res == gfx_result::success && i < threads; ++i) {
+            res = st.results[i];
+        }
+        deallocator(st.results);
+        return res;
+    }
 };
 }  // namespace helpers
 }  // namespace gfx
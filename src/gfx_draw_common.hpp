@@ -4,6 +4,7 @@
 #include <gfx_palette.hpp>
 #include <gfx_pixel.hpp>
 #include <gfx_positioning.hpp>
+#include <gfx_profile.hpp>
 namespace gfx {
 namespace helpers {
 bool draw_translate(spoint16 in, point16* out);
@@ -768,6 +769,16 @@ gfx_result aa_row_impl(aa_row_indexed, Destination& destination, spoint16 locati
     return gfx_result::success;
 }
 
+// the fast paths write through spans, so targets without them, like displays, go per pixel
+template <typename Destination,
+          bool BltSpans = Destination::caps::blt_spans,
+          bool Indexed = Destination::pixel_type::template has_channel_names<channel_name::index>::value>
+struct aa_row_destination_tag { typedef typename aa_row_tag<typename Destination::pixel_type>::type type; };
+template <typename Destination>
+struct aa_row_destination_tag<Destination, false, false> { typedef aa_row_generic type; };
+template <typename Destination>
+struct aa_row_destination_tag<Destination, false, true> { typedef aa_row_indexed type; };
+
 } // namespace helpers
 
 // public entry: picks the tag at compile time, dispatches to the one live overload
@@ -775,7 +786,7 @@ template <typename Destination>
 gfx_result aa_rasterize_row(Destination& destination, spoint16 location,
                             const uint8_t* cov, size_t width,
                             typename Destination::pixel_type color, uint8_t alpha = 255) {
-    typename helpers::aa_row_tag<typename Destination::pixel_type>::type tag;
+    typename helpers::aa_row_destination_tag<Destination>::type tag;
     return helpers::aa_row_impl(tag, destination, location, cov, width, color, alpha);
 }
 
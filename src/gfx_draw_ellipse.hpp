@@ -130,21 +130,25 @@ public:
     // draws an ellipse with the specified dimensions and of the specified color, with an optional clipping rectangle
     template <typename Destination, typename PixelType>
     inline static gfx_result ellipse(Destination& destination, const srect16& rect, PixelType color, const srect16* clip = nullptr) {
+        HTCW_GFX_PROFILE_SCOPE("ellipse");
         return ellipse_impl(destination, rect, color, clip, false);
     }
     // draws an ellipse with the specified dimensions and of the specified color, with an optional clipping rectangle
     template <typename Destination, typename PixelType>
     inline static gfx_result ellipse(Destination& destination, const rect16& rect, PixelType color, const srect16* clip = nullptr) {
+        HTCW_GFX_PROFILE_SCOPE("ellipse");
         return ellipse(destination, (srect16)rect, color, clip);
     }
     // draws a filled ellipse with the specified dimensions and of the specified color, with an optional clipping rectangle
     template <typename Destination, typename PixelType>
     inline static gfx_result filled_ellipse(Destination& destination, const srect16& rect, PixelType color, const srect16* clip = nullptr) {
+        HTCW_GFX_PROFILE_SCOPE("filled_ellipse");
         return ellipse_impl(destination, rect, color, clip, true);
     }
     // draws a filled ellipse with the specified dimensions and of the specified color, with an optional clipping rectangle
     template <typename Destination, typename PixelType>
     inline static gfx_result filled_ellipse(Destination& destination, const rect16& rect, PixelType color, const srect16* clip = nullptr) {
+        HTCW_GFX_PROFILE_SCOPE("filled_ellipse");
         return filled_ellipse(destination, (srect16)rect, color, clip);
     }
 };
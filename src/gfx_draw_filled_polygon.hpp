@@ -289,6 +289,7 @@ class xdraw_filled_polygon {
                                             PixelType color,
                                             fill_rule rule = fill_rule::even_odd,
                                             const srect16* clip = nullptr) {
+        HTCW_GFX_PROFILE_SCOPE("filled_polygon");
         return filled_polygon_impl(destination, path, color, rule, clip);
     }
 
@@ -301,6 +302,7 @@ class xdraw_filled_polygon {
                                                fill_rule rule = fill_rule::even_odd,
                                                mask_draw_cache* cache = nullptr,
                                                const srect16* clip = nullptr) {
+        HTCW_GFX_PROFILE_SCOPE("aa_filled_polygon");
         return aa_filled_polygon_impl(destination, path, color, rule, cache, clip);
     }
 
@@ -311,6 +313,7 @@ class xdraw_filled_polygon {
                                             PixelType color,
                                             fill_rule rule = fill_rule::even_odd,
                                             const srect16* clip = nullptr) {
+        HTCW_GFX_PROFILE_SCOPE("filled_polygon");
         return filled_polygon_impl(destination, (spath16)path, color, rule, clip);
     }
 
@@ -323,6 +326,7 @@ class xdraw_filled_polygon {
                                                fill_rule rule = fill_rule::even_odd,
                                                mask_draw_cache* cache = nullptr,
                                                const srect16* clip = nullptr) {
+        HTCW_GFX_PROFILE_SCOPE("aa_filled_polygon");
         return aa_filled_polygon_impl(destination, (spath16)path, color, rule, cache, clip);
     }
 };
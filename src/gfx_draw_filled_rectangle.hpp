@@ -165,8 +165,13 @@ class xdraw_filled_rectangle {
     template <typename Destination, typename PixelType>
     static gfx_result filled_rectangle_impl(Destination& destination, const srect16& rect, PixelType color, const srect16* clip) {
         srect16 sr = rect;
-        if (nullptr != clip)
+        if (nullptr != clip) {
+            // cropping a rectangle that lies outside the clip leaves a sliver on its edge
+            if (!sr.intersects(*clip)) {
+                return gfx_result::success;
+            }
             sr = sr.crop(*clip);
+        }
         rect16 r;
         if (!draw_translate_adjust(sr, &r))
             return gfx_result::success;
@@ -181,10 +186,12 @@ class xdraw_filled_rectangle {
     // draws a filled rectangle with the specified dimensions and of the specified color, with an optional clipping rectangle
     template <typename Destination, typename PixelType>
     inline static gfx_result filled_rectangle(Destination& destination, const rect16& rect, PixelType color, const srect16* clip = nullptr) {
+        HTCW_GFX_PROFILE_SCOPE("filled_rectangle");
         return filled_rectangle(destination, (srect16)rect, color, clip);
     }
     template <typename Destination, typename PixelType>
     inline static gfx_result filled_rectangle(Destination& destination, const srect16& rect, PixelType color, const srect16* clip = nullptr) {
+        HTCW_GFX_PROFILE_SCOPE("filled_rectangle");
         return filled_rectangle_impl(destination, rect, color, clip);
     }
 
@@ -44,11 +44,13 @@ public:
     // draws a filled rounded rectangle with the specified dimensions and of the specified color, with an optional clipping rectangle
     template <typename Destination, typename PixelType>
     inline static gfx_result filled_rounded_rectangle(Destination& destination, const srect16& rect, float ratio, PixelType color, const srect16* clip = nullptr) {
+        HTCW_GFX_PROFILE_SCOPE("filled_rounded_rectangle");
         return filled_rounded_rectangle_impl(destination, rect, ratio, color, clip);
     }
     // draws a filled rounded rectangle with the specified dimensions and of the specified color, with an optional clipping rectangle
     template <typename Destination, typename PixelType>
     inline static gfx_result filled_rounded_rectangle(Destination& destination, const rect16& rect, float ratio, PixelType color, const srect16* clip = nullptr) {
+        HTCW_GFX_PROFILE_SCOPE("filled_rounded_rectangle");
         return filled_rounded_rectangle(destination, (srect16)rect, ratio, color, clip);
     }
 };
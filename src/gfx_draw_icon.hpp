@@ -46,6 +46,9 @@ class xdraw_icon {
             }
             bounds = bounds.crop((srect16)destination.bounds());
             rect16 dstr = (rect16)bounds;
+            // the right and bottom may have been cropped too
+            srcr.x2 = srcr.x1 + dstr.width() - 1;
+            srcr.y2 = srcr.y1 + dstr.height() - 1;
             gfx_result r;
             if(opaque) {
                 gfx_result r;
@@ -221,11 +224,13 @@ public:
     // draws an icon to the destination at the location with an optional clipping rectangle
     template <typename Destination, typename Source, typename PixelType>
     static inline gfx_result icon(Destination& destination, spoint16 location, const Source& source, PixelType forecolor, PixelType backcolor = PixelType(0, true), bool transparent_background = true, bool invert = false, const srect16* clip = nullptr) {
+        HTCW_GFX_PROFILE_SCOPE("icon");
         return icon_impl(destination, location, source, forecolor, backcolor, transparent_background, invert, clip);
     }
     // draws an icon to the destination at the location with an optional clipping rectangle
     template <typename Destination, typename Source, typename PixelType>
     static inline gfx_result icon(Destination& destination, point16 location, const Source& source, PixelType forecolor, PixelType backcolor = PixelType(0, true), bool transparent_background = true, bool invert = false, const srect16* clip = nullptr) {
+        HTCW_GFX_PROFILE_SCOPE("icon");
         return icon(destination,(spoint16)location,source,forecolor,backcolor,transparent_background,invert,clip);
     }
 };
@@ -61,11 +61,13 @@ public:
     // draws an image from the specified stream to the specified destination rectangle with the an optional clipping rectangle
     template <typename Destination>
     static inline gfx_result image(Destination& destination, const srect16& destination_rect, const ::gfx::image& source_image, const rect16& source_rect = rect16(0, 0, 65535, 65535),const srect16* clip = nullptr) {
+        HTCW_GFX_PROFILE_SCOPE("image");
         return image_impl(destination, destination_rect, source_image, source_rect, clip);
     }
     // draws an image from the specified stream to the specified destination rectangle with the an optional clipping rectangle
     template <typename Destination>
     static inline gfx_result image(Destination& destination, const rect16& destination_rect, const ::gfx::image& source_image, const rect16& source_rect = rect16(0, 0, 65535, 65535), const srect16* clip = nullptr) {
+        HTCW_GFX_PROFILE_SCOPE("image");
         return image(destination,(srect16)destination_rect, source_image, source_rect, clip);
     }
 };
@@ -73,11 +73,13 @@ public:
     // draws a line with the specified start and end point and of the specified color, with an optional clipping rectangle
     template <typename Destination, typename PixelType>
     inline static gfx_result line(Destination& destination, const rect16& rect, PixelType color, const srect16* clip = nullptr) {
+        HTCW_GFX_PROFILE_SCOPE("line");
         return line(destination, (srect16)rect, color, clip);
     }
     // draws a line with the specified start and end point and of the specified color, with an optional clipping rectangle
     template <typename Destination, typename PixelType>
     inline static gfx_result line(Destination& destination, const srect16& rect, PixelType color, const srect16* clip = nullptr) {
+        HTCW_GFX_PROFILE_SCOPE("line");
         return line_impl(destination, rect, color, clip);
     }
 };
@@ -0,0 +1,539 @@
+#ifndef HTCW_GFX_DRAW_LIST_HPP
+#define HTCW_GFX_DRAW_LIST_HPP
+#include <stdlib.h>
+#include <string.h>
+#include "gfx_draw.hpp"
+namespace gfx {
+// A recorded sequence of draw calls for a kind of destination, held in a
+// single growable buffer. Each command keeps its bounds, so the list can be
+// replayed one tile at a time into a buffer that only covers that tile, and
+// only the commands that touch the tile are run. Fonts, caches, bitmaps and
+// canvas scene state are referenced, not copied, and must outlive the list.
+// Text is copied.
+template <typename Destination>
+class draw_list final {
+   public:
+    using destination_type = Destination;
+    // draws a canvas command. The canvas is sized to the command's bounds, with its top left at theirs
+    typedef gfx_result (*canvas_scene_callback)(::gfx::canvas& destination, void* state);
+    // sends a finished tile to the display. tile is in list coordinates
+    typedef gfx_result (*flush_callback)(Destination& tile_buffer, const srect16& tile, void* state);
+
+   private:
+    struct replay_context {
+        spoint16 offset;
+        srect16 clip;
+        mask_draw_cache* cache;
+        void* (*allocator)(size_t);
+        void* (*reallocator)(void*, size_t);
+        void (*deallocator)(void*);
+    };
+    typedef gfx_result (*replay_callback)(Destination& destination, const void* command, const replay_context& context);
+    struct entry {
+        replay_callback replay;
+        srect16 bounds;
+        size_t size;
+    };
+    template <typename PixelType>
+    struct shape_command {
+        srect16 rect;
+        float ratio;
+        PixelType color;
+    };
+    template <typename PixelType>
+    struct aa_command {
+        srect16 rect;
+        PixelType color;
+        int16_t width;
+        int16_t radius;
+        int16_t start_angle;
+        int16_t end_angle;
+        line_cap cap;
+    };
+    // the points follow
+    template <typename PixelType>
+    struct aa_path_command {
+        size_t size;
+        PixelType color;
+        int16_t width;
+        int16_t miter_limit;
+        line_cap cap;
+        line_join join;
+    };
+    // the text follows
+    template <typename PixelType>
+    struct text_command {
+        srect16 rect;
+        text_info info;
+        PixelType color;
+    };
+    template <typename Source>
+    struct bitmap_command {
+        srect16 rect;
+        Source* source;
+        rect16 source_rect;
+        bitmap_resize resize;
+        bool transparent;
+        typename Source::pixel_type transparent_color;
+    };
+    struct canvas_command {
+        srect16 rect;
+        canvas_scene_callback scene;
+        void* state;
+    };
+    constexpr static const size_t alignment = 8;
+    uint8_t* m_begin;
+    size_t m_size;
+    size_t m_capacity;
+    size_t m_count;
+    srect16 m_bounds;
+    void* (*m_allocator)(size_t);
+    void* (*m_reallocator)(void*, size_t);
+    void (*m_deallocator)(void*);
+    draw_list(const draw_list& rhs) = delete;
+    draw_list& operator=(const draw_list& rhs) = delete;
+    constexpr static size_t aligned(size_t size) {
+        return (size + (alignment - 1)) & ~(alignment - 1);
+    }
+    // appends a command with room for size bytes after it and returns that room, or nullptr if out of memory
+    void* append(replay_callback replay, const srect16& bounds, size_t size) {
+        const size_t total = aligned(sizeof(entry)) + aligned(size);
+        if (m_size + total > m_capacity && gfx_result::success != reserve(m_size + total > m_capacity * 2 ? m_size + total : m_capacity * 2)) {
+            return nullptr;
+        }
+        entry* e = (entry*)(m_begin + m_size);
+        e->replay = replay;
+        e->bounds = bounds.normalize();
+        e->size = total;
+        m_bounds = (m_count == 0) ? e->bounds : m_bounds.merge(e->bounds);
+        ++m_count;
+        m_size += total;
+        return ((uint8_t*)e) + aligned(sizeof(entry));
+    }
+    template <typename PixelType>
+    static gfx_result replay_point(Destination& destination, const void* command, const replay_context& context) {
+        const shape_command<PixelType>& c = *(const shape_command<PixelType>*)command;
+        return draw::point(destination, c.rect.point1().offset(context.offset), c.color, &context.clip);
+    }
+    template <typename PixelType>
+    static gfx_result replay_filled_rectangle(Destination& destination, const void* command, const replay_context& context) {
+        const shape_command<PixelType>& c = *(const shape_command<PixelType>*)command;
+        return draw::filled_rectangle(destination, c.rect.offset(context.offset), c.color, &context.clip);
+    }
+    template <typename PixelType>
+    static gfx_result replay_rectangle(Destination& destination, const void* command, const replay_context& context) {
+        const shape_command<PixelType>& c = *(const shape_command<PixelType>*)command;
+        return draw::rectangle(destination, c.rect.offset(context.offset), c.color, &context.clip);
+    }
+    template <typename PixelType>
+    static gfx_result replay_line(Destination& destination, const void* command, const replay_context& context) {
+        const shape_command<PixelType>& c = *(const shape_command<PixelType>*)command;
+        return draw::line(destination, c.rect.offset(context.offset), c.color, &context.clip);
+    }
+    template <typename PixelType>
+    static gfx_result replay_ellipse(Destination& destination, const void* command, const replay_context& context) {
+        const shape_command<PixelType>& c = *(const shape_command<PixelType>*)command;
+        return draw::ellipse(destination, c.rect.offset(context.offset), c.color, &context.clip);
+    }
+    template <typename PixelType>
+    static gfx_result replay_filled_ellipse(Destination& destination, const void* command, const replay_context& context) {
+        const shape_command<PixelType>& c = *(const shape_command<PixelType>*)command;
+        return draw::filled_ellipse(destination, c.rect.offset(context.offset), c.color, &context.clip);
+    }
+    template <typename PixelType>
+    static gfx_result replay_rounded_rectangle(Destination& destination, const void* command, const replay_context& context) {
+        const shape_command<PixelType>& c = *(const shape_command<PixelType>*)command;
+        return draw::rounded_rectangle(destination, c.rect.offset(context.offset), c.ratio, c.color, &context.clip);
+    }
+    template <typename PixelType>
+    static gfx_result replay_filled_rounded_rectangle(Destination& destination, const void* command, const replay_context& context) {
+        const shape_command<PixelType>& c = *(const shape_command<PixelType>*)command;
+        return draw::filled_rounded_rectangle(destination, c.rect.offset(context.offset), c.ratio, c.color, &context.clip);
+    }
+    template <typename PixelType>
+    static gfx_result replay_aa_line(Destination& destination, const void* command, const replay_context& context) {
+        const aa_command<PixelType>& c = *(const aa_command<PixelType>*)command;
+        return draw::aa_line(destination, c.rect.offset(context.offset), c.color, c.width, c.cap, context.cache, &context.clip);
+    }
+    template <typename PixelType>
+    static gfx_result replay_aa_rounded_rectangle(Destination& destination, const void* command, const replay_context& context) {
+        const aa_command<PixelType>& c = *(const aa_command<PixelType>*)command;
+        return draw::aa_rounded_rectangle(destination, c.rect.offset(context.offset), c.color, c.radius, c.width, context.cache, &context.clip);
+    }
+    template <typename PixelType>
+    static gfx_result replay_aa_filled_rounded_rectangle(Destination& destination, const void* command, const replay_context& context) {
+        const aa_command<PixelType>& c = *(const aa_command<PixelType>*)command;
+        return draw::aa_filled_rounded_rectangle(destination, c.rect.offset(context.offset), c.color, c.radius, context.cache, &context.clip);
+    }
+    template <typename PixelType>
+    static gfx_result replay_aa_arc(Destination& destination, const void* command, const replay_context& context) {
+        const aa_command<PixelType>& c = *(const aa_command<PixelType>*)command;
+        return draw::aa_arc(destination, c.rect.offset(context.offset), c.color, c.start_angle, c.end_angle, c.width, c.cap, context.cache, &context.clip);
+    }
+    template <typename PixelType>
+    static gfx_result replay_aa_filled_arc(Destination& destination, const void* command, const replay_context& context) {
+        const aa_command<PixelType>& c = *(const aa_command<PixelType>*)command;
+        return draw::aa_filled_arc(destination, c.rect.offset(context.offset), c.color, c.start_angle, c.end_angle, context.cache, &context.clip);
+    }
+    // copies the points so they can be offset without touching the list
+    template <typename PixelType>
+    static spoint16* replay_path_points(const aa_path_command<PixelType>& c, const replay_context& context) {
+        spoint16* result = (spoint16*)context.allocator(c.size * sizeof(spoint16));
+        if (result == nullptr) {
+            return nullptr;
+        }
+        const spoint16* src = (const spoint16*)(((const uint8_t*)&c) + aligned(sizeof(c)));
+        for (size_t i = 0; i < c.size; ++i) {
+            result[i] = src[i].offset(context.offset);
+        }
+        return result;
+    }
+    template <typename PixelType>
+    static gfx_result replay_aa_polyline(Destination& destination, const void* command, const replay_context& context) {
+        const aa_path_command<PixelType>& c = *(const aa_path_command<PixelType>*)command;
+        spoint16* pts = replay_path_points(c, context);
+        if (pts == nullptr) {
+            return gfx_result::out_of_memory;
+        }
+        const gfx_result r = draw::aa_polyline(destination, spath16(c.size, pts), c.color, c.width, c.cap, c.join, c.miter_limit, context.cache, &context.clip);
+        context.deallocator(pts);
+        return r;
+    }
+    template <typename PixelType>
+    static gfx_result replay_aa_polygon(Destination& destination, const void* command, const replay_context& context) {
+        const aa_path_command<PixelType>& c = *(const aa_path_command<PixelType>*)command;
+        spoint16* pts = replay_path_points(c, context);
+        if (pts == nullptr) {
+            return gfx_result::out_of_memory;
+        }
+        const gfx_result r = draw::aa_polygon(destination, spath16(c.size, pts), c.color, c.width, c.join, c.miter_limit, context.cache, &context.clip);
+        context.deallocator(pts);
+        return r;
+    }
+    template <typename PixelType>
+    static gfx_result replay_text(Destination& destination, const void* command, const replay_context& context) {
+        const text_command<PixelType>& c = *(const text_command<PixelType>*)command;
+        text_info info = c.info;
+        info.text = (text_handle)(((const uint8_t*)&c) + aligned(sizeof(c)));
+        return draw::text(destination, c.rect.offset(context.offset), info, c.color, &context.clip);
+    }
+    template <typename Source>
+    static gfx_result replay_bitmap(Destination& destination, const void* command, const replay_context& context) {
+        const bitmap_command<Source>& c = *(const bitmap_command<Source>*)command;
+        return draw::bitmap(destination, c.rect.offset(context.offset), *c.source, c.source_rect, c.resize, c.transparent ? &c.transparent_color : nullptr, &context.clip);
+    }
+    static gfx_result replay_canvas(Destination& destination, const void* command, const replay_context& context) {
+        const canvas_command& c = *(const canvas_command*)command;
+        ::gfx::canvas cvs((size16)c.rect.dimensions(), context.allocator, context.reallocator, context.deallocator);
+        gfx_result r = cvs.initialize();
+        if (r != gfx_result::success) {
+            return r;
+        }
+        r = draw::canvas(destination, cvs, c.rect.point1().offset(context.offset), &context.clip);
+        if (r != gfx_result::success) {
+            return r;
+        }
+        return c.scene(cvs, c.state);
+    }
+    template <typename PixelType>
+    gfx_result add_shape(replay_callback replay, const srect16& rect, float ratio, PixelType color) {
+        shape_command<PixelType>* c = (shape_command<PixelType>*)append(replay, rect, sizeof(shape_command<PixelType>));
+        if (c == nullptr) {
+            return gfx_result::out_of_memory;
+        }
+        c->rect = rect;
+        c->ratio = ratio;
+        c->color = color;
+        return gfx_result::success;
+    }
+    template <typename PixelType>
+    gfx_result add_aa(replay_callback replay, const srect16& rect, int16_t outset, PixelType color, int16_t width, int16_t radius, int16_t start_angle, int16_t end_angle, line_cap cap) {
+        aa_command<PixelType>* c = (aa_command<PixelType>*)append(replay, rect.normalize().inflate(outset, outset), sizeof(aa_command<PixelType>));
+        if (c == nullptr) {
+            return gfx_result::out_of_memory;
+        }
+        c->rect = rect;
+        c->color = color;
+        c->width = width;
+        c->radius = radius;
+        c->start_angle = start_angle;
+        c->end_angle = end_angle;
+        c->cap = cap;
+        return gfx_result::success;
+    }
+    template <typename PixelType>
+    gfx_result add_aa_path(replay_callback replay, const spath16& path, PixelType color, int16_t width, line_cap cap, line_join join, int16_t miter_limit) {
+        if (path.size() == 0) {
+            return gfx_result::success;
+        }
+        // a miter can reach miter_limit half widths from its vertex
+        const int16_t outset = (int16_t)((width * (join == line_join::miter && miter_limit > 1 ? miter_limit : 1) + 1) / 2 + 1);
+        using cmd_t = aa_path_command<PixelType>;
+        cmd_t* c = (cmd_t*)append(replay, path.bounds().inflate(outset, outset), aligned(sizeof(cmd_t)) + path.size() * sizeof(spoint16));
+        if (c == nullptr) {
+            return gfx_result::out_of_memory;
+        }
+        c->size = path.size();
+        c->color = color;
+        c->width = width;
+        c->miter_limit = miter_limit;
+        c->cap = cap;
+        c->join = join;
+        memcpy(((uint8_t*)c) + aligned(sizeof(cmd_t)), path.begin(), path.size() * sizeof(spoint16));
+        return gfx_result::success;
+    }
+
+   public:
+    draw_list(void* (*allocator)(size_t) = ::malloc, void* (*reallocator)(void*, size_t) = ::realloc, void (*deallocator)(void*) = ::free)
+        : m_begin(nullptr), m_size(0), m_capacity(0), m_count(0), m_bounds(0, 0, 0, 0), m_allocator(allocator), m_reallocator(reallocator), m_deallocator(deallocator) {
+    }
+    draw_list(draw_list&& rhs) : m_begin(rhs.m_begin), m_size(rhs.m_size), m_capacity(rhs.m_capacity), m_count(rhs.m_count), m_bounds(rhs.m_bounds), m_allocator(rhs.m_allocator), m_reallocator(rhs.m_reallocator), m_deallocator(rhs.m_deallocator) {
+        rhs.m_begin = nullptr;
+        rhs.m_size = 0;
+        rhs.m_capacity = 0;
+        rhs.m_count = 0;
+    }
+    draw_list& operator=(draw_list&& rhs) {
+        if (this != &rhs) {
+            release();
+            m_begin = rhs.m_begin;
+            m_size = rhs.m_size;
+            m_capacity = rhs.m_capacity;
+            m_count = rhs.m_count;
+            m_bounds = rhs.m_bounds;
+            m_allocator = rhs.m_allocator;
+            m_reallocator = rhs.m_reallocator;
+            m_deallocator = rhs.m_deallocator;
+            rhs.m_begin = nullptr;
+            rhs.m_size = 0;
+            rhs.m_capacity = 0;
+            rhs.m_count = 0;
+        }
+        return *this;
+    }
+    ~draw_list() {
+        release();
+    }
+    // the number of commands
+    inline size_t count() const {
+        return m_count;
+    }
+    // the area covered by all of the commands
+    inline srect16 bounds() const {
+        return m_bounds;
+    }
+    // the size of the recorded commands in bytes
+    inline size_t memory_size() const {
+        return m_size;
+    }
+    // grows the buffer to hold at least size bytes of commands
+    gfx_result reserve(size_t size) {
+        if (size <= m_capacity) {
+            return gfx_result::success;
+        }
+        void* p;
+        if (m_begin == nullptr) {
+            if (m_allocator == nullptr) {
+                return gfx_result::out_of_memory;
+            }
+            p = m_allocator(size);
+        } else {
+            if (m_reallocator == nullptr) {
+                return gfx_result::out_of_memory;
+            }
+            p = m_reallocator(m_begin, size);
+        }
+        if (p == nullptr) {
+            return gfx_result::out_of_memory;
+        }
+        m_begin = (uint8_t*)p;
+        m_capacity = size;
+        return gfx_result::success;
+    }
+    // removes the commands but keeps the buffer for the next frame
+    inline void clear() {
+        m_size = 0;
+        m_count = 0;
+    }
+    // removes the commands and frees the buffer
+    void release() {
+        if (m_begin != nullptr && m_deallocator != nullptr) {
+            m_deallocator(m_begin);
+        }
+        m_begin = nullptr;
+        m_size = 0;
+        m_capacity = 0;
+        m_count = 0;
+    }
+    template <typename PixelType>
+    inline gfx_result point(spoint16 location, PixelType color) {
+        return add_shape(replay_point<PixelType>, srect16(location, location), 0, color);
+    }
+    template <typename PixelType>
+    inline gfx_result filled_rectangle(const srect16& rect, PixelType color) {
+        return add_shape(replay_filled_rectangle<PixelType>, rect, 0, color);
+    }
+    template <typename PixelType>
+    inline gfx_result rectangle(const srect16& rect, PixelType color) {
+        return add_shape(replay_rectangle<PixelType>, rect, 0, color);
+    }
+    template <typename PixelType>
+    inline gfx_result line(const srect16& rect, PixelType color) {
+        return add_shape(replay_line<PixelType>, rect, 0, color);
+    }
+    template <typename PixelType>
+    inline gfx_result ellipse(const srect16& rect, PixelType color) {
+        return add_shape(replay_ellipse<PixelType>, rect, 0, color);
+    }
+    template <typename PixelType>
+    inline gfx_result filled_ellipse(const srect16& rect, PixelType color) {
+        return add_shape(replay_filled_ellipse<PixelType>, rect, 0, color);
+    }
+    template <typename PixelType>
+    inline gfx_result rounded_rectangle(const srect16& rect, float ratio, PixelType color) {
+        return add_shape(replay_rounded_rectangle<PixelType>, rect, ratio, color);
+    }
+    template <typename PixelType>
+    inline gfx_result filled_rounded_rectangle(const srect16& rect, float ratio, PixelType color) {
+        return add_shape(replay_filled_rounded_rectangle<PixelType>, rect, ratio, color);
+    }
+    template <typename PixelType>
+    inline gfx_result aa_line(const srect16& rect, PixelType color, int16_t width, line_cap cap = line_cap::butt) {
+        return add_aa(replay_aa_line<PixelType>, rect, (width + 1) / 2 + 1, color, width, 0, 0, 0, cap);
+    }
+    template <typename PixelType>
+    inline gfx_result aa_rounded_rectangle(const srect16& rect, PixelType color, int16_t radius, int16_t width) {
+        return add_aa(replay_aa_rounded_rectangle<PixelType>, rect, width + 1, color, width, radius, 0, 0, line_cap::butt);
+    }
+    template <typename PixelType>
+    inline gfx_result aa_filled_rounded_rectangle(const srect16& rect, PixelType color, int16_t radius) {
+        return add_aa(replay_aa_filled_rounded_rectangle<PixelType>, rect, 1, color, 0, radius, 0, 0, line_cap::butt);
+    }
+    template <typename PixelType>
+    inline gfx_result aa_arc(const srect16& rect, PixelType color, int16_t start_angle, int16_t end_angle, int16_t width, line_cap cap = line_cap::butt) {
+        return add_aa(replay_aa_arc<PixelType>, rect, width + 1, color, width, 0, start_angle, end_angle, cap);
+    }
+    template <typename PixelType>
+    inline gfx_result aa_filled_arc(const srect16& rect, PixelType color, int16_t start_angle, int16_t end_angle) {
+        return add_aa(replay_aa_filled_arc<PixelType>, rect, 1, color, 0, 0, start_angle, end_angle, line_cap::butt);
+    }
+    // the points are copied
+    template <typename PixelType>
+    inline gfx_result aa_polyline(const spath16& path, PixelType color, int16_t width, line_cap cap = line_cap::butt, line_join join = line_join::miter, int16_t miter_limit = 4) {
+        return add_aa_path(replay_aa_polyline<PixelType>, path, color, width, cap, join, miter_limit);
+    }
+    // the points are copied
+    template <typename PixelType>
+    inline gfx_result aa_polygon(const spath16& path, PixelType color, int16_t width, line_join join = line_join::miter, int16_t miter_limit = 4) {
+        return add_aa_path(replay_aa_polygon<PixelType>, path, color, width, line_cap::butt, join, miter_limit);
+    }
+    // the text is copied. The font and caches are not
+    template <typename PixelType>
+    gfx_result text(const srect16& dest_rect, const text_info& info, PixelType color) {
+        using cmd_t = text_command<PixelType>;
+        cmd_t* c = (cmd_t*)append(replay_text<PixelType>, dest_rect, aligned(sizeof(cmd_t)) + info.text_byte_count);
+        if (c == nullptr) {
+            return gfx_result::out_of_memory;
+        }
+        c->rect = dest_rect;
+        c->info = info;
+        c->color = color;
+        if (info.text_byte_count != 0) {
+            memcpy(((uint8_t*)c) + aligned(sizeof(cmd_t)), info.text, info.text_byte_count);
+        }
+        return gfx_result::success;
+    }
+    // the source is drawn from when the list is rendered, so it must outlive the list
+    template <typename Source>
+    gfx_result bitmap(const srect16& dest_rect, Source& source, const rect16& source_rect, bitmap_resize resize_type = bitmap_resize::crop, const typename Source::pixel_type* transparent_color = nullptr) {
+        using cmd_t = bitmap_command<Source>;
+        cmd_t* c = (cmd_t*)append(replay_bitmap<Source>, dest_rect, sizeof(cmd_t));
+        if (c == nullptr) {
+            return gfx_result::out_of_memory;
+        }
+        c->rect = dest_rect;
+        c->source = &source;
+        c->source_rect = source_rect;
+        c->resize = resize_type;
+        c->transparent = transparent_color != nullptr;
+        if (transparent_color != nullptr) {
+            c->transparent_color = *transparent_color;
+        }
+        return gfx_result::success;
+    }
+    // records vector drawing. scene is called on every replay that touches bounds with a canvas
+    // of that size whose top left is at the top left of bounds. It must draw the same thing each time
+    gfx_result canvas(const srect16& bounds, canvas_scene_callback scene, void* state = nullptr) {
+        if (scene == nullptr) {
+            return gfx_result::invalid_argument;
+        }
+        canvas_command* c = (canvas_command*)append(replay_canvas, bounds, sizeof(canvas_command));
+        if (c == nullptr) {
+            return gfx_result::out_of_memory;
+        }
+        c->rect = bounds.normalize();
+        c->scene = scene;
+        c->state = state;
+        return gfx_result::success;
+    }
+    // replays the commands that intersect tile into destination, whose top left is the top left of tile.
+    // nothing is drawn outside of tile. cache: optional draw cache for the anti-aliased commands
+    gfx_result render(Destination& destination, const srect16& tile, mask_draw_cache* cache = nullptr) const {
+        const srect16 t = tile.normalize();
+        replay_context ctx;
+        ctx.offset = spoint16(-t.x1, -t.y1);
+        ctx.clip = srect16(spoint16::zero(), t.dimensions());
+        ctx.allocator = m_allocator;
+        ctx.reallocator = m_reallocator;
+        ctx.deallocator = m_deallocator;
+        mask_draw_cache local(m_allocator, m_reallocator, m_deallocator);
+        ctx.cache = (cache != nullptr) ? cache : &local;
+        const uint8_t* p = m_begin;
+        const uint8_t* const end = m_begin + m_size;
+        while (p < end) {
+            const entry& e = *(const entry*)p;
+            if (e.bounds.intersects(t)) {
+                const gfx_result r = e.replay(destination, p + aligned(sizeof(entry)), ctx);
+                if (r != gfx_result::success) {
+                    return r;
+                }
+            }
+            p += e.size;
+        }
+        return gfx_result::success;
+    }
+    // replays every command into destination at its own coordinates
+    inline gfx_result render(Destination& destination, mask_draw_cache* cache = nullptr) const {
+        return render(destination, (srect16)destination.bounds(), cache);
+    }
+    // renders area one tile at a time through tile_buffer, left to right and top to bottom,
+    // calling flush with each finished tile. Tiles are as large as tile_buffer, less at the edges of area.
+    // tile_buffer is not cleared between tiles, so the list should paint every pixel of area
+    gfx_result render_tiles(Destination& tile_buffer, const srect16& area, flush_callback flush, void* state = nullptr, mask_draw_cache* cache = nullptr) const {
+        const size16 dim = tile_buffer.dimensions();
+        if (flush == nullptr || dim.width == 0 || dim.height == 0) {
+            return gfx_result::invalid_argument;
+        }
+        const srect16 a = area.normalize();
+        mask_draw_cache local(m_allocator, m_reallocator, m_deallocator);
+        if (cache == nullptr) {
+            cache = &local;
+        }
+        for (int y = a.y1; y <= a.y2; y += dim.height) {
+            for (int x = a.x1; x <= a.x2; x += dim.width) {
+                const srect16 tile = srect16((int16_t)x, (int16_t)y, (int16_t)(x + dim.width - 1), (int16_t)(y + dim.height - 1)).crop(a);
+                gfx_result r = render(tile_buffer, tile, cache);
+                if (r != gfx_result::success) {
+                    return r;
+                }
+                r = flush(tile_buffer, tile, state);
+                if (r != gfx_result::success) {
+                    return r;
+                }
+            }
+        }
+        return gfx_result::success;
+    }
+};
+}  // namespace gfx
+#endif
@@ -0,0 +1,158 @@
+#ifndef HTCW_GFX_DRAW_MASK_HPP
+#define HTCW_GFX_DRAW_MASK_HPP
+#include "gfx_draw_common.hpp"
+#include "gfx_mask_draw_cache.hpp"
+namespace gfx {
+namespace helpers {
+class xdraw_mask {
+    // crops the mask at location to the clip and the destination. returns false if nothing is left
+    template <typename Destination>
+    static bool mask_bounds(const Destination& destination, spoint16 location, size16 dimensions, const srect16* clip, srect16* result) {
+        ssize16 ss;
+        draw_translate(destination.dimensions(), &ss);
+        const srect16 bounds(spoint16(0, 0), ss);
+        srect16 c = (nullptr != clip) ? clip->crop(bounds) : bounds;
+        const srect16 r(location, (ssize16)dimensions);
+        if (!r.intersects(c)) {
+            return false;
+        }
+        *result = r.crop(c);
+        return true;
+    }
+    template <typename Destination, typename Mask, typename PixelType>
+    static gfx_result mask_fill_impl(Destination& destination, spoint16 location, const Mask& mask, PixelType color, const srect16* clip) {
+        static_assert(helpers::is_same<typename Mask::pixel_type, alpha_pixel<8>>::value, "Mask must be an 8-bit alpha bitmap");
+        if (nullptr == mask.cbegin()) {
+            return gfx_result::invalid_argument;
+        }
+        srect16 c;
+        if (!mask_bounds(destination, location, mask.dimensions(), clip, &c)) {
+            return gfx_result::success;
+        }
+        const uint8_t opacity = color.opacity8();
+        typename Destination::pixel_type fgpx;
+        gfx_result r = convert_palette_from(destination, color, &fgpx, nullptr);
+        if (r != gfx_result::success) {
+            return r;
+        }
+        // the mask rows are already coverage, so they go straight to the row blender
+        const size_t stride = mask.dimensions().width;
+        const size_t row_w = (size_t)(c.x2 - c.x1 + 1);
+        const uint8_t* cov = mask.cbegin() + (size_t)(c.y1 - location.y) * stride + (size_t)(c.x1 - location.x);
+        for (int py = c.y1; py <= c.y2; ++py, cov += stride) {
+            r = aa_rasterize_row(destination, {c.x1, (int16_t)py}, cov, row_w, fgpx, opacity);
+            if (r != gfx_result::success) {
+                return r;
+            }
+        }
+        return gfx_result::success;
+    }
+    template <typename Destination, typename Source, typename Mask>
+    static gfx_result masked_bitmap_impl(Destination& destination, spoint16 location, const Source& source, const Mask& mask, mask_draw_cache* cache, const srect16* clip) {
+        static_assert(helpers::is_same<typename Mask::pixel_type, alpha_pixel<8>>::value, "Mask must be an 8-bit alpha bitmap");
+        if (nullptr == mask.cbegin()) {
+            return gfx_result::invalid_argument;
+        }
+        // only the area covered by both the source and the mask is drawn
+        const size16 sdim = source.dimensions();
+        const size16 mdim = mask.dimensions();
+        const size16 dim(sdim.width < mdim.width ? sdim.width : mdim.width,
+                         sdim.height < mdim.height ? sdim.height : mdim.height);
+        srect16 c;
+        if (!mask_bounds(destination, location, dim, clip, &c)) {
+            return gfx_result::success;
+        }
+        mask_draw_cache local;
+        mask_draw_cache* dc = (nullptr != cache) ? cache : &local;
+        const int row_w = c.x2 - c.x1 + 1;
+        uint8_t* cov = dc->ensure((size_t)row_w);
+        if (nullptr == cov) {
+            return gfx_result::out_of_memory;
+        }
+        const size_t stride = mdim.width;
+        const int sx1 = c.x1 - location.x;
+        gfx_result r;
+        for (int py = c.y1; py <= c.y2; ++py) {
+            const int sy = py - location.y;
+            const uint8_t* m = mask.cbegin() + (size_t)sy * stride + (size_t)sx1;
+            // source pixels are drawn in runs of one color so each run is a single row blend.
+            // fully transparent pixels join whatever run they fall in
+            typename Destination::pixel_type run_px, dpx;
+            int run = -1;
+            for (int i = 0; i < row_w; ++i) {
+                uint8_t a = m[i];
+                if (0 != a) {
+                    typename Source::pixel_type spx;
+                    r = source.point(point16((uint16_t)(sx1 + i), (uint16_t)sy), &spx);
+                    if (r != gfx_result::success) {
+                        return r;
+                    }
+                    const uint8_t sa = spx.opacity8();
+                    if (sa < 255) {
+                        a = (uint8_t)(((unsigned int)a * sa + 127) / 255);
+                    }
+                    if (0 != a) {
+                        r = convert_palette(destination, source, spx, &dpx, nullptr);
+                        if (r != gfx_result::success) {
+                            return r;
+                        }
+                        if (run == -1) {
+                            run = 0;
+                            run_px = dpx;
+                        } else if (dpx.native_value != run_px.native_value) {
+                            r = aa_rasterize_row(destination, {(int16_t)(c.x1 + run), (int16_t)py}, cov + run, (size_t)(i - run), run_px);
+                            if (r != gfx_result::success) {
+                                return r;
+                            }
+                            run = i;
+                            run_px = dpx;
+                        }
+                    }
+                }
+                cov[i] = a;
+            }
+            if (run != -1) {
+                r = aa_rasterize_row(destination, {(int16_t)(c.x1 + run), (int16_t)py}, cov + run, (size_t)(row_w - run), run_px);
+                if (r != gfx_result::success) {
+                    return r;
+                }
+            }
+        }
+        return gfx_result::success;
+    }
+
+   public:
+    // fills color through an 8-bit alpha mask, such as one made by canvas::render_mask(), with its top left at location.
+    // clip: optional clipping rectangle
+    template <typename Destination, typename Mask, typename PixelType>
+    inline static gfx_result mask_fill(Destination& destination, point16 location, const Mask& mask, PixelType color, const srect16* clip = nullptr) {
+        HTCW_GFX_PROFILE_SCOPE("mask_fill");
+        return mask_fill_impl(destination, (spoint16)location, mask, color, clip);
+    }
+    // fills color through an 8-bit alpha mask, such as one made by canvas::render_mask(), with its top left at location.
+    // clip: optional clipping rectangle
+    template <typename Destination, typename Mask, typename PixelType>
+    inline static gfx_result mask_fill(Destination& destination, spoint16 location, const Mask& mask, PixelType color, const srect16* clip = nullptr) {
+        HTCW_GFX_PROFILE_SCOPE("mask_fill");
+        return mask_fill_impl(destination, location, mask, color, clip);
+    }
+    // draws source through an 8-bit alpha mask of the same size, both with their top left at location.
+    // the source's own alpha channel, if any, is combined with the mask.
+    // cache: optional draw cache to reuse across calls. clip: optional clipping rectangle
+    template <typename Destination, typename Source, typename Mask>
+    inline static gfx_result masked_bitmap(Destination& destination, point16 location, const Source& source, const Mask& mask, mask_draw_cache* cache = nullptr, const srect16* clip = nullptr) {
+        HTCW_GFX_PROFILE_SCOPE("masked_bitmap");
+        return masked_bitmap_impl(destination, (spoint16)location, source, mask, cache, clip);
+    }
+    // draws source through an 8-bit alpha mask of the same size, both with their top left at location.
+    // the source's own alpha channel, if any, is combined with the mask.
+    // cache: optional draw cache to reuse across calls. clip: optional clipping rectangle
+    template <typename Destination, typename Source, typename Mask>
+    inline static gfx_result masked_bitmap(Destination& destination, spoint16 location, const Source& source, const Mask& mask, mask_draw_cache* cache = nullptr, const srect16* clip = nullptr) {
+        HTCW_GFX_PROFILE_SCOPE("masked_bitmap");
+        return masked_bitmap_impl(destination, location, source, mask, cache, clip);
+    }
+};
+}  // namespace helpers
+}  // namespace gfx
+#endif
@@ -75,10 +75,12 @@ class xdraw_point {
 public:
     template<typename Destination,typename PixelType>
     static gfx_result point(Destination& destination, point16 location, PixelType color, const srect16* clip = nullptr) {
+        HTCW_GFX_PROFILE_SCOPE("point");
         return point_impl(destination,(point16)location,color,clip);
     }
     template<typename Destination,typename PixelType>
     static gfx_result point(Destination& destination, spoint16 location, PixelType color, const srect16* clip = nullptr) {
+        HTCW_GFX_PROFILE_SCOPE("point");
         return point_impl(destination,location,color,clip);
     }
 };
@@ -36,10 +36,12 @@ class xdraw_rectangle {
     // draws a filled rectangle with the specified dimensions and of the specified color, with an optional clipping rectangle
     template <typename Destination, typename PixelType>
     inline static gfx_result rectangle(Destination& destination, const rect16& rect, PixelType color, const srect16* clip = nullptr) {
+        HTCW_GFX_PROFILE_SCOPE("rectangle");
         return rectangle(destination, (srect16)rect, color, clip);
     }
     template <typename Destination, typename PixelType>
     inline static gfx_result rectangle(Destination& destination, const srect16& rect, PixelType color, const srect16* clip = nullptr) {
+        HTCW_GFX_PROFILE_SCOPE("rectangle");
         return rectangle_impl(destination, rect, color, clip);
     }
 };
@@ -50,11 +50,13 @@ public:
     // draws a rounded rectangle with the specified dimensions and of the specified color, with an optional clipping rectangle
     template <typename Destination, typename PixelType>
     inline static gfx_result rounded_rectangle(Destination& destination, const srect16& rect, float ratio, PixelType color, const srect16* clip = nullptr) {
+        HTCW_GFX_PROFILE_SCOPE("rounded_rectangle");
         return rounded_rectangle_impl(destination, rect, ratio, color, clip);
     }
     // draws a rounded rectangle with the specified dimensions and of the specified color, with an optional clipping rectangle
     template <typename Destination, typename PixelType>
     inline static gfx_result rounded_rectangle(Destination& destination, const rect16& rect, float ratio, PixelType color, const srect16* clip = nullptr) {
+        HTCW_GFX_PROFILE_SCOPE("rounded_rectangle");
         return rounded_rectangle(destination, (srect16)rect, ratio, color, clip);
     }
 };
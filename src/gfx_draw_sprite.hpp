@@ -42,11 +42,13 @@ public:
     // draws a sprite to the destination at the specified location with an optional clipping rectangle
     template <typename Destination, typename Sprite>
     static inline gfx_result sprite(Destination& destination, spoint16 location, const Sprite& sprite, const srect16* clip = nullptr) {
+        HTCW_GFX_PROFILE_SCOPE("sprite");
         return sprite_impl(destination, location, sprite, clip);
     }
     // draws a sprite to the destination at the location with an optional clipping rectangle
     template <typename Destination, typename Sprite>
     static inline gfx_result sprite(Destination& destination, point16 location, const Sprite& the_sprite, const srect16* clip = nullptr) {
+        HTCW_GFX_PROFILE_SCOPE("sprite");
         return sprite(destination, (spoint16)location, the_sprite, clip);
     }
 };
@@ -3,6 +3,7 @@
 #include "gfx_draw_common.hpp"
 #include "gfx_draw_icon.hpp"
 #include "gfx_font.hpp"
+#include "gfx_text_layout.hpp"
 namespace gfx {
 namespace helpers {
 class xdraw_text {
@@ -30,24 +31,47 @@ class xdraw_text {
         const srect16& dest_rect,
         const text_info& info,
         PixelType color,
-        const srect16* clip) {
+        const srect16* clip,
+        void*(*allocator)(size_t),
+        void*(*reallocator)(void*,size_t),
+        void(*deallocator)(void*)) {
         using st_t = draw_font_cb_state<Destination,PixelType>;
         st_t st;
         st.dst = &destination;
         st.color = &color;
         st.clip = clip;
-        return info.text_font->draw(dest_rect,info,draw_font_helper<Destination,PixelType>::do_draw,&st);
+        return info.text_font->draw(dest_rect,info,draw_font_helper<Destination,PixelType>::do_draw,&st,allocator,reallocator,deallocator);
+    }
+    template <typename Destination, typename PixelType>
+    static gfx_result text_layout_impl(
+        Destination& destination,
+        const srect16& dest_rect,
+        const text_layout& layout,
+        PixelType color,
+        const srect16* clip,
+        font_draw_cache* draw_cache) {
+        using st_t = draw_font_cb_state<Destination,PixelType>;
+        st_t st;
+        st.dst = &destination;
+        st.color = &color;
+        st.clip = clip;
+        return layout.draw(dest_rect,draw_font_helper<Destination,PixelType>::do_draw,&st,draw_cache);
     }
 public:  
-    // draws text to the specified destination rectangle with the specified font and colors and optional clipping rectangle
+    // draws text to the specified destination rectangle with the specified font and colors and optional clipping rectangle.
+    // glyphs that aren't in the draw cache are rendered into a scratch buffer from the allocators
     template <typename Destination, typename PixelType>
     inline static gfx_result text(
         Destination& destination,
         const srect16& dest_rect,
         const text_info& info,
         PixelType color,
-        const srect16* clip = nullptr) {
-        return text_impl(destination, dest_rect, info, color, clip);
+        const srect16* clip = nullptr,
+        void*(*allocator)(size_t)=::malloc,
+        void*(*reallocator)(void*,size_t)=::realloc,
+        void(*deallocator)(void*)=::free) {
+        HTCW_GFX_PROFILE_SCOPE("text");
+        return text_impl(destination, dest_rect, info, color, clip, allocator, reallocator, deallocator);
     }
     // draws text to the specified destination rectangle with the specified font and colors and optional clipping rectangle
     template <typename Destination, typename PixelType>
@@ -56,8 +80,36 @@ public:
         const rect16& dest_rect,
         const text_info& info,
         PixelType color,
-        const srect16* clip = nullptr) {
-        return text(destination, (srect16)dest_rect, info, color, clip);
+        const srect16* clip = nullptr,
+        void*(*allocator)(size_t)=::malloc,
+        void*(*reallocator)(void*,size_t)=::realloc,
+        void(*deallocator)(void*)=::free) {
+        HTCW_GFX_PROFILE_SCOPE("text");
+        return text(destination, (srect16)dest_rect, info, color, clip, allocator, reallocator, deallocator);
+    }
+    // draws previously laid out text to the specified destination rectangle with the specified color, optional clipping rectangle and optional glyph cache
+    template <typename Destination, typename PixelType>
+    inline static gfx_result text(
+        Destination& destination,
+        const srect16& dest_rect,
+        const text_layout& layout,
+        PixelType color,
+        const srect16* clip = nullptr,
+        font_draw_cache* draw_cache = nullptr) {
+        HTCW_GFX_PROFILE_SCOPE("text");
+        return text_layout_impl(destination, dest_rect, layout, color, clip, draw_cache);
+    }
+    // draws previously laid out text to the specified destination rectangle with the specified color, optional clipping rectangle and optional glyph cache
+    template <typename Destination, typename PixelType>
+    inline static gfx_result text(
+        Destination& destination,
+        const rect16& dest_rect,
+        const text_layout& layout,
+        PixelType color,
+        const srect16* clip = nullptr,
+        font_draw_cache* draw_cache = nullptr) {
+        HTCW_GFX_PROFILE_SCOPE("text");
+        return text(destination, (srect16)dest_rect, layout, color, clip, draw_cache);
     }
     
 };
@@ -7,15 +7,22 @@ namespace gfx {
     class text_encoder {
     public:
         virtual gfx_result to_utf32(const text_handle in, int32_t* out_codepoint, size_t* in_out_length) const=0;
+        // decodes as many codepoints as will fit into out_codepoints.
+        // *in_out_length is the number of bytes available in in, and receives the number of bytes consumed.
+        // *in_out_count is the capacity of out_codepoints, and receives the number of codepoints written.
+        // on failure the codepoints before the offending sequence are still reported.
+        virtual gfx_result to_utf32_array(const text_handle in, size_t* in_out_length, int32_t* out_codepoints, size_t* in_out_count) const;
     };
     class text_encoding {
         class utf8_encoder : public text_encoder {
         public: 
             virtual gfx_result to_utf32(const text_handle in, int32_t* out_codepoint, size_t* in_out_length) const override;
+            virtual gfx_result to_utf32_array(const text_handle in, size_t* in_out_length, int32_t* out_codepoints, size_t* in_out_count) const override;
         };
         class latin1_encoder : public text_encoder {
         public: 
             virtual gfx_result to_utf32(const text_handle in, int32_t* out_codepoint, size_t* in_out_length) const override;
+            virtual gfx_result to_utf32_array(const text_handle in, size_t* in_out_length, int32_t* out_codepoints, size_t* in_out_count) const override;
         };
         static const utf8_encoder s_utf8;
         static const latin1_encoder s_latin1;
@@ -23,5 +30,33 @@ namespace gfx {
         static const text_encoder& utf8;
         static const text_encoder& latin1;
     };
+    // reads the codepoints of a string a chunk at a time
+    class text_decoder final {
+        const text_encoder* m_encoding;
+        const uint8_t* m_text;
+        size_t m_length;
+        gfx_result m_result;
+        size_t m_index;
+        size_t m_count;
+        int32_t m_buffer[32];
+        gfx_result fill();
+    public:
+        text_decoder(const text_encoder& encoding, const text_handle text, size_t length);
+        // retrieves the next codepoint, or 0 at the end of the text
+        inline gfx_result next(int32_t* out_codepoint) {
+            if(m_index==m_count) {
+                gfx_result res = fill();
+                if(res!=gfx_result::success) {
+                    return res;
+                }
+                if(m_count==0) {
+                    *out_codepoint = 0;
+                    return gfx_result::success;
+                }
+            }
+            *out_codepoint = m_buffer[m_index++];
+            return gfx_result::success;
+        }
+    };
 }
 #endif // HTCW_GFX_ENCODING_HPP
\ No newline at end of file
@@ -0,0 +1,95 @@
+#ifndef HTCW_GFX_FLUSH_PIPELINE_HPP
+#define HTCW_GFX_FLUSH_PIPELINE_HPP
+#include <stdlib.h>
+#include "gfx_core.hpp"
+#include "gfx_positioning.hpp"
+namespace gfx {
+// Sends a frame to a display a strip at a time through a ring of transfer
+// buffers. While one strip is on the bus, the next is rendered into another
+// buffer, so rendering and transfer overlap. With two buffers this is the
+// usual double buffered DMA loop. More buffers let rendering run further
+// ahead of a bursty bus. The transport tells the pipeline each time a
+// transfer finishes by calling transfer_complete(), which may be done from an
+// interrupt or another thread. Transfers must finish in the order they were
+// started. While every buffer is in flight the pipeline calls a wait callback,
+// which can block until the transport signals a completion. Without one it
+// yields to other threads, or on ESP32 delays a tick so lower priority tasks
+// can run.
+class flush_pipeline final {
+   public:
+    // renders bounds into buffer as rows of bounds.width() pixels
+    typedef gfx_result (*render_callback)(const rect16& bounds, void* buffer, void* state);
+    // starts sending size bytes of buffer to bounds. buffer must not be reused until transfer_complete() is called for it
+    typedef gfx_result (*transfer_callback)(const rect16& bounds, const void* buffer, size_t size, void* state);
+    // waits for a transfer to complete, or for a while. It's called until the pipeline has what it's waiting for
+    typedef void (*wait_callback)(void* state);
+
+   private:
+    void* m_info;
+    void* (*m_allocator)(size_t);
+    void* (*m_reallocator)(void*, size_t);
+    void (*m_deallocator)(void*);
+    flush_pipeline(const flush_pipeline& rhs) = delete;
+    flush_pipeline& operator=(const flush_pipeline& rhs) = delete;
+
+   public:
+    // the buffers are allocated with allocator, so it can select DMA capable memory
+    flush_pipeline(void* (*allocator)(size_t) = ::malloc, void* (*reallocator)(void*, size_t) = ::realloc, void (*deallocator)(void*) = ::free);
+    flush_pipeline(flush_pipeline&& rhs);
+    ~flush_pipeline();
+    flush_pipeline& operator=(flush_pipeline&& rhs);
+    // allocates buffer_count buffers of buffer_size bytes each. transfer is called with transfer_state for each finished strip,
+    // and wait with wait_state whenever the pipeline has to wait for a transfer
+    gfx_result initialize(size_t buffer_size, size_t buffer_count, transfer_callback transfer, void* transfer_state = nullptr, wait_callback wait = nullptr, void* wait_state = nullptr);
+    bool initialized() const;
+    // waits for outstanding transfers and frees the buffers
+    void deinitialize();
+    size_t buffer_size() const;
+    size_t buffer_count() const;
+    // the number of transfers started but not yet complete
+    size_t pending() const;
+    // called by the transport when the oldest outstanding transfer is done. Safe to call from an interrupt or another thread
+    void transfer_complete();
+    // waits until every transfer is complete
+    gfx_result wait_all();
+    // renders area as strips of as many whole rows as fit in a buffer, and starts a transfer for each.
+    // bit_depth is the size of a pixel in the buffers. Returns once the last strip's transfer is started
+    gfx_result flush(const rect16& area, size_t bit_depth, render_callback render, void* render_state = nullptr);
+};
+#ifdef HTCW_GFX_THREADS
+// A stand in for a display bus, for testing and benchmarking a flush_pipeline
+// without hardware. Transfers are queued to a worker thread, which holds each
+// one for latency plus its size over the bandwidth, hands the data to an
+// optional receive callback, and then completes it on the pipeline.
+class flush_mock_transport final {
+   public:
+    // called on the worker thread with each transfer's data before it is completed
+    typedef void (*receive_callback)(const rect16& bounds, const void* buffer, size_t size, void* state);
+
+   private:
+    void* m_info;
+    void* (*m_allocator)(size_t);
+    void* (*m_reallocator)(void*, size_t);
+    void (*m_deallocator)(void*);
+    flush_mock_transport(const flush_mock_transport& rhs) = delete;
+    flush_mock_transport& operator=(const flush_mock_transport& rhs) = delete;
+
+   public:
+    flush_mock_transport(void* (*allocator)(size_t) = ::malloc, void* (*reallocator)(void*, size_t) = ::realloc, void (*deallocator)(void*) = ::free);
+    flush_mock_transport(flush_mock_transport&& rhs);
+    ~flush_mock_transport();
+    flush_mock_transport& operator=(flush_mock_transport&& rhs);
+    // bytes_per_second: the simulated bandwidth, or 0 for unlimited. latency_us: the fixed time each transfer takes on top of that
+    gfx_result initialize(flush_pipeline& pipeline, size_t bytes_per_second, uint32_t latency_us = 0, receive_callback receive = nullptr, void* receive_state = nullptr);
+    bool initialized() const;
+    // finishes the queued transfers and stops the worker
+    void deinitialize();
+    // the total bytes and transfers completed
+    size_t bytes() const;
+    size_t transfers() const;
+    // a flush_pipeline::transfer_callback. Pass the transport as its state
+    static gfx_result transfer(const rect16& bounds, const void* buffer, size_t size, void* state);
+};
+#endif
+}  // namespace gfx
+#endif
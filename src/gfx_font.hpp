@@ -162,20 +162,29 @@ namespace gfx {
         virtual uint16_t line_height() const = 0;
         virtual uint16_t line_advance() const = 0;
         virtual uint16_t base_line() const = 0;
+        // measures a single glyph, kerned against codepoint2 if it isn't 0
+        inline gfx_result measure_glyph(int32_t codepoint1, int32_t codepoint2, font_glyph_info* out_glyph_info) const {
+            return on_measure(codepoint1,codepoint2,out_glyph_info);
+        }
+        // renders a single glyph into destination, which must be the size measure_glyph() reports for it
+        inline gfx_result draw_glyph(bitmap<alpha_pixel<8>>& destination, int32_t codepoint, int32_t glyph_index = -1) const {
+            return on_draw(destination,codepoint,glyph_index);
+        }
     public:
         gfx_result measure(uint16_t max_width,const text_handle text, size_t text_data_len, size16* out_area, uint16_t tab_width = 4, const text_encoder& encoding = text_encoding::utf8, font_measure_cache* cache = nullptr) const;
-        gfx_result draw(const srect16& bounds, const text_handle text,size_t text_data_len, font_draw_callback callback, void* callback_state=nullptr,  uint16_t tab_width = 4, const text_encoder& encoding = text_encoding::utf8, font_draw_cache* draw_cache = nullptr, font_measure_cache* measure_cache = nullptr) const;
+        // the glyphs that aren't cached are rendered into a scratch buffer from the allocators
+        gfx_result draw(const srect16& bounds, const text_handle text,size_t text_data_len, font_draw_callback callback, void* callback_state=nullptr,  uint16_t tab_width = 4, const text_encoder& encoding = text_encoding::utf8, font_draw_cache* draw_cache = nullptr, font_measure_cache* measure_cache = nullptr, void*(*allocator)(size_t)=::malloc, void*(*reallocator)(void*,size_t)=::realloc, void(*deallocator)(void*)=::free) const;
         inline gfx_result measure(uint16_t max_width,const char* text, size16* out_area, uint16_t tab_width = 4, const text_encoder& encoding = text_encoding::utf8, font_measure_cache* cache = nullptr) const {
             return this->measure(max_width,(text_handle)text,strlen(text),out_area,tab_width,encoding,cache);
         }
         inline gfx_result measure(uint16_t max_width,const text_info& ti, size16* out_area) const {
             return this->measure(max_width,ti.text,ti.text_byte_count,out_area, ti.tab_width,*ti.encoding,ti.measure_cache);
         }
-        inline gfx_result draw(const srect16& bounds, const char* text, font_draw_callback callback, void* callback_state=nullptr,  uint16_t tab_width = 4, const text_encoder& encoding = text_encoding::utf8, font_draw_cache* draw_cache = nullptr, font_measure_cache* measure_cache = nullptr) const {
-            return this->draw(bounds,(text_handle)text,strlen(text),callback,callback_state,tab_width,encoding,draw_cache,measure_cache);
+        inline gfx_result draw(const srect16& bounds, const char* text, font_draw_callback callback, void* callback_state=nullptr,  uint16_t tab_width = 4, const text_encoder& encoding = text_encoding::utf8, font_draw_cache* draw_cache = nullptr, font_measure_cache* measure_cache = nullptr, void*(*allocator)(size_t)=::malloc, void*(*reallocator)(void*,size_t)=::realloc, void(*deallocator)(void*)=::free) const {
+            return this->draw(bounds,(text_handle)text,strlen(text),callback,callback_state,tab_width,encoding,draw_cache,measure_cache,allocator,reallocator,deallocator);
         }
-        inline gfx_result draw(const srect16& bounds, const text_info& ti, font_draw_callback callback, void* callback_state=nullptr) const {
-            return this->draw(bounds,ti.text,ti.text_byte_count,callback,callback_state,ti.tab_width,*ti.encoding,ti.draw_cache,ti.measure_cache);
+        inline gfx_result draw(const srect16& bounds, const text_info& ti, font_draw_callback callback, void* callback_state=nullptr, void*(*allocator)(size_t)=::malloc, void*(*reallocator)(void*,size_t)=::realloc, void(*deallocator)(void*)=::free) const {
+            return this->draw(bounds,ti.text,ti.text_byte_count,callback,callback_state,ti.tab_width,*ti.encoding,ti.draw_cache,ti.measure_cache,allocator,reallocator,deallocator);
         }
     };
     
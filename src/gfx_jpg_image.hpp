@@ -20,11 +20,15 @@ class jpg_image : public image {
     void* m_info;
     void* m_pool;
     void* m_bmp;
+    void*(*m_allocator)(size_t);
+    void*(*m_reallocator)(void*,size_t);
+    void(*m_deallocator)(void*);
     jpg_image(const jpg_image& rhs)=delete;
     jpg_image& operator=(const jpg_image& rhs)=delete;
 public:
-    jpg_image();
-    jpg_image(stream& stream, jpg_scale scale = jpg_scale::scale_1_1, bool initialize=false);
+    jpg_image(void*(*allocator)(size_t)=::malloc, void*(*reallocator)(void*,size_t)=::realloc, void(*deallocator)(void*)=::free);
+    // the decoder's state and work area are allocated with allocator when initialized
+    jpg_image(stream& stream, jpg_scale scale = jpg_scale::scale_1_1, bool initialize=false, void*(*allocator)(size_t)=::malloc, void*(*reallocator)(void*,size_t)=::realloc, void(*deallocator)(void*)=::free);
     virtual ~jpg_image();
     jpg_image(jpg_image&& rhs);
     jpg_image& operator=(jpg_image&& rhs);
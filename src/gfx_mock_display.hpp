@@ -0,0 +1,320 @@
+#ifndef HTCW_GFX_MOCK_DISPLAY_HPP
+#define HTCW_GFX_MOCK_DISPLAY_HPP
+#include <stdlib.h>
+#include "gfx_core.hpp"
+#include "gfx_positioning.hpp"
+#include "gfx_palette.hpp"
+#include "gfx_bitmap.hpp"
+namespace gfx {
+// what each part of talking to a display controller costs, in nanoseconds
+struct mock_bus_cost {
+    // per command sent, including toggling DC and starting the transaction
+    uint32_t command_ns;
+    // per address window set, on top of its two commands and their parameters
+    uint32_t window_ns;
+    // per byte sent to the display
+    uint32_t write_byte_ns;
+    // per byte read back from the display
+    uint32_t read_byte_ns;
+    // an SPI bus at the specified clock, with typical driver overhead. A clock of 0 makes the bytes free
+    constexpr static mock_bus_cost spi(uint32_t write_hz = 40000000, uint32_t read_hz = 10000000) {
+        return {2000, 500, write_hz == 0 ? 0 : uint32_t(8000000000ull / write_hz), read_hz == 0 ? 0 : uint32_t(8000000000ull / read_hz)};
+    }
+};
+// what a mock_display has done on its bus
+struct mock_bus_stats {
+    size_t commands;
+    size_t windows;
+    size_t bytes_written;
+    size_t bytes_read;
+    size_t pixels_written;
+    size_t pixels_read;
+    // the modelled bus time for all of the above
+    uint64_t time_ns;
+};
+// A draw target that models a display controller, like an ILI9341, on a
+// serial bus. It keeps its contents in memory, and charges each operation what
+// a typical driver would send for it: an address window, a memory read or
+// write command, and the pixel data. Use it to measure what draw operations
+// cost on a real panel, or to catch changes that add bus traffic, without
+// hardware. Nothing is cached between operations, so every point costs a
+// window of its own.
+template <typename PixelType, typename PaletteType = palette<PixelType, PixelType>>
+class mock_display final {
+   public:
+    using type = mock_display;
+    using pixel_type = PixelType;
+    using palette_type = PaletteType;
+    using frame_type = bitmap<PixelType, PaletteType>;
+    // like most display drivers: no direct memory access, but it can stream from sources and read back
+    using caps = gfx::gfx_caps<false, false, true, true>;
+
+   private:
+    frame_type m_frame;
+    mock_bus_cost m_cost;
+    mutable mock_bus_stats m_stats;
+    rect16 m_batch;
+    point16 m_batch_cursor;
+    size_t m_batch_count;
+    bool m_batching;
+    void* (*m_allocator)(size_t);
+    void* (*m_reallocator)(void*, size_t);
+    void (*m_deallocator)(void*);
+    mock_display(const mock_display& rhs) = delete;
+    mock_display& operator=(const mock_display& rhs) = delete;
+    constexpr static size_t pixel_bytes(size_t count) {
+        return (count * pixel_type::bit_depth + 7) / 8;
+    }
+    // charged by reads too, which are const
+    void charge_command(size_t parameter_bytes) const {
+        ++m_stats.commands;
+        m_stats.bytes_written += parameter_bytes;
+        m_stats.time_ns += m_cost.command_ns + (uint64_t)parameter_bytes * m_cost.write_byte_ns;
+    }
+    // column and row address set, four bytes each
+    void charge_window() const {
+        ++m_stats.windows;
+        m_stats.time_ns += m_cost.window_ns;
+        charge_command(4);
+        charge_command(4);
+    }
+    void charge_write(size_t pixels) {
+        charge_command(0);
+        const size_t bytes = pixel_bytes(pixels);
+        m_stats.pixels_written += pixels;
+        m_stats.bytes_written += bytes;
+        m_stats.time_ns += (uint64_t)bytes * m_cost.write_byte_ns;
+    }
+    // memory read clocks out a dummy byte before the pixels
+    void charge_read(size_t pixels) const {
+        charge_command(0);
+        const size_t bytes = pixel_bytes(pixels) + 1;
+        m_stats.pixels_read += pixels;
+        m_stats.bytes_read += bytes;
+        m_stats.time_ns += (uint64_t)bytes * m_cost.read_byte_ns;
+    }
+
+   public:
+    // the frame buffer is allocated with allocator when initialized
+    mock_display(size16 dimensions, const mock_bus_cost& cost = mock_bus_cost::spi(), const palette_type* palette = nullptr, void* (*allocator)(size_t) = ::malloc, void* (*reallocator)(void*, size_t) = ::realloc, void (*deallocator)(void*) = ::free) : m_frame(dimensions, nullptr, palette), m_cost(cost), m_batch_count(0), m_batching(false), m_allocator(allocator), m_reallocator(reallocator), m_deallocator(deallocator) {
+        reset_stats();
+    }
+    mock_display(mock_display&& rhs) : m_frame(rhs.m_frame), m_cost(rhs.m_cost), m_stats(rhs.m_stats), m_batch(rhs.m_batch), m_batch_cursor(rhs.m_batch_cursor), m_batch_count(rhs.m_batch_count), m_batching(rhs.m_batching), m_allocator(rhs.m_allocator), m_reallocator(rhs.m_reallocator), m_deallocator(rhs.m_deallocator) {
+        rhs.m_frame = frame_type(rhs.m_frame.dimensions(), nullptr, rhs.m_frame.palette());
+    }
+    mock_display& operator=(mock_display&& rhs) {
+        deinitialize();
+        m_frame = rhs.m_frame;
+        m_cost = rhs.m_cost;
+        m_stats = rhs.m_stats;
+        m_batch = rhs.m_batch;
+        m_batch_cursor = rhs.m_batch_cursor;
+        m_batch_count = rhs.m_batch_count;
+        m_batching = rhs.m_batching;
+        m_allocator = rhs.m_allocator;
+        m_reallocator = rhs.m_reallocator;
+        m_deallocator = rhs.m_deallocator;
+        rhs.m_frame = frame_type(rhs.m_frame.dimensions(), nullptr, rhs.m_frame.palette());
+        return *this;
+    }
+    ~mock_display() {
+        deinitialize();
+    }
+    // allocates the frame buffer and clears it
+    gfx_result initialize() {
+        if (m_frame.begin() != nullptr) {
+            return gfx_result::success;
+        }
+        if (m_allocator == nullptr) {
+            return gfx_result::out_of_memory;
+        }
+        void* buffer = m_allocator(frame_type::sizeof_buffer(m_frame.dimensions()));
+        if (buffer == nullptr) {
+            return gfx_result::out_of_memory;
+        }
+        m_frame = frame_type(m_frame.dimensions(), buffer, m_frame.palette());
+        m_frame.clear(m_frame.bounds());
+        m_batching = false;
+        return gfx_result::success;
+    }
+    inline bool initialized() const {
+        return m_frame.begin() != nullptr;
+    }
+    void deinitialize() {
+        if (m_frame.begin() != nullptr) {
+            m_deallocator(m_frame.begin());
+            m_frame = frame_type(m_frame.dimensions(), nullptr, m_frame.palette());
+        }
+    }
+    inline size16 dimensions() const {
+        return m_frame.dimensions();
+    }
+    inline rect16 bounds() const {
+        return m_frame.bounds();
+    }
+    inline const palette_type* palette() const {
+        return m_frame.palette();
+    }
+    // the display contents
+    inline const frame_type& frame() const {
+        return m_frame;
+    }
+    inline const mock_bus_cost& cost() const {
+        return m_cost;
+    }
+    inline void cost(const mock_bus_cost& value) {
+        m_cost = value;
+    }
+    // the bus activity since the last reset
+    inline const mock_bus_stats& stats() const {
+        return m_stats;
+    }
+    inline void reset_stats() {
+        m_stats = {0, 0, 0, 0, 0, 0, 0};
+    }
+    gfx_result point(point16 location, pixel_type color) {
+        if (!initialized()) {
+            return gfx_result::invalid_state;
+        }
+        if (!bounds().intersects(location)) {
+            return gfx_result::success;
+        }
+        charge_window();
+        charge_write(1);
+        return m_frame.point(location, color);
+    }
+    gfx_result point(point16 location, pixel_type* out_color) const {
+        if (!initialized()) {
+            return gfx_result::invalid_state;
+        }
+        if (!bounds().intersects(location)) {
+            return gfx_result::invalid_argument;
+        }
+        charge_window();
+        charge_read(1);
+        return m_frame.point(location, out_color);
+    }
+    // one window, with the color repeated for every pixel
+    gfx_result fill(const rect16& bounds, pixel_type color) {
+        if (!initialized()) {
+            return gfx_result::invalid_state;
+        }
+        if (!bounds.intersects(this->bounds())) {
+            return gfx_result::success;
+        }
+        const rect16 r = bounds.normalize().crop(this->bounds());
+        charge_window();
+        charge_write(r.area());
+        return m_frame.fill(r, color);
+    }
+    inline gfx_result clear(const rect16& bounds) {
+        return fill(bounds, pixel_type());
+    }
+    // streams the source into one window, converting each pixel
+    template <typename Source>
+    gfx_result copy_from(const rect16& src_rect, const Source& src, point16 location) {
+        if (!initialized()) {
+            return gfx_result::invalid_state;
+        }
+        rect16 srcr = src_rect.normalize().crop(src.bounds());
+        rect16 dstr(location, srcr.dimensions());
+        if (!dstr.intersects(bounds())) {
+            return gfx_result::success;
+        }
+        dstr = dstr.crop(bounds());
+        charge_window();
+        charge_write(dstr.area());
+        const uint16_t w = dstr.width(), h = dstr.height();
+        for (uint16_t y = 0; y < h; ++y) {
+            for (uint16_t x = 0; x < w; ++x) {
+                typename Source::pixel_type spx;
+                gfx_result r = src.point(point16(srcr.x1 + x, srcr.y1 + y), &spx);
+                if (r != gfx_result::success) {
+                    return r;
+                }
+                pixel_type dpx;
+                r = convert_palette(m_frame, src, spx, &dpx);
+                if (r != gfx_result::success) {
+                    return r;
+                }
+                r = m_frame.point(point16(dstr.x1 + x, dstr.y1 + y), dpx);
+                if (r != gfx_result::success) {
+                    return r;
+                }
+            }
+        }
+        return gfx_result::success;
+    }
+    // reads a region back, in one window
+    template <typename Target>
+    gfx_result copy_to(const rect16& src_rect, Target& dst, point16 location) const {
+        if (!initialized()) {
+            return gfx_result::invalid_state;
+        }
+        if (!src_rect.intersects(bounds())) {
+            return gfx_result::success;
+        }
+        const rect16 srcr = src_rect.normalize().crop(bounds());
+        rect16 dstr(location, srcr.dimensions());
+        if (!dstr.intersects(dst.bounds())) {
+            return gfx_result::success;
+        }
+        dstr = dstr.crop(dst.bounds());
+        charge_window();
+        charge_read(dstr.area());
+        return m_frame.copy_to(rect16(srcr.point1(), dstr.dimensions()), dst, location);
+    }
+    // sets a window that write_batch() fills left to right, top to bottom
+    gfx_result begin_batch(const rect16& bounds) {
+        if (!initialized()) {
+            return gfx_result::invalid_state;
+        }
+        const rect16 r = bounds.normalize();
+        if (!this->bounds().contains(r)) {
+            return gfx_result::invalid_argument;
+        }
+        m_batch = r;
+        m_batch_cursor = r.point1();
+        m_batch_count = 0;
+        m_batching = true;
+        charge_window();
+        charge_command(0);
+        return gfx_result::success;
+    }
+    gfx_result write_batch(pixel_type color) {
+        if (!m_batching) {
+            return gfx_result::invalid_state;
+        }
+        if (m_batch_cursor.y > m_batch.y2) {
+            // the controller ignores writes past the end of the window
+            return gfx_result::success;
+        }
+        ++m_stats.pixels_written;
+        // pixels smaller than a byte are sent packed, so charge by the bit
+        const size_t before = pixel_bytes(m_batch_count++), after = pixel_bytes(m_batch_count);
+        m_stats.bytes_written += after - before;
+        m_stats.time_ns += (uint64_t)(after - before) * m_cost.write_byte_ns;
+        const gfx_result r = m_frame.point(m_batch_cursor, color);
+        if (++m_batch_cursor.x > m_batch.x2) {
+            m_batch_cursor.x = m_batch.x1;
+            ++m_batch_cursor.y;
+        }
+        return r;
+    }
+    gfx_result commit_batch() {
+        if (!m_batching) {
+            return gfx_result::invalid_state;
+        }
+        m_batching = false;
+        return gfx_result::success;
+    }
+    inline gfx_result suspend() {
+        return gfx_result::success;
+    }
+    inline gfx_result resume(bool force = false) {
+        (void)force;
+        return gfx_result::success;
+    }
+};
+}  // namespace gfx
+#endif
@@ -0,0 +1,59 @@
+#ifndef HTCW_GFX_PACKED_FONT_HPP
+#define HTCW_GFX_PACKED_FONT_HPP
+#include <gfx_font.hpp>
+namespace gfx {
+    // A prerendered fixed size font with 2 or 4 bit anti-aliased glyphs stored as
+    // RLE compressed rows, a sorted codepoint index and a kerning table.
+    // Fonts in this format are produced with packed_font::compile() from any
+    // other font, typically offline as part of an asset pipeline. When
+    // constructed over a memory buffer (such as a header in flash) no part of the
+    // font is copied into RAM.
+    class packed_font : public font {
+        const uint8_t* m_data;
+        size_t m_data_size;
+        gfx::stream* m_stream;
+        uint8_t m_bpp;
+        uint16_t m_line_height;
+        uint16_t m_line_advance;
+        uint16_t m_base_line;
+        uint32_t m_glyph_count;
+        uint32_t m_kern_count;
+        uint32_t m_glyph_data_size;
+        void*(*m_allocator)(size_t);
+        void*(*m_reallocator)(void*,size_t);
+        void(*m_deallocator)(void*);
+        packed_font(const packed_font& rhs)=delete;
+        packed_font& operator=(const packed_font& rhs)=delete;
+        gfx::gfx_result read(size_t offset, uint8_t* data, size_t size) const;
+        gfx::gfx_result find_glyph(int32_t codepoint, int32_t* out_glyph_index) const;
+        gfx::gfx_result read_glyph(int32_t glyph_index, uint8_t* out_entry) const;
+        gfx::gfx_result find_kerning(int32_t codepoint1, int32_t codepoint2, int16_t* out_adjustment) const;
+    protected:
+        virtual gfx::gfx_result on_measure(int32_t codepoint1,int32_t codepoint2, font_glyph_info* out_glyph_info) const override;
+        virtual gfx::gfx_result on_draw(gfx::bitmap<gfx::alpha_pixel<8>>& destination,int32_t codepoint, int32_t glyph_index = -1) const override;
+    public:
+        packed_font(const uint8_t* data, size_t size, bool initialize = false);
+        // glyphs read from the stream are staged in memory from the allocator while they are drawn
+        packed_font(gfx::stream& stream, bool initialize = false, void*(*allocator)(size_t)=::malloc, void*(*reallocator)(void*,size_t)=::realloc, void(*deallocator)(void*)=::free);
+        packed_font(void*(*allocator)(size_t)=::malloc, void*(*reallocator)(void*,size_t)=::realloc, void(*deallocator)(void*)=::free);
+        virtual ~packed_font();
+        packed_font(packed_font&& rhs);
+        packed_font& operator=(packed_font&& rhs);
+        virtual gfx::gfx_result initialize() override;
+        virtual bool initialized() const override;
+        virtual void deinitialize() override;
+        virtual uint16_t line_height() const override;
+        virtual uint16_t line_advance() const override;
+        virtual uint16_t base_line() const override;
+        // the bits per pixel of the glyph alpha values (2 or 4)
+        uint8_t bits_per_pixel() const;
+        size_t glyph_count() const;
+        size_t kerning_pairs() const;
+        // renders the given codepoints of an initialized font at its current size into the packed format.
+        // codepoints the source does not contain are skipped.
+        static gfx::gfx_result compile(const font& source, const int32_t* codepoints, size_t codepoint_count, stream& output, uint8_t bits_per_pixel = 4, bool kerning = true, void*(allocator)(size_t)=::malloc, void*(reallocator)(void*,size_t)=::realloc, void(deallocator)(void*)=::free);
+        // renders the codepoint range first to last (inclusive) of an initialized font at its current size into the packed format.
+        static gfx::gfx_result compile(const font& source, int32_t first, int32_t last, stream& output, uint8_t bits_per_pixel = 4, bool kerning = true, void*(allocator)(size_t)=::malloc, void*(reallocator)(void*,size_t)=::realloc, void(deallocator)(void*)=::free);
+    };
+}
+#endif // HTCW_GFX_PACKED_FONT_HPP
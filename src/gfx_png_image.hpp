@@ -9,11 +9,15 @@ namespace gfx {
 class png_image : public image {
     stream* m_stream;
     size16 m_dimensions;
+    void*(*m_allocator)(size_t);
+    void*(*m_reallocator)(void*,size_t);
+    void(*m_deallocator)(void*);
     png_image(const png_image& rhs)=delete;
     png_image& operator=(const png_image& rhs)=delete;
 public:
-    png_image();
-    png_image(stream& stream, bool initialize=false);
+    png_image(void*(*allocator)(size_t)=::malloc, void*(*reallocator)(void*,size_t)=::realloc, void(*deallocator)(void*)=::free);
+    // the decoder's state and buffers are allocated with allocator while drawing
+    png_image(stream& stream, bool initialize=false, void*(*allocator)(size_t)=::malloc, void*(*reallocator)(void*,size_t)=::realloc, void(*deallocator)(void*)=::free);
     virtual ~png_image();
     png_image(png_image&& rhs);
     png_image& operator=(png_image&& rhs);
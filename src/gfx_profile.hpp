@@ -0,0 +1,30 @@
+#ifndef HTCW_GFX_PROFILE_HPP
+#define HTCW_GFX_PROFILE_HPP
+#include "gfx_core.hpp"
+//#define HTCW_GFX_PROFILE
+namespace gfx {
+namespace helpers {
+// marks the draw:: entry point running on the current thread for as long as it's in scope,
+// so a profiling_target can group what it sees by the call that caused it.
+// Nested markers leave the outermost one in place
+class profile_scope final {
+    const char* m_previous;
+    profile_scope(const profile_scope& rhs) = delete;
+    profile_scope& operator=(const profile_scope& rhs) = delete;
+
+   public:
+    profile_scope(const char* name);
+    ~profile_scope();
+    // the name of the outermost marker in scope, or nullptr if there is none
+    static const char* current();
+};
+}  // namespace helpers
+}  // namespace gfx
+#ifdef HTCW_GFX_PROFILE
+#define HTCW_GFX_PROFILE_CONCAT_IMPL(x, y) x##y
+#define HTCW_GFX_PROFILE_CONCAT(x, y) HTCW_GFX_PROFILE_CONCAT_IMPL(x, y)
+#define HTCW_GFX_PROFILE_SCOPE(name) ::gfx::helpers::profile_scope HTCW_GFX_PROFILE_CONCAT(htcw_gfx_profile_scope, __LINE__)(name)
+#else
+#define HTCW_GFX_PROFILE_SCOPE(name)
+#endif
+#endif
@@ -0,0 +1,305 @@
+#ifndef HTCW_GFX_PROFILING_TARGET_HPP
+#define HTCW_GFX_PROFILING_TARGET_HPP
+#include <stdio.h>
+#include <string.h>
+#include "gfx_core.hpp"
+#include "gfx_positioning.hpp"
+#include "gfx_bitmap.hpp"
+#include "gfx_profile.hpp"
+namespace gfx {
+// returns the current time in any unit, for timing the calls a profiling_target passes through
+typedef uint64_t (*profile_clock_callback)(void* state);
+// what a profiling_target saw while one draw:: entry point was running
+struct profile_counts {
+    // the entry point, or nullptr for calls made outside of one
+    const char* scope;
+    size_t point_reads;
+    size_t point_writes;
+    // clears are counted as fills
+    size_t fills;
+    size_t fill_pixels;
+    size_t spans;
+    size_t cspans;
+    size_t batches;
+    size_t batch_pixels;
+    size_t copy_froms;
+    size_t copy_from_pixels;
+    size_t copy_tos;
+    size_t copy_to_pixels;
+    // the time spent in the destination, in the clock's units
+    uint64_t time;
+};
+namespace helpers {
+// the draw destination side of profiling_target, plus the counts
+template <typename Destination, size_t MaxScopes>
+class profiling_target_base {
+    static_assert(MaxScopes > 0, "MaxScopes must be at least 1");
+
+   public:
+    using type = profiling_target_base;
+    using pixel_type = typename Destination::pixel_type;
+    using palette_type = typename Destination::palette_type;
+
+   protected:
+    Destination* m_destination;
+    profile_clock_callback m_clock;
+    void* m_clock_state;
+    // written by the const members too
+    mutable profile_counts m_counts[MaxScopes];
+    mutable size_t m_count;
+    // where scopes go once m_counts is full
+    mutable profile_counts m_other;
+    static void clear_counts(profile_counts& counts, const char* scope) {
+        memset(&counts, 0, sizeof(counts));
+        counts.scope = scope;
+    }
+    // the counts for the entry point that is running
+    profile_counts& counts() const {
+        const char* name = profile_scope::current();
+        // names are usually literals, and so can be compared by address
+        for (size_t i = 0; i < m_count; ++i) {
+            const char* s = m_counts[i].scope;
+            if (s == name || (s != nullptr && name != nullptr && 0 == strcmp(s, name))) {
+                return m_counts[i];
+            }
+        }
+        if (m_count == MaxScopes) {
+            return m_other;
+        }
+        profile_counts& result = m_counts[m_count++];
+        clear_counts(result, name);
+        return result;
+    }
+    inline uint64_t start() const {
+        return m_clock == nullptr ? 0 : m_clock(m_clock_state);
+    }
+    inline void stop(profile_counts& counts, uint64_t started) const {
+        if (m_clock != nullptr) {
+            counts.time += m_clock(m_clock_state) - started;
+        }
+    }
+    static gfx_result dump_line(stream& out, const profile_counts& c) {
+        // how the entry point wrote its pixels, which shows where it fell back to points
+        char path[64];
+        path[0] = '\0';
+        if (c.fills != 0) strcat(path, " fill");
+        if (c.spans != 0) strcat(path, " span");
+        if (c.batches != 0) strcat(path, " batch");
+        if (c.copy_froms != 0) strcat(path, " copy_from");
+        if (c.point_writes != 0) strcat(path, " point");
+        char line[320];
+        const int len = snprintf(line, sizeof(line), "%-28s %10lu %10lu %8lu %10lu %8lu %8lu %8lu %10lu %8lu %10lu %8lu %10lu %12llu %s\n",
+                                 c.scope == nullptr ? "(none)" : c.scope,
+                                 (unsigned long)c.point_reads, (unsigned long)c.point_writes,
+                                 (unsigned long)c.fills, (unsigned long)c.fill_pixels,
+                                 (unsigned long)c.spans, (unsigned long)c.cspans,
+                                 (unsigned long)c.batches, (unsigned long)c.batch_pixels,
+                                 (unsigned long)c.copy_froms, (unsigned long)c.copy_from_pixels,
+                                 (unsigned long)c.copy_tos, (unsigned long)c.copy_to_pixels,
+                                 (unsigned long long)c.time, path[0] == '\0' ? " -" : path);
+        if (len < 0) {
+            return gfx_result::invalid_format;
+        }
+        const size_t size = (size_t)len < sizeof(line) ? (size_t)len : sizeof(line) - 1;
+        return out.write((const uint8_t*)line, size) == size ? gfx_result::success : gfx_result::io_error;
+    }
+
+   public:
+    profiling_target_base(Destination& destination, profile_clock_callback clock, void* clock_state) : m_destination(&destination), m_clock(clock), m_clock_state(clock_state), m_count(0) {
+        clear_counts(m_other, "(other)");
+    }
+    // the wrapped draw target
+    inline Destination& destination() const {
+        return *m_destination;
+    }
+    inline size16 dimensions() const {
+        return m_destination->dimensions();
+    }
+    inline rect16 bounds() const {
+        return dimensions().bounds();
+    }
+    inline const palette_type* palette() const {
+        return m_destination->palette();
+    }
+    // indicates the number of entry points seen, not including those past MaxScopes
+    inline size_t count() const {
+        return m_count;
+    }
+    // retrieves the counts for the entry point at index, in the order they were first seen
+    inline const profile_counts& operator[](size_t index) const {
+        return m_counts[index];
+    }
+    // retrieves the counts for the named entry point, or nullptr if it wasn't seen
+    const profile_counts* find(const char* scope) const {
+        for (size_t i = 0; i < m_count; ++i) {
+            const char* s = m_counts[i].scope;
+            if (s == scope || (s != nullptr && scope != nullptr && 0 == strcmp(s, scope))) {
+                return &m_counts[i];
+            }
+        }
+        return nullptr;
+    }
+    // the combined counts of the entry points seen after the first MaxScopes
+    inline const profile_counts& other() const {
+        return m_other;
+    }
+    // forgets all counts
+    void reset() {
+        m_count = 0;
+        clear_counts(m_other, "(other)");
+    }
+    // writes a table of the counts, one entry point per line
+    gfx_result dump(stream& out) const {
+        char line[320];
+        const int len = snprintf(line, sizeof(line), "%-28s %10s %10s %8s %10s %8s %8s %8s %10s %8s %10s %8s %10s %12s %s\n",
+                                 "scope", "reads", "writes", "fills", "fill px", "spans", "cspans", "batches", "batch px", "froms", "from px", "tos", "to px", "time", "path");
+        if (len < 0) {
+            return gfx_result::invalid_format;
+        }
+        if (out.write((const uint8_t*)line, (size_t)len) != (size_t)len) {
+            return gfx_result::io_error;
+        }
+        for (size_t i = 0; i < m_count; ++i) {
+            const gfx_result r = dump_line(out, m_counts[i]);
+            if (r != gfx_result::success) {
+                return r;
+            }
+        }
+        if (m_count == MaxScopes) {
+            return dump_line(out, m_other);
+        }
+        return gfx_result::success;
+    }
+    gfx_result point(point16 location, pixel_type* out_pixel) const {
+        profile_counts& c = counts();
+        ++c.point_reads;
+        const uint64_t t = start();
+        const gfx_result r = m_destination->point(location, out_pixel);
+        stop(c, t);
+        return r;
+    }
+    gfx_result point(point16 location, pixel_type color) {
+        profile_counts& c = counts();
+        ++c.point_writes;
+        const uint64_t t = start();
+        const gfx_result r = m_destination->point(location, color);
+        stop(c, t);
+        return r;
+    }
+    gfx_result fill(const rect16& bounds, pixel_type color) {
+        profile_counts& c = counts();
+        ++c.fills;
+        c.fill_pixels += bounds.normalize().area();
+        const uint64_t t = start();
+        const gfx_result r = m_destination->fill(bounds, color);
+        stop(c, t);
+        return r;
+    }
+    gfx_result clear(const rect16& bounds) {
+        profile_counts& c = counts();
+        ++c.fills;
+        c.fill_pixels += bounds.normalize().area();
+        const uint64_t t = start();
+        const gfx_result r = m_destination->clear(bounds);
+        stop(c, t);
+        return r;
+    }
+    template <typename Source>
+    gfx_result copy_from(const rect16& src_rect, const Source& src, point16 location) {
+        profile_counts& c = counts();
+        ++c.copy_froms;
+        c.copy_from_pixels += src_rect.normalize().area();
+        const uint64_t t = start();
+        const gfx_result r = m_destination->copy_from(src_rect, src, location);
+        stop(c, t);
+        return r;
+    }
+    template <typename Target>
+    gfx_result copy_to(const rect16& src_rect, Target& dst, point16 location) const {
+        profile_counts& c = counts();
+        ++c.copy_tos;
+        c.copy_to_pixels += src_rect.normalize().area();
+        const uint64_t t = start();
+        const gfx_result r = m_destination->copy_to(src_rect, dst, location);
+        stop(c, t);
+        return r;
+    }
+    // the batch members are only usable if the destination has them
+    gfx_result begin_batch(const rect16& bounds) {
+        profile_counts& c = counts();
+        ++c.batches;
+        const uint64_t t = start();
+        const gfx_result r = m_destination->begin_batch(bounds);
+        stop(c, t);
+        return r;
+    }
+    gfx_result write_batch(pixel_type color) {
+        profile_counts& c = counts();
+        ++c.batch_pixels;
+        const uint64_t t = start();
+        const gfx_result r = m_destination->write_batch(color);
+        stop(c, t);
+        return r;
+    }
+    gfx_result commit_batch() {
+        profile_counts& c = counts();
+        const uint64_t t = start();
+        const gfx_result r = m_destination->commit_batch();
+        stop(c, t);
+        return r;
+    }
+    inline gfx_result suspend() {
+        return m_destination->suspend();
+    }
+    inline gfx_result resume(bool force = false) {
+        return m_destination->resume(force);
+    }
+};
+template <typename Destination, size_t MaxScopes, bool BltSpans>
+class profiling_target_impl : public profiling_target_base<Destination, MaxScopes> {
+   public:
+    profiling_target_impl(Destination& destination, profile_clock_callback clock, void* clock_state) : profiling_target_base<Destination, MaxScopes>(destination, clock, clock_state) {
+    }
+};
+// span access is passed through and counted. What is done with a span afterward
+// happens directly in the destination's memory, so it can't be timed
+template <typename Destination, size_t MaxScopes>
+class profiling_target_impl<Destination, MaxScopes, true> : public profiling_target_base<Destination, MaxScopes>, public blt_span {
+   public:
+    profiling_target_impl(Destination& destination, profile_clock_callback clock, void* clock_state) : profiling_target_base<Destination, MaxScopes>(destination, clock, clock_state) {
+    }
+    virtual size16 span_dimensions() const override {
+        return this->m_destination->span_dimensions();
+    }
+    virtual size_t pixel_width() const override {
+        return this->m_destination->pixel_width();
+    }
+    virtual gfx_span span(point16 location) const override {
+        ++this->counts().spans;
+        return this->m_destination->span(location);
+    }
+    virtual const gfx_cspan cspan(point16 location) const override {
+        ++this->counts().cspans;
+        return this->m_destination->cspan(location);
+    }
+};
+}  // namespace helpers
+// wraps a draw destination and counts the calls made to it, grouped by the draw:: entry point that
+// made them, so you can see which primitives fall back to drawing a point at a time. Entry points
+// are only known when HTCW_GFX_PROFILE is defined. Otherwise everything is counted under nullptr.
+// The wrapper isn't a blt target, so draw:: takes its non-blt paths through it.
+// clock, if specified, times each call passed through to the destination
+template <typename Destination, size_t MaxScopes = 32>
+class profiling_target final : public helpers::profiling_target_impl<Destination, MaxScopes, Destination::caps::blt_spans> {
+    using base_type = helpers::profiling_target_impl<Destination, MaxScopes, Destination::caps::blt_spans>;
+
+   public:
+    using type = profiling_target;
+    using pixel_type = typename Destination::pixel_type;
+    using palette_type = typename Destination::palette_type;
+    using caps = gfx::gfx_caps<false, Destination::caps::blt_spans, Destination::caps::copy_from, Destination::caps::copy_to>;
+    profiling_target(Destination& destination, profile_clock_callback clock = nullptr, void* clock_state = nullptr) : base_type(destination, clock, clock_state) {
+    }
+};
+}  // namespace gfx
+#endif
@@ -0,0 +1,70 @@
+#ifndef HTCW_GFX_SDF_FONT_HPP
+#define HTCW_GFX_SDF_FONT_HPP
+#include <gfx_font.hpp>
+#include <gfx_tt_font.hpp>
+#include <htcw_data.hpp>
+namespace gfx {
+    // Renders a TrueType font at any size from 8-bit signed distance fields.
+    // Each glyph's field is computed once from the anti-aliased glyph of the source
+    // tt_font at its current (reference) size and kept in an internal cache, so
+    // changing the size of this font is cheap and does not invalidate anything.
+    // Sizes up to about twice the reference size keep good quality. Since the
+    // glyph bitmaps change with the size, do not attach a font_draw_cache to text
+    // drawn with a font whose size is being animated.
+    class sdf_font : public font {
+        typedef struct {
+            int accessed;
+            size16 dimensions;
+            spoint16 offset;
+            uint8_t* data;
+        } cache_entry_t;
+        using map_t = data::simple_fixed_map<int32_t,cache_entry_t,32>;
+        tt_font* m_source;
+        float m_size;
+        font_size_units m_units;
+        float m_ratio;
+        uint8_t m_padding;
+        uint16_t m_line_height;
+        uint16_t m_line_advance;
+        uint16_t m_base_line;
+        void*(*m_allocator)(size_t);
+        void*(*m_reallocator)(void*,size_t);
+        void(*m_deallocator)(void*);
+        mutable int m_accessed;
+        mutable map_t m_cache;
+        mutable size_t m_memory_size;
+        size_t m_max_memory_size;
+        sdf_font(const sdf_font& rhs)=delete;
+        sdf_font& operator=(const sdf_font& rhs)=delete;
+        static int hash_function(const int32_t& key);
+        void set_size();
+        void expire_memory(size_t new_data_size) const;
+        gfx::gfx_result field(int32_t codepoint, const cache_entry_t** out_entry) const;
+    protected:
+        virtual gfx::gfx_result on_measure(int32_t codepoint1,int32_t codepoint2, font_glyph_info* out_glyph_info) const override;
+        virtual gfx::gfx_result on_draw(gfx::bitmap<gfx::alpha_pixel<8>>& destination,int32_t codepoint, int32_t glyph_index = -1) const override;
+    public:
+        // source must be initialized before this font is. padding is the range of the distance fields in reference pixels.
+        sdf_font(tt_font& source, float size, font_size_units units = font_size_units::em, uint8_t padding = 4, void*(allocator)(size_t)=::malloc, void*(reallocator)(void*,size_t)=::realloc, void(deallocator)(void*)=::free);
+        sdf_font(void*(allocator)(size_t)=::malloc, void*(reallocator)(void*,size_t)=::realloc, void(deallocator)(void*)=::free);
+        virtual ~sdf_font();
+        sdf_font(sdf_font&& rhs);
+        sdf_font& operator=(sdf_font&& rhs);
+        // changes the rendered size without discarding the cached fields
+        void size(float size, font_size_units units = font_size_units::em);
+        float size() const;
+        // the maximum bytes of distance fields to keep, or 0 for no limit
+        size_t max_memory_size() const;
+        void max_memory_size(size_t value);
+        size_t memory_size() const;
+        // discards the cached distance fields
+        void clear();
+        virtual gfx::gfx_result initialize() override;
+        virtual bool initialized() const override;
+        virtual void deinitialize() override;
+        virtual uint16_t line_height() const override;
+        virtual uint16_t line_advance() const override;
+        virtual uint16_t base_line() const override;
+    };
+}
+#endif // HTCW_GFX_SDF_FONT_HPP
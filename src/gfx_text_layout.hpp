@@ -0,0 +1,136 @@
+#ifndef HTCW_GFX_TEXT_LAYOUT_HPP
+#define HTCW_GFX_TEXT_LAYOUT_HPP
+#include <gfx_core.hpp>
+#include <gfx_positioning.hpp>
+#include <gfx_font.hpp>
+#include <htcw_data.hpp>
+namespace gfx {
+    // a single positioned glyph within a text_layout
+    struct text_layout_glyph final {
+        int32_t codepoint;
+        int32_t glyph_index;
+        // relative to the layout origin
+        spoint16 location;
+        size16 dimensions;
+    };
+    // a line box within a text_layout
+    struct text_layout_line final {
+        uint32_t first_glyph;
+        uint32_t glyph_count;
+        uint16_t y;
+        uint16_t width;
+    };
+    // Holds the result of measuring and laying out a run of text once, so that it
+    // can be drawn repeatedly (in any color) without re-running line breaking, tab
+    // expansion, kerning or glyph measurement. The font referenced by the text_info
+    // must outlive the layout since glyphs are still rasterized by the font unless
+    // they are found in the draw cache passed to draw(). The text_info's draw cache
+    // isn't kept.
+    class text_layout final {
+        const font* m_font;
+        text_layout_glyph* m_glyphs;
+        size_t m_glyph_count;
+        size_t m_glyph_capacity;
+        text_layout_line* m_lines;
+        size_t m_line_count;
+        size_t m_line_capacity;
+        size16 m_dimensions;
+        uint16_t m_max_width;
+        void*(*m_allocator)(size_t);
+        void*(*m_reallocator)(void*,size_t);
+        void(*m_deallocator)(void*);
+        text_layout(const text_layout& rhs)=delete;
+        text_layout& operator=(const text_layout& rhs)=delete;
+        gfx_result add_glyph(const text_layout_glyph& glyph);
+        gfx_result add_line(const text_layout_line& line);
+    public:
+        text_layout(void*(allocator)(size_t)=::malloc, void*(reallocator)(void*,size_t)=::realloc, void(deallocator)(void*)=::free);
+        text_layout(text_layout&& rhs);
+        ~text_layout();
+        text_layout& operator=(text_layout&& rhs);
+        // measures and lays out the text, wrapping at max_width
+        gfx_result initialize(uint16_t max_width, const text_info& info);
+        bool initialized() const;
+        void deinitialize();
+        const ::gfx::font* text_font() const;
+        uint16_t max_width() const;
+        // the area covered by the laid out text
+        size16 dimensions() const;
+        size_t glyphs() const;
+        const text_layout_glyph& glyph(size_t index) const;
+        size_t lines() const;
+        const text_layout_line& line(size_t index) const;
+        size_t memory_size() const;
+        // draws the glyphs offset by bounds.point1(), skipping lines below bounds.y2.
+        // glyphs are looked up in and added to draw_cache if it's given
+        gfx_result draw(const srect16& bounds, font_draw_callback callback, void* callback_state=nullptr, font_draw_cache* draw_cache=nullptr) const;
+    };
+    // A small LRU cache of text_layout instances keyed by the text bytes, the font
+    // and its line height, the encoding, the wrapping width and the tab width. The
+    // line height stands in for the font's size, so clear the cache after resizing
+    // a font to a size with the same line height.
+    class text_layout_cache final {
+        typedef struct layout_key {
+            uint32_t hash;
+            const uint8_t* text;
+            size_t text_byte_count;
+            const font* text_font;
+            uint16_t line_height;
+            const text_encoder* encoding;
+            uint16_t max_width;
+            uint16_t tab_width;
+            inline bool operator==(const layout_key& rhs) const {
+                return hash==rhs.hash &&
+                    text_byte_count==rhs.text_byte_count &&
+                    text_font==rhs.text_font &&
+                    line_height==rhs.line_height &&
+                    encoding==rhs.encoding &&
+                    max_width==rhs.max_width &&
+                    tab_width==rhs.tab_width &&
+                    0==memcmp(text,rhs.text,text_byte_count);
+            }
+        } key_t;
+        typedef struct {
+            int accessed;
+            text_layout* layout;
+        } cache_entry_t;
+        using map_t = data::simple_fixed_map<key_t,cache_entry_t,16>;
+        void*(*m_allocator)(size_t);
+        void*(*m_reallocator)(void*,size_t);
+        void(*m_deallocator)(void*);
+        bool m_initialized;
+        int m_accessed;
+        map_t m_cache;
+        size_t m_memory_size;
+        size_t m_max_memory_size;
+        size_t m_max_entries;
+        text_layout_cache(const text_layout_cache& rhs)=delete;
+        text_layout_cache& operator=(const text_layout_cache& rhs)=delete;
+        static int hash_function(const key_t& key);
+        static void make_key(uint16_t max_width, const text_info& info, key_t* out_key);
+        static size_t entry_size(const map_t::value_type& value);
+        void free_entry(map_t::value_type& value);
+        void expire_item();
+        void reduce(int new_size, int new_items);
+    public:
+        text_layout_cache(void*(allocator)(size_t)=::malloc, void*(reallocator)(void*,size_t)=::realloc, void(deallocator)(void*)=::free);
+        text_layout_cache(text_layout_cache&& rhs);
+        ~text_layout_cache();
+        text_layout_cache& operator=(text_layout_cache&& rhs);
+        size_t max_memory_size() const;
+        void max_memory_size(size_t value);
+        size_t memory_size() const;
+        size_t max_entries() const;
+        void max_entries(size_t value);
+        size_t entries() const;
+        // retrieves the layout for the text, creating and caching it if necessary
+        gfx_result layout(uint16_t max_width, const text_info& info, const text_layout** out_layout);
+        // retrieves the layout for the text only if it is already cached
+        gfx_result find(uint16_t max_width, const text_info& info, const text_layout** out_layout);
+        void clear();
+        gfx_result initialize();
+        bool initialized() const;
+        void deinitialize();
+    };
+}
+#endif // HTCW_GFX_TEXT_LAYOUT_HPP
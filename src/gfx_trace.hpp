@@ -0,0 +1,106 @@
+#ifndef HTCW_GFX_TRACE_HPP
+#define HTCW_GFX_TRACE_HPP
+#include <stdlib.h>
+#include "gfx_core.hpp"
+//#define HTCW_GFX_TRACE
+namespace gfx {
+// returns the current time in nanoseconds, from any fixed point
+typedef uint64_t (*trace_clock_callback)(void* state);
+// what an event marks. The values are the Chrome trace event phases
+enum struct trace_phase : char {
+    begin = 'B',
+    end = 'E',
+    instant = 'i',
+    // async events are matched by their id rather than nesting, and may start and end on different threads
+    async_begin = 'b',
+    async_end = 'e'
+};
+struct trace_event {
+    // both point to string literals
+    const char* category;
+    const char* name;
+    uint64_t timestamp;
+    // matches async events to each other
+    uint64_t id;
+    // a small number for the thread that recorded it, in order of first use
+    uint32_t thread;
+    trace_phase phase;
+};
+// Records the trace points in the library into a ring buffer, to see when
+// SVG parsing, rasterization, blending, JPG decoding, glyph drawing and
+// flushing happen and how they overlap with transfers. The trace points are
+// compiled out unless HTCW_GFX_TRACE is defined. Once the buffer is full the
+// oldest events are overwritten. dump() writes Chrome trace event JSON, which
+// Perfetto or chrome://tracing can open.
+class trace_buffer final {
+    void* m_info;
+    void* (*m_allocator)(size_t);
+    void* (*m_reallocator)(void*, size_t);
+    void (*m_deallocator)(void*);
+    trace_buffer(const trace_buffer& rhs) = delete;
+    trace_buffer& operator=(const trace_buffer& rhs) = delete;
+
+   public:
+    trace_buffer(void* (*allocator)(size_t) = ::malloc, void* (*reallocator)(void*, size_t) = ::realloc, void (*deallocator)(void*) = ::free);
+    trace_buffer(trace_buffer&& rhs);
+    ~trace_buffer();
+    trace_buffer& operator=(trace_buffer&& rhs);
+    // allocates room for capacity events. clock is called with clock_state for each one
+    gfx_result initialize(size_t capacity, trace_clock_callback clock, void* clock_state = nullptr);
+    bool initialized() const;
+    // stops recording to this buffer if it is, and frees it
+    void deinitialize();
+    // makes this the buffer the trace points record to, replacing any other. Only one records at a time
+    gfx_result start();
+    // stops the trace points recording to this buffer
+    void stop();
+    // indicates whether this is the buffer being recorded to
+    bool recording() const;
+    size_t capacity() const;
+    // the number of events held, which is at most capacity()
+    size_t count() const;
+    // the number of events overwritten since the last clear()
+    size_t dropped() const;
+    void clear();
+    // adds an event. The trace points call this on the buffer being recorded to
+    void record(trace_phase phase, const char* category, const char* name, uint64_t id = 0);
+    // retrieves an event, oldest first
+    gfx_result event(size_t index, trace_event* out_event) const;
+    // writes the events as Chrome trace event JSON, with times in microseconds from the oldest event.
+    // Stop recording first so the buffer doesn't change while it's written
+    gfx_result dump(stream& out) const;
+};
+namespace helpers {
+// records to the buffer being recorded to, if any
+void trace_record(trace_phase phase, const char* category, const char* name, uint64_t id = 0);
+// records a begin event now and the matching end event when it goes out of scope
+class trace_scope final {
+    const char* m_category;
+    const char* m_name;
+    trace_scope(const trace_scope& rhs) = delete;
+    trace_scope& operator=(const trace_scope& rhs) = delete;
+
+   public:
+    inline trace_scope(const char* category, const char* name) : m_category(category), m_name(name) {
+        trace_record(trace_phase::begin, category, name);
+    }
+    inline ~trace_scope() {
+        trace_record(trace_phase::end, m_category, m_name);
+    }
+};
+}  // namespace helpers
+}  // namespace gfx
+#ifdef HTCW_GFX_TRACE
+#define HTCW_GFX_TRACE_CONCAT_IMPL(x, y) x##y
+#define HTCW_GFX_TRACE_CONCAT(x, y) HTCW_GFX_TRACE_CONCAT_IMPL(x, y)
+#define HTCW_GFX_TRACE_SCOPE(category, name) ::gfx::helpers::trace_scope HTCW_GFX_TRACE_CONCAT(htcw_gfx_trace_scope, __LINE__)(category, name)
+#define HTCW_GFX_TRACE_INSTANT(category, name) ::gfx::helpers::trace_record(::gfx::trace_phase::instant, category, name)
+#define HTCW_GFX_TRACE_ASYNC_BEGIN(category, name, id) ::gfx::helpers::trace_record(::gfx::trace_phase::async_begin, category, name, id)
+#define HTCW_GFX_TRACE_ASYNC_END(category, name, id) ::gfx::helpers::trace_record(::gfx::trace_phase::async_end, category, name, id)
+#else
+#define HTCW_GFX_TRACE_SCOPE(category, name)
+#define HTCW_GFX_TRACE_INSTANT(category, name)
+#define HTCW_GFX_TRACE_ASYNC_BEGIN(category, name, id)
+#define HTCW_GFX_TRACE_ASYNC_END(category, name, id)
+#endif
+#endif
@@ -12,15 +12,38 @@ namespace gfx {
         float m_size;
         font_size_units m_units;
         bool m_kerning;
+        typedef struct {
+            uint16_t glyph;
+            int16_t advance;
+            int16_t x0, y0, x1, y1;
+        } preload_glyph_t;
+        typedef struct {
+            uint32_t key;
+            int16_t adjust;
+        } preload_kern_t;
+        int32_t m_preload_first;
+        int32_t m_preload_last;
+        preload_glyph_t* m_preload_glyphs;
+        preload_kern_t* m_preload_kerns;
+        size_t m_preload_kern_capacity;
+        size_t m_preload_kern_count;
+        void*(*m_allocator)(size_t);
+        void*(*m_reallocator)(void*,size_t);
+        void(*m_deallocator)(void*);
         tt_font(const tt_font& rhs)=delete;
         tt_font& operator=(const tt_font& rhs)=delete;
         void set_size();
+        gfx::gfx_result load_preload();
+        void free_preload();
+        bool preload_kern_insert(uint32_t key, int16_t adjust);
+        int16_t preload_kern_find(uint32_t key) const;
     protected:
         virtual gfx::gfx_result on_measure(int32_t codepoint1,int32_t codepoint2, font_glyph_info* out_glyph_info) const override;
         virtual gfx::gfx_result on_draw(gfx::bitmap<gfx::alpha_pixel<8>>& destination,int32_t codepoint, int32_t glyph_index = -1) const override;
     public:
-        tt_font(gfx::stream& stream,float size, font_size_units units = font_size_units::em, bool initialize = false);
-        tt_font();
+        // the font's state, the preloaded data and the memory used to rasterize glyphs come from allocator
+        tt_font(gfx::stream& stream,float size, font_size_units units = font_size_units::em, bool initialize = false, void*(*allocator)(size_t)=::malloc, void*(*reallocator)(void*,size_t)=::realloc, void(*deallocator)(void*)=::free);
+        tt_font(void*(*allocator)(size_t)=::malloc, void*(*reallocator)(void*,size_t)=::realloc, void(*deallocator)(void*)=::free);
         virtual ~tt_font();
         tt_font(tt_font&& rhs);
         tt_font& operator=(tt_font&& rhs);
@@ -31,6 +54,16 @@ namespace gfx {
         virtual uint16_t line_height() const override;
         virtual uint16_t line_advance() const override;
         virtual uint16_t base_line() const override;
+        // the scale factor from font units to pixels at the current size
+        float scale() const;
+        // the scale factor from font units to pixels at the given size
+        float scale(float size, font_size_units units = font_size_units::em) const;
+        // preloads the glyph indices, metrics and kerning pairs for the codepoints first through last (inclusive)
+        // so that measuring text in that range does not read from the stream. takes effect at initialize(), or
+        // immediately if the font is already initialized. pass a last less than first to disable it.
+        gfx::gfx_result preload(int32_t first, int32_t last);
+        // the number of bytes used by preloaded data
+        size_t preload_memory_size() const;
     };
 }
 #endif // HTCW_GFX_TT_FONT_HPP
\ No newline at end of file
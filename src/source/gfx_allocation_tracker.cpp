@@ -0,0 +1,239 @@
+#include "gfx_allocation_tracker.hpp"
+#include <stddef.h>
+#include <stdio.h>
+#include <atomic>
+namespace gfx {
+struct allocation_counters {
+    std::atomic<size_t> current;
+    std::atomic<size_t> peak;
+    std::atomic<size_t> allocations;
+    std::atomic<size_t> reallocations;
+    std::atomic<size_t> deallocations;
+    std::atomic<size_t> failures;
+    std::atomic<size_t> histogram[allocation_histogram_buckets];
+};
+// the block header. It is padded out so the memory after it stays aligned
+struct allocation_header {
+    size_t size;
+    size_t tag;
+};
+constexpr static const size_t allocation_header_size = sizeof(allocation_header) > alignof(max_align_t) ? sizeof(allocation_header) : alignof(max_align_t);
+static allocation_counters allocation_tags[allocation_tag_count];
+static allocation_counters allocation_total;
+static void* (*allocation_backing_allocator)(size_t) = ::malloc;
+static void* (*allocation_backing_reallocator)(void*, size_t) = ::realloc;
+static void (*allocation_backing_deallocator)(void*) = ::free;
+static const char* allocation_tag_names[allocation_tag_count] = {"canvas", "font", "image", "svg", "tvg", "raster"};
+
+static size_t allocation_bucket(size_t size) {
+    size_t bucket = 0;
+    size_t limit = 16;
+    while (bucket < allocation_histogram_buckets - 1 && size > limit) {
+        limit <<= 1;
+        ++bucket;
+    }
+    return bucket;
+}
+static void allocation_raise_peak(std::atomic<size_t>& peak, size_t value) {
+    size_t old = peak.load(std::memory_order_relaxed);
+    while (value > old && !peak.compare_exchange_weak(old, value, std::memory_order_relaxed)) {
+    }
+}
+static void allocation_grow(allocation_counters& counters, size_t size) {
+    allocation_raise_peak(counters.peak, counters.current.fetch_add(size, std::memory_order_relaxed) + size);
+}
+static void allocation_add(size_t tag, size_t size) {
+    allocation_grow(allocation_tags[tag], size);
+    allocation_grow(allocation_total, size);
+}
+static void allocation_remove(size_t tag, size_t size) {
+    allocation_tags[tag].current.fetch_sub(size, std::memory_order_relaxed);
+    allocation_total.current.fetch_sub(size, std::memory_order_relaxed);
+}
+static void allocation_count(std::atomic<size_t> allocation_counters::*counter, size_t tag) {
+    (allocation_tags[tag].*counter).fetch_add(1, std::memory_order_relaxed);
+    (allocation_total.*counter).fetch_add(1, std::memory_order_relaxed);
+}
+static void allocation_count_size(size_t tag, size_t size) {
+    const size_t bucket = allocation_bucket(size);
+    allocation_tags[tag].histogram[bucket].fetch_add(1, std::memory_order_relaxed);
+    allocation_total.histogram[bucket].fetch_add(1, std::memory_order_relaxed);
+}
+static void* allocation_allocate(size_t tag, size_t size) {
+    allocation_count(&allocation_counters::allocations, tag);
+    allocation_count_size(tag, size);
+    uint8_t* block = (uint8_t*)allocation_backing_allocator(size + allocation_header_size);
+    if (block == nullptr) {
+        allocation_count(&allocation_counters::failures, tag);
+        return nullptr;
+    }
+    allocation_header* header = (allocation_header*)block;
+    header->size = size;
+    header->tag = tag;
+    allocation_add(tag, size);
+    return block + allocation_header_size;
+}
+static void allocation_deallocate(void* ptr) {
+    if (ptr == nullptr) {
+        return;
+    }
+    uint8_t* block = ((uint8_t*)ptr) - allocation_header_size;
+    const allocation_header* header = (const allocation_header*)block;
+    // the block is charged to the tag it was allocated with
+    allocation_count(&allocation_counters::deallocations, header->tag);
+    allocation_remove(header->tag, header->size);
+    allocation_backing_deallocator(block);
+}
+static void* allocation_reallocate(size_t tag, void* ptr, size_t size) {
+    if (ptr == nullptr) {
+        return allocation_allocate(tag, size);
+    }
+    uint8_t* block = ((uint8_t*)ptr) - allocation_header_size;
+    const allocation_header old = *(const allocation_header*)block;
+    allocation_count(&allocation_counters::reallocations, old.tag);
+    allocation_count_size(old.tag, size);
+    block = (uint8_t*)allocation_backing_reallocator(block, size + allocation_header_size);
+    if (block == nullptr) {
+        allocation_count(&allocation_counters::failures, old.tag);
+        return nullptr;
+    }
+    ((allocation_header*)block)->size = size;
+    allocation_remove(old.tag, old.size);
+    allocation_add(old.tag, size);
+    return block + allocation_header_size;
+}
+template <size_t Tag>
+struct allocation_tagged {
+    static void* allocate(size_t size) {
+        return allocation_allocate(Tag, size);
+    }
+    static void* reallocate(void* ptr, size_t size) {
+        return allocation_reallocate(Tag, ptr, size);
+    }
+};
+static void* (*const allocation_allocators[allocation_tag_count])(size_t) = {
+    allocation_tagged<0>::allocate, allocation_tagged<1>::allocate, allocation_tagged<2>::allocate,
+    allocation_tagged<3>::allocate, allocation_tagged<4>::allocate, allocation_tagged<5>::allocate};
+static void* (*const allocation_reallocators[allocation_tag_count])(void*, size_t) = {
+    allocation_tagged<0>::reallocate, allocation_tagged<1>::reallocate, allocation_tagged<2>::reallocate,
+    allocation_tagged<3>::reallocate, allocation_tagged<4>::reallocate, allocation_tagged<5>::reallocate};
+
+static allocation_stats allocation_read(const allocation_counters& counters) {
+    allocation_stats result;
+    result.current = counters.current.load(std::memory_order_relaxed);
+    result.peak = counters.peak.load(std::memory_order_relaxed);
+    result.allocations = counters.allocations.load(std::memory_order_relaxed);
+    result.reallocations = counters.reallocations.load(std::memory_order_relaxed);
+    result.deallocations = counters.deallocations.load(std::memory_order_relaxed);
+    result.failures = counters.failures.load(std::memory_order_relaxed);
+    for (size_t i = 0; i < allocation_histogram_buckets; ++i) {
+        result.histogram[i] = counters.histogram[i].load(std::memory_order_relaxed);
+    }
+    return result;
+}
+static void allocation_clear(allocation_counters& counters) {
+    counters.peak.store(counters.current.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    counters.allocations.store(0, std::memory_order_relaxed);
+    counters.reallocations.store(0, std::memory_order_relaxed);
+    counters.deallocations.store(0, std::memory_order_relaxed);
+    counters.failures.store(0, std::memory_order_relaxed);
+    for (size_t i = 0; i < allocation_histogram_buckets; ++i) {
+        counters.histogram[i].store(0, std::memory_order_relaxed);
+    }
+}
+static gfx_result allocation_write(stream& out, const char* text, int length) {
+    if (length < 0) {
+        return gfx_result::invalid_format;
+    }
+    return out.write((const uint8_t*)text, (size_t)length) == (size_t)length ? gfx_result::success : gfx_result::io_error;
+}
+static gfx_result allocation_dump_line(stream& out, const char* name, const allocation_stats& stats) {
+    char line[128];
+    const int len = snprintf(line, sizeof(line), "%-8s %10lu %10lu %10lu %10lu %10lu %8lu\n", name,
+                             (unsigned long)stats.current, (unsigned long)stats.peak,
+                             (unsigned long)stats.allocations, (unsigned long)stats.reallocations,
+                             (unsigned long)stats.deallocations, (unsigned long)stats.failures);
+    return allocation_write(out, line, len);
+}
+static gfx_result allocation_dump_histogram(stream& out, const char* name, const allocation_stats& stats) {
+    char line[256];
+    int len = snprintf(line, sizeof(line), "%-8s", name);
+    for (size_t i = 0; i < allocation_histogram_buckets && len > 0 && (size_t)len < sizeof(line); ++i) {
+        len += snprintf(line + len, sizeof(line) - len, " %7lu", (unsigned long)stats.histogram[i]);
+    }
+    if (len > 0 && (size_t)len < sizeof(line) - 1) {
+        line[len++] = '\n';
+    }
+    return allocation_write(out, line, len);
+}
+
+void* (*allocation_tracker::allocator(allocation_tag tag))(size_t) {
+    return allocation_allocators[(size_t)tag];
+}
+void* (*allocation_tracker::reallocator(allocation_tag tag))(void*, size_t) {
+    return allocation_reallocators[(size_t)tag];
+}
+void (*allocation_tracker::deallocator(allocation_tag tag))(void*) {
+    // each block's header records its tag, so one deallocator serves them all
+    (void)tag;
+    return allocation_deallocate;
+}
+void allocation_tracker::backing(void* (*allocator)(size_t), void* (*reallocator)(void*, size_t), void (*deallocator)(void*)) {
+    allocation_backing_allocator = allocator;
+    allocation_backing_reallocator = reallocator;
+    allocation_backing_deallocator = deallocator;
+}
+size_t allocation_tracker::overhead() {
+    return allocation_header_size;
+}
+allocation_stats allocation_tracker::stats(allocation_tag tag) {
+    return allocation_read(allocation_tags[(size_t)tag]);
+}
+allocation_stats allocation_tracker::total() {
+    return allocation_read(allocation_total);
+}
+void allocation_tracker::reset(allocation_tag tag) {
+    allocation_clear(allocation_tags[(size_t)tag]);
+}
+void allocation_tracker::reset() {
+    for (size_t i = 0; i < allocation_tag_count; ++i) {
+        allocation_clear(allocation_tags[i]);
+    }
+    allocation_clear(allocation_total);
+}
+const char* allocation_tracker::name(allocation_tag tag) {
+    return (size_t)tag < allocation_tag_count ? allocation_tag_names[(size_t)tag] : nullptr;
+}
+gfx_result allocation_tracker::dump(stream& out) {
+    char line[256];
+    int len = snprintf(line, sizeof(line), "%-8s %10s %10s %10s %10s %10s %8s\n", "tag", "current", "peak", "allocs", "reallocs", "frees", "failed");
+    gfx_result r = allocation_write(out, line, len);
+    for (size_t i = 0; r == gfx_result::success && i < allocation_tag_count; ++i) {
+        r = allocation_dump_line(out, allocation_tag_names[i], allocation_read(allocation_tags[i]));
+    }
+    if (r == gfx_result::success) {
+        r = allocation_dump_line(out, "total", allocation_read(allocation_total));
+    }
+    if (r != gfx_result::success) {
+        return r;
+    }
+    // the histogram columns are the largest request each bucket counts
+    len = snprintf(line, sizeof(line), "\n%-8s", "size <=");
+    size_t limit = 16;
+    for (size_t i = 0; i < allocation_histogram_buckets - 1 && len > 0 && (size_t)len < sizeof(line); ++i) {
+        len += snprintf(line + len, sizeof(line) - len, limit < 1024 ? " %7lu" : " %6luK", (unsigned long)(limit < 1024 ? limit : limit / 1024));
+        limit <<= 1;
+    }
+    if (len > 0 && (size_t)len < sizeof(line)) {
+        len += snprintf(line + len, sizeof(line) - len, " %7s\n", "more");
+    }
+    r = allocation_write(out, line, len);
+    for (size_t i = 0; r == gfx_result::success && i < allocation_tag_count; ++i) {
+        r = allocation_dump_histogram(out, allocation_tag_names[i], allocation_read(allocation_tags[i]));
+    }
+    if (r == gfx_result::success) {
+        r = allocation_dump_histogram(out, "total", allocation_read(allocation_total));
+    }
+    return r;
+}
+}  // namespace gfx
@@ -1,16 +1,154 @@
 #include <gfx_canvas.hpp>
 #include <gfx_math.hpp>
 #include <ml_reader.hpp>
+#include <gfx_trace.hpp>
+#ifdef HTCW_GFX_THREADS
+#include <new>
+#include <thread>
+#endif
 
 #include "plutovg.h"
 #define CHND ((plutovg_canvas_t*)m_info)
 namespace gfx {
+// The scratch arena hands out transient rasterization memory from blocks it
+// keeps between renders. Freeing only reclaims the most recent allocation and
+// everything is released at once when a render finishes. The allocator
+// signatures carry no state, so the active arena is tracked per thread.
+#define CANVAS_SCRATCH_ALIGN(x) (((x)+7)&~((size_t)7))
+#define CANVAS_SCRATCH_HEADER CANVAS_SCRATCH_ALIGN(sizeof(size_t))
+typedef struct canvas_scratch_block {
+    canvas_scratch_block* next;
+    size_t size;
+    size_t used;
+} canvas_scratch_block_t;
+typedef struct {
+    canvas_scratch_block_t* blocks;
+    size_t used;
+    size_t high_water;
+    size_t peak;
+    size_t initial_size;
+    void*(*allocator)(size_t);
+    void(*deallocator)(void*);
+} canvas_scratch_t;
+static thread_local canvas_scratch_t* canvas_scratch_current = nullptr;
+static uint8_t* canvas_scratch_data(canvas_scratch_block_t* block) {
+    return ((uint8_t*)block)+CANVAS_SCRATCH_ALIGN(sizeof(canvas_scratch_block_t));
+}
+static bool canvas_scratch_add_block(canvas_scratch_t* scratch, size_t size) {
+    canvas_scratch_block_t* block = (canvas_scratch_block_t*)scratch->allocator(CANVAS_SCRATCH_ALIGN(sizeof(canvas_scratch_block_t))+size);
+    if(block==nullptr) {
+        return false;
+    }
+    block->next = scratch->blocks;
+    block->size = size;
+    block->used = 0;
+    scratch->blocks = block;
+    return true;
+}
+static void canvas_scratch_free_blocks(canvas_scratch_t* scratch) {
+    canvas_scratch_block_t* block = scratch->blocks;
+    while(block!=nullptr) {
+        canvas_scratch_block_t* next = block->next;
+        scratch->deallocator(block);
+        block = next;
+    }
+    scratch->blocks = nullptr;
+}
+static void canvas_scratch_destroy(canvas_scratch_t* scratch) {
+    canvas_scratch_free_blocks(scratch);
+    scratch->deallocator(scratch);
+}
+// makes the arena empty. If a render needed more than one block they are replaced with a single block large enough for it
+static void canvas_scratch_reset(canvas_scratch_t* scratch) {
+    if(scratch->blocks!=nullptr && scratch->blocks->next!=nullptr) {
+        canvas_scratch_free_blocks(scratch);
+        canvas_scratch_add_block(scratch,math::max_(scratch->initial_size,scratch->peak));
+    } else if(scratch->blocks!=nullptr) {
+        scratch->blocks->used = 0;
+    }
+    scratch->used = 0;
+    scratch->peak = 0;
+}
+static bool canvas_scratch_is_last(canvas_scratch_block_t* block, uint8_t* ptr) {
+    return block!=nullptr && ptr+CANVAS_SCRATCH_ALIGN(*(size_t*)(ptr-CANVAS_SCRATCH_HEADER))==canvas_scratch_data(block)+block->used;
+}
+static void* canvas_scratch_allocate(size_t size) {
+    canvas_scratch_t* scratch = canvas_scratch_current;
+    const size_t need = CANVAS_SCRATCH_HEADER+CANVAS_SCRATCH_ALIGN(size);
+    canvas_scratch_block_t* block = scratch->blocks;
+    if(block==nullptr || block->size-block->used<need) {
+        size_t block_size = block==nullptr?scratch->initial_size:block->size*2;
+        if(block_size<need) {
+            block_size = need;
+        }
+        if(!canvas_scratch_add_block(scratch,block_size)) {
+            return nullptr;
+        }
+        block = scratch->blocks;
+    }
+    uint8_t* result = canvas_scratch_data(block)+block->used+CANVAS_SCRATCH_HEADER;
+    *(size_t*)(result-CANVAS_SCRATCH_HEADER)=size;
+    block->used+=need;
+    scratch->used+=need;
+    if(scratch->used>scratch->peak) {
+        scratch->peak = scratch->used;
+        if(scratch->peak>scratch->high_water) {
+            scratch->high_water = scratch->peak;
+        }
+    }
+    return result;
+}
+static void canvas_scratch_deallocate(void* ptr) {
+    if(ptr==nullptr) {
+        return;
+    }
+    canvas_scratch_t* scratch = canvas_scratch_current;
+    uint8_t* p = (uint8_t*)ptr;
+    if(canvas_scratch_is_last(scratch->blocks,p)) {
+        const size_t need = CANVAS_SCRATCH_HEADER+CANVAS_SCRATCH_ALIGN(*(size_t*)(p-CANVAS_SCRATCH_HEADER));
+        scratch->blocks->used-=need;
+        scratch->used-=need;
+    }
+}
+static void* canvas_scratch_reallocate(void* ptr, size_t size) {
+    if(ptr==nullptr) {
+        return canvas_scratch_allocate(size);
+    }
+    canvas_scratch_t* scratch = canvas_scratch_current;
+    uint8_t* p = (uint8_t*)ptr;
+    size_t* old_size = (size_t*)(p-CANVAS_SCRATCH_HEADER);
+    canvas_scratch_block_t* block = scratch->blocks;
+    if(canvas_scratch_is_last(block,p)) {
+        // grow or shrink in place
+        const size_t start = (size_t)(p-canvas_scratch_data(block));
+        if(block->size-start>=CANVAS_SCRATCH_ALIGN(size)) {
+            const size_t old_need = CANVAS_SCRATCH_ALIGN(*old_size);
+            block->used = start+CANVAS_SCRATCH_ALIGN(size);
+            scratch->used = scratch->used-old_need+CANVAS_SCRATCH_ALIGN(size);
+            if(scratch->used>scratch->peak) {
+                scratch->peak = scratch->used;
+                if(scratch->peak>scratch->high_water) {
+                    scratch->high_water = scratch->peak;
+                }
+            }
+            *old_size = size;
+            return ptr;
+        }
+    }
+    void* result = canvas_scratch_allocate(size);
+    if(result==nullptr) {
+        return nullptr;
+    }
+    memcpy(result,ptr,*old_size<size?*old_size:size);
+    return result;
+}
+
 
 
-canvas::canvas(void*(*allocator)(size_t), void*(*reallocator)(void*,size_t), void(*deallocator)(void*)) : m_info(nullptr), m_style(nullptr), m_dimensions(0,0),m_global_clip(NAN,NAN,NAN,NAN),m_write_callback(nullptr),m_read_callback(nullptr), m_free_callback_state(nullptr),m_allocator(allocator),m_reallocator(reallocator),m_deallocator(deallocator) {
+canvas::canvas(void*(*allocator)(size_t), void*(*reallocator)(void*,size_t), void(*deallocator)(void*)) : m_info(nullptr), m_style(nullptr), m_dimensions(0,0),m_global_clip(NAN,NAN,NAN,NAN),m_write_callback(nullptr),m_read_callback(nullptr), m_free_callback_state(nullptr),m_scratch(nullptr),m_scratch_size(0),m_allocator(allocator),m_reallocator(reallocator),m_deallocator(deallocator) {
 
 }
-canvas::canvas(size16 dimensions,void*(*allocator)(size_t), void*(*reallocator)(void*,size_t), void(*deallocator)(void*)) : m_info(nullptr),m_style(nullptr), m_dimensions(dimensions),m_global_clip(NAN,NAN,NAN,NAN), m_write_callback(nullptr),m_read_callback(nullptr), m_free_callback_state(nullptr),m_allocator(allocator),m_reallocator(reallocator),m_deallocator(deallocator) {
+canvas::canvas(size16 dimensions,void*(*allocator)(size_t), void*(*reallocator)(void*,size_t), void(*deallocator)(void*)) : m_info(nullptr),m_style(nullptr), m_dimensions(dimensions),m_global_clip(NAN,NAN,NAN,NAN), m_write_callback(nullptr),m_read_callback(nullptr), m_free_callback_state(nullptr),m_scratch(nullptr),m_scratch_size(0),m_allocator(allocator),m_reallocator(reallocator),m_deallocator(deallocator) {
 
 }
 canvas::canvas(canvas&& rhs) {
@@ -28,6 +166,9 @@ canvas::canvas(canvas&& rhs) {
     m_free_callback_state = rhs.m_free_callback_state;
     rhs.m_free_callback_state = nullptr;
     m_global_clip = rhs.m_global_clip;
+    m_scratch = rhs.m_scratch;
+    rhs.m_scratch = nullptr;
+    m_scratch_size = rhs.m_scratch_size;
     m_allocator = rhs.m_allocator;
     m_reallocator = rhs.m_reallocator;
     m_deallocator = rhs.m_deallocator;
@@ -52,6 +193,9 @@ canvas& canvas::operator=(canvas&& rhs) {
     m_free_callback_state = rhs.m_free_callback_state;
     rhs.m_free_callback_state = nullptr;
     m_global_clip = rhs.m_global_clip;
+    m_scratch = rhs.m_scratch;
+    rhs.m_scratch = nullptr;
+    m_scratch_size = rhs.m_scratch_size;
     m_allocator = rhs.m_allocator;
     m_reallocator = rhs.m_reallocator;
     m_deallocator = rhs.m_deallocator;
@@ -100,7 +244,7 @@ gfx_result canvas::callbacks(size16 dimensions, spoint16 offset,vector_on_read_c
 
 }
                          
-gfx_result canvas::direct(blt_span* bmp_data, size16 dimensions, spoint16 offset,on_direct_read_callback_type on_read,on_direct_write_callback_type on_write) {
+gfx_result canvas::direct(blt_span* bmp_data, size16 dimensions, spoint16 offset,on_direct_read_callback_type on_read,on_direct_write_callback_type on_write, const srect16* clip) {
     if(bmp_data==nullptr) {
         plutovg_canvas_set_direct(CHND,nullptr,offset.x,offset.y,0,0,on_read,on_write);
         
@@ -122,7 +266,18 @@ gfx_result canvas::direct(blt_span* bmp_data, size16 dimensions, spoint16 offset
                                 (float)m_dimensions.width-1.f);
     clip_rect.y2 = math::min_((float)bmp_loc.y + dimensions.height-1.f,
                                 (float)m_dimensions.height-1.f);
-    plutovg_rect_t r={clip_rect.x1,clip_rect.y1,clip_rect.width(),clip_rect.height()};
+    if(clip!=nullptr) {
+        // the clip is in target coordinates
+        clip_rect.x1 = math::max_(clip_rect.x1,(float)(clip->x1+bmp_loc.x));
+        clip_rect.y1 = math::max_(clip_rect.y1,(float)(clip->y1+bmp_loc.y));
+        clip_rect.x2 = math::min_(clip_rect.x2,(float)(clip->x2+bmp_loc.x));
+        clip_rect.y2 = math::min_(clip_rect.y2,(float)(clip->y2+bmp_loc.y));
+    }
+    plutovg_rect_t r={clip_rect.x1,clip_rect.y1,0.f,0.f};
+    if(clip_rect.x2>=clip_rect.x1 && clip_rect.y2>=clip_rect.y1) {
+        r.w = clip_rect.width();
+        r.h = clip_rect.height();
+    }
     plutovg_canvas_global_clip(CHND,&r);
     plutovg_canvas_set_direct(CHND,bmp_data,-offset.x,-offset.y,dimensions.width,dimensions.height,on_read,on_write);
     return gfx_result::success;
@@ -183,6 +338,10 @@ void canvas::deinitialize() {
         m_deallocator(m_style);
         m_style = nullptr;
     }
+    if(m_scratch!=nullptr) {
+        canvas_scratch_destroy((canvas_scratch_t*)m_scratch);
+        m_scratch = nullptr;
+    }
     if(m_callback_state!=nullptr && m_free_callback_state!=nullptr) {
         m_free_callback_state(m_callback_state);
         m_callback_state = nullptr;
@@ -435,7 +594,7 @@ void canvas::font(stream& ttf_stream, size_t index) {
     if(!initialized()) {
         return;
     }
-    plutovg_font_face_t* ff = plutovg_font_face_load_from_stream(ttf_stream,index,nullptr,nullptr);
+    plutovg_font_face_t* ff = plutovg_font_face_load_from_stream(ttf_stream,index,nullptr,nullptr,m_allocator,m_deallocator);
     plutovg_canvas_set_font_face(CHND,ff);
 }
 float canvas::font_size() const {
@@ -640,7 +799,7 @@ gfx_result canvas::text(pointf location, const canvas_text_info& info) {
     if(info.ttf_font->caps().seek) {
         info.ttf_font->seek(0);
     }
-    plutovg_font_face_t* face = plutovg_font_face_load_from_stream(*info.ttf_font,(int)info.ttf_font_face,nullptr,nullptr);
+    plutovg_font_face_t* face = plutovg_font_face_load_from_stream(*info.ttf_font,(int)info.ttf_font_face,nullptr,nullptr,m_allocator,m_deallocator);
     if(face==nullptr) {
         return gfx_result::invalid_format; // TODO: might be out of memory
     }
@@ -664,76 +823,162 @@ gfx_result canvas::reserve(size_t points) {
     }
     return gfx_result::success;
 }
-gfx_result canvas::render(bool preserve,void*(*allocator)(size_t),void*(*reallocator)(void*,size_t),void(*deallocator)(void*)) {
-    if(!initialized()) return gfx_result::invalid_state;
-    if(allocator==nullptr) allocator = m_allocator;
-    if(reallocator==nullptr) reallocator = m_reallocator;
-    if(deallocator==nullptr) deallocator = m_deallocator;
-    plutovg_canvas_set_fill_rule(CHND,(plutovg_fill_rule_t)(int)m_style->fill_rule);
-    plutovg_canvas_set_font_size(CHND,m_style->font_size);
-    bool paint_fill = m_style->fill_paint_type!=paint_type::none;
-    bool paint_stroke = m_style->stroke_paint_type!=paint_type::none;
-    
-    if(m_style->fill_paint_type==paint_type::solid) {
+void*(*canvas::allocator() const)(size_t) {
+    return m_allocator;
+}
+void*(*canvas::reallocator() const)(void*,size_t) {
+    return m_reallocator;
+}
+void(*canvas::deallocator() const)(void*) {
+    return m_deallocator;
+}
+size_t canvas::scratch_size() const {
+    return m_scratch_size;
+}
+void canvas::scratch_size(size_t value) {
+    if(m_scratch!=nullptr) {
+        canvas_scratch_destroy((canvas_scratch_t*)m_scratch);
+        m_scratch = nullptr;
+    }
+    m_scratch_size = value;
+}
+size_t canvas::scratch_high_water() const {
+    if(m_scratch==nullptr) {
+        return 0;
+    }
+    return ((canvas_scratch_t*)m_scratch)->high_water;
+}
+void* canvas::scratch_begin(void*(*&allocator)(size_t), void*(*&reallocator)(void*,size_t), void(*&deallocator)(void*)) {
+    void* previous = canvas_scratch_current;
+    if(m_scratch==nullptr && m_scratch_size>0) {
+        canvas_scratch_t* scratch = (canvas_scratch_t*)m_allocator(sizeof(canvas_scratch_t));
+        if(scratch!=nullptr) {
+            scratch->blocks = nullptr;
+            scratch->used = 0;
+            scratch->peak = 0;
+            scratch->high_water = 0;
+            scratch->initial_size = m_scratch_size;
+            scratch->allocator = m_allocator;
+            scratch->deallocator = m_deallocator;
+            if(!canvas_scratch_add_block(scratch,m_scratch_size)) {
+                m_deallocator(scratch);
+                scratch = nullptr;
+            }
+        }
+        m_scratch = scratch;
+    }
+    if(m_scratch!=nullptr) {
+        canvas_scratch_current = (canvas_scratch_t*)m_scratch;
+        allocator = canvas_scratch_allocate;
+        reallocator = canvas_scratch_reallocate;
+        deallocator = canvas_scratch_deallocate;
+    } else {
+        if(allocator==nullptr) allocator = m_allocator;
+        if(reallocator==nullptr) reallocator = m_reallocator;
+        if(deallocator==nullptr) deallocator = m_deallocator;
+    }
+    return previous;
+}
+void canvas::scratch_end(void* previous) {
+    if(m_scratch!=nullptr && canvas_scratch_current==(canvas_scratch_t*)m_scratch) {
+        canvas_scratch_reset((canvas_scratch_t*)m_scratch);
+    }
+    canvas_scratch_current = (canvas_scratch_t*)previous;
+}
+static gfx_result canvas_apply_paint(plutovg_canvas_t* cvs, paint_type type, float opacity, const vector_pixel& color, const gradient& grad, const texture& tex) {
+    if(type==paint_type::solid) {
         plutovg_color_t col;
-        plutovg_canvas_set_opacity(CHND,m_style->fill_opacity);
-        col.a = m_style->fill_color.template channelr<channel_name::A>();
-        col.r = m_style->fill_color.template channelr<channel_name::R>();
-        col.g = m_style->fill_color.template channelr<channel_name::G>();
-        col.b = m_style->fill_color.template channelr<channel_name::B>();
-        if(!plutovg_canvas_set_color(CHND,&col)) {
+        plutovg_canvas_set_opacity(cvs,opacity);
+        col.a = color.template channelr<channel_name::A>();
+        col.r = color.template channelr<channel_name::R>();
+        col.g = color.template channelr<channel_name::G>();
+        col.b = color.template channelr<channel_name::B>();
+        if(!plutovg_canvas_set_color(cvs,&col)) {
             return gfx_result::out_of_memory;
         }
-    } else if(m_style->fill_paint_type==paint_type::gradient) {
-        plutovg_canvas_set_opacity(CHND,m_style->fill_opacity);
-        if(m_style->fill_gradient.type==gradient_type::linear) {
-            if(!plutovg_canvas_set_linear_gradient(CHND,
-                                        m_style->fill_gradient.linear.x1,
-                                        m_style->fill_gradient.linear.y1,
-                                        m_style->fill_gradient.linear.x2,
-                                        m_style->fill_gradient.linear.y2,
-                                        (plutovg_spread_method_t)(int)m_style->fill_gradient.spread,
-                                        m_style->fill_gradient.stops,
-                                        (int)m_style->fill_gradient.stops_size,
-                                        &m_style->fill_gradient.transform)) {
+    } else if(type==paint_type::gradient) {
+        plutovg_canvas_set_opacity(cvs,opacity);
+        if(grad.type==gradient_type::linear) {
+            if(!plutovg_canvas_set_linear_gradient(cvs,
+                                        grad.linear.x1,
+                                        grad.linear.y1,
+                                        grad.linear.x2,
+                                        grad.linear.y2,
+                                        (plutovg_spread_method_t)(int)grad.spread,
+                                        grad.stops,
+                                        (int)grad.stops_size,
+                                        &grad.transform)) {
                 return gfx_result::out_of_memory;
             }
         } else {
-            if(!plutovg_canvas_set_radial_gradient(CHND,m_style->fill_gradient.radial.cx,m_style->fill_gradient.radial.cy,m_style->fill_gradient.radial.cr,m_style->fill_gradient.radial.fx,
-                                        m_style->fill_gradient.radial.fy,m_style->fill_gradient.radial.fr,(plutovg_spread_method_t)(int)m_style->fill_gradient.spread,
-                                        m_style->fill_gradient.stops,
-                                        (int)m_style->fill_gradient.stops_size,
-                                        &m_style->fill_gradient.transform)) {
+            if(!plutovg_canvas_set_radial_gradient(cvs,grad.radial.cx,grad.radial.cy,grad.radial.cr,grad.radial.fx,
+                                        grad.radial.fy,grad.radial.fr,(plutovg_spread_method_t)(int)grad.spread,
+                                        grad.stops,
+                                        (int)grad.stops_size,
+                                        &grad.transform)) {
                 return gfx_result::out_of_memory;
             }
         }
-    } else if(m_style->fill_paint_type==paint_type::texture) {
-        plutovg_canvas_set_opacity(CHND,m_style->fill_opacity);
-        if(m_style->fill_texture.direct!=nullptr) {
-            if(!plutovg_canvas_set_texture_direct(CHND,m_style->fill_texture.dimensions.width,
-                                m_style->fill_texture.dimensions.height,
-                                m_style->fill_texture.direct,
-                                m_style->fill_texture.on_direct_read_callback,
-                                (plutovg_texture_type_t)(int)m_style->fill_texture.type,
-                                m_style->fill_texture.opacity,
-                                &m_style->fill_texture.transform)) {
+    } else if(type==paint_type::texture) {
+        plutovg_canvas_set_opacity(cvs,opacity);
+        if(tex.direct!=nullptr) {
+            if(!plutovg_canvas_set_texture_direct(cvs,tex.dimensions.width,
+                                tex.dimensions.height,
+                                tex.direct,
+                                tex.on_direct_read_callback,
+                                (plutovg_texture_type_t)(int)tex.type,
+                                tex.opacity,
+                                &tex.transform)) {
                 return gfx_result::out_of_memory;
             }
         } else {
-            if(!plutovg_canvas_set_texture(CHND,
-                            m_style->fill_texture.dimensions.width,
-                            m_style->fill_texture.dimensions.height,
-                            m_style->fill_texture.on_read_callback,
-                            m_style->fill_texture.on_read_callback_state,
-                            (plutovg_texture_type_t)(int)m_style->fill_texture.type,
-                            m_style->fill_texture.opacity,
-                            &m_style->fill_texture.transform)){
+            if(!plutovg_canvas_set_texture(cvs,
+                            tex.dimensions.width,
+                            tex.dimensions.height,
+                            tex.on_read_callback,
+                            tex.on_read_callback_state,
+                            (plutovg_texture_type_t)(int)tex.type,
+                            tex.opacity,
+                            &tex.transform)){
                 return gfx_result::out_of_memory;
             }
         }
     }
-    
+    return gfx_result::success;
+}
+gfx_result canvas::apply_fill_paint() {
+    return canvas_apply_paint(CHND,m_style->fill_paint_type,m_style->fill_opacity,m_style->fill_color,m_style->fill_gradient,m_style->fill_texture);
+}
+gfx_result canvas::apply_stroke_paint() {
+    return canvas_apply_paint(CHND,m_style->stroke_paint_type,m_style->stroke_opacity,m_style->stroke_color,m_style->stroke_gradient,m_style->stroke_texture);
+}
+void canvas::apply_stroke_style() {
+    plutovg_canvas_set_line_width(CHND,m_style->stroke_width);
+    if(m_style->stroke_dash.values_size>0) {
+        plutovg_canvas_set_dash(CHND,m_style->stroke_dash.offset,m_style->stroke_dash.values,m_style->stroke_dash.values_size);
+    }
+    plutovg_canvas_set_line_cap(CHND,(plutovg_line_cap_t)(int)m_style->stroke_line_cap);
+    plutovg_canvas_set_line_join(CHND,(plutovg_line_join_t)(int)m_style->stroke_line_join);
+    plutovg_canvas_set_miter_limit(CHND,m_style->stroke_miter_limit);
+}
+gfx_result canvas::render(bool preserve,void*(*allocator)(size_t),void*(*reallocator)(void*,size_t),void(*deallocator)(void*)) {
+    if(!initialized()) return gfx_result::invalid_state;
+    void* previous = scratch_begin(allocator,reallocator,deallocator);
+    gfx_result res = render_impl(preserve,allocator,reallocator,deallocator);
+    scratch_end(previous);
+    return res;
+}
+gfx_result canvas::render_impl(bool preserve,void*(*allocator)(size_t),void*(*reallocator)(void*,size_t),void(*deallocator)(void*)) {
+    plutovg_canvas_set_fill_rule(CHND,(plutovg_fill_rule_t)(int)m_style->fill_rule);
+    plutovg_canvas_set_font_size(CHND,m_style->font_size);
+    bool paint_fill = m_style->fill_paint_type!=paint_type::none;
+    bool paint_stroke = m_style->stroke_paint_type!=paint_type::none;
     if(paint_fill) {
+        HTCW_GFX_TRACE_SCOPE("canvas", "fill");
+        gfx_result res = apply_fill_paint();
+        if(res!=gfx_result::success) {
+            return res;
+        }
         if(paint_stroke || preserve) {
             if(!plutovg_canvas_fill_preserve(CHND,allocator,reallocator,deallocator)) {
                 return gfx_result::out_of_memory;
@@ -745,79 +990,12 @@ gfx_result canvas::render(bool preserve,void*(*allocator)(size_t),void*(*realloc
         }
     }
     if(paint_stroke) {
-        plutovg_canvas_set_line_width(CHND,m_style->stroke_width);
-        if(m_style->stroke_dash.values_size>0) {
-            plutovg_canvas_set_dash(CHND,m_style->stroke_dash.offset,m_style->stroke_dash.values,m_style->stroke_dash.values_size);
-        }
-        plutovg_canvas_set_line_cap(CHND,(plutovg_line_cap_t)(int)m_style->stroke_line_cap);
-        plutovg_canvas_set_line_join(CHND,(plutovg_line_join_t)(int)m_style->stroke_line_join);
-        plutovg_canvas_set_miter_limit(CHND,m_style->stroke_miter_limit);
-    }
-    if(m_style->stroke_paint_type==paint_type::solid) {
-        plutovg_color_t col;
-        plutovg_canvas_set_opacity(CHND,m_style->stroke_opacity);
-        col.a = m_style->stroke_color.template channelr<channel_name::A>();
-        col.r = m_style->stroke_color.template channelr<channel_name::R>();
-        col.g = m_style->stroke_color.template channelr<channel_name::G>();
-        col.b = m_style->stroke_color.template channelr<channel_name::B>();
-        if(!plutovg_canvas_set_color(CHND,&col)) {
-            return gfx_result::out_of_memory;
+        HTCW_GFX_TRACE_SCOPE("canvas", "stroke");
+        apply_stroke_style();
+        gfx_result res = apply_stroke_paint();
+        if(res!=gfx_result::success) {
+            return res;
         }
-    } else if(m_style->stroke_paint_type==paint_type::gradient) {
-        plutovg_canvas_set_opacity(CHND,m_style->stroke_opacity);
-        if(m_style->stroke_gradient.type==gradient_type::linear) {
-            if(!plutovg_canvas_set_linear_gradient(CHND,
-                                        m_style->stroke_gradient.linear.x1,
-                                        m_style->stroke_gradient.linear.y1,
-                                        m_style->stroke_gradient.linear.x2,
-                                        m_style->stroke_gradient.linear.y2,
-                                        (plutovg_spread_method_t)(int)m_style->stroke_gradient.spread,
-                                        m_style->stroke_gradient.stops,
-                                        (int)m_style->stroke_gradient.stops_size,
-                                        &m_style->stroke_gradient.transform)) {
-                return gfx_result::out_of_memory;
-            }
-        } else {
-            if(!plutovg_canvas_set_radial_gradient(CHND,
-                                        m_style->stroke_gradient.radial.cx,
-                                        m_style->stroke_gradient.radial.cy,
-                                        m_style->stroke_gradient.radial.cr,
-                                        m_style->stroke_gradient.radial.fx,
-                                        m_style->stroke_gradient.radial.fy,
-                                        m_style->stroke_gradient.radial.fr,
-                                        (plutovg_spread_method_t)(int)m_style->stroke_gradient.spread,
-                                        m_style->stroke_gradient.stops,
-                                        (int)m_style->stroke_gradient.stops_size,
-                                        &m_style->stroke_gradient.transform)) {
-                return gfx_result::out_of_memory;
-            }
-        }
-    } else if(m_style->stroke_paint_type==paint_type::texture) {
-        plutovg_canvas_set_opacity(CHND,m_style->stroke_opacity);
-        if(m_style->stroke_texture.direct!=nullptr) {
-            if(!plutovg_canvas_set_texture_direct(CHND,m_style->stroke_texture.dimensions.width,
-                                m_style->stroke_texture.dimensions.height,
-                                m_style->stroke_texture.direct,
-                                m_style->stroke_texture.on_direct_read_callback,
-                                (plutovg_texture_type_t)(int)m_style->stroke_texture.type,
-                                m_style->stroke_texture.opacity,
-                                &m_style->stroke_texture.transform)) {
-                return gfx_result::out_of_memory;
-            }
-        } else {
-            if(!plutovg_canvas_set_texture(CHND,
-                            m_style->stroke_texture.dimensions.width,
-                            m_style->stroke_texture.dimensions.height,
-                            m_style->stroke_texture.on_read_callback,
-                            m_style->stroke_texture.on_read_callback_state,
-                            (plutovg_texture_type_t)(int)m_style->stroke_texture.type,
-                            m_style->stroke_texture.opacity,
-                            &m_style->stroke_texture.transform)) {
-                return gfx_result::out_of_memory;
-            }
-        }
-    }
-    if(paint_stroke) {
         if(preserve) {
             if(!plutovg_canvas_stroke_preserve(CHND,allocator,reallocator,deallocator)) {
                 return gfx_result::out_of_memory;
@@ -833,4 +1011,48 @@ gfx_result canvas::render(bool preserve,void*(*allocator)(size_t),void*(*realloc
 
     return gfx_result::success;
 }
-}
\ No newline at end of file
+size_t canvas_thread_count() {
+#ifdef HTCW_GFX_THREADS
+    const unsigned int result = std::thread::hardware_concurrency();
+    return result==0?1:(size_t)result;
+#else
+    return 1;
+#endif
+}
+#ifdef HTCW_GFX_THREADS
+// runs first to last-1, handing the upper half of the range to a new thread until each thread has one index
+static void canvas_thread_run(size_t first, size_t last, void(*work)(size_t index, void* state), void* state) {
+    if(last-first==1) {
+        work(first,state);
+        return;
+    }
+    const size_t mid = first+(last-first)/2;
+    std::thread upper;
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS)
+    try {
+        upper = std::thread(canvas_thread_run,mid,last,work,state);
+    } catch(...) {
+        // out of threads, so this one runs the upper half too
+    }
+#else
+    upper = std::thread(canvas_thread_run,mid,last,work,state);
+#endif
+    canvas_thread_run(first,mid,work,state);
+    if(upper.joinable()) {
+        upper.join();
+    } else {
+        canvas_thread_run(mid,last,work,state);
+    }
+}
+gfx_result canvas_thread_dispatch(size_t count, void(*work)(size_t index, void* state), void* state, void* dispatch_state) {
+    (void)dispatch_state;
+    if(work==nullptr) {
+        return gfx_result::invalid_argument;
+    }
+    if(count!=0) {
+        canvas_thread_run(0,count,work,state);
+    }
+    return gfx_result::success;
+}
+#endif
+}
@@ -0,0 +1,92 @@
+#include "gfx_canvas.hpp"
+#include "plutovg.h"
+#include "plutovg-private.h"
+#include "plutovg-utils.h"
+#include <string.h>
+#define CHND ((plutovg_canvas_t*)m_info)
+
+namespace gfx {
+// writes the coverage of spans into mask, whose top left is at location. when combine is set, the coverage is
+// laid over what is already there the way an opaque paint would be
+static void canvas_mask_write(bitmap<alpha_pixel<8>>& mask, spoint16 location, const plutovg_span_buffer_t* spans, bool combine) {
+    const int w = mask.dimensions().width;
+    const int h = mask.dimensions().height;
+    uint8_t* data = (uint8_t*)mask.begin();
+    const plutovg_span_t* span = spans->spans.data;
+    const plutovg_span_t* end = span + spans->spans.size;
+    for(;span<end;++span) {
+        const int y = span->y - location.y;
+        if(y<0) continue;
+        if(y>=h) break;
+        int x1 = span->x - location.x;
+        int x2 = x1 + span->len;
+        if(x1<0) x1 = 0;
+        if(x2>w) x2 = w;
+        if(x2<=x1) continue;
+        uint8_t* p = data + (size_t)y*w + x1;
+        const unsigned int c = span->coverage;
+        if(!combine) {
+            memset(p,(int)c,(size_t)(x2-x1));
+            continue;
+        }
+        for(int i = x1;i<x2;++i,++p) {
+            const unsigned int v = *p;
+            *p = (uint8_t)(v + c - (v*c + 127) / 255);
+        }
+    }
+}
+// returns the rasterized spans, cut to the clip path if one is set
+static const plutovg_span_buffer_t* canvas_mask_spans(plutovg_canvas_t* cvs) {
+    if(cvs->state->clipping) {
+        if(!plutovg_span_buffer_intersect(&cvs->clip_spans, &cvs->fill_spans, &cvs->state->clip_spans)) {
+            return nullptr;
+        }
+        return &cvs->clip_spans;
+    }
+    return &cvs->fill_spans;
+}
+gfx_result canvas::render_mask(bitmap<alpha_pixel<8>>& destination, spoint16 location, bool preserve,void*(*allocator)(size_t),void*(*reallocator)(void*,size_t),void(*deallocator)(void*)) {
+    if(!initialized()) {
+        return gfx_result::invalid_state;
+    }
+    if(destination.begin()==nullptr) {
+        return gfx_result::invalid_argument;
+    }
+    void* previous = scratch_begin(allocator,reallocator,deallocator);
+    gfx_result res = render_mask_impl(destination,location,preserve,allocator,reallocator,deallocator);
+    scratch_end(previous);
+    return res;
+}
+gfx_result canvas::render_mask_impl(bitmap<alpha_pixel<8>>& destination, spoint16 location, bool preserve,void*(*allocator)(size_t),void*(*reallocator)(void*,size_t),void(*deallocator)(void*)) {
+    plutovg_canvas_t* cvs = CHND;
+    const size16 dim = destination.dimensions();
+    memset(destination.begin(),0,destination.size_bytes());
+    const plutovg_rect_t clip = {(float)location.x,(float)location.y,(float)dim.width,(float)dim.height};
+    const bool fill = m_style->fill_paint_type!=paint_type::none;
+    if(fill) {
+        if(!plutovg_rasterize(&cvs->fill_spans,cvs->path,&cvs->state->matrix,&clip,NULL,(plutovg_fill_rule_t)(int)m_style->fill_rule,allocator,reallocator,deallocator)) {
+            return gfx_result::out_of_memory;
+        }
+        const plutovg_span_buffer_t* spans = canvas_mask_spans(cvs);
+        if(spans==nullptr) {
+            return gfx_result::out_of_memory;
+        }
+        canvas_mask_write(destination,location,spans,false);
+    }
+    if(m_style->stroke_paint_type!=paint_type::none) {
+        apply_stroke_style();
+        if(!plutovg_rasterize(&cvs->fill_spans,cvs->path,&cvs->state->matrix,&clip,&cvs->state->stroke,PLUTOVG_FILL_RULE_NON_ZERO,allocator,reallocator,deallocator)) {
+            return gfx_result::out_of_memory;
+        }
+        const plutovg_span_buffer_t* spans = canvas_mask_spans(cvs);
+        if(spans==nullptr) {
+            return gfx_result::out_of_memory;
+        }
+        canvas_mask_write(destination,location,spans,fill);
+    }
+    if(!preserve) {
+        plutovg_canvas_new_path(cvs);
+    }
+    return gfx_result::success;
+}
+}
@@ -143,23 +143,28 @@ gfx_result canvas_path::text(pointf location, const canvas_text_info& info) {
     if(res!=gfx_result::success) {
         return res;
     }
-    plutovg_font_face_t* face = plutovg_font_face_load_from_stream(*info.ttf_font,(int)info.ttf_font_face,nullptr,nullptr);
+    plutovg_font_face_t* face = plutovg_font_face_load_from_stream(*info.ttf_font,(int)info.ttf_font_face,nullptr,nullptr,m_allocator,m_deallocator);
     if(face==nullptr) {
         return gfx_result::out_of_memory;
     }
     float advance_width = 0.f;
-    int32_t cp;
+    int32_t cp[32];
     size_t length = info.text_byte_count;
     text_handle text = info.text;
     const uint8_t* data = (const uint8_t*)text;
     while(length) {
         size_t l = length;
-        if(::gfx::gfx_result::success!=info.encoding->to_utf32((::gfx::text_handle)data,&cp,&l)) {
-            return gfx_result::io_error;
-        }
+        size_t count = sizeof(cp)/sizeof(*cp);
+        gfx_result r = info.encoding->to_utf32_array((::gfx::text_handle)data,&l,cp,&count);
         data+=l;
         length-=l;
-        advance_width += plutovg_font_face_get_glyph_path(face, info.font_size, location.x + advance_width, location.y,(plutovg_codepoint_t)cp, PHND);
+        for(size_t i = 0;i<count;++i) {
+            advance_width += plutovg_font_face_get_glyph_path(face, info.font_size, location.x + advance_width, location.y,(plutovg_codepoint_t)cp[i], PHND);
+        }
+        if(r!=gfx_result::success || count==0) {
+            plutovg_font_face_destroy(face);
+            return gfx_result::io_error;
+        }
     }
     
     plutovg_font_face_destroy(face);
@@ -0,0 +1,244 @@
+#include "gfx_canvas.hpp"
+#include "plutovg.h"
+#include "plutovg-private.h"
+#include "plutovg-utils.h"
+#include <math.h>
+#include <string.h>
+#define SHND ((plutovg_span_buffer_t*)m_spans)
+
+namespace gfx {
+// copies the spans offset by dx,dy and cut to the canvas clip into the canvas fill spans, then blends them with the current paint
+static bool canvas_shape_blend(plutovg_canvas_t* cvs, const plutovg_span_buffer_t* spans, int dx, int dy) {
+    plutovg_span_buffer_t* out = &cvs->fill_spans;
+    plutovg_span_buffer_reset(out);
+    if(!plutovg_array_ensure<decltype(out->spans),plutovg_span_t>(out->spans,spans->spans.size)) {
+        return false;
+    }
+    const int cx1 = (int)cvs->clip_rect.x;
+    const int cy1 = (int)cvs->clip_rect.y;
+    const int cx2 = cx1 + (int)cvs->clip_rect.w;
+    const int cy2 = cy1 + (int)cvs->clip_rect.h;
+    const plutovg_span_t* src = spans->spans.data;
+    const plutovg_span_t* src_end = src + spans->spans.size;
+    plutovg_span_t* dst = out->spans.data;
+    for(;src<src_end;++src) {
+        const int y = src->y + dy;
+        if(y<cy1) continue;
+        if(y>=cy2) break;
+        int x1 = src->x + dx;
+        int x2 = x1 + src->len;
+        if(x1<cx1) x1 = cx1;
+        if(x2>cx2) x2 = cx2;
+        if(x2<=x1) continue;
+        dst->x = x1;
+        dst->len = x2-x1;
+        dst->y = y;
+        dst->coverage = src->coverage;
+        ++dst;
+    }
+    out->spans.size = (size_t)(dst-out->spans.data);
+    if(cvs->state->clipping) {
+        if(!plutovg_span_buffer_intersect(&cvs->clip_spans, out, &cvs->state->clip_spans)) {
+            return false;
+        }
+        return plutovg_blend(cvs, &cvs->clip_spans);
+    }
+    return plutovg_blend(cvs, out);
+}
+canvas_shape::canvas_shape(void*(*allocator)(size_t),void*(*reallocator)(void*,size_t),void(*deallocator)(void*)) : m_path(nullptr),m_spans(nullptr),m_dash(nullptr),m_dash_size(0),m_fill_valid(false),m_stroke_valid(false),m_allocator(allocator),m_reallocator(reallocator),m_deallocator(deallocator) {
+
+}
+canvas_shape::canvas_shape(canvas_shape&& rhs) : m_path(nullptr),m_spans(nullptr),m_dash(nullptr),m_dash_size(0),m_fill_valid(false),m_stroke_valid(false) {
+    *this = (canvas_shape&&)rhs;
+}
+canvas_shape::~canvas_shape() {
+    deinitialize();
+}
+canvas_shape& canvas_shape::operator=(canvas_shape&& rhs) {
+    deinitialize();
+    m_path = rhs.m_path;
+    rhs.m_path = nullptr;
+    m_spans = rhs.m_spans;
+    rhs.m_spans = nullptr;
+    m_dash = rhs.m_dash;
+    rhs.m_dash = nullptr;
+    m_dash_size = rhs.m_dash_size;
+    rhs.m_dash_size = 0;
+    m_dash_offset = rhs.m_dash_offset;
+    m_fill_rule = rhs.m_fill_rule;
+    m_stroke_width = rhs.m_stroke_width;
+    m_stroke_line_cap = rhs.m_stroke_line_cap;
+    m_stroke_line_join = rhs.m_stroke_line_join;
+    m_stroke_miter_limit = rhs.m_stroke_miter_limit;
+    m_transform = rhs.m_transform;
+    m_fill_valid = rhs.m_fill_valid;
+    rhs.m_fill_valid = false;
+    m_stroke_valid = rhs.m_stroke_valid;
+    rhs.m_stroke_valid = false;
+    m_allocator = rhs.m_allocator;
+    m_reallocator = rhs.m_reallocator;
+    m_deallocator = rhs.m_deallocator;
+    return *this;
+}
+gfx_result canvas_shape::initialize(const canvas_path& path, const canvas& source) {
+    if(!source.initialized()) {
+        return gfx_result::invalid_state;
+    }
+    if(path.m_info==nullptr) {
+        return gfx_result::invalid_argument;
+    }
+    deinitialize();
+    const canvas_style& style = *source.m_style;
+    if(style.stroke_dash.values_size>0) {
+        m_dash = (float*)m_allocator(style.stroke_dash.values_size*sizeof(float));
+        if(m_dash==nullptr) {
+            return gfx_result::out_of_memory;
+        }
+        memcpy(m_dash,style.stroke_dash.values,style.stroke_dash.values_size*sizeof(float));
+        m_dash_size = style.stroke_dash.values_size;
+    }
+    m_dash_offset = style.stroke_dash.offset;
+    m_spans = m_allocator(sizeof(plutovg_span_buffer_t)*2);
+    if(m_spans==nullptr) {
+        deinitialize();
+        return gfx_result::out_of_memory;
+    }
+    plutovg_span_buffer_init(SHND,m_allocator,m_reallocator,m_deallocator);
+    plutovg_span_buffer_init(SHND+1,m_allocator,m_reallocator,m_deallocator);
+    m_path = plutovg_path_clone((const plutovg_path_t*)path.m_info,m_allocator,m_reallocator,m_deallocator);
+    if(m_path==nullptr) {
+        deinitialize();
+        return gfx_result::out_of_memory;
+    }
+    m_fill_rule = style.fill_rule;
+    m_stroke_width = style.stroke_width;
+    m_stroke_line_cap = style.stroke_line_cap;
+    m_stroke_line_join = style.stroke_line_join;
+    m_stroke_miter_limit = style.stroke_miter_limit;
+    m_transform = source.transform();
+    return gfx_result::success;
+}
+bool canvas_shape::initialized() const {
+    return m_path!=nullptr;
+}
+void canvas_shape::deinitialize() {
+    if(m_path!=nullptr) {
+        plutovg_path_destroy((plutovg_path_t*)m_path,m_deallocator);
+        m_path = nullptr;
+    }
+    if(m_spans!=nullptr) {
+        plutovg_span_buffer_destroy(SHND);
+        plutovg_span_buffer_destroy(SHND+1);
+        m_deallocator(m_spans);
+        m_spans = nullptr;
+    }
+    if(m_dash!=nullptr) {
+        m_deallocator(m_dash);
+        m_dash = nullptr;
+    }
+    m_dash_size = 0;
+    m_fill_valid = false;
+    m_stroke_valid = false;
+}
+void canvas_shape::invalidate() {
+    m_fill_valid = false;
+    m_stroke_valid = false;
+}
+bool canvas_shape::fill_valid() const {
+    return m_fill_valid;
+}
+bool canvas_shape::stroke_valid() const {
+    return m_stroke_valid;
+}
+gfx_result canvas_shape::rasterize(bool stroke, const matrix& transform, void*(*allocator)(size_t), void*(*reallocator)(void*,size_t), void(*deallocator)(void*)) {
+    // no clip rectangle, so the coverage stays whole when the shape is moved
+    if(stroke) {
+        plutovg_stroke_data_t data;
+        data.style.width = m_stroke_width;
+        data.style.cap = (plutovg_line_cap_t)(int)m_stroke_line_cap;
+        data.style.join = (plutovg_line_join_t)(int)m_stroke_line_join;
+        data.style.miter_limit = m_stroke_miter_limit;
+        data.dash.offset = m_dash_offset;
+        data.dash.array.data = m_dash;
+        data.dash.array.size = m_dash_size;
+        data.dash.array.capacity = m_dash_size;
+        data.dash.array.allocator = m_allocator;
+        data.dash.array.reallocator = m_reallocator;
+        data.dash.array.deallocator = m_deallocator;
+        if(!plutovg_rasterize(SHND+1,(const plutovg_path_t*)m_path,&transform,nullptr,&data,PLUTOVG_FILL_RULE_NON_ZERO,allocator,reallocator,deallocator)) {
+            plutovg_span_buffer_reset(SHND+1);
+            return gfx_result::out_of_memory;
+        }
+        m_stroke_valid = true;
+    } else {
+        if(!plutovg_rasterize(SHND,(const plutovg_path_t*)m_path,&transform,nullptr,nullptr,(plutovg_fill_rule_t)(int)m_fill_rule,allocator,reallocator,deallocator)) {
+            plutovg_span_buffer_reset(SHND);
+            return gfx_result::out_of_memory;
+        }
+        m_fill_valid = true;
+    }
+    return gfx_result::success;
+}
+gfx_result canvas_shape::render(canvas& destination, spoint16 offset, void*(*allocator)(size_t), void*(*reallocator)(void*,size_t), void(*deallocator)(void*)) {
+    if(!initialized() || !destination.initialized()) {
+        return gfx_result::invalid_state;
+    }
+    void* previous = destination.scratch_begin(allocator,reallocator,deallocator);
+    gfx_result res = render_impl(destination,offset,allocator,reallocator,deallocator);
+    destination.scratch_end(previous);
+    return res;
+}
+gfx_result canvas_shape::render_impl(canvas& destination, spoint16 offset, void*(*allocator)(size_t), void*(*reallocator)(void*,size_t), void(*deallocator)(void*)) {
+    plutovg_canvas_t* cvs = (plutovg_canvas_t*)destination.m_info;
+    const canvas_style& style = *destination.m_style;
+    const bool paint_fill = style.fill_paint_type!=paint_type::none;
+    const bool paint_stroke = style.stroke_paint_type!=paint_type::none;
+    const matrix& transform = cvs->state->matrix;
+    // the coverage can be reused under any whole pixel translation of the transform it was made with
+    const float tx = transform.e - m_transform.e;
+    const float ty = transform.f - m_transform.f;
+    const float rx = floorf(tx+.5f);
+    const float ry = floorf(ty+.5f);
+    int dx = offset.x, dy = offset.y;
+    if(transform.a==m_transform.a && transform.b==m_transform.b &&
+            transform.c==m_transform.c && transform.d==m_transform.d &&
+            fabsf(tx-rx)<=(1.f/256.f) && fabsf(ty-ry)<=(1.f/256.f)) {
+        dx += (int)rx;
+        dy += (int)ry;
+    } else {
+        invalidate();
+        m_transform = transform;
+    }
+    if(paint_fill) {
+        if(!m_fill_valid) {
+            gfx_result res = rasterize(false,m_transform,allocator,reallocator,deallocator);
+            if(res!=gfx_result::success) {
+                return res;
+            }
+        }
+        gfx_result res = destination.apply_fill_paint();
+        if(res!=gfx_result::success) {
+            return res;
+        }
+        if(!canvas_shape_blend(cvs,SHND,dx,dy)) {
+            return gfx_result::out_of_memory;
+        }
+    }
+    if(paint_stroke) {
+        if(!m_stroke_valid) {
+            gfx_result res = rasterize(true,m_transform,allocator,reallocator,deallocator);
+            if(res!=gfx_result::success) {
+                return res;
+            }
+        }
+        gfx_result res = destination.apply_stroke_paint();
+        if(res!=gfx_result::success) {
+            return res;
+        }
+        if(!canvas_shape_blend(cvs,SHND+1,dx,dy)) {
+            return gfx_result::out_of_memory;
+        }
+    }
+    return gfx_result::success;
+}
+}
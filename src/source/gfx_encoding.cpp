@@ -1,4 +1,5 @@
 #include <stdint.h>
+#include <string.h>
 #include <gfx_encoding.hpp>
 namespace gfx {
 typedef uint32_t UTF32; /* at least 32 bits */
@@ -151,34 +152,6 @@ static gfx_result utf8_to_utf32(const char* utf8, int32_t* out_codepoint, size_t
     return result;
 }
 
-gfx_result static latin1_to_utf8(const char* in,  size_t* in_out_in_length, char* utf8_out, size_t* in_out_utf8_out_length) {
-    char* outstart = utf8_out;
-    char* outend = utf8_out + (*in_out_utf8_out_length);
-    const char* inend = in + *in_out_in_length;
-    *in_out_in_length = 0;
-    *in_out_utf8_out_length = 0;
-    char c;
-    while (in < inend) {
-        c = *in++;
-        ++*in_out_in_length;
-        if (c < 0x80) {
-            if (utf8_out >= outend) return gfx_result::out_of_memory;
-            *utf8_out++ = c;
-            *in_out_utf8_out_length=1;
-            return gfx_result::success;
-        } else {
-            if (utf8_out >= outend) return gfx_result::out_of_memory;
-            *utf8_out++ = 0xC0 | (c >> 6);
-            if (utf8_out >= outend) return gfx_result::out_of_memory;
-            *utf8_out++ = 0x80 | (0x3F & c);
-            *in_out_utf8_out_length=2;
-            return gfx_result::success;
-        }
-    }
-    *in_out_utf8_out_length = utf8_out - outstart;
-    return gfx_result::success;
-}
-
 gfx_result text_encoding::utf8_encoder::to_utf32(const text_handle in, int32_t* out_codepoint, size_t* in_out_length) const {
     const char* pin = (const char *)in;
     if(*in_out_length==0) {
@@ -187,22 +160,110 @@ gfx_result text_encoding::utf8_encoder::to_utf32(const text_handle in, int32_t*
     return utf8_to_utf32(pin, out_codepoint, in_out_length);
 }
 
+gfx_result text_encoding::utf8_encoder::to_utf32_array(const text_handle in, size_t* in_out_length, int32_t* out_codepoints, size_t* in_out_count) const {
+    const uint8_t* src = (const uint8_t*)in;
+    const size_t len = *in_out_length;
+    const size_t cap = *in_out_count;
+    size_t i = 0, n = 0;
+    gfx_result result = gfx_result::success;
+    while(i<len && n<cap) {
+        // ASCII runs are copied 8 bytes at a time
+        while(len-i>=8 && cap-n>=8) {
+            uint64_t w;
+            memcpy(&w,src+i,sizeof(w));
+            if(w&0x8080808080808080ULL) {
+                break;
+            }
+            const uint8_t* p = src+i;
+            int32_t* o = out_codepoints+n;
+            o[0]=p[0];o[1]=p[1];o[2]=p[2];o[3]=p[3];
+            o[4]=p[4];o[5]=p[5];o[6]=p[6];o[7]=p[7];
+            i+=8;
+            n+=8;
+        }
+        if(i==len || n==cap) {
+            break;
+        }
+        if(src[i]<0x80) {
+            out_codepoints[n++]=src[i++];
+            continue;
+        }
+        size_t l = len-i;
+        result = utf8_to_utf32((const char*)src+i,out_codepoints+n,&l);
+        if(result!=gfx_result::success) {
+            break;
+        }
+        i+=l;
+        ++n;
+    }
+    *in_out_length = i;
+    *in_out_count = n;
+    return result;
+}
 gfx_result text_encoding::latin1_encoder::to_utf32(const text_handle in, int32_t* out_codepoint, size_t* in_out_length) const {
-    const char* pin = (const char *)in;
-    if(*in_out_length==0) {
-        *in_out_length = trailingBytesForUTF8[(size_t)*pin]+1;
+    *out_codepoint = *(const uint8_t*)in;
+    *in_out_length = 1;
+    return gfx_result::success;
+}
+gfx_result text_encoding::latin1_encoder::to_utf32_array(const text_handle in, size_t* in_out_length, int32_t* out_codepoints, size_t* in_out_count) const {
+    const uint8_t* src = (const uint8_t*)in;
+    const size_t n = *in_out_length<*in_out_count?*in_out_length:*in_out_count;
+    for(size_t i = 0;i<n;++i) {
+        out_codepoints[i]=src[i];
+    }
+    *in_out_length = n;
+    *in_out_count = n;
+    return gfx_result::success;
+}
+gfx_result text_encoder::to_utf32_array(const text_handle in, size_t* in_out_length, int32_t* out_codepoints, size_t* in_out_count) const {
+    const uint8_t* src = (const uint8_t*)in;
+    const size_t len = *in_out_length;
+    const size_t cap = *in_out_count;
+    size_t i = 0, n = 0;
+    gfx_result result = gfx_result::success;
+    while(i<len && n<cap) {
+        size_t l = len-i;
+        result = to_utf32((text_handle)(src+i),out_codepoints+n,&l);
+        if(result!=gfx_result::success) {
+            break;
+        }
+        i+=l;
+        ++n;
+    }
+    *in_out_length = i;
+    *in_out_count = n;
+    return result;
+}
+text_decoder::text_decoder(const text_encoder& encoding, const text_handle text, size_t length) : 
+            m_encoding(&encoding),
+            m_text((const uint8_t*)text),
+            m_length(text==nullptr?0:length),
+            m_result(gfx_result::success),
+            m_index(0),
+            m_count(0) {
+}
+gfx_result text_decoder::fill() {
+    // report a failure only once the codepoints before it have been read
+    if(m_result!=gfx_result::success) {
+        return m_result;
     }
-    char out_tmp1[4];
-    size_t outlen = sizeof(out_tmp1);
-    gfx_result r= latin1_to_utf8(pin, in_out_length,out_tmp1, &outlen);
-    if (r!=gfx_result::success) {
-        *out_codepoint = 0;
-        return r;
+    m_index = 0;
+    m_count = 0;
+    if(m_length==0) {
+        return gfx_result::success;
     }
-    r=utf8_to_utf32(out_tmp1, out_codepoint, &outlen);
-    if (r!=gfx_result::success) {
-        *out_codepoint = 0;
-        return r;
+    size_t len = m_length;
+    size_t count = sizeof(m_buffer)/sizeof(*m_buffer);
+    m_result = m_encoding->to_utf32_array((text_handle)m_text,&len,m_buffer,&count);
+    m_text+=len;
+    m_length-=len;
+    m_count = count;
+    if(m_count==0) {
+        if(m_result==gfx_result::success) {
+            // nothing could be decoded, so stop rather than spin
+            m_length = 0;
+        }
+        return m_result;
     }
     return gfx_result::success;
 }
@@ -0,0 +1,336 @@
+#include "gfx_flush_pipeline.hpp"
+#include "gfx_trace.hpp"
+#include <new>
+#include <atomic>
+#ifdef HTCW_GFX_THREADS
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#elif defined(ESP_PLATFORM)
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#endif
+namespace gfx {
+// the buffer pointers follow
+struct flush_pipeline_info {
+    size_t buffer_size;
+    size_t buffer_count;
+    flush_pipeline::transfer_callback transfer;
+    void* transfer_state;
+    flush_pipeline::wait_callback wait;
+    void* wait_state;
+    // only the flushing thread writes issued. only the transport writes completed
+    std::atomic<size_t> issued;
+    std::atomic<size_t> completed;
+    inline uint8_t** buffers() {
+        return (uint8_t**)(this + 1);
+    }
+};
+#define PHND ((flush_pipeline_info*)m_info)
+static void flush_pipeline_wait(flush_pipeline_info& info) {
+    if (info.wait != nullptr) {
+        info.wait(info.wait_state);
+        return;
+    }
+#ifdef HTCW_GFX_THREADS
+    std::this_thread::yield();
+#elif defined(ESP_PLATFORM)
+    // taskYIELD() would starve lower priority tasks, so give up the CPU for a tick
+    vTaskDelay(1);
+#endif
+}
+flush_pipeline::flush_pipeline(void* (*allocator)(size_t), void* (*reallocator)(void*, size_t), void (*deallocator)(void*)) : m_info(nullptr), m_allocator(allocator), m_reallocator(reallocator), m_deallocator(deallocator) {
+}
+flush_pipeline::flush_pipeline(flush_pipeline&& rhs) : m_info(rhs.m_info), m_allocator(rhs.m_allocator), m_reallocator(rhs.m_reallocator), m_deallocator(rhs.m_deallocator) {
+    rhs.m_info = nullptr;
+}
+flush_pipeline::~flush_pipeline() {
+    deinitialize();
+}
+flush_pipeline& flush_pipeline::operator=(flush_pipeline&& rhs) {
+    deinitialize();
+    m_info = rhs.m_info;
+    m_allocator = rhs.m_allocator;
+    m_reallocator = rhs.m_reallocator;
+    m_deallocator = rhs.m_deallocator;
+    rhs.m_info = nullptr;
+    return *this;
+}
+gfx_result flush_pipeline::initialize(size_t buffer_size, size_t buffer_count, transfer_callback transfer, void* transfer_state, wait_callback wait, void* wait_state) {
+    if (m_info != nullptr) {
+        return gfx_result::success;
+    }
+    if (buffer_size == 0 || buffer_count == 0 || transfer == nullptr) {
+        return gfx_result::invalid_argument;
+    }
+    if (m_allocator == nullptr || m_deallocator == nullptr) {
+        return gfx_result::out_of_memory;
+    }
+    void* mem = m_allocator(sizeof(flush_pipeline_info) + sizeof(uint8_t*) * buffer_count);
+    if (mem == nullptr) {
+        return gfx_result::out_of_memory;
+    }
+    flush_pipeline_info* info = new (mem) flush_pipeline_info();
+    info->buffer_size = buffer_size;
+    info->buffer_count = buffer_count;
+    info->transfer = transfer;
+    info->transfer_state = transfer_state;
+    info->wait = wait;
+    info->wait_state = wait_state;
+    info->issued.store(0);
+    info->completed.store(0);
+    for (size_t i = 0; i < buffer_count; ++i) {
+        info->buffers()[i] = (uint8_t*)m_allocator(buffer_size);
+        if (info->buffers()[i] == nullptr) {
+            while (i > 0) {
+                m_deallocator(info->buffers()[--i]);
+            }
+            info->~flush_pipeline_info();
+            m_deallocator(mem);
+            return gfx_result::out_of_memory;
+        }
+    }
+    m_info = info;
+    return gfx_result::success;
+}
+bool flush_pipeline::initialized() const {
+    return m_info != nullptr;
+}
+void flush_pipeline::deinitialize() {
+    if (m_info == nullptr) {
+        return;
+    }
+    wait_all();
+    for (size_t i = 0; i < PHND->buffer_count; ++i) {
+        m_deallocator(PHND->buffers()[i]);
+    }
+    PHND->~flush_pipeline_info();
+    m_deallocator(m_info);
+    m_info = nullptr;
+}
+size_t flush_pipeline::buffer_size() const {
+    return m_info == nullptr ? 0 : PHND->buffer_size;
+}
+size_t flush_pipeline::buffer_count() const {
+    return m_info == nullptr ? 0 : PHND->buffer_count;
+}
+size_t flush_pipeline::pending() const {
+    if (m_info == nullptr) {
+        return 0;
+    }
+    return PHND->issued.load(std::memory_order_relaxed) - PHND->completed.load(std::memory_order_acquire);
+}
+void flush_pipeline::transfer_complete() {
+    if (m_info != nullptr) {
+        // transfers finish in order, so this is the id the oldest one started with
+        const size_t id = PHND->completed.fetch_add(1, std::memory_order_release);
+        HTCW_GFX_TRACE_ASYNC_END("flush", "transfer", id);
+        (void)id;
+    }
+}
+gfx_result flush_pipeline::wait_all() {
+    if (m_info == nullptr) {
+        return gfx_result::invalid_state;
+    }
+    while (pending() != 0) {
+        flush_pipeline_wait(*PHND);
+    }
+    return gfx_result::success;
+}
+gfx_result flush_pipeline::flush(const rect16& area, size_t bit_depth, render_callback render, void* render_state) {
+    if (m_info == nullptr) {
+        return gfx_result::invalid_state;
+    }
+    if (render == nullptr || bit_depth == 0) {
+        return gfx_result::invalid_argument;
+    }
+    const rect16 a = area.normalize();
+    // strips are packed like a bitmap, so only whole strips need whole bytes
+    const size_t lines = (PHND->buffer_size * 8) / (a.width() * bit_depth);
+    if (lines == 0) {
+        return gfx_result::invalid_argument;
+    }
+    HTCW_GFX_TRACE_SCOPE("flush", "flush");
+    flush_pipeline_info& info = *PHND;
+    for (size_t y = a.y1; y <= a.y2; y += lines) {
+        const size_t y2 = y + lines - 1 < a.y2 ? y + lines - 1 : a.y2;
+        const rect16 strip(a.x1, (uint16_t)y, a.x2, (uint16_t)y2);
+        const size_t issued = info.issued.load(std::memory_order_relaxed);
+        // the buffer is free once the transfer that last used it is complete
+        if (issued - info.completed.load(std::memory_order_acquire) >= info.buffer_count) {
+            HTCW_GFX_TRACE_SCOPE("flush", "wait");
+            while (issued - info.completed.load(std::memory_order_acquire) >= info.buffer_count) {
+                flush_pipeline_wait(info);
+            }
+        }
+        uint8_t* buffer = info.buffers()[issued % info.buffer_count];
+        gfx_result r;
+        {
+            HTCW_GFX_TRACE_SCOPE("flush", "render");
+            r = render(strip, buffer, render_state);
+        }
+        if (r != gfx_result::success) {
+            return r;
+        }
+        // counted before it starts, since it may complete before transfer returns
+        HTCW_GFX_TRACE_ASYNC_BEGIN("flush", "transfer", issued);
+        info.issued.store(issued + 1, std::memory_order_release);
+        r = info.transfer(strip, buffer, (a.width() * strip.height() * bit_depth + 7) / 8, info.transfer_state);
+        if (r != gfx_result::success) {
+            info.issued.store(issued, std::memory_order_release);
+            return r;
+        }
+    }
+    return gfx_result::success;
+}
+#undef PHND
+#ifdef HTCW_GFX_THREADS
+struct flush_mock_job {
+    rect16 bounds;
+    const void* buffer;
+    size_t size;
+};
+// the job ring follows
+struct flush_mock_info {
+    flush_pipeline* pipeline;
+    size_t bytes_per_second;
+    uint32_t latency_us;
+    flush_mock_transport::receive_callback receive;
+    void* receive_state;
+    std::mutex lock;
+    std::condition_variable signal;
+    size_t capacity;
+    size_t head;
+    size_t count;
+    bool stop;
+    std::atomic<size_t> bytes;
+    std::atomic<size_t> transfers;
+    std::thread worker;
+    inline flush_mock_job* jobs() {
+        return (flush_mock_job*)(this + 1);
+    }
+};
+#define MHND ((flush_mock_info*)m_info)
+static void flush_mock_work(flush_mock_info* info) {
+    while (true) {
+        flush_mock_job job;
+        {
+            std::unique_lock<std::mutex> guard(info->lock);
+            info->signal.wait(guard, [info] { return info->count != 0 || info->stop; });
+            if (info->count == 0) {
+                return;
+            }
+            job = info->jobs()[info->head];
+        }
+        const auto start = std::chrono::steady_clock::now();
+        uint64_t us = info->latency_us;
+        if (info->bytes_per_second != 0) {
+            us += (uint64_t)job.size * 1000000 / info->bytes_per_second;
+        }
+        if (info->receive != nullptr) {
+            info->receive(job.bounds, job.buffer, job.size, info->receive_state);
+        }
+        std::this_thread::sleep_until(start + std::chrono::microseconds(us));
+        info->bytes.fetch_add(job.size);
+        info->transfers.fetch_add(1);
+        {
+            std::lock_guard<std::mutex> guard(info->lock);
+            info->head = (info->head + 1) % info->capacity;
+            --info->count;
+        }
+        info->pipeline->transfer_complete();
+    }
+}
+flush_mock_transport::flush_mock_transport(void* (*allocator)(size_t), void* (*reallocator)(void*, size_t), void (*deallocator)(void*)) : m_info(nullptr), m_allocator(allocator), m_reallocator(reallocator), m_deallocator(deallocator) {
+}
+flush_mock_transport::flush_mock_transport(flush_mock_transport&& rhs) : m_info(rhs.m_info), m_allocator(rhs.m_allocator), m_reallocator(rhs.m_reallocator), m_deallocator(rhs.m_deallocator) {
+    rhs.m_info = nullptr;
+}
+flush_mock_transport::~flush_mock_transport() {
+    deinitialize();
+}
+flush_mock_transport& flush_mock_transport::operator=(flush_mock_transport&& rhs) {
+    deinitialize();
+    m_info = rhs.m_info;
+    m_allocator = rhs.m_allocator;
+    m_reallocator = rhs.m_reallocator;
+    m_deallocator = rhs.m_deallocator;
+    rhs.m_info = nullptr;
+    return *this;
+}
+gfx_result flush_mock_transport::initialize(flush_pipeline& pipeline, size_t bytes_per_second, uint32_t latency_us, receive_callback receive, void* receive_state) {
+    if (m_info != nullptr) {
+        return gfx_result::success;
+    }
+    // never more transfers in flight than the pipeline has buffers
+    const size_t capacity = pipeline.buffer_count();
+    if (capacity == 0) {
+        return gfx_result::invalid_state;
+    }
+    if (m_allocator == nullptr || m_deallocator == nullptr) {
+        return gfx_result::out_of_memory;
+    }
+    void* mem = m_allocator(sizeof(flush_mock_info) + sizeof(flush_mock_job) * capacity);
+    if (mem == nullptr) {
+        return gfx_result::out_of_memory;
+    }
+    flush_mock_info* info = new (mem) flush_mock_info();
+    info->pipeline = &pipeline;
+    info->bytes_per_second = bytes_per_second;
+    info->latency_us = latency_us;
+    info->receive = receive;
+    info->receive_state = receive_state;
+    info->capacity = capacity;
+    info->head = 0;
+    info->count = 0;
+    info->stop = false;
+    info->bytes.store(0);
+    info->transfers.store(0);
+    info->worker = std::thread(flush_mock_work, info);
+    m_info = info;
+    return gfx_result::success;
+}
+bool flush_mock_transport::initialized() const {
+    return m_info != nullptr;
+}
+void flush_mock_transport::deinitialize() {
+    if (m_info == nullptr) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> guard(MHND->lock);
+        MHND->stop = true;
+    }
+    MHND->signal.notify_one();
+    MHND->worker.join();
+    MHND->~flush_mock_info();
+    m_deallocator(m_info);
+    m_info = nullptr;
+}
+size_t flush_mock_transport::bytes() const {
+    return m_info == nullptr ? 0 : MHND->bytes.load();
+}
+size_t flush_mock_transport::transfers() const {
+    return m_info == nullptr ? 0 : MHND->transfers.load();
+}
+gfx_result flush_mock_transport::transfer(const rect16& bounds, const void* buffer, size_t size, void* state) {
+    flush_mock_transport* transport = (flush_mock_transport*)state;
+    if (transport == nullptr || transport->m_info == nullptr) {
+        return gfx_result::invalid_state;
+    }
+    flush_mock_info* info = (flush_mock_info*)transport->m_info;
+    {
+        std::lock_guard<std::mutex> guard(info->lock);
+        if (info->count == info->capacity) {
+            return gfx_result::device_error;
+        }
+        info->jobs()[(info->head + info->count) % info->capacity] = {bounds, buffer, size};
+        ++info->count;
+    }
+    info->signal.notify_one();
+    return gfx_result::success;
+}
+#undef MHND
+#endif
+}  // namespace gfx
@@ -1,4 +1,5 @@
 #include <gfx_font.hpp>
+#include <gfx_trace.hpp>
 using namespace gfx;
 int font_draw_cache::hash_function(const int32_t& key) {
     return (int)(key+5);
@@ -22,7 +23,7 @@ void font_draw_cache::expire_memory(size_t new_data_size) {
             break;
         }
         m_memory_size-=sz;
-        free(data);
+        m_deallocator(data);
         m_cache.remove(k);   
     }
     if(!m_cache.size()) {
@@ -46,7 +47,7 @@ void font_draw_cache::expire_item() {
             }  
         }
         m_memory_size-=sz;
-        if(data!=nullptr) free(data);
+        if(data!=nullptr) m_deallocator(data);
         m_cache.remove(k);
         if(!m_cache.size()) {
             m_accessed=-1;
@@ -74,7 +75,7 @@ void font_draw_cache::reduce(int new_size, int new_items) {
                 break;
             }
             m_memory_size-=sz;
-            free(data);
+            m_deallocator(data);
             m_cache.remove(k);   
         }
     }
@@ -98,7 +99,7 @@ void font_draw_cache::reduce(int new_size, int new_items) {
                 break;
             }
             m_memory_size-=sz;
-            free(data);
+            m_deallocator(data);
             m_cache.remove(k);   
         }
     }
@@ -489,34 +490,26 @@ gfx_result font::measure(uint16_t max_width,const text_handle text, size_t text_
     if(cache!=nullptr&&!cache->initialized()) {
         cache = nullptr;
     }
-    const uint8_t* sz = (const uint8_t*)text;
-    size_t len=text_length;
     out_area->width = 0;
     out_area->height = 0;
-    if(len==0) {
+    if(text_length==0) {
         return gfx_result::success;
     }
+    text_decoder decoder(encoding,text,text_length);
     uint16_t em_width = 0;
     uint16_t x_ext = 0, y_ext = 0;
     uint16_t x = 0,y=0;
     int32_t cp=0, cp_next=0;
-    size_t advlen = len;
-    size_t advlen_next = 0;
     const uint16_t lineadv = this->line_advance();
-    gfx_result res = encoding.to_utf32((text_handle)sz,&cp,&advlen);
+    gfx_result res = decoder.next(&cp);
     if(res!=gfx_result::success) {
         return res;
     }
-    sz+=advlen;
-    len-=advlen;
-    if(len) {
-        advlen_next = len;
-        res = encoding.to_utf32((text_handle)sz,&cp_next,&advlen_next);
-        if(res!=gfx_result::success) {
-            return res;
-        }
-        sz+=advlen_next;
-        len-=advlen_next;
+    res = decoder.next(&cp_next);
+    if(res!=gfx_result::success) {
+        return res;
+    }
+    if(cp_next) {
         y_ext = lineadv;
     }
     font_glyph_info em_gi;
@@ -547,7 +540,10 @@ gfx_result font::measure(uint16_t max_width,const text_handle text, size_t text_
                     em_width=em_gi.advance_width;
                 }
                 cw = em_width*tab_width;
-                x=((x/cw)+1)*cw;
+                // a tab width of 0, or a font with no width for 'M', makes tabs take no space
+                if(cw!=0) {
+                    x=((x/cw)+1)*cw;
+                }
                 if(x>=max_width) {
                     x=0;
                     y+=lineadv;
@@ -613,16 +609,9 @@ gfx_result font::measure(uint16_t max_width,const text_handle text, size_t text_
             break;
         }
         // advance
-        if(len) {
-            advlen_next = len;
-            res = encoding.to_utf32((text_handle)sz,&cp_next,&advlen_next);
-            if(res!=gfx_result::success) {
-                return res;
-            }
-            sz+=advlen_next;
-            len-=advlen_next;
-        } else {
-            cp_next = 0;
+        res = decoder.next(&cp_next);
+        if(res!=gfx_result::success) {
+            return res;
         }
     }
     out_area->width = x_ext;
@@ -633,12 +622,13 @@ gfx_result font::measure(uint16_t max_width,const text_handle text, size_t text_
     return gfx_result::success;
 }
 
-gfx_result font::draw(const gfx::srect16& bounds, const text_handle text, size_t text_length, font_draw_callback callback, void* callback_state, uint16_t tab_width, const text_encoder& encoding, font_draw_cache* draw_cache, font_measure_cache* measure_cache) const {
+gfx_result font::draw(const gfx::srect16& bounds, const text_handle text, size_t text_length, font_draw_callback callback, void* callback_state, uint16_t tab_width, const text_encoder& encoding, font_draw_cache* draw_cache, font_measure_cache* measure_cache, void*(*allocator)(size_t), void*(*reallocator)(void*,size_t), void(*deallocator)(void*)) const {
     using bmp_t = gfx::bitmap<alpha_pixel<8>>;
     using const_bmp_t = gfx::const_bitmap<alpha_pixel<8>>;
-    if(text==nullptr || callback==nullptr) {
+    if(text==nullptr || callback==nullptr || allocator==nullptr || reallocator==nullptr || deallocator==nullptr) {
         return gfx_result::invalid_argument;
     }
+    HTCW_GFX_TRACE_SCOPE("font", "draw");
     if(draw_cache!=nullptr&& !draw_cache->initialized()) {
         // don't bother using it if it's disabled.
         draw_cache = nullptr;
@@ -650,33 +640,23 @@ gfx_result font::draw(const gfx::srect16& bounds, const text_handle text, size_t
 
     uint8_t* buffer = nullptr;
     size_t buffer_size = 0;
-    const uint8_t* sz = (const uint8_t*)text;
-    size_t len = text_length;
-    if(len==0) {
+    if(text_length==0) {
         return gfx_result::success;
     }
+    text_decoder decoder(encoding,text,text_length);
     uint16_t em_width = 0;
     uint16_t x_ext = 0, y_ext = 0;
     uint16_t x = 0,y=0;
     int32_t cp=0, cp_next=0;
-    size_t advlen = len;
-    size_t advlen_next = 0;
     const uint16_t lineh = this->line_advance();
     //printf("line adv: %d\n",(int)lineh);
-    gfx_result res = encoding.to_utf32((text_handle)sz,&cp,&advlen);
+    gfx_result res = decoder.next(&cp);
     if(res!=gfx_result::success) {
         return res;
     }
-    sz +=advlen;
-    len-=advlen;
-    if(len) {
-        advlen_next = len;
-        res = encoding.to_utf32((text_handle)sz,&cp_next,&advlen_next);
-        if(res!=gfx_result::success) {
-            return res;
-        }
-        sz+=advlen_next;
-        len-=advlen_next;
+    res = decoder.next(&cp_next);
+    if(res!=gfx_result::success) {
+        return res;
     }
     font_glyph_info em_gi;
     uint16_t xo, cw;
@@ -696,7 +676,7 @@ gfx_result font::draw(const gfx::srect16& bounds, const text_handle text, size_t
                         res=on_measure('M',0,&em_gi);
                         if(res!=gfx_result::success) {
                             if(buffer) {
-                                free(buffer);
+                                deallocator(buffer);
                             }
                             return res;
                         }
@@ -708,7 +688,10 @@ gfx_result font::draw(const gfx::srect16& bounds, const text_handle text, size_t
                 }
                 
                 cw = em_width*tab_width;
-                x=((x/cw)+1)*cw;
+                // a tab width of 0, or a font with no width for 'M', makes tabs take no space
+                if(cw!=0) {
+                    x=((x/cw)+1)*cw;
+                }
                 if(x>=bounds.width()) {
                     x=0;
                     y+=lineh;
@@ -735,7 +718,7 @@ gfx_result font::draw(const gfx::srect16& bounds, const text_handle text, size_t
                     res = this->on_measure((int)cp,(int)(cp_next>=0x20)?cp_next:0,&gi);
                     if(res!=gfx_result::success) {
                         if(buffer) {
-                            free(buffer);
+                            deallocator(buffer);
                         }
                         return res;
                     }
@@ -750,6 +733,7 @@ gfx_result font::draw(const gfx::srect16& bounds, const text_handle text, size_t
                         size16 d;
                         uint8_t * b;
                         if(gfx_result::success==draw_cache->find(cp,&d,&b)) {
+                            HTCW_GFX_TRACE_SCOPE("font", "glyph_cached");
                             const_bmp_t cbmp(d,b);
                             //printf("gi.offset.y: %d\n",gi.offset.y);
                             spoint16 loc = spoint16(x,y).offset(bounds.point1()).offset(gi.offset);
@@ -760,29 +744,33 @@ gfx_result font::draw(const gfx::srect16& bounds, const text_handle text, size_t
                         }
                     }
                     if(!cached) {
+                        HTCW_GFX_TRACE_SCOPE("font", "glyph");
                         // do draw
                         size_t bsize = gi.dimensions.width*gi.dimensions.height;
                         if(buffer_size==0) {
-                            buffer = (uint8_t*)malloc(bsize);
+                            buffer = (uint8_t*)allocator(bsize);
                             if(buffer==nullptr) {
                                 return gfx_result::out_of_memory;
                             }
-                            memset(buffer,0,bsize);
                             buffer_size = bsize;
                         } else {
                             if(buffer_size<bsize) {
-                                buffer = (uint8_t*)realloc(buffer,bsize);
-                                if(buffer==nullptr) {
+                                uint8_t* p = (uint8_t*)reallocator(buffer,bsize);
+                                if(p==nullptr) {
+                                    deallocator(buffer);
                                     return gfx_result::out_of_memory;
                                 }
+                                buffer = p;
                                 buffer_size = bsize;
                             }
                         }
+                        // the buffer is reused, and glyphs with nothing to draw, like spaces, don't write to it
+                        memset(buffer,0,bsize);
                         bmp_t bmp(gi.dimensions,buffer);
                         res = on_draw(bmp,cp,gi.glyph_index1);
                         if(res!=gfx_result::success) {
                             if(buffer) {
-                                free(buffer);
+                                deallocator(buffer);
                             }
                             return res;
                         }
@@ -817,23 +805,16 @@ gfx_result font::draw(const gfx::srect16& bounds, const text_handle text, size_t
             break;
         }
         // advance
-        if(len) {
-            advlen_next = len;
-            res = encoding.to_utf32((text_handle)sz,&cp_next,&advlen_next);
-            if(res!=gfx_result::success) {
-                if(buffer) {
-                    free(buffer);
-                }
-                return res;
+        res = decoder.next(&cp_next);
+        if(res!=gfx_result::success) {
+            if(buffer) {
+                deallocator(buffer);
             }
-            sz+=advlen_next;
-            len-=advlen_next;
-        } else {
-            cp_next = 0;
+            return res;
         }
     }
     if(buffer) {
-        free(buffer);
+        deallocator(buffer);
     }
     return gfx_result::success;
 }
@@ -1,20 +1,21 @@
 #include "gfx_jpg_image.hpp"
 #include "tjpgd.h"
+#include "gfx_trace.hpp"
 namespace gfx {
 #define LDB_WORD(ptr) (uint16_t)(((uint16_t) * ((uint8_t *)(ptr)) << 8) | (uint16_t) * (uint8_t *)((ptr) + 1))
 static uint8_t jpg_image_buffer[JD_SZBUF];
 
-jpg_image::jpg_image() : m_stream(nullptr), m_native_dimensions(0, 0), m_scale(jpg_scale::scale_1_1), m_info(nullptr), m_pool(nullptr),m_bmp(nullptr)
+jpg_image::jpg_image(void*(*allocator)(size_t), void*(*reallocator)(void*,size_t), void(*deallocator)(void*)) : m_stream(nullptr), m_native_dimensions(0, 0), m_scale(jpg_scale::scale_1_1), m_info(nullptr), m_pool(nullptr),m_bmp(nullptr),m_allocator(allocator),m_reallocator(reallocator),m_deallocator(deallocator)
 {
 }
-jpg_image::jpg_image(stream &stream, jpg_scale scale, bool initialize) : m_stream(&stream),m_native_dimensions(0,0), m_scale(scale), m_info(nullptr), m_pool(nullptr),m_bmp(nullptr)
+jpg_image::jpg_image(stream &stream, jpg_scale scale, bool initialize, void*(*allocator)(size_t), void*(*reallocator)(void*,size_t), void(*deallocator)(void*)) : m_stream(&stream),m_native_dimensions(0,0), m_scale(scale), m_info(nullptr), m_pool(nullptr),m_bmp(nullptr),m_allocator(allocator),m_reallocator(reallocator),m_deallocator(deallocator)
 {
     if (initialize)
     {
         this->initialize();
     }
 }
-jpg_image::jpg_image(jpg_image &&rhs) : m_stream(rhs.m_stream), m_native_dimensions(rhs.m_native_dimensions),m_scale(rhs.m_scale), m_info(rhs.m_info), m_pool(rhs.m_pool),m_bmp(rhs.m_bmp)
+jpg_image::jpg_image(jpg_image &&rhs) : m_stream(rhs.m_stream), m_native_dimensions(rhs.m_native_dimensions),m_scale(rhs.m_scale), m_info(rhs.m_info), m_pool(rhs.m_pool),m_bmp(rhs.m_bmp),m_allocator(rhs.m_allocator),m_reallocator(rhs.m_reallocator),m_deallocator(rhs.m_deallocator)
 {
     rhs.m_stream = nullptr;
     rhs.m_native_dimensions = {0, 0};
@@ -31,6 +32,9 @@ jpg_image &jpg_image::operator=(jpg_image &&rhs)
     m_info = rhs.m_info;
     m_pool = rhs.m_pool;
     m_bmp = rhs.m_bmp;
+    m_allocator = rhs.m_allocator;
+    m_reallocator = rhs.m_reallocator;
+    m_deallocator = rhs.m_deallocator;
     rhs.m_stream = nullptr;
     rhs.m_native_dimensions = {0, 0};
     rhs.m_info = nullptr;
@@ -99,24 +103,24 @@ gfx_result jpg_image::initialize()
             m_native_dimensions.width = LDB_WORD(&jpg_image_buffer[3]);
             m_native_dimensions.height = LDB_WORD(&jpg_image_buffer[1]);
             m_stream->seek(0);
-            m_info = malloc(sizeof(JDEC));
+            m_info = m_allocator(sizeof(JDEC));
             if (m_info == nullptr)
             {
                 return gfx_result::out_of_memory;
             }
-            m_pool = malloc(pool_size);
+            m_pool = m_allocator(pool_size);
             if (m_pool == nullptr)
             {
-                free(m_info);
+                m_deallocator(m_info);
                 m_info = nullptr;
                 return gfx_result::out_of_memory;
             }
             ((JDEC *)m_info)->device = nullptr;
-            m_bmp = malloc(bitmap<rgba_pixel<32>>::sizeof_buffer({16,16}));
+            m_bmp = m_allocator(bitmap<rgba_pixel<32>>::sizeof_buffer({16,16}));
             if(m_bmp==nullptr) {
-                free(m_pool);
+                m_deallocator(m_pool);
                 m_pool=nullptr;
-                free(m_info);
+                m_deallocator(m_info);
                 m_info = nullptr;
                 return gfx_result::out_of_memory;
             }
@@ -142,16 +146,16 @@ void jpg_image::deinitialize()
 {
     if (m_info)
     {
-        free(m_info);
+        m_deallocator(m_info);
         m_info = nullptr;
     }
     if (m_pool)
     {
-        free(m_pool);
+        m_deallocator(m_pool);
         m_pool = nullptr;
     }
     if(m_bmp) {
-        free(m_bmp);
+        m_deallocator(m_bmp);
         m_bmp = nullptr;
     }
     m_native_dimensions = {0, 0};
@@ -174,6 +178,7 @@ void jpg_image::scale(jpg_scale value) {
 }
 gfx_result jpg_image::draw(const rect16 &bounds, image_draw_callback callback, void *callback_state) const
 {
+    HTCW_GFX_TRACE_SCOPE("jpg", "decode");
     if (!initialized())
         return gfx_result::invalid_state;
     if (callback == nullptr)
@@ -242,6 +247,7 @@ gfx_result jpg_image::draw(const rect16 &bounds, image_draw_callback callback, v
                              JRECT *rect   /* Rectangle to output */
                           )
                     {
+                        HTCW_GFX_TRACE_SCOPE("jpg", "mcu");
                         dec_state& st=*(dec_state*)jdec->device;
                         int x1 = rect->left;
                         int y1 = rect->top;
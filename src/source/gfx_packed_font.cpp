@@ -0,0 +1,630 @@
+#include <gfx_packed_font.hpp>
+namespace gfx {
+// file layout (all values little endian):
+// header:
+//  "GFXP", version:u8, bpp:u8, reserved:u16,
+//  line_height:u16, line_advance:u16, base_line:u16, reserved:u16,
+//  glyph_count:u32, kern_count:u32, glyph_data_size:u32
+// glyph index (sorted by codepoint):
+//  codepoint:i32, data_offset:u32, width:u16, height:u16,
+//  offset_x:i16, offset_y:i16, advance_width:i16, reserved:u16
+// kerning table (sorted by codepoint1 then codepoint2):
+//  codepoint1:i32, codepoint2:i32, adjustment:i16, reserved:u16
+// glyph data:
+//  RLE rows. A control byte with the high bit set is a run of (c&0x7F)+1
+//  pixels of the level in the following byte. Otherwise it is followed by
+//  c+1 literal levels packed MSB first at bpp bits each. Runs never span rows.
+static const uint8_t packed_font_version = 1;
+static const size_t packed_font_header_size = 28;
+static const size_t packed_font_glyph_entry_size = 20;
+static const size_t packed_font_kern_entry_size = 12;
+
+static inline uint16_t packed_font_u16(const uint8_t* p) {
+    return uint16_t(p[0]) | (uint16_t(p[1]) << 8);
+}
+static inline uint32_t packed_font_u32(const uint8_t* p) {
+    return uint32_t(p[0]) | (uint32_t(p[1]) << 8) | (uint32_t(p[2]) << 16) | (uint32_t(p[3]) << 24);
+}
+static inline void packed_font_put16(uint8_t* p, uint16_t value) {
+    p[0] = uint8_t(value);
+    p[1] = uint8_t(value >> 8);
+}
+static inline void packed_font_put32(uint8_t* p, uint32_t value) {
+    p[0] = uint8_t(value);
+    p[1] = uint8_t(value >> 8);
+    p[2] = uint8_t(value >> 16);
+    p[3] = uint8_t(value >> 24);
+}
+// decodes RLE rows into 8-bit alpha
+static gfx_result packed_font_decode(const uint8_t* src, size_t src_size, uint8_t bpp, uint8_t* dst, size_t width, size_t height, size_t stride) {
+    const uint8_t* const src_end = src + src_size;
+    const uint8_t scale = bpp == 4 ? 17 : 85;
+    const uint8_t level_mask = (1 << bpp) - 1;
+    const uint8_t per_byte = 8 / bpp;
+    for (size_t y = 0; y < height; ++y) {
+        uint8_t* row = dst + y * stride;
+        size_t x = 0;
+        while (x < width) {
+            if (src >= src_end) {
+                return gfx_result::invalid_format;
+            }
+            uint8_t c = *src++;
+            size_t count = (c & 0x7F) + 1;
+            if (x + count > width) {
+                return gfx_result::invalid_format;
+            }
+            if (c & 0x80) {
+                if (src >= src_end) {
+                    return gfx_result::invalid_format;
+                }
+                memset(row + x, (*src++ & level_mask) * scale, count);
+                x += count;
+            } else {
+                if (src + ((count + per_byte - 1) / per_byte) > src_end) {
+                    return gfx_result::invalid_format;
+                }
+                uint8_t* p = row + x;
+                x += count;
+                while (count >= per_byte) {
+                    uint8_t b = *src++;
+                    if (bpp == 4) {
+                        *p++ = (b >> 4) * scale;
+                        *p++ = (b & 0xF) * scale;
+                    } else {
+                        *p++ = (b >> 6) * scale;
+                        *p++ = ((b >> 4) & 3) * scale;
+                        *p++ = ((b >> 2) & 3) * scale;
+                        *p++ = (b & 3) * scale;
+                    }
+                    count -= per_byte;
+                }
+                if (count) {
+                    uint8_t b = *src++;
+                    int shift = 8 - bpp;
+                    while (count--) {
+                        *p++ = ((b >> shift) & level_mask) * scale;
+                        shift -= bpp;
+                    }
+                }
+            }
+        }
+    }
+    return gfx_result::success;
+}
+gfx_result packed_font::read(size_t offset, uint8_t* data, size_t size) const {
+    if (m_data != nullptr) {
+        if (offset + size > m_data_size) {
+            return gfx_result::invalid_format;
+        }
+        memcpy(data, m_data + offset, size);
+        return gfx_result::success;
+    }
+    if (m_stream == nullptr) {
+        return gfx_result::invalid_state;
+    }
+    if (offset != m_stream->seek(offset)) {
+        return gfx_result::io_error;
+    }
+    if (size != m_stream->read(data, size)) {
+        return gfx_result::io_error;
+    }
+    return gfx_result::success;
+}
+gfx_result packed_font::read_glyph(int32_t glyph_index, uint8_t* out_entry) const {
+    if (glyph_index < 0 || (uint32_t)glyph_index >= m_glyph_count) {
+        return gfx_result::invalid_argument;
+    }
+    return read(packed_font_header_size + glyph_index * packed_font_glyph_entry_size, out_entry, packed_font_glyph_entry_size);
+}
+gfx_result packed_font::find_glyph(int32_t codepoint, int32_t* out_glyph_index) const {
+    int32_t lo = 0, hi = ((int32_t)m_glyph_count) - 1;
+    uint8_t entry[4];
+    while (lo <= hi) {
+        int32_t mid = (lo + hi) / 2;
+        const uint8_t* p;
+        if (m_data != nullptr) {
+            p = m_data + packed_font_header_size + mid * packed_font_glyph_entry_size;
+        } else {
+            gfx_result res = read(packed_font_header_size + mid * packed_font_glyph_entry_size, entry, sizeof(entry));
+            if (res != gfx_result::success) {
+                return res;
+            }
+            p = entry;
+        }
+        int32_t cmp = (int32_t)packed_font_u32(p);
+        if (cmp == codepoint) {
+            *out_glyph_index = mid;
+            return gfx_result::success;
+        }
+        if (cmp < codepoint) {
+            lo = mid + 1;
+        } else {
+            hi = mid - 1;
+        }
+    }
+    return gfx_result::not_supported;
+}
+gfx_result packed_font::find_kerning(int32_t codepoint1, int32_t codepoint2, int16_t* out_adjustment) const {
+    *out_adjustment = 0;
+    if (m_kern_count == 0) {
+        return gfx_result::success;
+    }
+    const size_t start = packed_font_header_size + m_glyph_count * packed_font_glyph_entry_size;
+    int32_t lo = 0, hi = ((int32_t)m_kern_count) - 1;
+    uint8_t entry[packed_font_kern_entry_size];
+    while (lo <= hi) {
+        int32_t mid = (lo + hi) / 2;
+        const uint8_t* p;
+        if (m_data != nullptr) {
+            p = m_data + start + mid * packed_font_kern_entry_size;
+        } else {
+            gfx_result res = read(start + mid * packed_font_kern_entry_size, entry, sizeof(entry));
+            if (res != gfx_result::success) {
+                return res;
+            }
+            p = entry;
+        }
+        int32_t cmp1 = (int32_t)packed_font_u32(p);
+        int32_t cmp2 = (int32_t)packed_font_u32(p + 4);
+        if (cmp1 == codepoint1 && cmp2 == codepoint2) {
+            *out_adjustment = (int16_t)packed_font_u16(p + 8);
+            return gfx_result::success;
+        }
+        if (cmp1 < codepoint1 || (cmp1 == codepoint1 && cmp2 < codepoint2)) {
+            lo = mid + 1;
+        } else {
+            hi = mid - 1;
+        }
+    }
+    return gfx_result::success;
+}
+packed_font::packed_font(const uint8_t* data, size_t size, bool initialize) : m_data(data), m_data_size(size), m_stream(nullptr), m_bpp(0), m_glyph_count(0), m_kern_count(0), m_glyph_data_size(0), m_allocator(::malloc), m_reallocator(::realloc), m_deallocator(::free) {
+    if (initialize) {
+        this->initialize();
+    }
+}
+packed_font::packed_font(gfx::stream& stream, bool initialize, void*(*allocator)(size_t), void*(*reallocator)(void*,size_t), void(*deallocator)(void*)) : m_data(nullptr), m_data_size(0), m_stream(&stream), m_bpp(0), m_glyph_count(0), m_kern_count(0), m_glyph_data_size(0), m_allocator(allocator), m_reallocator(reallocator), m_deallocator(deallocator) {
+    if (initialize) {
+        this->initialize();
+    }
+}
+packed_font::packed_font(void*(*allocator)(size_t), void*(*reallocator)(void*,size_t), void(*deallocator)(void*)) : m_data(nullptr), m_data_size(0), m_stream(nullptr), m_bpp(0), m_glyph_count(0), m_kern_count(0), m_glyph_data_size(0), m_allocator(allocator), m_reallocator(reallocator), m_deallocator(deallocator) {
+}
+packed_font::~packed_font() {
+    deinitialize();
+}
+packed_font::packed_font(packed_font&& rhs) {
+    m_data = rhs.m_data;
+    m_data_size = rhs.m_data_size;
+    m_stream = rhs.m_stream;
+    m_bpp = rhs.m_bpp;
+    m_line_height = rhs.m_line_height;
+    m_line_advance = rhs.m_line_advance;
+    m_base_line = rhs.m_base_line;
+    m_glyph_count = rhs.m_glyph_count;
+    m_kern_count = rhs.m_kern_count;
+    m_glyph_data_size = rhs.m_glyph_data_size;
+    m_allocator = rhs.m_allocator;
+    m_reallocator = rhs.m_reallocator;
+    m_deallocator = rhs.m_deallocator;
+    rhs.m_data = nullptr;
+    rhs.m_stream = nullptr;
+    rhs.m_bpp = 0;
+}
+packed_font& packed_font::operator=(packed_font&& rhs) {
+    m_data = rhs.m_data;
+    m_data_size = rhs.m_data_size;
+    m_stream = rhs.m_stream;
+    m_bpp = rhs.m_bpp;
+    m_line_height = rhs.m_line_height;
+    m_line_advance = rhs.m_line_advance;
+    m_base_line = rhs.m_base_line;
+    m_glyph_count = rhs.m_glyph_count;
+    m_kern_count = rhs.m_kern_count;
+    m_glyph_data_size = rhs.m_glyph_data_size;
+    m_allocator = rhs.m_allocator;
+    m_reallocator = rhs.m_reallocator;
+    m_deallocator = rhs.m_deallocator;
+    rhs.m_data = nullptr;
+    rhs.m_stream = nullptr;
+    rhs.m_bpp = 0;
+    return *this;
+}
+gfx_result packed_font::initialize() {
+    if (m_bpp != 0) {
+        return gfx_result::success;
+    }
+    if (m_data == nullptr) {
+        if (m_stream == nullptr) {
+            return gfx_result::invalid_state;
+        }
+        if (!m_stream->caps().read || !m_stream->caps().seek) {
+            return gfx_result::invalid_argument;
+        }
+    }
+    uint8_t header[packed_font_header_size];
+    gfx_result res = read(0, header, sizeof(header));
+    if (res != gfx_result::success) {
+        return res;
+    }
+    if (0 != memcmp(header, "GFXP", 4) || header[4] != packed_font_version) {
+        return gfx_result::invalid_format;
+    }
+    if (header[5] != 2 && header[5] != 4) {
+        return gfx_result::invalid_format;
+    }
+    m_line_height = packed_font_u16(header + 8);
+    m_line_advance = packed_font_u16(header + 10);
+    m_base_line = packed_font_u16(header + 12);
+    m_glyph_count = packed_font_u32(header + 16);
+    m_kern_count = packed_font_u32(header + 20);
+    m_glyph_data_size = packed_font_u32(header + 24);
+    if (m_data != nullptr &&
+            m_data_size < packed_font_header_size +
+                m_glyph_count * packed_font_glyph_entry_size +
+                m_kern_count * packed_font_kern_entry_size +
+                m_glyph_data_size) {
+        return gfx_result::invalid_format;
+    }
+    m_bpp = header[5];
+    return gfx_result::success;
+}
+bool packed_font::initialized() const {
+    return m_bpp != 0;
+}
+void packed_font::deinitialize() {
+    m_bpp = 0;
+}
+uint16_t packed_font::line_height() const {
+    return m_line_height;
+}
+uint16_t packed_font::line_advance() const {
+    return m_line_advance;
+}
+uint16_t packed_font::base_line() const {
+    return m_base_line;
+}
+uint8_t packed_font::bits_per_pixel() const {
+    return m_bpp;
+}
+size_t packed_font::glyph_count() const {
+    return m_glyph_count;
+}
+size_t packed_font::kerning_pairs() const {
+    return m_kern_count;
+}
+gfx_result packed_font::on_measure(int32_t codepoint1, int32_t codepoint2, font_glyph_info* out_glyph_info) const {
+    if (!initialized()) {
+        return gfx_result::invalid_state;
+    }
+    int32_t gi;
+    gfx_result res = find_glyph(codepoint1, &gi);
+    if (res != gfx_result::success) {
+        return res;
+    }
+    uint8_t entry[packed_font_glyph_entry_size];
+    res = read_glyph(gi, entry);
+    if (res != gfx_result::success) {
+        return res;
+    }
+    out_glyph_info->glyph_index1 = gi;
+    out_glyph_info->glyph_index2 = -1;
+    out_glyph_info->dimensions.width = packed_font_u16(entry + 8);
+    out_glyph_info->dimensions.height = packed_font_u16(entry + 10);
+    out_glyph_info->offset.x = (int16_t)packed_font_u16(entry + 12);
+    out_glyph_info->offset.y = (int16_t)packed_font_u16(entry + 14);
+    out_glyph_info->advance_width = (int16_t)packed_font_u16(entry + 16);
+    if (codepoint2 != 0) {
+        int32_t gi2;
+        if (gfx_result::success == find_glyph(codepoint2, &gi2)) {
+            out_glyph_info->glyph_index2 = gi2;
+        }
+        int16_t adj;
+        res = find_kerning(codepoint1, codepoint2, &adj);
+        if (res != gfx_result::success) {
+            return res;
+        }
+        out_glyph_info->advance_width += adj;
+    }
+    return gfx_result::success;
+}
+gfx_result packed_font::on_draw(bitmap<alpha_pixel<8>>& destination, int32_t codepoint, int32_t glyph_index) const {
+    if (!initialized()) {
+        return gfx_result::invalid_state;
+    }
+    gfx_result res;
+    if (glyph_index < 0) {
+        res = find_glyph(codepoint, &glyph_index);
+        if (res != gfx_result::success) {
+            return res;
+        }
+    }
+    uint8_t entry[packed_font_glyph_entry_size];
+    res = read_glyph(glyph_index, entry);
+    if (res != gfx_result::success) {
+        return res;
+    }
+    uint32_t offs = packed_font_u32(entry + 4);
+    uint32_t end = m_glyph_data_size;
+    if ((uint32_t)glyph_index + 1 < m_glyph_count) {
+        uint8_t next[8];
+        res = read(packed_font_header_size + (glyph_index + 1) * packed_font_glyph_entry_size, next, sizeof(next));
+        if (res != gfx_result::success) {
+            return res;
+        }
+        end = packed_font_u32(next + 4);
+    }
+    if (end < offs || end > m_glyph_data_size) {
+        return gfx_result::invalid_format;
+    }
+    size16 dim(packed_font_u16(entry + 8), packed_font_u16(entry + 10));
+    const size16 ddim = destination.dimensions();
+    if (ddim.width < dim.width || ddim.height < dim.height) {
+        return gfx_result::invalid_argument;
+    }
+    const size_t data_start = packed_font_header_size +
+                              m_glyph_count * packed_font_glyph_entry_size +
+                              m_kern_count * packed_font_kern_entry_size;
+    if (m_data != nullptr) {
+        return packed_font_decode(m_data + data_start + offs, end - offs, m_bpp, destination.begin(), dim.width, dim.height, ddim.width);
+    }
+    uint8_t* tmp = (uint8_t*)m_allocator(end - offs);
+    if (tmp == nullptr) {
+        return gfx_result::out_of_memory;
+    }
+    res = read(data_start + offs, tmp, end - offs);
+    if (res == gfx_result::success) {
+        res = packed_font_decode(tmp, end - offs, m_bpp, destination.begin(), dim.width, dim.height, ddim.width);
+    }
+    m_deallocator(tmp);
+    return res;
+}
+namespace {
+struct packed_font_buffer {
+    uint8_t* data;
+    size_t size;
+    size_t capacity;
+    void* (*allocator)(size_t);
+    void* (*reallocator)(void*, size_t);
+    bool reserve(size_t extra) {
+        if (size + extra <= capacity) {
+            return true;
+        }
+        size_t cap = capacity ? capacity * 2 : 256;
+        while (cap < size + extra) {
+            cap *= 2;
+        }
+        uint8_t* p = (uint8_t*)(data == nullptr ? allocator(cap) : reallocator(data, cap));
+        if (p == nullptr) {
+            return false;
+        }
+        data = p;
+        capacity = cap;
+        return true;
+    }
+    bool put(const uint8_t* src, size_t count) {
+        if (!reserve(count)) {
+            return false;
+        }
+        memcpy(data + size, src, count);
+        size += count;
+        return true;
+    }
+    bool put(uint8_t value) {
+        return put(&value, 1);
+    }
+};
+int packed_font_cmp_cp(const void* lhs, const void* rhs) {
+    int32_t l = *(const int32_t*)lhs, r = *(const int32_t*)rhs;
+    return l < r ? -1 : (l > r ? 1 : 0);
+}
+}  // namespace
+static bool packed_font_encode_row(const uint8_t* levels, size_t width, uint8_t bpp, packed_font_buffer& out) {
+    const size_t per_byte = 8 / bpp;
+    size_t i = 0;
+    while (i < width) {
+        size_t run = 1;
+        while (i + run < width && run < 128 && levels[i + run] == levels[i]) {
+            ++run;
+        }
+        if (run >= 3 || (run == 2 && i + run == width)) {
+            if (!out.put(uint8_t(0x80 | (run - 1))) || !out.put(levels[i])) {
+                return false;
+            }
+            i += run;
+            continue;
+        }
+        // gather literals until the next worthwhile run
+        size_t j = i;
+        while (j < width && (j - i) < 128) {
+            if (j + 2 < width && levels[j] == levels[j + 1] && levels[j] == levels[j + 2]) {
+                break;
+            }
+            ++j;
+        }
+        size_t count = j - i;
+        if (!out.put(uint8_t(count - 1))) {
+            return false;
+        }
+        while (count) {
+            uint8_t b = 0;
+            for (size_t k = 0; k < per_byte; ++k) {
+                b <<= bpp;
+                if (count) {
+                    b |= levels[i++];
+                    --count;
+                }
+            }
+            if (!out.put(b)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+gfx_result packed_font::compile(const font& source, const int32_t* codepoints, size_t codepoint_count, stream& output, uint8_t bits_per_pixel, bool kerning, void*(allocator)(size_t), void*(reallocator)(void*, size_t), void(deallocator)(void*)) {
+    if (codepoints == nullptr || (bits_per_pixel != 2 && bits_per_pixel != 4)) {
+        return gfx_result::invalid_argument;
+    }
+    if (!source.initialized()) {
+        return gfx_result::invalid_state;
+    }
+    if (!output.caps().write) {
+        return gfx_result::invalid_argument;
+    }
+    gfx_result res = gfx_result::success;
+    const uint8_t max_level = (1 << bits_per_pixel) - 1;
+    packed_font_buffer index = {nullptr, 0, 0, allocator, reallocator};
+    packed_font_buffer kern = {nullptr, 0, 0, allocator, reallocator};
+    packed_font_buffer glyphs = {nullptr, 0, 0, allocator, reallocator};
+    uint8_t* bmp_buf = nullptr;
+    size_t bmp_size = 0;
+    uint32_t glyph_count = 0;
+    uint32_t kern_count = 0;
+    uint8_t header[packed_font_header_size];
+    int32_t* cps = (int32_t*)allocator(codepoint_count * sizeof(int32_t) + 1);
+    if (cps == nullptr) {
+        return gfx_result::out_of_memory;
+    }
+    memcpy(cps, codepoints, codepoint_count * sizeof(int32_t));
+    qsort(cps, codepoint_count, sizeof(int32_t), packed_font_cmp_cp);
+    size_t count = 0;
+    for (size_t i = 0; i < codepoint_count; ++i) {
+        if (count == 0 || cps[count - 1] != cps[i]) {
+            cps[count++] = cps[i];
+        }
+    }
+    // glyphs
+    for (size_t i = 0; i < count; ++i) {
+        font_glyph_info gi;
+        if (gfx_result::success != source.measure_glyph(cps[i], 0, &gi)) {
+            // not in the source font
+            cps[i] = -1;
+            continue;
+        }
+        const size_t sz = gi.dimensions.width * gi.dimensions.height;
+        if (sz > bmp_size) {
+            uint8_t* p = (uint8_t*)(bmp_buf == nullptr ? allocator(sz) : reallocator(bmp_buf, sz));
+            if (p == nullptr) {
+                res = gfx_result::out_of_memory;
+                goto done;
+            }
+            bmp_buf = p;
+            bmp_size = sz;
+        }
+        if (sz) {
+            memset(bmp_buf, 0, sz);
+            bitmap<alpha_pixel<8>> bmp(gi.dimensions, bmp_buf);
+            res = source.draw_glyph(bmp, cps[i], gi.glyph_index1);
+            if (res != gfx_result::success) {
+                goto done;
+            }
+            for (size_t j = 0; j < sz; ++j) {
+                bmp_buf[j] = (uint8_t)((bmp_buf[j] * max_level + 127) / 255);
+            }
+        }
+        uint8_t entry[packed_font_glyph_entry_size];
+        packed_font_put32(entry, (uint32_t)cps[i]);
+        packed_font_put32(entry + 4, (uint32_t)glyphs.size);
+        packed_font_put16(entry + 8, gi.dimensions.width);
+        packed_font_put16(entry + 10, gi.dimensions.height);
+        packed_font_put16(entry + 12, (uint16_t)gi.offset.x);
+        packed_font_put16(entry + 14, (uint16_t)gi.offset.y);
+        packed_font_put16(entry + 16, (uint16_t)gi.advance_width);
+        packed_font_put16(entry + 18, 0);
+        if (!index.put(entry, sizeof(entry))) {
+            res = gfx_result::out_of_memory;
+            goto done;
+        }
+        for (size_t y = 0; y < gi.dimensions.height; ++y) {
+            if (!packed_font_encode_row(bmp_buf + y * gi.dimensions.width, gi.dimensions.width, bits_per_pixel, glyphs)) {
+                res = gfx_result::out_of_memory;
+                goto done;
+            }
+        }
+        ++glyph_count;
+    }
+    // kerning pairs
+    if (kerning) {
+        for (size_t i = 0; i < count; ++i) {
+            if (cps[i] == -1) {
+                continue;
+            }
+            font_glyph_info gi;
+            if (gfx_result::success != source.measure_glyph(cps[i], 0, &gi)) {
+                continue;
+            }
+            for (size_t j = 0; j < count; ++j) {
+                if (cps[j] == -1) {
+                    continue;
+                }
+                font_glyph_info gik;
+                if (gfx_result::success != source.measure_glyph(cps[i], cps[j], &gik)) {
+                    continue;
+                }
+                int adj = gik.advance_width - gi.advance_width;
+                if (adj != 0) {
+                    uint8_t entry[packed_font_kern_entry_size];
+                    packed_font_put32(entry, (uint32_t)cps[i]);
+                    packed_font_put32(entry + 4, (uint32_t)cps[j]);
+                    packed_font_put16(entry + 8, (uint16_t)(int16_t)adj);
+                    packed_font_put16(entry + 10, 0);
+                    if (!kern.put(entry, sizeof(entry))) {
+                        res = gfx_result::out_of_memory;
+                        goto done;
+                    }
+                    ++kern_count;
+                }
+            }
+        }
+    }
+    memcpy(header, "GFXP", 4);
+    header[4] = packed_font_version;
+    header[5] = bits_per_pixel;
+    packed_font_put16(header + 6, 0);
+    packed_font_put16(header + 8, source.line_height());
+    packed_font_put16(header + 10, source.line_advance());
+    packed_font_put16(header + 12, source.base_line());
+    packed_font_put16(header + 14, 0);
+    packed_font_put32(header + 16, glyph_count);
+    packed_font_put32(header + 20, kern_count);
+    packed_font_put32(header + 24, (uint32_t)glyphs.size);
+    if (sizeof(header) != output.write(header, sizeof(header)) ||
+        (index.size && index.size != output.write(index.data, index.size)) ||
+        (kern.size && kern.size != output.write(kern.data, kern.size)) ||
+        (glyphs.size && glyphs.size != output.write(glyphs.data, glyphs.size))) {
+        res = gfx_result::io_error;
+    }
+done:
+    if (bmp_buf != nullptr) {
+        deallocator(bmp_buf);
+    }
+    if (index.data != nullptr) {
+        deallocator(index.data);
+    }
+    if (kern.data != nullptr) {
+        deallocator(kern.data);
+    }
+    if (glyphs.data != nullptr) {
+        deallocator(glyphs.data);
+    }
+    deallocator(cps);
+    return res;
+}
+gfx_result packed_font::compile(const font& source, int32_t first, int32_t last, stream& output, uint8_t bits_per_pixel, bool kerning, void*(allocator)(size_t), void*(reallocator)(void*, size_t), void(deallocator)(void*)) {
+    if (last < first) {
+        return gfx_result::invalid_argument;
+    }
+    size_t count = (size_t)(last - first) + 1;
+    int32_t* cps = (int32_t*)allocator(count * sizeof(int32_t));
+    if (cps == nullptr) {
+        return gfx_result::out_of_memory;
+    }
+    for (size_t i = 0; i < count; ++i) {
+        cps[i] = first + (int32_t)i;
+    }
+    gfx_result res = compile(source, cps, count, output, bits_per_pixel, kerning, allocator, reallocator, deallocator);
+    deallocator(cps);
+    return res;
+}
+}  // namespace gfx
@@ -40,10 +40,10 @@ static inline gfx_result png_read_uint32(stream* stm,uint32_t* out_result)
     return gfx_result::success;
 }
 
-png_image::png_image() : m_stream(nullptr),m_dimensions(0,0) {
+png_image::png_image(void*(*allocator)(size_t), void*(*reallocator)(void*,size_t), void(*deallocator)(void*)) : m_stream(nullptr),m_dimensions(0,0),m_allocator(allocator),m_reallocator(reallocator),m_deallocator(deallocator) {
 
 }
-png_image::png_image(stream& stream, bool initialize) : m_stream(&stream), m_dimensions(0,0) {
+png_image::png_image(stream& stream, bool initialize, void*(*allocator)(size_t), void*(*reallocator)(void*,size_t), void(*deallocator)(void*)) : m_stream(&stream), m_dimensions(0,0),m_allocator(allocator),m_reallocator(reallocator),m_deallocator(deallocator) {
     if(initialize) {
         this->initialize();
     }
@@ -51,7 +51,7 @@ png_image::png_image(stream& stream, bool initialize) : m_stream(&stream), m_dim
 png_image::~png_image() {
     deinitialize();
 }
-png_image::png_image(png_image&& rhs) : m_stream(rhs.m_stream),m_dimensions(rhs.m_dimensions) {
+png_image::png_image(png_image&& rhs) : m_stream(rhs.m_stream),m_dimensions(rhs.m_dimensions),m_allocator(rhs.m_allocator),m_reallocator(rhs.m_reallocator),m_deallocator(rhs.m_deallocator) {
     rhs.m_stream = nullptr;
     rhs.m_dimensions = {0,0};
 }
@@ -59,6 +59,9 @@ png_image& png_image::operator=(png_image&& rhs) {
     this->deinitialize();
     m_stream=rhs.m_stream;
     m_dimensions=rhs.m_dimensions;
+    m_allocator=rhs.m_allocator;
+    m_reallocator=rhs.m_reallocator;
+    m_deallocator=rhs.m_deallocator;
     rhs.m_stream = nullptr;
     rhs.m_dimensions = {0,0};
     return *this;
@@ -70,6 +73,9 @@ gfx_result png_image::initialize() {
     if(m_stream==nullptr) {
         return gfx_result::invalid_state;
     }
+    if(m_allocator==nullptr || m_reallocator==nullptr || m_deallocator==nullptr) {
+        return gfx_result::invalid_argument;
+    }
     if(!m_stream->caps().read || !m_stream->caps().seek) {
         return gfx_result::invalid_argument;
     }
@@ -130,7 +136,7 @@ gfx_result png_image::draw(const rect16& bounds, image_draw_callback callback, v
     if(m_stream->caps().seek) {
         m_stream->seek(0);
     }
-    pngle_t* p = pngle_new();
+    pngle_t* p = pngle_new_ex(m_allocator,m_deallocator);
     uint8_t buf[256];
     if(p==nullptr) {
         return gfx_result::out_of_memory;
@@ -157,6 +163,7 @@ gfx_result png_image::draw(const rect16& bounds, image_draw_callback callback, v
             pngle_destroy(p);
             return r;
         } else if(ustate.error!=gfx_result::success) {
+            pngle_destroy(p);
             return ustate.error;
         }
         remain = remain + len - fed;
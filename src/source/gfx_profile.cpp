@@ -0,0 +1,21 @@
+#include "gfx_profile.hpp"
+namespace gfx {
+namespace helpers {
+#ifdef HTCW_GFX_THREADS
+static thread_local const char* profile_scope_name = nullptr;
+#else
+static const char* profile_scope_name = nullptr;
+#endif
+profile_scope::profile_scope(const char* name) : m_previous(profile_scope_name) {
+    if (profile_scope_name == nullptr) {
+        profile_scope_name = name;
+    }
+}
+profile_scope::~profile_scope() {
+    profile_scope_name = m_previous;
+}
+const char* profile_scope::current() {
+    return profile_scope_name;
+}
+}  // namespace helpers
+}  // namespace gfx
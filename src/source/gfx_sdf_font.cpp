@@ -0,0 +1,357 @@
+#include <gfx_sdf_font.hpp>
+#include <math.h>
+namespace gfx {
+// the field value at the glyph edge
+static const uint8_t sdf_font_on_edge = 128;
+
+int sdf_font::hash_function(const int32_t& key) {
+    return (int)(key+5);
+}
+void sdf_font::set_size() {
+    m_ratio = m_source->scale(m_size,m_units)/m_source->scale();
+    m_line_height = (uint16_t)floorf(m_source->line_height()*m_ratio+.5f);
+    m_line_advance = (uint16_t)floorf(m_source->line_advance()*m_ratio+.5f);
+    m_base_line = (uint16_t)floorf(m_source->base_line()*m_ratio+.5f);
+}
+void sdf_font::expire_memory(size_t new_data_size) const {
+    while(m_cache.size() && (m_memory_size+new_data_size)>m_max_memory_size) {
+        int min = -1;
+        size_t sz = 0;
+        uint8_t* data = nullptr;
+        map_t::key_type k;
+        for(size_t i = 0;i<m_cache.size();++i) {
+            map_t::value_type& v = *m_cache.at(i);
+            if(min==-1 || v.value.accessed<min) {
+                min = v.value.accessed;
+                k=v.key;
+                sz = v.value.dimensions.width*v.value.dimensions.height + sizeof(cache_entry_t)+sizeof(int32_t);
+                data = v.value.data;
+            }
+        }
+        if(min==-1) {
+            break;
+        }
+        m_memory_size-=sz;
+        if(data!=nullptr) {
+            m_deallocator(data);
+        }
+        m_cache.remove(k);
+    }
+    if(!m_cache.size()) {
+        m_accessed=-1;
+    }
+}
+gfx_result sdf_font::field(int32_t codepoint, const cache_entry_t** out_entry) const {
+    cache_entry_t* entry = m_cache.find(codepoint);
+    if(entry!=nullptr) {
+        entry->accessed = ++m_accessed;
+        *out_entry = entry;
+        return gfx_result::success;
+    }
+    const font& src = *m_source;
+    font_glyph_info gi;
+    gfx_result res = src.measure_glyph(codepoint,0,&gi);
+    if(res!=gfx_result::success) {
+        return res;
+    }
+    cache_entry_t e;
+    e.offset.x = gi.offset.x-m_padding;
+    e.offset.y = gi.offset.y-m_padding;
+    e.dimensions.width = gi.dimensions.width+2*m_padding;
+    e.dimensions.height = gi.dimensions.height+2*m_padding;
+    e.data = nullptr;
+    const int gw = gi.dimensions.width, gh = gi.dimensions.height;
+    if(gw>0 && gh>0) {
+        uint8_t* cov = (uint8_t*)m_allocator(gw*gh);
+        if(cov==nullptr) {
+            return gfx_result::out_of_memory;
+        }
+        memset(cov,0,gw*gh);
+        bitmap<alpha_pixel<8>> bmp(gi.dimensions,cov);
+        res = src.draw_glyph(bmp,codepoint,gi.glyph_index1);
+        if(res!=gfx_result::success) {
+            m_deallocator(cov);
+            return res;
+        }
+        e.data = (uint8_t*)m_allocator(e.dimensions.width*e.dimensions.height);
+        if(e.data==nullptr) {
+            m_deallocator(cov);
+            return gfx_result::out_of_memory;
+        }
+        // each partially covered pixel locates the edge at (coverage-0.5) pixels
+        // from its center. the distance of a field pixel is the smallest distance
+        // to such an edge estimate within the padding.
+        const int p = m_padding;
+        const float pmax = (float)p;
+        const float k = ((float)sdf_font_on_edge)/p;
+        uint8_t* out = e.data;
+        for(int fy = 0;fy<e.dimensions.height;++fy) {
+            const int y = fy-p;
+            for(int fx = 0;fx<e.dimensions.width;++fx) {
+                const int x = fx-p;
+                const bool in_glyph = x>=0 && y>=0 && x<gw && y<gh;
+                const float a = in_glyph?cov[y*gw+x]/255.0f:0.0f;
+                const bool inside = a>=.5f;
+                float d = pmax;
+                if(a>0.0f && a<1.0f) {
+                    d = inside?a-.5f:.5f-a;
+                }
+                for(int qy = y-p;qy<=y+p;++qy) {
+                    const int dy = qy-y;
+                    const bool row_in = qy>=0 && qy<gh;
+                    for(int qx = x-p;qx<=x+p;++qx) {
+                        // the area around the rendered glyph is uncovered
+                        const float qa = (row_in && qx>=0 && qx<gw)?cov[qy*gw+qx]/255.0f:0.0f;
+                        if((qa>=.5f)==inside) {
+                            continue;
+                        }
+                        const int dx = qx-x;
+                        const float dq = sqrtf((float)(dx*dx+dy*dy))-(inside?.5f-qa:qa-.5f);
+                        if(dq<d) {
+                            d = dq;
+                        }
+                    }
+                }
+                if(d<0.0f) {
+                    d = 0.0f;
+                }
+                const float v = sdf_font_on_edge+(inside?d:-d)*k;
+                *out++ = v<=0.0f?0:(v>=255.0f?255:(uint8_t)(v+.5f));
+            }
+        }
+        m_deallocator(cov);
+    }
+    size_t sz = e.dimensions.width*e.dimensions.height + sizeof(cache_entry_t)+sizeof(int32_t);
+    if(m_max_memory_size>0) {
+        expire_memory(sz);
+    }
+    e.accessed = ++m_accessed;
+    if(!m_cache.insert({codepoint,e})) {
+        if(e.data!=nullptr) {
+            m_deallocator(e.data);
+        }
+        return gfx_result::out_of_memory;
+    }
+    m_memory_size+=sz;
+    *out_entry = m_cache.find(codepoint);
+    return gfx_result::success;
+}
+sdf_font::sdf_font(tt_font& source, float size, font_size_units units, uint8_t padding, void*(allocator)(size_t), void*(reallocator)(void*,size_t), void(deallocator)(void*)) :
+                                m_source(&source),
+                                m_size(size),
+                                m_units(units),
+                                m_ratio(NAN),
+                                m_padding(padding),
+                                m_line_height(0),
+                                m_line_advance(0),
+                                m_base_line(0),
+                                m_allocator(allocator),
+                                m_reallocator(reallocator),
+                                m_deallocator(deallocator),
+                                m_accessed(-1),
+                                m_cache(hash_function,allocator,reallocator,deallocator),
+                                m_memory_size(0),
+                                m_max_memory_size(0) {
+}
+sdf_font::sdf_font(void*(allocator)(size_t), void*(reallocator)(void*,size_t), void(deallocator)(void*)) :
+                                m_source(nullptr),
+                                m_size(0),
+                                m_units(font_size_units::em),
+                                m_ratio(NAN),
+                                m_padding(4),
+                                m_line_height(0),
+                                m_line_advance(0),
+                                m_base_line(0),
+                                m_allocator(allocator),
+                                m_reallocator(reallocator),
+                                m_deallocator(deallocator),
+                                m_accessed(-1),
+                                m_cache(hash_function,allocator,reallocator,deallocator),
+                                m_memory_size(0),
+                                m_max_memory_size(0) {
+}
+sdf_font::~sdf_font() {
+    deinitialize();
+}
+sdf_font::sdf_font(sdf_font&& rhs) : m_source(rhs.m_source),
+                                m_size(rhs.m_size),
+                                m_units(rhs.m_units),
+                                m_ratio(rhs.m_ratio),
+                                m_padding(rhs.m_padding),
+                                m_line_height(rhs.m_line_height),
+                                m_line_advance(rhs.m_line_advance),
+                                m_base_line(rhs.m_base_line),
+                                m_allocator(rhs.m_allocator),
+                                m_reallocator(rhs.m_reallocator),
+                                m_deallocator(rhs.m_deallocator),
+                                m_accessed(rhs.m_accessed),
+                                m_cache(helpers::gfx_move(rhs.m_cache)),
+                                m_memory_size(rhs.m_memory_size),
+                                m_max_memory_size(rhs.m_max_memory_size) {
+    // the cached fields belong to us now
+    rhs.m_source = nullptr;
+    rhs.m_ratio = NAN;
+}
+sdf_font& sdf_font::operator=(sdf_font&& rhs) {
+    deinitialize();
+    m_source=rhs.m_source;
+    m_size=rhs.m_size;
+    m_units=rhs.m_units;
+    m_ratio=rhs.m_ratio;
+    m_padding=rhs.m_padding;
+    m_line_height=rhs.m_line_height;
+    m_line_advance=rhs.m_line_advance;
+    m_base_line=rhs.m_base_line;
+    m_allocator=rhs.m_allocator;
+    m_reallocator=rhs.m_reallocator;
+    m_deallocator=rhs.m_deallocator;
+    m_accessed=rhs.m_accessed;
+    m_cache=helpers::gfx_move(rhs.m_cache);
+    m_memory_size=rhs.m_memory_size;
+    m_max_memory_size=rhs.m_max_memory_size;
+    rhs.m_source = nullptr;
+    rhs.m_ratio = NAN;
+    return *this;
+}
+void sdf_font::size(float size, font_size_units units) {
+    m_size = size;
+    m_units = units;
+    if(!initialized()) {
+        return;
+    }
+    set_size();
+}
+float sdf_font::size() const {
+    return m_size;
+}
+size_t sdf_font::max_memory_size() const {
+    return m_max_memory_size;
+}
+void sdf_font::max_memory_size(size_t value) {
+    m_max_memory_size = value;
+    if(value>0 && m_memory_size>value) {
+        expire_memory(0);
+    }
+}
+size_t sdf_font::memory_size() const {
+    return m_memory_size;
+}
+void sdf_font::clear() {
+    if(m_source!=nullptr) {
+        for(size_t i = 0;i<m_cache.size();++i) {
+            uint8_t* p = m_cache.at(i)->value.data;
+            if(p!=nullptr) {
+                m_deallocator(p);
+            }
+        }
+        m_cache.clear();
+    }
+    m_accessed=-1;
+    m_memory_size=0;
+}
+gfx_result sdf_font::initialize() {
+    if(initialized()) {
+        return gfx_result::success;
+    }
+    if(m_source==nullptr || m_padding==0 || m_size!=m_size || 0.0f>=m_size) {
+        return gfx_result::invalid_argument;
+    }
+    if(!m_source->initialized()) {
+        return gfx_result::invalid_state;
+    }
+    set_size();
+    return gfx_result::success;
+}
+bool sdf_font::initialized() const {
+    return m_ratio==m_ratio;
+}
+void sdf_font::deinitialize() {
+    clear();
+    m_ratio = NAN;
+}
+uint16_t sdf_font::line_height() const {
+    return m_line_height;
+}
+uint16_t sdf_font::line_advance() const {
+    return m_line_advance;
+}
+uint16_t sdf_font::base_line() const {
+    return m_base_line;
+}
+gfx_result sdf_font::on_measure(int32_t codepoint1, int32_t codepoint2, font_glyph_info* out_glyph_info) const {
+    if(!initialized()) {
+        return gfx_result::invalid_state;
+    }
+    font_glyph_info gi;
+    const font& src = *m_source;
+    gfx_result res = src.measure_glyph(codepoint1,codepoint2,&gi);
+    if(res!=gfx_result::success) {
+        return res;
+    }
+    // the field box is the glyph box at the reference size, padded on each side
+    const float fx = gi.offset.x-m_padding;
+    const float fy = gi.offset.y-m_padding;
+    const float fw = gi.dimensions.width+2*m_padding;
+    const float fh = gi.dimensions.height+2*m_padding;
+    const int x0 = (int)floorf(fx*m_ratio);
+    const int y0 = (int)floorf(fy*m_ratio);
+    const int x1 = (int)ceilf((fx+fw)*m_ratio);
+    const int y1 = (int)ceilf((fy+fh)*m_ratio);
+    out_glyph_info->glyph_index1 = gi.glyph_index1;
+    out_glyph_info->glyph_index2 = gi.glyph_index2;
+    out_glyph_info->offset.x = x0;
+    out_glyph_info->offset.y = y0;
+    out_glyph_info->dimensions.width = x1-x0;
+    out_glyph_info->dimensions.height = y1-y0;
+    out_glyph_info->advance_width = (int16_t)floorf(gi.advance_width*m_ratio+.5f);
+    return gfx_result::success;
+}
+gfx_result sdf_font::on_draw(bitmap<alpha_pixel<8>>& destination, int32_t codepoint, int32_t glyph_index) const {
+    // the field is looked up by codepoint
+    (void)glyph_index;
+    if(!initialized()) {
+        return gfx_result::invalid_state;
+    }
+    const cache_entry_t* e;
+    gfx_result res = field(codepoint,&e);
+    if(res!=gfx_result::success) {
+        return res;
+    }
+    const size16 ddim = destination.dimensions();
+    uint8_t* dst = destination.begin();
+    if(e->data==nullptr) {
+        memset(dst,0,ddim.width*ddim.height);
+        return gfx_result::success;
+    }
+    const int fw = e->dimensions.width, fh = e->dimensions.height;
+    const float inv = 1.0f/m_ratio;
+    // coverage = 0.5 + the signed distance in destination pixels, ramped to 0-255
+    const float cov_scale = (m_ratio*m_padding/sdf_font_on_edge)*255.0f;
+    const float cov_bias = 127.5f-sdf_font_on_edge*cov_scale;
+    const float x0 = floorf(e->offset.x*m_ratio);
+    const float y0 = floorf(e->offset.y*m_ratio);
+    for(int y = 0;y<ddim.height;++y) {
+        const float sy = (y0+y+.5f)*inv-e->offset.y-.5f;
+        const int iy = (int)floorf(sy);
+        const float ty = sy-iy;
+        const uint8_t* row0 = (iy>=0 && iy<fh)?e->data+iy*fw:nullptr;
+        const uint8_t* row1 = (iy+1>=0 && iy+1<fh)?e->data+(iy+1)*fw:nullptr;
+        uint8_t* out = dst+y*ddim.width;
+        for(int x = 0;x<ddim.width;++x) {
+            const float sx = (x0+x+.5f)*inv-e->offset.x-.5f;
+            const int ix = (int)floorf(sx);
+            const float tx = sx-ix;
+            // samples outside of the field are fully outside the glyph
+            const float v00 = (row0!=nullptr && ix>=0 && ix<fw)?row0[ix]:0;
+            const float v01 = (row0!=nullptr && ix+1>=0 && ix+1<fw)?row0[ix+1]:0;
+            const float v10 = (row1!=nullptr && ix>=0 && ix<fw)?row1[ix]:0;
+            const float v11 = (row1!=nullptr && ix+1>=0 && ix+1<fw)?row1[ix+1]:0;
+            const float top = v00+(v01-v00)*tx;
+            const float bottom = v10+(v11-v10)*tx;
+            const float c = (top+(bottom-top)*ty)*cov_scale+cov_bias;
+            *out++ = c<=0.f?0:(c>=255.f?255:(uint8_t)c);
+        }
+    }
+    return gfx_result::success;
+}
+}  // namespace gfx
@@ -1,7 +1,10 @@
 #include <string.h>
+#include <new>
 #include <gfx_canvas.hpp>
 #include <gfx_math.hpp>
 #include <ml_reader.hpp>
+#include <gfx_trace.hpp>
+#include "plutovg.h"
 
 using namespace gfx;
 using namespace ml;
@@ -409,6 +412,13 @@ struct svg_context {
     bool in_path;
     bool in_defs;
     int tag_id;
+    // the destination's clip, used to skip elements that can't be seen
+    ::gfx::rectf clip;
+    // when set, paths are handed to this instead of being drawn
+    gfx_result(*record)(void* state, const canvas_path& path, const canvas_style& style, const matrix& transform);
+    // when set along with record, called at the start and end of each group
+    gfx_result(*record_group)(void* state, bool begin);
+    void* record_state;
     void*(*allocator)(size_t);
     void*(*reallocator)(void*,size_t);
     void(*deallocator)(void*);
@@ -451,6 +461,10 @@ static void svg_init_context(svg_context& ctx) {
     ctx.in_defs = false;
     ctx.in_path = false;
     ctx.tag_id = 0;
+    ctx.clip = {0,0,-1,-1};
+    ctx.record = nullptr;
+    ctx.record_group = nullptr;
+    ctx.record_state = nullptr;
     ctx.align_scale = view_scale_meet;
     ctx.align_type = view_align_x_mid_y_mid;
     ctx.grad_head = nullptr;
@@ -3183,7 +3197,6 @@ static void svg_apply_css(svg_attrib* attr,svg_css_data* css ) {
 static result_t svg_apply_attribute(svg_context& ctx, const rectf& local_bounds, canvas_style* out_style) {
     result_t res = SUCCESS;
     svg_attrib& a = svg_get_attr(ctx);
-    svg_apply_css(&a,ctx.css_current);
     out_style->fill_color =  a.fillColor;
     out_style->fill_gradient.stops = nullptr;
     out_style->fill_gradient.stops_size = 0;
@@ -4227,14 +4240,66 @@ error:
     
     return res;
 }
+// how far past its control points a stroke can reach
+static float svg_stroke_extent(float width, line_join join, float miter_limit, line_cap cap) {
+    float factor = 1.f;
+    if(join==line_join::miter && miter_limit>factor) {
+        factor = miter_limit;
+    }
+    if(cap==line_cap::square && factor<1.4142136f) {
+        factor = 1.4142136f;
+    }
+    return width*.5f*factor;
+}
+// the axis aligned bounds of a rectangle under a transform
+static rectf svg_map_bounds(const rectf& bounds, const matrix& transform) {
+    pointf pts[4];
+    transform.map(bounds.x1,bounds.y1,&pts[0].x,&pts[0].y);
+    transform.map(bounds.x2,bounds.y1,&pts[1].x,&pts[1].y);
+    transform.map(bounds.x2,bounds.y2,&pts[2].x,&pts[2].y);
+    transform.map(bounds.x1,bounds.y2,&pts[3].x,&pts[3].y);
+    rectf result(pts[0].x,pts[0].y,pts[0].x,pts[0].y);
+    for(int i = 1;i<4;++i) {
+        result.x1 = math::min_(result.x1,pts[i].x);
+        result.y1 = math::min_(result.y1,pts[i].y);
+        result.x2 = math::max_(result.x2,pts[i].x);
+        result.y2 = math::max_(result.y2,pts[i].y);
+    }
+    return result;
+}
+// indicates whether anything inside bounds can touch a pixel of the (inclusive) clip
+// once transformed. a pixel of slack covers antialiasing.
+static bool svg_bounds_visible(const rectf& bounds, const matrix& transform, const rectf& clip) {
+    rectf b = svg_map_bounds(bounds,transform);
+    return b.x1-1<=clip.x2+1 && b.x2+1>=clip.x1 && b.y1-1<=clip.y2+1 && b.y2+1>=clip.y1;
+}
 static result_t svg_draw_path(svg_context& ctx,const canvas_path& path) {
     result_t res;
     canvas_style s;
+    svg_attrib& a = svg_get_attr(ctx);
+    svg_apply_css(&a,ctx.css_current);
+    if(ctx.record==nullptr) {
+        // cull against the clip before resolving the style or rasterizing
+        if(a.hasFill==0 && a.hasStroke==0) {
+            return SUCCESS;
+        }
+        rectf bounds = path.bounds();
+        if(a.hasStroke!=0) {
+            float e = svg_stroke_extent(a.strokeWidth,a.strokeLineJoin,a.miterLimit,a.strokeLineCap);
+            bounds = rectf(bounds.x1-e,bounds.y1-e,bounds.x2+e,bounds.y2+e);
+        }
+        if(!svg_bounds_visible(bounds,a.xform*ctx.xform,ctx.clip)) {
+            return SUCCESS;
+        }
+    }
     res = svg_apply_attribute(ctx, path.bounds(true), &s);
     if(res!=gfx_result::success) {
         return res;
     }
-    svg_attrib& a = svg_get_attr(ctx);
+    if(ctx.record!=nullptr) {
+        res = ctx.record(ctx.record_state,path,s,a.xform);
+        goto error;
+    }
     ctx.cvs->transform(a.xform * ctx.xform);
     ctx.cvs->style(s);
     res=ctx.cvs->path(path);
@@ -4264,10 +4329,33 @@ static result_t svg_skip_to_end_elem(svg_context& ctx) {
     }
     return SUCCESS;
 }
+#ifdef HTCW_GFX_TRACE
+// trace event names need to outlive the reader's buffer
+static const char* svg_trace_element_name(int id) {
+    switch(id) {
+        case TAG_CIRCLE: return "circle";
+        case TAG_DEFS: return "defs";
+        case TAG_ELLIPSE: return "ellipse";
+        case TAG_G: return "g";
+        case TAG_LINE: return "line";
+        case TAG_LINEAR_GRADIENT: return "linearGradient";
+        case TAG_PATH: return "path";
+        case TAG_POLYGON: return "polygon";
+        case TAG_POLYLINE: return "polyline";
+        case TAG_RADIAL_GRADIENT: return "radialGradient";
+        case TAG_RECT: return "rect";
+        case TAG_STOP: return "stop";
+        case TAG_STYLE: return "style";
+        case TAG_SVG: return "svg";
+        default: return "element";
+    }
+}
+#endif
 static result_t svg_parse_start_element(svg_context& ctx) {
     result_t res = SUCCESS;
     int id = svg_elementid(ctx.rdr.value());
     ctx.tag_id = id;
+    HTCW_GFX_TRACE_SCOPE("svg", svg_trace_element_name(id));
     if (ctx.in_defs) {
         switch (id) {
             case TAG_STYLE:
@@ -4330,6 +4418,12 @@ static result_t svg_parse_start_element(svg_context& ctx) {
             if (!SUCCEEDED(res)) {
                 return res;
             }
+            if(ctx.record_group!=nullptr) {
+                res = ctx.record_group(ctx.record_state,true);
+                if (!SUCCEEDED(res)) {
+                    return res;
+                }
+            }
             break;
         case TAG_PATH:
             if (ctx.in_path) {
@@ -4443,6 +4537,14 @@ static result_t svg_parse_end_element(svg_context& ctx) {
     }
     switch (ctx.tag_id) {
         case TAG_G:
+            if(ctx.record_group!=nullptr && !ctx.in_defs) {
+                result_t res = ctx.record_group(ctx.record_state,false);
+                if (!SUCCEEDED(res)) {
+                    return res;
+                }
+            }
+            svg_pop_attr(ctx);
+            break;
         case TAG_STYLE:
         //case TAG_LINEAR_GRADIENT:
         //case TAG_RADIAL_GRADIENT:
@@ -4601,48 +4703,29 @@ static result_t svg_document_dimensions(stream& stream, sizef* out_dimensions, f
     return res;
     
 }
-static result_t svg_render_document(stream& stream, canvas& destination, const matrix& transform, float dpi,void*(*allocator)(size_t),void*(*reallocator)(void*,size_t),void(*deallocator)(void*)) {
-    if(stream.caps().read==0) {
-        return INVALID_ARG;
-    }
-    svg_context* pctx= new svg_context();
-    if(pctx==nullptr) {
-        return OUT_OF_MEMORY;
-    }
-    svg_init_context(*pctx);
-    result_t res=SUCCESS;
-    rectf vr;
-    pctx->dpi = dpi;
-    pctx->cvs    = &destination;
-    pctx->xform = transform;
-    pctx->allocator = allocator;
-    pctx->reallocator = reallocator;
-    pctx->deallocator = deallocator;
-    pctx->rdr.set(stream);
-    matrix init_xfrm = destination.transform();
-    canvas_style init_style = destination.style();
-    bool done = !pctx->rdr.read();
+static result_t svg_parse_document(svg_context& ctx) {
+    result_t res = SUCCESS;
+    bool done = !ctx.rdr.read();
     while (!done) {
-        ml::ml_node_type nt = pctx->rdr.node_type();
+        ml::ml_node_type nt = ctx.rdr.node_type();
         switch (nt) {
             case ::ml::ml_node_type::element:
-                res = svg_parse_start_element(*pctx);
+                res = svg_parse_start_element(ctx);
                 if (!SUCCEEDED(res)) {
-                    goto error;
+                    return res;
                 }
                 break;
             case ::ml::ml_node_type::element_end:
-                res = svg_parse_end_element(*pctx);
+                res = svg_parse_end_element(ctx);
                 if (!SUCCEEDED(res)) {
-                    goto error;
+                    return res;
                 }
-                nt = pctx->rdr.node_type();
+                nt = ctx.rdr.node_type();
                 if (nt == ::ml::ml_node_type::element_end &&
-            (done=!pctx->rdr.read())) {
-                    res=IO_ERROR;
-                    goto error;
+            (done=!ctx.rdr.read())) {
+                    return IO_ERROR;
                 }
-                nt = pctx->rdr.node_type();
+                nt = ctx.rdr.node_type();
                 break;
             case ::ml::ml_node_type::eof:
                 done = true;
@@ -4652,18 +4735,41 @@ static result_t svg_render_document(stream& stream, canvas& destination, const m
             case ::ml::ml_node_type::error_eref:
             case ::ml::ml_node_type::error_overflow:
             case ::ml::ml_node_type::error_syntax:
-                goto error;
+                return res;
             default:
-                done = !pctx->rdr.read();
+                done = !ctx.rdr.read();
                 break;
         }
     }
-    
-error:
-    if(pctx!=nullptr) {
-        svg_delete_context(*pctx);
-        delete pctx;
+    return res;
+}
+static result_t svg_render_document(stream& stream, canvas& destination, const matrix& transform, float dpi,void*(*allocator)(size_t),void*(*reallocator)(void*,size_t),void(*deallocator)(void*)) {
+    HTCW_GFX_TRACE_SCOPE("svg", "render_document");
+    if(stream.caps().read==0) {
+        return INVALID_ARG;
+    }
+    // the context is large, so it comes from the heap the caller chose rather than the stack
+    void* mem = allocator(sizeof(svg_context));
+    if(mem==nullptr) {
+        return OUT_OF_MEMORY;
     }
+    svg_context* pctx= new(mem) svg_context();
+    svg_init_context(*pctx);
+    result_t res=SUCCESS;
+    pctx->dpi = dpi;
+    pctx->cvs    = &destination;
+    pctx->xform = transform;
+    pctx->allocator = allocator;
+    pctx->reallocator = reallocator;
+    pctx->deallocator = deallocator;
+    pctx->rdr.set(stream);
+    pctx->clip = destination.clip_bounds();
+    matrix init_xfrm = destination.transform();
+    canvas_style init_style = destination.style();
+    res = svg_parse_document(*pctx);
+    svg_delete_context(*pctx);
+    pctx->~svg_context();
+    deallocator(pctx);
     destination.transform(init_xfrm);
     destination.style(init_style);
     return res;
@@ -4682,4 +4788,1040 @@ gfx_result canvas::render_svg(stream& document, const matrix& transform, float d
 }
 gfx_result canvas::svg_dimensions(stream& document, sizef* out_dimensions,float dpi) {
     return svg_document_dimensions(document,out_dimensions,dpi);
-}
\ No newline at end of file
+}
+// svg_document display list layout. Every field is a 32-bit word so that a
+// list written on a host of the other byte order can be fixed up word by word.
+// header:
+//  magic:u32 ('SVGD'), version:u32, size_in_bytes:u32, record_count:u32,
+//  width:f32, height:f32, view_transform:f32[6], flags:u32
+// record:
+//  record_words:u32, bounds:f32[4], transform:f32[6],
+//  fill_paint:u8|stroke_paint:u8|fill_rule:u8|line_cap:u8 (u32), line_join:u32,
+//  fill_opacity:f32, stroke_opacity:f32, stroke_width:f32, miter_limit:f32,
+//  font_size:f32, fill_color:u32, stroke_color:u32,
+//  dash_offset:f32, dash_count:u32, dash_values:f32[dash_count],
+//  fill gradient (if fill_paint is gradient), stroke gradient (if stroke_paint is gradient):
+//   type:u8|spread:u8 (u32), transform:f32[6], params:f32[6], stop_count:u32,
+//   stops:{offset:f32, color:u32}[stop_count]
+//  path_element_count:u32, path elements (plutovg_path_element_t, 2 words each)
+// group (precedes the records of a <g> element, not counted in record_count):
+//  group_words:u32 (with svg_doc_group_flag), record_count:u32, bounds:f32[4]
+// bounds are x1,y1,x2,y2 after the record transform, and include the stroke,
+// so whole records or groups outside the clip can be skipped.
+static const uint32_t svg_doc_magic = 0x44475653;
+static const uint32_t svg_doc_version = 2;
+static const size_t svg_doc_header_words = 13;
+// the words of a record without dashes, gradients or path elements
+static const size_t svg_doc_record_words = 23;
+static const size_t svg_doc_group_words = 6;
+static const uint32_t svg_doc_group_flag = 0x80000000;
+// nesting deeper than this is flattened into the enclosing group
+static const size_t svg_doc_max_groups = 16;
+// the user transform is applied before the view transform (preserveAspectRatio="none")
+static const uint32_t svg_doc_flag_user_first = 1;
+static_assert(sizeof(gradient_stop)==8,"gradient_stop must be two words");
+static_assert(sizeof(plutovg_path_element_t)==8,"path elements must be two words");
+
+struct svg_doc_builder {
+    uint8_t* data;
+    size_t size;
+    size_t capacity;
+    uint32_t count;
+    // the open groups
+    size_t group_offsets[svg_doc_max_groups];
+    uint32_t group_counts[svg_doc_max_groups];
+    rectf group_bounds[svg_doc_max_groups];
+    size_t groups;
+    // open groups past svg_doc_max_groups
+    size_t groups_untracked;
+    void*(*allocator)(size_t);
+    void*(*reallocator)(void*,size_t);
+};
+struct svg_doc_record {
+    rectf bounds;
+    matrix transform;
+    canvas_style style;
+    const plutovg_path_element_t* elements;
+    size_t elements_size;
+};
+static inline uint32_t svg_doc_u32(const uint8_t* p) {
+    uint32_t result;
+    memcpy(&result,p,4);
+    return result;
+}
+static inline float svg_doc_f32(const uint8_t* p) {
+    float result;
+    memcpy(&result,p,4);
+    return result;
+}
+static inline uint8_t* svg_doc_put32(uint8_t* p, uint32_t value) {
+    memcpy(p,&value,4);
+    return p+4;
+}
+static inline uint8_t* svg_doc_putf(uint8_t* p, float value) {
+    memcpy(p,&value,4);
+    return p+4;
+}
+static inline uint8_t* svg_doc_put_matrix(uint8_t* p, const matrix& value) {
+    p=svg_doc_putf(p,value.a);
+    p=svg_doc_putf(p,value.b);
+    p=svg_doc_putf(p,value.c);
+    p=svg_doc_putf(p,value.d);
+    p=svg_doc_putf(p,value.e);
+    return svg_doc_putf(p,value.f);
+}
+static inline matrix svg_doc_matrix(const uint8_t* p) {
+    return matrix(svg_doc_f32(p),svg_doc_f32(p+4),svg_doc_f32(p+8),svg_doc_f32(p+12),svg_doc_f32(p+16),svg_doc_f32(p+20));
+}
+static inline uint8_t* svg_doc_put_bounds(uint8_t* p, const rectf& value) {
+    p=svg_doc_putf(p,value.x1);
+    p=svg_doc_putf(p,value.y1);
+    p=svg_doc_putf(p,value.x2);
+    return svg_doc_putf(p,value.y2);
+}
+static inline rectf svg_doc_bounds(const uint8_t* p) {
+    return rectf(svg_doc_f32(p),svg_doc_f32(p+4),svg_doc_f32(p+8),svg_doc_f32(p+12));
+}
+static inline rectf svg_doc_union(const rectf& lhs, const rectf& rhs) {
+    return rectf(math::min_(lhs.x1,rhs.x1),math::min_(lhs.y1,rhs.y1),math::max_(lhs.x2,rhs.x2),math::max_(lhs.y2,rhs.y2));
+}
+static size_t svg_doc_gradient_words(const gradient& value) {
+    return 14+value.stops_size*2;
+}
+static uint8_t* svg_doc_put_gradient(uint8_t* p, const gradient& value) {
+    p=svg_doc_put32(p,uint32_t(value.type)|(uint32_t(value.spread)<<8));
+    p=svg_doc_put_matrix(p,value.transform);
+    if(value.type==gradient_type::linear) {
+        p=svg_doc_putf(p,value.linear.x1);
+        p=svg_doc_putf(p,value.linear.y1);
+        p=svg_doc_putf(p,value.linear.x2);
+        p=svg_doc_putf(p,value.linear.y2);
+        p=svg_doc_putf(p,0);
+        p=svg_doc_putf(p,0);
+    } else {
+        p=svg_doc_putf(p,value.radial.cx);
+        p=svg_doc_putf(p,value.radial.cy);
+        p=svg_doc_putf(p,value.radial.fx);
+        p=svg_doc_putf(p,value.radial.fy);
+        p=svg_doc_putf(p,value.radial.cr);
+        p=svg_doc_putf(p,value.radial.fr);
+    }
+    p=svg_doc_put32(p,(uint32_t)value.stops_size);
+    for(size_t i = 0;i<value.stops_size;++i) {
+        p=svg_doc_putf(p,value.stops[i].offset);
+        p=svg_doc_put32(p,value.stops[i].color.native_value);
+    }
+    return p;
+}
+// decodes a gradient in place. the stops point into the display list.
+static bool svg_doc_gradient(const uint8_t** current, const uint8_t* end, gradient* out_gradient) {
+    const uint8_t* p = *current;
+    if(end-p<14*4) {
+        return false;
+    }
+    uint32_t type = svg_doc_u32(p);
+    if((type&0xFF)>1 || ((type>>8)&0xFF)>2) {
+        return false;
+    }
+    out_gradient->type = (gradient_type)(type&0xFF);
+    out_gradient->spread = (spread_method)((type>>8)&0xFF);
+    out_gradient->transform = svg_doc_matrix(p+4);
+    p+=28;
+    if(out_gradient->type==gradient_type::linear) {
+        out_gradient->linear.x1 = svg_doc_f32(p);
+        out_gradient->linear.y1 = svg_doc_f32(p+4);
+        out_gradient->linear.x2 = svg_doc_f32(p+8);
+        out_gradient->linear.y2 = svg_doc_f32(p+12);
+    } else {
+        out_gradient->radial.cx = svg_doc_f32(p);
+        out_gradient->radial.cy = svg_doc_f32(p+4);
+        out_gradient->radial.fx = svg_doc_f32(p+8);
+        out_gradient->radial.fy = svg_doc_f32(p+12);
+        out_gradient->radial.cr = svg_doc_f32(p+16);
+        out_gradient->radial.fr = svg_doc_f32(p+20);
+    }
+    p+=24;
+    size_t stops = svg_doc_u32(p);
+    p+=4;
+    if(size_t(end-p)/8<stops) {
+        return false;
+    }
+    out_gradient->stops = stops?(gradient_stop*)p:nullptr;
+    out_gradient->stops_size = stops;
+    *current = p+stops*8;
+    return true;
+}
+// reads the group header at *current if there is one, advancing to its first record
+static bool svg_doc_read_group(const uint8_t** current, const uint8_t* end, uint32_t* out_count, rectf* out_bounds, const uint8_t** out_group_end) {
+    const uint8_t* p = *current;
+    if(size_t(end-p)<svg_doc_group_words*4) {
+        return false;
+    }
+    uint32_t words = svg_doc_u32(p);
+    if(0==(words&svg_doc_group_flag)) {
+        return false;
+    }
+    words&=~svg_doc_group_flag;
+    if(words<svg_doc_group_words || size_t(end-p)/4<words) {
+        return false;
+    }
+    *out_count = svg_doc_u32(p+4);
+    *out_bounds = svg_doc_bounds(p+8);
+    *out_group_end = p+words*4;
+    *current = p+svg_doc_group_words*4;
+    return true;
+}
+// decodes and validates the record at *current, advancing past it. group headers before it are skipped.
+static bool svg_doc_read_record(const uint8_t** current, const uint8_t* end, svg_doc_record* out_record) {
+    const uint8_t* p = *current;
+    while(size_t(end-p)>=svg_doc_group_words*4 && 0!=(svg_doc_u32(p)&svg_doc_group_flag)) {
+        p+=svg_doc_group_words*4;
+    }
+    if(size_t(end-p)<svg_doc_record_words*4) {
+        return false;
+    }
+    size_t words = svg_doc_u32(p);
+    if(words<svg_doc_record_words || size_t(end-p)/4<words) {
+        return false;
+    }
+    const uint8_t* rec_end = p+words*4;
+    out_record->bounds = svg_doc_bounds(p+4);
+    out_record->transform = svg_doc_matrix(p+20);
+    p+=44;
+    uint32_t flags = svg_doc_u32(p);
+    uint8_t fill_paint = flags&0xFF;
+    uint8_t stroke_paint = (flags>>8)&0xFF;
+    if(fill_paint>2 || stroke_paint>2) {
+        return false;
+    }
+    canvas_style& s = out_record->style;
+    s.fill_paint_type = (paint_type)fill_paint;
+    s.stroke_paint_type = (paint_type)stroke_paint;
+    s.fill_rule = (gfx::fill_rule)((flags>>16)&0xFF);
+    s.stroke_line_cap = (line_cap)((flags>>24)&0xFF);
+    s.stroke_line_join = (line_join)svg_doc_u32(p+4);
+    s.fill_opacity = svg_doc_f32(p+8);
+    s.stroke_opacity = svg_doc_f32(p+12);
+    s.stroke_width = svg_doc_f32(p+16);
+    s.stroke_miter_limit = svg_doc_f32(p+20);
+    s.font_size = svg_doc_f32(p+24);
+    s.fill_color.native_value = svg_doc_u32(p+28);
+    s.stroke_color.native_value = svg_doc_u32(p+32);
+    s.stroke_dash.offset = svg_doc_f32(p+36);
+    size_t dashes = svg_doc_u32(p+40);
+    p+=44;
+    if(size_t(rec_end-p)/4<dashes) {
+        return false;
+    }
+    s.stroke_dash.values = dashes?(float*)p:nullptr;
+    s.stroke_dash.values_size = dashes;
+    p+=dashes*4;
+    s.fill_gradient.stops = nullptr;
+    s.fill_gradient.stops_size = 0;
+    s.stroke_gradient.stops = nullptr;
+    s.stroke_gradient.stops_size = 0;
+    if(s.fill_paint_type==paint_type::gradient && !svg_doc_gradient(&p,rec_end,&s.fill_gradient)) {
+        return false;
+    }
+    if(s.stroke_paint_type==paint_type::gradient && !svg_doc_gradient(&p,rec_end,&s.stroke_gradient)) {
+        return false;
+    }
+    if(rec_end-p<4) {
+        return false;
+    }
+    size_t elements = svg_doc_u32(p);
+    p+=4;
+    if(size_t(rec_end-p)/8!=elements) {
+        return false;
+    }
+    const plutovg_path_element_t* e = (const plutovg_path_element_t*)p;
+    for(size_t i = 0;i<elements;) {
+        // read as plain words. the command may not be a valid enum value yet
+        uint32_t cmd = svg_doc_u32(p+i*8);
+        uint32_t len = svg_doc_u32(p+i*8+4);
+        if(cmd>PLUTOVG_PATH_COMMAND_CLOSE || len!=(cmd==PLUTOVG_PATH_COMMAND_CUBIC_TO?4:2) || elements-i<len) {
+            return false;
+        }
+        i+=len;
+    }
+    out_record->elements = elements?e:nullptr;
+    out_record->elements_size = elements;
+    *current = rec_end;
+    return true;
+}
+gfx_result svg_document::record(void* state, const canvas_path& path, const canvas_style& style, const matrix& transform) {
+    svg_doc_builder& b = *(svg_doc_builder*)state;
+    const plutovg_path_element_t* elements;
+    int elements_size = plutovg_path_get_elements((const plutovg_path_t*)path.m_info,&elements);
+    if(elements_size<=0 || (style.fill_paint_type==paint_type::none && style.stroke_paint_type==paint_type::none)) {
+        // nothing would be drawn
+        return gfx_result::success;
+    }
+    size_t words = svg_doc_record_words+style.stroke_dash.values_size+elements_size*2;
+    if(style.fill_paint_type==paint_type::gradient) {
+        words+=svg_doc_gradient_words(style.fill_gradient);
+    }
+    if(style.stroke_paint_type==paint_type::gradient) {
+        words+=svg_doc_gradient_words(style.stroke_gradient);
+    }
+    if(b.size+words*4>b.capacity) {
+        size_t cap = b.capacity*2;
+        if(cap<b.size+words*4) {
+            cap = b.size+words*4;
+        }
+        uint8_t* data = (uint8_t*)(b.data==nullptr?b.allocator(cap):b.reallocator(b.data,cap));
+        if(data==nullptr) {
+            return gfx_result::out_of_memory;
+        }
+        b.data = data;
+        b.capacity = cap;
+    }
+    // conservative bounds from the control points, widened by the stroke
+    rectf bounds(elements[1].point.x,elements[1].point.y,elements[1].point.x,elements[1].point.y);
+    for(int i = 0;i<elements_size;i+=elements[i].header.length) {
+        for(int j = 1;j<elements[i].header.length;++j) {
+            const pointf& pt = elements[i+j].point;
+            bounds = svg_doc_union(bounds,rectf(pt.x,pt.y,pt.x,pt.y));
+        }
+    }
+    if(style.stroke_paint_type!=paint_type::none) {
+        float e = svg_stroke_extent(style.stroke_width,style.stroke_line_join,style.stroke_miter_limit,style.stroke_line_cap);
+        bounds = rectf(bounds.x1-e,bounds.y1-e,bounds.x2+e,bounds.y2+e);
+    }
+    bounds = svg_map_bounds(bounds,transform);
+    if(b.groups>0) {
+        b.group_bounds[b.groups-1] = svg_doc_union(b.group_bounds[b.groups-1],bounds);
+    }
+    uint8_t* p = b.data+b.size;
+    p=svg_doc_put32(p,(uint32_t)words);
+    p=svg_doc_put_bounds(p,bounds);
+    p=svg_doc_put_matrix(p,transform);
+    p=svg_doc_put32(p,uint32_t(style.fill_paint_type)|
+                        (uint32_t(style.stroke_paint_type)<<8)|
+                        (uint32_t(style.fill_rule)<<16)|
+                        (uint32_t(style.stroke_line_cap)<<24));
+    p=svg_doc_put32(p,(uint32_t)style.stroke_line_join);
+    p=svg_doc_putf(p,style.fill_opacity);
+    p=svg_doc_putf(p,style.stroke_opacity);
+    p=svg_doc_putf(p,style.stroke_width);
+    p=svg_doc_putf(p,style.stroke_miter_limit);
+    p=svg_doc_putf(p,style.font_size);
+    p=svg_doc_put32(p,style.fill_color.native_value);
+    p=svg_doc_put32(p,style.stroke_color.native_value);
+    p=svg_doc_putf(p,style.stroke_dash.offset);
+    p=svg_doc_put32(p,(uint32_t)style.stroke_dash.values_size);
+    for(size_t i = 0;i<style.stroke_dash.values_size;++i) {
+        p=svg_doc_putf(p,style.stroke_dash.values[i]);
+    }
+    if(style.fill_paint_type==paint_type::gradient) {
+        p=svg_doc_put_gradient(p,style.fill_gradient);
+    }
+    if(style.stroke_paint_type==paint_type::gradient) {
+        p=svg_doc_put_gradient(p,style.stroke_gradient);
+    }
+    p=svg_doc_put32(p,(uint32_t)elements_size);
+    memcpy(p,elements,elements_size*sizeof(plutovg_path_element_t));
+    b.size+=words*4;
+    ++b.count;
+    return gfx_result::success;
+}
+// opens or closes a group header. groups that end up empty are removed.
+static gfx_result svg_doc_record_group(void* state, bool begin) {
+    svg_doc_builder& b = *(svg_doc_builder*)state;
+    if(begin) {
+        if(b.groups==svg_doc_max_groups) {
+            ++b.groups_untracked;
+            return gfx_result::success;
+        }
+        if(b.size+svg_doc_group_words*4>b.capacity) {
+            size_t cap = b.capacity*2;
+            uint8_t* data = (uint8_t*)b.reallocator(b.data,cap);
+            if(data==nullptr) {
+                return gfx_result::out_of_memory;
+            }
+            b.data = data;
+            b.capacity = cap;
+        }
+        b.group_offsets[b.groups] = b.size;
+        b.group_counts[b.groups] = b.count;
+        b.group_bounds[b.groups] = rectf(INFINITY,INFINITY,-INFINITY,-INFINITY);
+        ++b.groups;
+        b.size+=svg_doc_group_words*4;
+        return gfx_result::success;
+    }
+    if(b.groups_untracked>0) {
+        --b.groups_untracked;
+        return gfx_result::success;
+    }
+    if(b.groups==0) {
+        return gfx_result::success;
+    }
+    --b.groups;
+    size_t offset = b.group_offsets[b.groups];
+    uint32_t count = b.count-b.group_counts[b.groups];
+    if(count==0) {
+        b.size = offset;
+        return gfx_result::success;
+    }
+    const rectf& bounds = b.group_bounds[b.groups];
+    uint8_t* p = b.data+offset;
+    p=svg_doc_put32(p,uint32_t((b.size-offset)/4)|svg_doc_group_flag);
+    p=svg_doc_put32(p,count);
+    svg_doc_put_bounds(p,bounds);
+    if(b.groups>0) {
+        b.group_bounds[b.groups-1] = svg_doc_union(b.group_bounds[b.groups-1],bounds);
+    }
+    return gfx_result::success;
+}
+svg_document::svg_document(void*(*allocator)(size_t), void*(*reallocator)(void*,size_t), void(*deallocator)(void*)) : m_data(nullptr), m_size(0), m_allocator(allocator), m_reallocator(reallocator), m_deallocator(deallocator) {
+}
+svg_document::svg_document(svg_document&& rhs) : m_data(rhs.m_data), m_size(rhs.m_size), m_allocator(rhs.m_allocator), m_reallocator(rhs.m_reallocator), m_deallocator(rhs.m_deallocator) {
+    rhs.m_data = nullptr;
+    rhs.m_size = 0;
+}
+svg_document::~svg_document() {
+    deinitialize();
+}
+svg_document& svg_document::operator=(svg_document&& rhs) {
+    deinitialize();
+    m_data = rhs.m_data;
+    m_size = rhs.m_size;
+    m_allocator = rhs.m_allocator;
+    m_reallocator = rhs.m_reallocator;
+    m_deallocator = rhs.m_deallocator;
+    rhs.m_data = nullptr;
+    rhs.m_size = 0;
+    return *this;
+}
+bool svg_document::initialized() const {
+    return m_data!=nullptr;
+}
+void svg_document::deinitialize() {
+    if(m_data!=nullptr) {
+        m_deallocator(m_data);
+        m_data = nullptr;
+        m_size = 0;
+    }
+}
+sizef svg_document::dimensions() const {
+    if(m_data==nullptr) {
+        return {0,0};
+    }
+    const uint8_t* p = (const uint8_t*)m_data;
+    return {svg_doc_f32(p+16),svg_doc_f32(p+20)};
+}
+size_t svg_document::memory_size() const {
+    return m_size;
+}
+gfx_result svg_document::compile(stream& document, float dpi) {
+    if(document.caps().read==0) {
+        return INVALID_ARG;
+    }
+    void* mem = m_allocator(sizeof(svg_context));
+    if(mem==nullptr) {
+        return OUT_OF_MEMORY;
+    }
+    svg_context* pctx= new(mem) svg_context();
+    svg_doc_builder b;
+    b.capacity = 1024;
+    b.data = (uint8_t*)m_allocator(b.capacity);
+    if(b.data==nullptr) {
+        pctx->~svg_context();
+        m_deallocator(pctx);
+        return OUT_OF_MEMORY;
+    }
+    b.size = svg_doc_header_words*4;
+    b.count = 0;
+    b.groups = 0;
+    b.groups_untracked = 0;
+    b.allocator = m_allocator;
+    b.reallocator = m_reallocator;
+    svg_init_context(*pctx);
+    pctx->dpi = dpi;
+    pctx->cvs = nullptr;
+    pctx->record = record;
+    pctx->record_group = svg_doc_record_group;
+    pctx->record_state = &b;
+    pctx->allocator = m_allocator;
+    pctx->reallocator = m_reallocator;
+    pctx->deallocator = m_deallocator;
+    pctx->rdr.set(document);
+    result_t res = svg_parse_document(*pctx);
+    // close anything a truncated document left open
+    b.groups_untracked = 0;
+    while(SUCCEEDED(res) && b.groups>0) {
+        res = svg_doc_record_group(&b,false);
+    }
+    if(SUCCEEDED(res)) {
+        uint8_t* p = b.data;
+        p=svg_doc_put32(p,svg_doc_magic);
+        p=svg_doc_put32(p,svg_doc_version);
+        p=svg_doc_put32(p,(uint32_t)b.size);
+        p=svg_doc_put32(p,b.count);
+        p=svg_doc_putf(p,pctx->dimensions.width);
+        p=svg_doc_putf(p,pctx->dimensions.height);
+        // with the user transform at identity the context holds only the view transform
+        p=svg_doc_put_matrix(p,pctx->xform);
+        svg_doc_put32(p,pctx->align_type==view_align_none?svg_doc_flag_user_first:0);
+        uint8_t* data = (uint8_t*)m_reallocator(b.data,b.size);
+        if(data!=nullptr) {
+            b.data = data;
+        }
+        deinitialize();
+        m_data = b.data;
+        m_size = b.size;
+    } else {
+        m_deallocator(b.data);
+    }
+    svg_delete_context(*pctx);
+    pctx->~svg_context();
+    m_deallocator(pctx);
+    return res;
+}
+gfx_result svg_document::read(stream& input) {
+    if(input.caps().read==0) {
+        return INVALID_ARG;
+    }
+    uint8_t header[svg_doc_header_words*4];
+    if(sizeof(header)!=input.read(header,sizeof(header))) {
+        return IO_ERROR;
+    }
+    bool swap = false;
+    uint32_t magic = svg_doc_u32(header);
+    if(magic!=svg_doc_magic) {
+        if(bits::swap(magic)!=svg_doc_magic) {
+            return gfx_result::invalid_format;
+        }
+        swap = true;
+    }
+    uint32_t version = svg_doc_u32(header+4);
+    uint32_t size = svg_doc_u32(header+8);
+    if(swap) {
+        version = bits::swap(version);
+        size = bits::swap(size);
+    }
+    if(version!=svg_doc_version) {
+        return gfx_result::not_supported;
+    }
+    if(size<sizeof(header) || (size&3)!=0) {
+        return gfx_result::invalid_format;
+    }
+    uint8_t* data = (uint8_t*)m_allocator(size);
+    if(data==nullptr) {
+        return OUT_OF_MEMORY;
+    }
+    memcpy(data,header,sizeof(header));
+    if(size-sizeof(header)!=input.read(data+sizeof(header),size-sizeof(header))) {
+        m_deallocator(data);
+        return IO_ERROR;
+    }
+    if(swap) {
+        for(uint8_t* p = data;p<data+size;p+=4) {
+            svg_doc_put32(p,bits::swap(svg_doc_u32(p)));
+        }
+    }
+    // validate every record up front so render() can trust the list
+    const uint8_t* p = data+sizeof(header);
+    const uint8_t* end = data+size;
+    uint32_t count = svg_doc_u32(data+12);
+    svg_doc_record rec;
+    for(uint32_t i = 0;i<count;++i) {
+        if(!svg_doc_read_record(&p,end,&rec)) {
+            m_deallocator(data);
+            return gfx_result::invalid_format;
+        }
+    }
+    if(p!=end) {
+        m_deallocator(data);
+        return gfx_result::invalid_format;
+    }
+    deinitialize();
+    m_data = data;
+    m_size = size;
+    return gfx_result::success;
+}
+gfx_result svg_document::write(stream& output) const {
+    if(m_data==nullptr) {
+        return gfx_result::invalid_state;
+    }
+    if(output.caps().write==0) {
+        return INVALID_ARG;
+    }
+    if(m_size!=output.write((const uint8_t*)m_data,m_size)) {
+        return IO_ERROR;
+    }
+    return gfx_result::success;
+}
+gfx_result svg_document::render(canvas& destination, const matrix& transform, void*(*allocator)(size_t), void*(*reallocator)(void*,size_t), void(*deallocator)(void*)) const {
+    if(m_data==nullptr) {
+        return gfx_result::invalid_state;
+    }
+    if(!destination.initialized()) {
+        return gfx_result::invalid_state;
+    }
+    const uint8_t* p = (const uint8_t*)m_data;
+    const uint8_t* end = p+m_size;
+    uint32_t count = svg_doc_u32(p+12);
+    matrix view = svg_doc_matrix(p+24);
+    matrix xform = transform;
+    xform = (svg_doc_u32(p+48)&svg_doc_flag_user_first)?xform*view:view*xform;
+    p+=svg_doc_header_words*4;
+    const rectf clip = destination.clip_bounds();
+    matrix init_xfrm = destination.transform();
+    canvas_style init_style = destination.style();
+    gfx_result res = gfx_result::success;
+    svg_doc_record rec;
+    uint32_t group_count;
+    rectf group_bounds;
+    const uint8_t* group_end;
+    for(uint32_t i = 0;i<count;++i) {
+        // skip whole groups, then single records, that lie outside the clip
+        while(svg_doc_read_group(&p,end,&group_count,&group_bounds,&group_end)) {
+            if(!svg_bounds_visible(group_bounds,xform,clip)) {
+                p = group_end;
+                i+=group_count;
+            }
+        }
+        if(i>=count) {
+            break;
+        }
+        if(!svg_doc_read_record(&p,end,&rec)) {
+            res = gfx_result::invalid_format;
+            break;
+        }
+        if(!svg_bounds_visible(rec.bounds,xform,clip)) {
+            continue;
+        }
+        destination.transform(rec.transform*xform);
+        destination.style(rec.style);
+        destination.clear_path();
+        res = destination.reserve((rec.elements_size+1)/2);
+        const plutovg_path_element_t* e = rec.elements;
+        for(size_t j = 0;SUCCEEDED(res) && j<rec.elements_size;j+=e[j].header.length) {
+            switch(e[j].header.command) {
+                case PLUTOVG_PATH_COMMAND_MOVE_TO:
+                    res = destination.move_to(e[j+1].point);
+                    break;
+                case PLUTOVG_PATH_COMMAND_LINE_TO:
+                    res = destination.line_to(e[j+1].point);
+                    break;
+                case PLUTOVG_PATH_COMMAND_CUBIC_TO:
+                    res = destination.cubic_to(e[j+1].point,e[j+2].point,e[j+3].point);
+                    break;
+                default: // PLUTOVG_PATH_COMMAND_CLOSE
+                    res = destination.close_path();
+                    break;
+            }
+        }
+        if(SUCCEEDED(res)) {
+            res = destination.render(false,allocator,reallocator,deallocator);
+        }
+        if(!SUCCEEDED(res)) {
+            break;
+        }
+    }
+    destination.transform(init_xfrm);
+    destination.style(init_style);
+    return res;
+}
+
+// svg_to_tvg
+enum {
+    SVG_TVG_STYLE_FLAT = 0,
+    SVG_TVG_STYLE_LINEAR,
+    SVG_TVG_STYLE_RADIAL
+};
+enum {
+    SVG_TVG_CMD_END_DOCUMENT = 0,
+    SVG_TVG_CMD_FILL_PATH = 3,
+    SVG_TVG_CMD_DRAW_LINE_PATH = 7,
+    SVG_TVG_CMD_OUTLINE_FILL_PATH = 10
+};
+enum {
+    SVG_TVG_PATH_LINE = 0,
+    SVG_TVG_PATH_HLINE,
+    SVG_TVG_PATH_VLINE,
+    SVG_TVG_PATH_CUBIC,
+    SVG_TVG_PATH_CLOSE = 6
+};
+// outline fill commands store the segment count in 6 bits
+static const size_t svg_tvg_max_outline_segments = 64;
+struct svg_tvg_writer {
+    stream* out;
+    uint8_t buffer[256];
+    size_t size;
+    bool failed;
+    uint8_t bits;
+    float scale;
+};
+struct svg_tvg_palette {
+    uint32_t* colors;
+    size_t size;
+    size_t capacity;
+    void*(*allocator)(size_t);
+    void*(*reallocator)(void*,size_t);
+};
+struct svg_tvg_paint {
+    uint8_t kind;
+    uint32_t color0;
+    uint32_t color1;
+    pointf point0;
+    pointf point1;
+};
+static void svg_tvg_flush(svg_tvg_writer& w) {
+    if(w.size>0 && !w.failed && w.size!=w.out->write(w.buffer,w.size)) {
+        w.failed = true;
+    }
+    w.size = 0;
+}
+static inline void svg_tvg_put8(svg_tvg_writer& w, uint8_t value) {
+    if(w.size==sizeof(w.buffer)) {
+        svg_tvg_flush(w);
+    }
+    w.buffer[w.size++]=value;
+}
+static void svg_tvg_put_varuint(svg_tvg_writer& w, uint32_t value) {
+    while(value>=0x80) {
+        svg_tvg_put8(w,uint8_t(value|0x80));
+        value>>=7;
+    }
+    svg_tvg_put8(w,uint8_t(value));
+}
+// writes a coordinate sized little endian value
+static void svg_tvg_put_raw(svg_tvg_writer& w, uint32_t value) {
+    svg_tvg_put8(w,uint8_t(value));
+    if(w.bits>8) {
+        svg_tvg_put8(w,uint8_t(value>>8));
+        if(w.bits>16) {
+            svg_tvg_put8(w,uint8_t(value>>16));
+            svg_tvg_put8(w,uint8_t(value>>24));
+        }
+    }
+}
+static inline int32_t svg_tvg_quantize(const svg_tvg_writer& w, float value) {
+    return (int32_t)lroundf(value*w.scale);
+}
+static inline void svg_tvg_put_unit(svg_tvg_writer& w, float value) {
+    svg_tvg_put_raw(w,(uint32_t)svg_tvg_quantize(w,value));
+}
+static inline void svg_tvg_put_point(svg_tvg_writer& w, pointf value) {
+    svg_tvg_put_unit(w,value.x);
+    svg_tvg_put_unit(w,value.y);
+}
+// packs a color as its RGBA8888 file bytes
+static uint32_t svg_tvg_color(vector_pixel color, float opacity) {
+    opacity = math::clamp(0.f,opacity,1.f);
+    uint32_t a = (uint32_t)(color.template channel<channel_name::A>()*opacity+.5f);
+    return uint32_t(color.template channel<channel_name::R>()) |
+        (uint32_t(color.template channel<channel_name::G>())<<8) |
+        (uint32_t(color.template channel<channel_name::B>())<<16) |
+        (a<<24);
+}
+static size_t svg_tvg_palette_find(const svg_tvg_palette& palette, uint32_t color) {
+    for(size_t i = 0;i<palette.size;++i) {
+        if(palette.colors[i]==color) {
+            return i;
+        }
+    }
+    return palette.size;
+}
+static gfx_result svg_tvg_palette_add(svg_tvg_palette& palette, uint32_t color) {
+    if(svg_tvg_palette_find(palette,color)<palette.size) {
+        return gfx_result::success;
+    }
+    if(palette.size==palette.capacity) {
+        size_t cap = palette.capacity?palette.capacity*2:16;
+        uint32_t* colors = (uint32_t*)(palette.colors==nullptr?palette.allocator(cap*sizeof(uint32_t)):palette.reallocator(palette.colors,cap*sizeof(uint32_t)));
+        if(colors==nullptr) {
+            return gfx_result::out_of_memory;
+        }
+        palette.colors = colors;
+        palette.capacity = cap;
+    }
+    palette.colors[palette.size++]=color;
+    return gfx_result::success;
+}
+// maps a style's paint to a TinyVG style in document space. returns false if it paints nothing
+static bool svg_tvg_resolve_paint(paint_type type, vector_pixel color, const gradient& grad, float opacity, const matrix& transform, svg_tvg_paint* out_paint) {
+    if(type==paint_type::solid) {
+        out_paint->kind = SVG_TVG_STYLE_FLAT;
+        out_paint->color0 = svg_tvg_color(color,opacity);
+        return true;
+    }
+    if(type!=paint_type::gradient || grad.stops_size==0) {
+        return false;
+    }
+    out_paint->color0 = svg_tvg_color(grad.stops[0].color,opacity);
+    if(grad.stops_size==1) {
+        out_paint->kind = SVG_TVG_STYLE_FLAT;
+        return true;
+    }
+    out_paint->color1 = svg_tvg_color(grad.stops[grad.stops_size-1].color,opacity);
+    matrix m = grad.transform;
+    m = m * transform;
+    if(grad.type==gradient_type::linear) {
+        out_paint->kind = SVG_TVG_STYLE_LINEAR;
+        m.map(grad.linear.x1,grad.linear.y1,&out_paint->point0.x,&out_paint->point0.y);
+        m.map(grad.linear.x2,grad.linear.y2,&out_paint->point1.x,&out_paint->point1.y);
+    } else {
+        out_paint->kind = SVG_TVG_STYLE_RADIAL;
+        m.map(grad.radial.cx,grad.radial.cy,&out_paint->point0.x,&out_paint->point0.y);
+        out_paint->point1.x = out_paint->point0.x+grad.radial.cr*sqrtf(fabsf(m.a*m.d-m.b*m.c));
+        out_paint->point1.y = out_paint->point0.y;
+    }
+    return true;
+}
+static gfx_result svg_tvg_add_paint(svg_tvg_palette& palette, const svg_tvg_paint& paint, float* in_out_extent) {
+    gfx_result res = svg_tvg_palette_add(palette,paint.color0);
+    if(res!=gfx_result::success || paint.kind==SVG_TVG_STYLE_FLAT) {
+        return res;
+    }
+    *in_out_extent = math::max_(*in_out_extent,math::max_(fabsf(paint.point0.x),fabsf(paint.point0.y),fabsf(paint.point1.x),fabsf(paint.point1.y)));
+    return svg_tvg_palette_add(palette,paint.color1);
+}
+static void svg_tvg_put_style(svg_tvg_writer& w, const svg_tvg_palette& palette, const svg_tvg_paint& paint) {
+    if(paint.kind==SVG_TVG_STYLE_FLAT) {
+        svg_tvg_put_varuint(w,(uint32_t)svg_tvg_palette_find(palette,paint.color0));
+        return;
+    }
+    svg_tvg_put_point(w,paint.point0);
+    svg_tvg_put_point(w,paint.point1);
+    svg_tvg_put_varuint(w,(uint32_t)svg_tvg_palette_find(palette,paint.color0));
+    svg_tvg_put_varuint(w,(uint32_t)svg_tvg_palette_find(palette,paint.color1));
+}
+// finds the next contour at or after *in_out_index that has at least one command after its move
+static bool svg_tvg_segment(const plutovg_path_element_t* elements, size_t size, size_t* in_out_index, size_t* out_start, size_t* out_commands) {
+    size_t i = *in_out_index;
+    while(i<size) {
+        size_t start = i;
+        size_t commands = 0;
+        i+=elements[i].header.length;
+        while(i<size && elements[i].header.command!=PLUTOVG_PATH_COMMAND_MOVE_TO) {
+            ++commands;
+            i+=elements[i].header.length;
+        }
+        if(commands>0) {
+            *out_start = start;
+            *out_commands = commands;
+            *in_out_index = i;
+            return true;
+        }
+    }
+    *in_out_index = i;
+    return false;
+}
+static void svg_tvg_put_segments(svg_tvg_writer& w, const plutovg_path_element_t* elements, size_t size, const matrix& transform) {
+    size_t index = 0, start, commands;
+    while(svg_tvg_segment(elements,size,&index,&start,&commands)) {
+        svg_tvg_put_varuint(w,(uint32_t)(commands-1));
+    }
+    index = 0;
+    while(svg_tvg_segment(elements,size,&index,&start,&commands)) {
+        pointf pt;
+        transform.map_point(elements[start+1].point,&pt);
+        int32_t sx = svg_tvg_quantize(w,pt.x), sy = svg_tvg_quantize(w,pt.y);
+        int32_t cx = sx, cy = sy;
+        svg_tvg_put_raw(w,(uint32_t)sx);
+        svg_tvg_put_raw(w,(uint32_t)sy);
+        for(size_t i = start+elements[start].header.length;i<index;i+=elements[i].header.length) {
+            switch(elements[i].header.command) {
+                case PLUTOVG_PATH_COMMAND_LINE_TO: {
+                    transform.map_point(elements[i+1].point,&pt);
+                    int32_t x = svg_tvg_quantize(w,pt.x), y = svg_tvg_quantize(w,pt.y);
+                    if(y==cy) {
+                        svg_tvg_put8(w,SVG_TVG_PATH_HLINE);
+                        svg_tvg_put_raw(w,(uint32_t)x);
+                    } else if(x==cx) {
+                        svg_tvg_put8(w,SVG_TVG_PATH_VLINE);
+                        svg_tvg_put_raw(w,(uint32_t)y);
+                    } else {
+                        svg_tvg_put8(w,SVG_TVG_PATH_LINE);
+                        svg_tvg_put_raw(w,(uint32_t)x);
+                        svg_tvg_put_raw(w,(uint32_t)y);
+                    }
+                    cx = x;
+                    cy = y;
+                    break;
+                }
+                case PLUTOVG_PATH_COMMAND_CUBIC_TO:
+                    svg_tvg_put8(w,SVG_TVG_PATH_CUBIC);
+                    for(int j = 1;j<4;++j) {
+                        transform.map_point(elements[i+j].point,&pt);
+                        svg_tvg_put_point(w,pt);
+                    }
+                    cx = svg_tvg_quantize(w,pt.x);
+                    cy = svg_tvg_quantize(w,pt.y);
+                    break;
+                default: // PLUTOVG_PATH_COMMAND_CLOSE
+                    svg_tvg_put8(w,SVG_TVG_PATH_CLOSE);
+                    cx = sx;
+                    cy = sy;
+                    break;
+            }
+        }
+    }
+}
+static size_t svg_tvg_segment_count(const plutovg_path_element_t* elements, size_t size) {
+    size_t index = 0, start, commands, result = 0;
+    while(svg_tvg_segment(elements,size,&index,&start,&commands)) {
+        ++result;
+    }
+    return result;
+}
+gfx_result gfx::svg_to_tvg(stream& input, stream& output, const svg_to_tvg_options& options, void*(*allocator)(size_t), void*(*reallocator)(void*,size_t), void(*deallocator)(void*)) {
+    if(output.caps().write==0 || !(options.precision>0.f) || options.scale>15 ||
+            (options.coordinate_bits!=0 && options.coordinate_bits!=8 && options.coordinate_bits!=16 && options.coordinate_bits!=32)) {
+        return INVALID_ARG;
+    }
+    svg_document doc(allocator,reallocator,deallocator);
+    gfx_result res = doc.compile(input,options.dpi);
+    if(res!=gfx_result::success) {
+        return res;
+    }
+    const uint8_t* const begin = (const uint8_t*)doc.m_data;
+    const uint8_t* const end = begin+doc.m_size;
+    const uint32_t count = svg_doc_u32(begin+12);
+    const matrix view = svg_doc_matrix(begin+24);
+    const sizef dim = doc.dimensions();
+    const uint32_t width = (uint32_t)ceilf(math::max_(dim.width,1.f));
+    const uint32_t height = (uint32_t)ceilf(math::max_(dim.height,1.f));
+    svg_tvg_palette palette;
+    palette.colors = nullptr;
+    palette.size = 0;
+    palette.capacity = 0;
+    palette.allocator = allocator;
+    palette.reallocator = reallocator;
+    // first pass: gather the palette and the coordinate extent in document space
+    float extent = 0;
+    const uint8_t* p = begin+svg_doc_header_words*4;
+    svg_doc_record rec;
+    for(uint32_t i = 0;i<count && res==gfx_result::success;++i) {
+        if(!svg_doc_read_record(&p,end,&rec)) {
+            res = gfx_result::invalid_format;
+            break;
+        }
+        matrix m = rec.transform;
+        m = m * view;
+        const canvas_style& s = rec.style;
+        svg_tvg_paint fill, stroke;
+        if(svg_tvg_resolve_paint(s.fill_paint_type,s.fill_color,s.fill_gradient,s.fill_opacity,m,&fill)) {
+            res = svg_tvg_add_paint(palette,fill,&extent);
+        }
+        if(res==gfx_result::success && s.stroke_width>0 && svg_tvg_resolve_paint(s.stroke_paint_type,s.stroke_color,s.stroke_gradient,s.stroke_opacity,m,&stroke)) {
+            res = svg_tvg_add_paint(palette,stroke,&extent);
+            extent = math::max_(extent,s.stroke_width*sqrtf(fabsf(m.a*m.d-m.b*m.c)));
+        }
+        for(size_t j = 0;j<rec.elements_size;j+=rec.elements[j].header.length) {
+            for(int k = 1;k<rec.elements[j].header.length;++k) {
+                pointf pt;
+                m.map_point(rec.elements[j+k].point,&pt);
+                extent = math::max_(extent,fabsf(pt.x),fabsf(pt.y));
+            }
+        }
+    }
+    if(res==gfx_result::success && palette.size==0) {
+        // the format requires at least one color
+        res = svg_tvg_palette_add(palette,0);
+    }
+    if(res!=gfx_result::success) {
+        if(palette.colors!=nullptr) {
+            deallocator(palette.colors);
+        }
+        return res;
+    }
+    // pick the smallest coordinate size that holds the extent at the required precision,
+    // then the finest scale that still fits in it
+    int min_scale = 0;
+    while(min_scale<15 && ldexpf(1.f,-min_scale)>options.precision) {
+        ++min_scale;
+    }
+    static const uint8_t bits_list[] = {8,16,32};
+    svg_tvg_writer w;
+    w.bits = 0;
+    int scale = -1;
+    for(size_t i = 0;i<sizeof(bits_list) && w.bits==0;++i) {
+        uint8_t bits = bits_list[i];
+        if(options.coordinate_bits!=0 && options.coordinate_bits!=bits) {
+            continue;
+        }
+        const float limit = bits==32?2147483520.f:(float)((1<<(bits-1))-1);
+        const uint32_t max_size = bits==32?0xFFFFFFFF:(uint32_t)((1<<bits)-1);
+        if(width>max_size || height>max_size) {
+            continue;
+        }
+        scale = options.scale>=0?options.scale:15;
+        while(scale>=0 && ldexpf(extent,scale)>limit) {
+            --scale;
+        }
+        if(options.scale>=0?scale==options.scale:scale>=min_scale) {
+            w.bits = bits;
+        }
+    }
+    if(w.bits==0) {
+        if(palette.colors!=nullptr) {
+            deallocator(palette.colors);
+        }
+        return INVALID_ARG;
+    }
+    w.out = &output;
+    w.size = 0;
+    w.failed = false;
+    w.scale = ldexpf(1.f,scale);
+    // header
+    svg_tvg_put8(w,0x72);
+    svg_tvg_put8(w,0x56);
+    svg_tvg_put8(w,1);
+    svg_tvg_put8(w,uint8_t(scale|((w.bits==16?0:w.bits==8?1:2)<<6)));
+    svg_tvg_put_raw(w,width);
+    svg_tvg_put_raw(w,height);
+    svg_tvg_put_varuint(w,(uint32_t)palette.size);
+    for(size_t i = 0;i<palette.size;++i) {
+        svg_tvg_put8(w,uint8_t(palette.colors[i]));
+        svg_tvg_put8(w,uint8_t(palette.colors[i]>>8));
+        svg_tvg_put8(w,uint8_t(palette.colors[i]>>16));
+        svg_tvg_put8(w,uint8_t(palette.colors[i]>>24));
+    }
+    // second pass: emit one path command per element, or a fill and a line path
+    // when an outlined element has too many contours for an outline fill
+    p = begin+svg_doc_header_words*4;
+    for(uint32_t i = 0;i<count && !w.failed;++i) {
+        svg_doc_read_record(&p,end,&rec);
+        matrix m = rec.transform;
+        m = m * view;
+        const canvas_style& s = rec.style;
+        svg_tvg_paint fill, stroke;
+        bool has_fill = svg_tvg_resolve_paint(s.fill_paint_type,s.fill_color,s.fill_gradient,s.fill_opacity,m,&fill);
+        bool has_stroke = s.stroke_width>0 && svg_tvg_resolve_paint(s.stroke_paint_type,s.stroke_color,s.stroke_gradient,s.stroke_opacity,m,&stroke);
+        float stroke_width = s.stroke_width*sqrtf(fabsf(m.a*m.d-m.b*m.c));
+        size_t segments = svg_tvg_segment_count(rec.elements,rec.elements_size);
+        if(segments==0) {
+            continue;
+        }
+        if(has_fill && has_stroke && segments<=svg_tvg_max_outline_segments) {
+            svg_tvg_put8(w,uint8_t(SVG_TVG_CMD_OUTLINE_FILL_PATH|(fill.kind<<6)));
+            svg_tvg_put8(w,uint8_t((segments-1)|(stroke.kind<<6)));
+            svg_tvg_put_style(w,palette,fill);
+            svg_tvg_put_style(w,palette,stroke);
+            svg_tvg_put_unit(w,stroke_width);
+            svg_tvg_put_segments(w,rec.elements,rec.elements_size,m);
+            continue;
+        }
+        if(has_fill) {
+            svg_tvg_put8(w,uint8_t(SVG_TVG_CMD_FILL_PATH|(fill.kind<<6)));
+            svg_tvg_put_varuint(w,(uint32_t)(segments-1));
+            svg_tvg_put_style(w,palette,fill);
+            svg_tvg_put_segments(w,rec.elements,rec.elements_size,m);
+        }
+        if(has_stroke) {
+            svg_tvg_put8(w,uint8_t(SVG_TVG_CMD_DRAW_LINE_PATH|(stroke.kind<<6)));
+            svg_tvg_put_varuint(w,(uint32_t)(segments-1));
+            svg_tvg_put_style(w,palette,stroke);
+            svg_tvg_put_unit(w,stroke_width);
+            svg_tvg_put_segments(w,rec.elements,rec.elements_size,m);
+        }
+    }
+    svg_tvg_put8(w,SVG_TVG_CMD_END_DOCUMENT);
+    svg_tvg_flush(w);
+    deallocator(palette.colors);
+    return w.failed?IO_ERROR:gfx_result::success;
+}
@@ -0,0 +1,605 @@
+#include <gfx_text_layout.hpp>
+#include <new>
+using namespace gfx;
+
+text_layout::text_layout(void*(allocator)(size_t), void*(reallocator)(void*,size_t), void(deallocator)(void*)) :
+                                m_font(nullptr),
+                                m_glyphs(nullptr),
+                                m_glyph_count(0),
+                                m_glyph_capacity(0),
+                                m_lines(nullptr),
+                                m_line_count(0),
+                                m_line_capacity(0),
+                                m_dimensions(0,0),
+                                m_max_width(0),
+                                m_allocator(allocator),
+                                m_reallocator(reallocator),
+                                m_deallocator(deallocator) {}
+text_layout::text_layout(text_layout&& rhs) : m_font(rhs.m_font),
+                                m_glyphs(rhs.m_glyphs),
+                                m_glyph_count(rhs.m_glyph_count),
+                                m_glyph_capacity(rhs.m_glyph_capacity),
+                                m_lines(rhs.m_lines),
+                                m_line_count(rhs.m_line_count),
+                                m_line_capacity(rhs.m_line_capacity),
+                                m_dimensions(rhs.m_dimensions),
+                                m_max_width(rhs.m_max_width),
+                                m_allocator(rhs.m_allocator),
+                                m_reallocator(rhs.m_reallocator),
+                                m_deallocator(rhs.m_deallocator) {
+    rhs.m_font = nullptr;
+    rhs.m_glyphs = nullptr;
+    rhs.m_glyph_count = 0;
+    rhs.m_glyph_capacity = 0;
+    rhs.m_lines = nullptr;
+    rhs.m_line_count = 0;
+    rhs.m_line_capacity = 0;
+}
+text_layout::~text_layout() {
+    deinitialize();
+}
+text_layout& text_layout::operator=(text_layout&& rhs) {
+    deinitialize();
+    m_font = rhs.m_font;
+    m_glyphs = rhs.m_glyphs;
+    m_glyph_count = rhs.m_glyph_count;
+    m_glyph_capacity = rhs.m_glyph_capacity;
+    m_lines = rhs.m_lines;
+    m_line_count = rhs.m_line_count;
+    m_line_capacity = rhs.m_line_capacity;
+    m_dimensions = rhs.m_dimensions;
+    m_max_width = rhs.m_max_width;
+    m_allocator = rhs.m_allocator;
+    m_reallocator = rhs.m_reallocator;
+    m_deallocator = rhs.m_deallocator;
+    rhs.m_font = nullptr;
+    rhs.m_glyphs = nullptr;
+    rhs.m_glyph_count = 0;
+    rhs.m_glyph_capacity = 0;
+    rhs.m_lines = nullptr;
+    rhs.m_line_count = 0;
+    rhs.m_line_capacity = 0;
+    return *this;
+}
+gfx_result text_layout::add_glyph(const text_layout_glyph& glyph) {
+    if(m_glyph_count==m_glyph_capacity) {
+        size_t cap = m_glyph_capacity?m_glyph_capacity*2:16;
+        text_layout_glyph* p = (text_layout_glyph*)(m_glyphs==nullptr?
+            m_allocator(cap*sizeof(text_layout_glyph)):
+            m_reallocator(m_glyphs,cap*sizeof(text_layout_glyph)));
+        if(p==nullptr) {
+            return gfx_result::out_of_memory;
+        }
+        m_glyphs = p;
+        m_glyph_capacity = cap;
+    }
+    m_glyphs[m_glyph_count++]=glyph;
+    return gfx_result::success;
+}
+gfx_result text_layout::add_line(const text_layout_line& line) {
+    if(m_line_count==m_line_capacity) {
+        size_t cap = m_line_capacity?m_line_capacity*2:4;
+        text_layout_line* p = (text_layout_line*)(m_lines==nullptr?
+            m_allocator(cap*sizeof(text_layout_line)):
+            m_reallocator(m_lines,cap*sizeof(text_layout_line)));
+        if(p==nullptr) {
+            return gfx_result::out_of_memory;
+        }
+        m_lines = p;
+        m_line_capacity = cap;
+    }
+    m_lines[m_line_count++]=line;
+    return gfx_result::success;
+}
+gfx_result text_layout::initialize(uint16_t max_width, const text_info& info) {
+    deinitialize();
+    if(info.text==nullptr || info.text_font==nullptr || info.encoding==nullptr) {
+        return gfx_result::invalid_argument;
+    }
+    font_measure_cache* cache = info.measure_cache;
+    if(cache!=nullptr && !cache->initialized()) {
+        cache = nullptr;
+    }
+    const font& fnt = *info.text_font;
+    const text_encoder& encoding = *info.encoding;
+    m_font = &fnt;
+    m_max_width = max_width;
+    if(info.text_byte_count==0) {
+        return gfx_result::success;
+    }
+    text_decoder decoder(encoding,info.text,info.text_byte_count);
+    uint16_t em_width = 0;
+    uint16_t x_ext = 0, y_ext = 0;
+    uint16_t x = 0,y=0;
+    int32_t cp=0, cp_next=0;
+    const uint16_t lineh = fnt.line_advance();
+    gfx_result res = decoder.next(&cp);
+    if(res!=gfx_result::success) {
+        deinitialize();
+        return res;
+    }
+    res = decoder.next(&cp_next);
+    if(res!=gfx_result::success) {
+        deinitialize();
+        return res;
+    }
+    text_layout_line ln;
+    ln.first_glyph = 0;
+    ln.glyph_count = 0;
+    ln.y = 0;
+    ln.width = 0;
+    font_glyph_info em_gi;
+    uint16_t xo, cw;
+    bool cached;
+    bool new_line;
+    while(1) {
+        font_glyph_info gi;
+        new_line = false;
+        switch(cp) {
+            case '\t':
+                if(em_width==0) {
+                    cached = false;
+                    if(cache!=nullptr) {
+                        if(gfx_result::success==cache->find('M',0,&em_gi)) {
+                            cached = true;
+                        }
+                    }
+                    if(!cached) {
+                        res=fnt.measure_glyph('M',0,&em_gi);
+                        if(res!=gfx_result::success) {
+                            deinitialize();
+                            return res;
+                        }
+                        if(cache!=nullptr) {
+                            cache->add('M',0,em_gi);
+                        }
+                    }
+                    em_width = em_gi.advance_width;
+                }
+                cw = em_width*info.tab_width;
+                // a tab width of 0, or a font with no width for 'M', makes tabs take no space
+                if(cw!=0) {
+                    x=((x/cw)+1)*cw;
+                }
+                if(x>=max_width) {
+                    x=0;
+                    new_line = true;
+                }
+                if(x>ln.width) {
+                    ln.width = x;
+                }
+                break;
+            case '\r':
+                x=0;
+                break;
+            case '\n':
+                x=0;
+                new_line = true;
+                break;
+            default:
+                cached = false;
+                if(cache!=nullptr) {
+                    if(gfx_result::success==cache->find(cp,(cp_next>=0x20)?cp_next:0,&gi)) {
+                        cached = true;
+                    }
+                }
+                if(!cached) {
+                    res = fnt.measure_glyph((int)cp,(int)(cp_next>=0x20)?cp_next:0,&gi);
+                    if(res!=gfx_result::success) {
+                        deinitialize();
+                        return res;
+                    }
+                    if(cache!=nullptr) {
+                        cache->add(cp,(int)(cp_next>=0x20)?cp_next:0,gi);
+                    }
+                }
+                if(cp>=0x20 && gi.dimensions.width!=0 && gi.dimensions.height!=0) {
+                    text_layout_glyph g;
+                    g.codepoint = cp;
+                    g.glyph_index = gi.glyph_index1;
+                    g.location = spoint16(x,y).offset(gi.offset);
+                    g.dimensions = gi.dimensions;
+                    res = add_glyph(g);
+                    if(res!=gfx_result::success) {
+                        deinitialize();
+                        return res;
+                    }
+                    ++ln.glyph_count;
+                }
+                if(y+lineh>y_ext) {
+                    y_ext = y+lineh;
+                }
+                xo=x+gi.dimensions.width+gi.offset.x;
+                if(xo>ln.width) {
+                    ln.width = xo;
+                }
+                if(xo>max_width) {
+                    x=0;
+                    new_line = true;
+                } else {
+                    x+=gi.advance_width;
+                }
+                break;
+        }
+        if(new_line) {
+            res = add_line(ln);
+            if(res!=gfx_result::success) {
+                deinitialize();
+                return res;
+            }
+            if(ln.width>x_ext) {
+                x_ext = ln.width;
+            }
+            y+=lineh;
+            ln.first_glyph = (uint32_t)m_glyph_count;
+            ln.glyph_count = 0;
+            ln.y = y;
+            ln.width = 0;
+        }
+        cp = cp_next;
+        if(!cp) {
+            break;
+        }
+        // advance
+        res = decoder.next(&cp_next);
+        if(res!=gfx_result::success) {
+            deinitialize();
+            return res;
+        }
+    }
+    if(ln.glyph_count || ln.width) {
+        res = add_line(ln);
+        if(res!=gfx_result::success) {
+            deinitialize();
+            return res;
+        }
+        if(ln.width>x_ext) {
+            x_ext = ln.width;
+        }
+    }
+    m_dimensions.width = x_ext>max_width?max_width:x_ext;
+    m_dimensions.height = y_ext;
+    return gfx_result::success;
+}
+bool text_layout::initialized() const {
+    return m_font!=nullptr;
+}
+void text_layout::deinitialize() {
+    if(m_glyphs!=nullptr) {
+        m_deallocator(m_glyphs);
+        m_glyphs = nullptr;
+    }
+    if(m_lines!=nullptr) {
+        m_deallocator(m_lines);
+        m_lines = nullptr;
+    }
+    m_glyph_count = 0;
+    m_glyph_capacity = 0;
+    m_line_count = 0;
+    m_line_capacity = 0;
+    m_dimensions = {0,0};
+    m_font = nullptr;
+}
+const ::gfx::font* text_layout::text_font() const {
+    return m_font;
+}
+uint16_t text_layout::max_width() const {
+    return m_max_width;
+}
+size16 text_layout::dimensions() const {
+    return m_dimensions;
+}
+size_t text_layout::glyphs() const {
+    return m_glyph_count;
+}
+const text_layout_glyph& text_layout::glyph(size_t index) const {
+    return m_glyphs[index];
+}
+size_t text_layout::lines() const {
+    return m_line_count;
+}
+const text_layout_line& text_layout::line(size_t index) const {
+    return m_lines[index];
+}
+size_t text_layout::memory_size() const {
+    return sizeof(text_layout)+
+        m_glyph_capacity*sizeof(text_layout_glyph)+
+        m_line_capacity*sizeof(text_layout_line);
+}
+gfx_result text_layout::draw(const srect16& bounds, font_draw_callback callback, void* callback_state, font_draw_cache* draw_cache) const {
+    using bmp_t = gfx::bitmap<alpha_pixel<8>>;
+    using const_bmp_t = gfx::const_bitmap<alpha_pixel<8>>;
+    if(callback==nullptr) {
+        return gfx_result::invalid_argument;
+    }
+    if(m_font==nullptr) {
+        return gfx_result::invalid_state;
+    }
+    if(draw_cache!=nullptr && !draw_cache->initialized()) {
+        draw_cache = nullptr;
+    }
+    uint8_t* buffer = nullptr;
+    size_t buffer_size = 0;
+    gfx_result res = gfx_result::success;
+    for(size_t l = 0;l<m_line_count;++l) {
+        const text_layout_line& ln = m_lines[l];
+        if(bounds.y1+ln.y>bounds.y2) {
+            break;
+        }
+        const text_layout_glyph* g = m_glyphs+ln.first_glyph;
+        for(size_t i = 0;i<ln.glyph_count;++i,++g) {
+            spoint16 loc = g->location.offset(bounds.point1());
+            if(draw_cache!=nullptr) {
+                size16 d;
+                uint8_t* b;
+                if(gfx_result::success==draw_cache->find(g->codepoint,&d,&b)) {
+                    const_bmp_t cbmp(d,b);
+                    callback(loc,cbmp,callback_state);
+                    continue;
+                }
+            }
+            size_t bsize = g->dimensions.width*g->dimensions.height;
+            if(buffer_size<bsize) {
+                uint8_t* p = (uint8_t*)(buffer==nullptr?m_allocator(bsize):m_reallocator(buffer,bsize));
+                if(p==nullptr) {
+                    res = gfx_result::out_of_memory;
+                    goto done;
+                }
+                buffer = p;
+                buffer_size = bsize;
+            }
+            memset(buffer,0,bsize);
+            bmp_t bmp(g->dimensions,buffer);
+            res = m_font->draw_glyph(bmp,g->codepoint,g->glyph_index);
+            if(res!=gfx_result::success) {
+                goto done;
+            }
+            if(draw_cache!=nullptr) {
+                // don't care about errors here
+                draw_cache->add(g->codepoint,g->dimensions,buffer);
+            }
+            const_bmp_t cbmp(g->dimensions,buffer);
+            callback(loc,cbmp,callback_state);
+        }
+    }
+done:
+    if(buffer!=nullptr) {
+        m_deallocator(buffer);
+    }
+    return res;
+}
+
+int text_layout_cache::hash_function(const key_t& key) {
+    return (int)(key.hash&0x7FFFFFFF);
+}
+void text_layout_cache::make_key(uint16_t max_width, const text_info& info, key_t* out_key) {
+    // FNV-1a
+    uint32_t h = 2166136261U;
+    const uint8_t* p = (const uint8_t*)info.text;
+    for(size_t i = 0;i<info.text_byte_count;++i) {
+        h = (h^p[i])*16777619U;
+    }
+    uintptr_t f = (uintptr_t)info.text_font;
+    for(size_t i = 0;i<sizeof(uintptr_t);++i) {
+        h = (h^(uint8_t)(f>>(i*8)))*16777619U;
+    }
+    const uint16_t line_height = info.text_font->line_height();
+    h = (h^(line_height&0xFF))*16777619U;
+    h = (h^(line_height>>8))*16777619U;
+    h = (h^(max_width&0xFF))*16777619U;
+    h = (h^(max_width>>8))*16777619U;
+    h = (h^(info.tab_width&0xFF))*16777619U;
+    h = (h^(info.tab_width>>8))*16777619U;
+    out_key->hash = h;
+    out_key->text = p;
+    out_key->text_byte_count = info.text_byte_count;
+    out_key->text_font = info.text_font;
+    out_key->line_height = line_height;
+    out_key->encoding = info.encoding;
+    out_key->max_width = max_width;
+    out_key->tab_width = info.tab_width;
+}
+size_t text_layout_cache::entry_size(const map_t::value_type& value) {
+    return sizeof(key_t)+sizeof(cache_entry_t)+value.key.text_byte_count+value.value.layout->memory_size();
+}
+void text_layout_cache::free_entry(map_t::value_type& value) {
+    if(value.value.layout!=nullptr) {
+        value.value.layout->~text_layout();
+        m_deallocator(value.value.layout);
+        value.value.layout = nullptr;
+    }
+    if(value.key.text!=nullptr) {
+        m_deallocator((void*)value.key.text);
+        value.key.text = nullptr;
+    }
+}
+void text_layout_cache::expire_item() {
+    if(m_cache.size()) {
+        int min = -1;
+        size_t index = 0;
+        for(size_t i = 0;i<m_cache.size();++i) {
+            map_t::value_type& v = *m_cache.at(i);
+            if(min==-1 || v.value.accessed<min) {
+                min = v.value.accessed;
+                index = i;
+            }
+        }
+        map_t::value_type& v = *m_cache.at(index);
+        key_t k = v.key;
+        m_memory_size-=entry_size(v);
+        // remove before freeing since the key compares the owned text
+        text_layout* layout = v.value.layout;
+        m_cache.remove(k);
+        layout->~text_layout();
+        m_deallocator(layout);
+        m_deallocator((void*)k.text);
+        if(!m_cache.size()) {
+            m_accessed=-1;
+        }
+    }
+}
+void text_layout_cache::reduce(int new_size, int new_items) {
+    if(new_size>-1) {
+        while(m_cache.size() && m_memory_size>(size_t)new_size) {
+            expire_item();
+        }
+    }
+    if(new_items>-1) {
+        while(m_cache.size()>(size_t)new_items) {
+            expire_item();
+        }
+    }
+    if(!m_cache.size()) {
+        m_accessed=-1;
+    }
+}
+text_layout_cache::text_layout_cache(void*(allocator)(size_t), void*(reallocator)(void*,size_t), void(deallocator)(void*)) :
+                                m_allocator(allocator),
+                                m_reallocator(reallocator),
+                                m_deallocator(deallocator),
+                                m_initialized(false),
+                                m_accessed(-1),
+                                m_cache(hash_function,allocator,reallocator,deallocator),
+                                m_memory_size(0),
+                                m_max_memory_size(0),
+                                m_max_entries(8) {}
+text_layout_cache::text_layout_cache(text_layout_cache&& rhs) : m_allocator(rhs.m_allocator),
+                                m_reallocator(rhs.m_reallocator),
+                                m_deallocator(rhs.m_deallocator),
+                                m_initialized(rhs.m_initialized),
+                                m_accessed(rhs.m_accessed),
+                                m_cache(helpers::gfx_move(rhs.m_cache)),
+                                m_memory_size(rhs.m_memory_size),
+                                m_max_memory_size(rhs.m_max_memory_size),
+                                m_max_entries(rhs.m_max_entries) {
+    // the entries belong to us now
+    rhs.m_initialized = false;
+}
+text_layout_cache::~text_layout_cache() {
+    deinitialize();
+}
+text_layout_cache& text_layout_cache::operator=(text_layout_cache&& rhs) {
+    deinitialize();
+    m_allocator=rhs.m_allocator;
+    m_reallocator=rhs.m_reallocator;
+    m_deallocator=rhs.m_deallocator;
+    m_initialized=rhs.m_initialized;
+    m_accessed=rhs.m_accessed;
+    m_cache=helpers::gfx_move(rhs.m_cache);
+    m_memory_size=rhs.m_memory_size;
+    m_max_memory_size=rhs.m_max_memory_size;
+    m_max_entries = rhs.m_max_entries;
+    rhs.m_initialized = false;
+    return *this;
+}
+size_t text_layout_cache::max_memory_size() const {
+    return m_max_memory_size;
+}
+void text_layout_cache::max_memory_size(size_t value) {
+    if(m_memory_size>value && value>0) {
+        reduce(value,-1);
+    }
+    m_max_memory_size = value;
+}
+size_t text_layout_cache::memory_size() const {
+    return m_memory_size;
+}
+size_t text_layout_cache::max_entries() const {
+    return m_max_entries;
+}
+void text_layout_cache::max_entries(size_t value) {
+    if(value>0 && m_cache.size()>value) {
+        reduce(-1,value);
+    }
+    m_max_entries = value;
+}
+size_t text_layout_cache::entries() const {
+    return m_cache.size();
+}
+gfx_result text_layout_cache::find(uint16_t max_width, const text_info& info, const text_layout** out_layout) {
+    if(out_layout==nullptr || info.text==nullptr || info.text_font==nullptr) {
+        return gfx_result::invalid_argument;
+    }
+    if(!m_initialized) {
+        return gfx_result::invalid_state;
+    }
+    key_t k;
+    make_key(max_width,info,&k);
+    cache_entry_t* entry = m_cache.find(k);
+    if(entry==nullptr) {
+        return gfx_result::canceled;
+    }
+    entry->accessed = ++m_accessed;
+    *out_layout = entry->layout;
+    return gfx_result::success;
+}
+gfx_result text_layout_cache::layout(uint16_t max_width, const text_info& info, const text_layout** out_layout) {
+    gfx_result res = find(max_width,info,out_layout);
+    if(res!=gfx_result::canceled) {
+        return res;
+    }
+    if(m_max_entries>0) {
+        while(m_cache.size() && (m_cache.size()+1)>m_max_entries) {
+            expire_item();
+        }
+    }
+    uint8_t* text = (uint8_t*)m_allocator(info.text_byte_count?info.text_byte_count:1);
+    if(text==nullptr) {
+        return gfx_result::out_of_memory;
+    }
+    memcpy(text,info.text,info.text_byte_count);
+    void* mem = m_allocator(sizeof(text_layout));
+    if(mem==nullptr) {
+        m_deallocator(text);
+        return gfx_result::out_of_memory;
+    }
+    text_layout* result = new(mem) text_layout(m_allocator,m_reallocator,m_deallocator);
+    res = result->initialize(max_width,info);
+    if(res!=gfx_result::success) {
+        result->~text_layout();
+        m_deallocator(mem);
+        m_deallocator(text);
+        return res;
+    }
+    map_t::value_type v;
+    make_key(max_width,info,&v.key);
+    v.key.text = text;
+    v.value.layout = result;
+    v.value.accessed = ++m_accessed;
+    size_t sz = entry_size(v);
+    if(m_max_memory_size>0) {
+        while(m_cache.size() && m_memory_size+sz>m_max_memory_size) {
+            expire_item();
+        }
+    }
+    if(!m_cache.insert(v)) {
+        free_entry(v);
+        return gfx_result::out_of_memory;
+    }
+    m_memory_size+=sz;
+    *out_layout = result;
+    return gfx_result::success;
+}
+void text_layout_cache::clear() {
+    for(size_t i = 0;i<m_cache.size();++i) {
+        free_entry(*m_cache.at(i));
+    }
+    m_cache.clear();
+    m_accessed=-1;
+    m_memory_size=0;
+}
+gfx_result text_layout_cache::initialize() {
+    m_accessed=-1;
+    m_memory_size=0;
+    m_initialized=true;
+    return gfx_result::success;
+}
+bool text_layout_cache::initialized() const {
+    return m_initialized;
+}
+void text_layout_cache::deinitialize() {
+    if(m_initialized) {
+        clear();
+    }
+    m_initialized= false;
+}
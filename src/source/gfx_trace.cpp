@@ -0,0 +1,226 @@
+#include "gfx_trace.hpp"
+#include <stdio.h>
+#include <new>
+#include <atomic>
+namespace gfx {
+// the events follow
+struct trace_buffer_info {
+    size_t capacity;
+    trace_clock_callback clock;
+    void* clock_state;
+    // the number of events ever recorded. The next one goes at written % capacity
+    std::atomic<size_t> written;
+    inline trace_event* events() {
+        return (trace_event*)(this + 1);
+    }
+};
+#define PHND ((trace_buffer_info*)m_info)
+static std::atomic<trace_buffer_info*> trace_current(nullptr);
+#ifdef HTCW_GFX_THREADS
+static std::atomic<uint32_t> trace_threads(0);
+#endif
+static uint32_t trace_thread() {
+#ifdef HTCW_GFX_THREADS
+    static thread_local uint32_t result = trace_threads.fetch_add(1, std::memory_order_relaxed);
+    return result;
+#else
+    return 0;
+#endif
+}
+static void trace_add(trace_buffer_info& info, trace_phase phase, const char* category, const char* name, uint64_t id) {
+    trace_event& e = info.events()[info.written.fetch_add(1, std::memory_order_relaxed) % info.capacity];
+    e.category = category;
+    e.name = name;
+    e.timestamp = info.clock(info.clock_state);
+    e.id = id;
+    e.thread = trace_thread();
+    e.phase = phase;
+}
+trace_buffer::trace_buffer(void* (*allocator)(size_t), void* (*reallocator)(void*, size_t), void (*deallocator)(void*)) : m_info(nullptr), m_allocator(allocator), m_reallocator(reallocator), m_deallocator(deallocator) {
+}
+trace_buffer::trace_buffer(trace_buffer&& rhs) : m_info(rhs.m_info), m_allocator(rhs.m_allocator), m_reallocator(rhs.m_reallocator), m_deallocator(rhs.m_deallocator) {
+    rhs.m_info = nullptr;
+}
+trace_buffer::~trace_buffer() {
+    deinitialize();
+}
+trace_buffer& trace_buffer::operator=(trace_buffer&& rhs) {
+    deinitialize();
+    m_info = rhs.m_info;
+    m_allocator = rhs.m_allocator;
+    m_reallocator = rhs.m_reallocator;
+    m_deallocator = rhs.m_deallocator;
+    rhs.m_info = nullptr;
+    return *this;
+}
+gfx_result trace_buffer::initialize(size_t capacity, trace_clock_callback clock, void* clock_state) {
+    if (m_info != nullptr) {
+        return gfx_result::success;
+    }
+    if (capacity == 0 || clock == nullptr) {
+        return gfx_result::invalid_argument;
+    }
+    if (m_allocator == nullptr || m_deallocator == nullptr) {
+        return gfx_result::out_of_memory;
+    }
+    void* mem = m_allocator(sizeof(trace_buffer_info) + sizeof(trace_event) * capacity);
+    if (mem == nullptr) {
+        return gfx_result::out_of_memory;
+    }
+    trace_buffer_info* info = new (mem) trace_buffer_info();
+    info->capacity = capacity;
+    info->clock = clock;
+    info->clock_state = clock_state;
+    info->written.store(0);
+    m_info = info;
+    return gfx_result::success;
+}
+bool trace_buffer::initialized() const {
+    return m_info != nullptr;
+}
+void trace_buffer::deinitialize() {
+    if (m_info == nullptr) {
+        return;
+    }
+    stop();
+    PHND->~trace_buffer_info();
+    m_deallocator(m_info);
+    m_info = nullptr;
+}
+gfx_result trace_buffer::start() {
+    if (m_info == nullptr) {
+        return gfx_result::invalid_state;
+    }
+    trace_current.store(PHND, std::memory_order_release);
+    return gfx_result::success;
+}
+void trace_buffer::stop() {
+    trace_buffer_info* expected = PHND;
+    if (expected != nullptr) {
+        trace_current.compare_exchange_strong(expected, nullptr, std::memory_order_acq_rel);
+    }
+}
+bool trace_buffer::recording() const {
+    return m_info != nullptr && trace_current.load(std::memory_order_acquire) == PHND;
+}
+size_t trace_buffer::capacity() const {
+    return m_info == nullptr ? 0 : PHND->capacity;
+}
+size_t trace_buffer::count() const {
+    if (m_info == nullptr) {
+        return 0;
+    }
+    const size_t written = PHND->written.load(std::memory_order_acquire);
+    return written < PHND->capacity ? written : PHND->capacity;
+}
+size_t trace_buffer::dropped() const {
+    if (m_info == nullptr) {
+        return 0;
+    }
+    const size_t written = PHND->written.load(std::memory_order_acquire);
+    return written < PHND->capacity ? 0 : written - PHND->capacity;
+}
+void trace_buffer::clear() {
+    if (m_info != nullptr) {
+        PHND->written.store(0, std::memory_order_release);
+    }
+}
+void trace_buffer::record(trace_phase phase, const char* category, const char* name, uint64_t id) {
+    if (m_info != nullptr) {
+        trace_add(*PHND, phase, category, name, id);
+    }
+}
+gfx_result trace_buffer::event(size_t index, trace_event* out_event) const {
+    if (m_info == nullptr) {
+        return gfx_result::invalid_state;
+    }
+    if (out_event == nullptr || index >= count()) {
+        return gfx_result::invalid_argument;
+    }
+    const size_t written = PHND->written.load(std::memory_order_acquire);
+    const size_t first = written < PHND->capacity ? 0 : written - PHND->capacity;
+    *out_event = PHND->events()[(first + index) % PHND->capacity];
+    return gfx_result::success;
+}
+static gfx_result trace_write(stream& out, const char* text, int length) {
+    if (length < 0) {
+        return gfx_result::invalid_format;
+    }
+    return out.write((const uint8_t*)text, (size_t)length) == (size_t)length ? gfx_result::success : gfx_result::io_error;
+}
+// writes a string literal as a JSON string. The names and categories never need more than quotes and backslashes escaped
+static gfx_result trace_write_string(stream& out, const char* text) {
+    gfx_result r = trace_write(out, "\"", 1);
+    while (r == gfx_result::success && *text) {
+        if (*text == '"' || *text == '\\') {
+            r = trace_write(out, "\\", 1);
+        }
+        if (r == gfx_result::success) {
+            r = trace_write(out, text, 1);
+        }
+        ++text;
+    }
+    if (r == gfx_result::success) {
+        r = trace_write(out, "\"", 1);
+    }
+    return r;
+}
+gfx_result trace_buffer::dump(stream& out) const {
+    if (m_info == nullptr) {
+        return gfx_result::invalid_state;
+    }
+    const size_t total = count();
+    uint64_t start = 0;
+    trace_event e;
+    if (total != 0) {
+        event(0, &e);
+        start = e.timestamp;
+    }
+    char line[160];
+    gfx_result r = trace_write(out, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[", 39);
+    for (size_t i = 0; r == gfx_result::success && i < total; ++i) {
+        event(i, &e);
+        r = trace_write(out, i == 0 ? "\n{\"name\":" : ",\n{\"name\":", i == 0 ? 9 : 10);
+        if (r == gfx_result::success) {
+            r = trace_write_string(out, e.name == nullptr ? "" : e.name);
+        }
+        if (r == gfx_result::success) {
+            r = trace_write(out, ",\"cat\":", 7);
+        }
+        if (r == gfx_result::success) {
+            r = trace_write_string(out, e.category == nullptr ? "gfx" : e.category);
+        }
+        if (r != gfx_result::success) {
+            break;
+        }
+        // the clock may not be monotonic across threads, so events before the first are clamped to it
+        const uint64_t ns = e.timestamp > start ? e.timestamp - start : 0;
+        int len = snprintf(line, sizeof(line), ",\"ph\":\"%c\",\"ts\":%llu.%03u,\"pid\":1,\"tid\":%u", (char)e.phase,
+                           (unsigned long long)(ns / 1000), (unsigned)(ns % 1000), (unsigned)e.thread);
+        if (len > 0 && (size_t)len < sizeof(line)) {
+            if (e.phase == trace_phase::async_begin || e.phase == trace_phase::async_end) {
+                len += snprintf(line + len, sizeof(line) - len, ",\"id\":\"0x%llx\"", (unsigned long long)e.id);
+            } else if (e.phase == trace_phase::instant) {
+                len += snprintf(line + len, sizeof(line) - len, ",\"s\":\"t\"");
+            }
+        }
+        if (len > 0 && (size_t)len < sizeof(line) - 1) {
+            line[len++] = '}';
+        }
+        r = trace_write(out, line, len);
+    }
+    if (r == gfx_result::success) {
+        r = trace_write(out, "\n]}\n", 4);
+    }
+    return r;
+}
+namespace helpers {
+void trace_record(trace_phase phase, const char* category, const char* name, uint64_t id) {
+    trace_buffer_info* info = trace_current.load(std::memory_order_acquire);
+    if (info != nullptr) {
+        trace_add(*info, phase, category, name, id);
+    }
+}
+}  // namespace helpers
+#undef PHND
+}  // namespace gfx
@@ -7,8 +7,9 @@
 #define STBTT_HEAP_FACTOR_SIZE_32 50
 #define STBTT_HEAP_FACTOR_SIZE_128 20
 #define STBTT_HEAP_FACTOR_SIZE_DEFAULT 10
-#define STBTT_malloc(x, u) ((void)(u), malloc(x))
-#define STBTT_free(x, u) ((void)(u), free(x))
+// stbtt gets the font's allocators through the userdata of its font info
+#define STBTT_malloc(x, u) ((u)!=NULL?((tt_font_allocators*)(u))->allocate(x):malloc(x))
+#define STBTT_free(x, u) ((u)!=NULL?((tt_font_allocators*)(u))->deallocate(x):free(x))
 /* for stream support */
 #define STBTT_STREAM_TYPE void*
 #define STBTT_STREAM_SEEK(s, x) do { gfx::stream* stm = (gfx::stream*)(s); stm->seek((long long)(x)); } while(0);
@@ -16,23 +17,37 @@
 
 namespace gfx {
 
+typedef struct {
+    void*(*allocate)(size_t);
+    void(*deallocate)(void*);
+} tt_font_allocators;
 
 #include "stb_rect_pack.h"
 #include "stb_truetype.h"
 
-tt_font::tt_font(stream& stream, float size, font_size_units units, bool initialize) : m_info(nullptr), m_stream(&stream),m_size(size),m_units(units) {
+// what m_info points to. The font info comes first, so m_info can be used as one
+typedef struct {
+    stbtt_fontinfo info;
+    tt_font_allocators allocators;
+} tt_font_info_t;
+
+tt_font::tt_font(stream& stream, float size, font_size_units units, bool initialize, void*(*allocator)(size_t), void*(*reallocator)(void*,size_t), void(*deallocator)(void*)) : m_info(nullptr), m_stream(&stream),m_size(size),m_units(units),m_preload_first(0),m_preload_last(-1),m_preload_glyphs(nullptr),m_preload_kerns(nullptr),m_preload_kern_capacity(0),m_preload_kern_count(0),m_allocator(allocator),m_reallocator(reallocator),m_deallocator(deallocator) {
     if(initialize) {
         this->initialize();
     }
 }
-tt_font::tt_font() : m_info(nullptr), m_stream(nullptr), m_line_height(0),m_scale(NAN),m_size(0),m_units(font_size_units::em) {
+tt_font::tt_font(void*(*allocator)(size_t), void*(*reallocator)(void*,size_t), void(*deallocator)(void*)) : m_info(nullptr), m_stream(nullptr), m_line_height(0),m_scale(NAN),m_size(0),m_units(font_size_units::em),m_preload_first(0),m_preload_last(-1),m_preload_glyphs(nullptr),m_preload_kerns(nullptr),m_preload_kern_capacity(0),m_preload_kern_count(0),m_allocator(allocator),m_reallocator(reallocator),m_deallocator(deallocator) {
 }
 
 tt_font::~tt_font() {
     deinitialize();
 }
-tt_font::tt_font(tt_font&& rhs) : m_info(rhs.m_info),m_stream(rhs.m_stream), m_line_height(rhs.m_line_height),m_line_advance(rhs.m_line_advance),m_base_line(rhs.m_base_line),m_scale(rhs.m_scale),m_size(rhs.m_size),m_units(rhs.m_units) {
+tt_font::tt_font(tt_font&& rhs) : m_info(rhs.m_info),m_stream(rhs.m_stream), m_line_height(rhs.m_line_height),m_line_advance(rhs.m_line_advance),m_base_line(rhs.m_base_line),m_scale(rhs.m_scale),m_size(rhs.m_size),m_units(rhs.m_units),m_kerning(rhs.m_kerning),m_preload_first(rhs.m_preload_first),m_preload_last(rhs.m_preload_last),m_preload_glyphs(rhs.m_preload_glyphs),m_preload_kerns(rhs.m_preload_kerns),m_preload_kern_capacity(rhs.m_preload_kern_capacity),m_preload_kern_count(rhs.m_preload_kern_count),m_allocator(rhs.m_allocator),m_reallocator(rhs.m_reallocator),m_deallocator(rhs.m_deallocator) {
     rhs.m_info = nullptr;
+    rhs.m_preload_glyphs = nullptr;
+    rhs.m_preload_kerns = nullptr;
+    rhs.m_preload_kern_capacity = 0;
+    rhs.m_preload_kern_count = 0;
 }
 tt_font& tt_font::operator=(tt_font&& rhs) {
     deinitialize();
@@ -44,7 +59,21 @@ tt_font& tt_font::operator=(tt_font&& rhs) {
     m_scale=rhs.m_scale;
     m_size=rhs.m_size;
     m_units=rhs.m_units;
+    m_kerning=rhs.m_kerning;
+    m_preload_first=rhs.m_preload_first;
+    m_preload_last=rhs.m_preload_last;
+    m_preload_glyphs=rhs.m_preload_glyphs;
+    m_preload_kerns=rhs.m_preload_kerns;
+    m_preload_kern_capacity=rhs.m_preload_kern_capacity;
+    m_preload_kern_count=rhs.m_preload_kern_count;
+    m_allocator=rhs.m_allocator;
+    m_reallocator=rhs.m_reallocator;
+    m_deallocator=rhs.m_deallocator;
     rhs.m_info = nullptr;
+    rhs.m_preload_glyphs = nullptr;
+    rhs.m_preload_kerns = nullptr;
+    rhs.m_preload_kern_capacity = 0;
+    rhs.m_preload_kern_count = 0;
     return *this;
 }
 void tt_font::set_size() {
@@ -72,14 +101,21 @@ gfx_result tt_font::initialize() {
     if(m_stream==nullptr) {
         return gfx_result::invalid_argument;
     }
-    stbtt_fontinfo* info = (stbtt_fontinfo* )STBTT_malloc(sizeof(stbtt_fontinfo),NULL);
-    if(info==nullptr) {
+    if(m_allocator==nullptr || m_deallocator==nullptr) {
+        return gfx_result::out_of_memory;
+    }
+    tt_font_info_t* tinfo = (tt_font_info_t*)m_allocator(sizeof(tt_font_info_t));
+    if(tinfo==nullptr) {
         return gfx_result::out_of_memory;
     }
-    m_info = info;
+    m_info = tinfo;
+    stbtt_fontinfo* info = &tinfo->info;
     if(!stbtt_InitFont(info,m_stream, stbtt_GetFontOffsetForIndex(m_stream, 0))) {
         return gfx_result::invalid_format;
     }
+    tinfo->allocators.allocate = m_allocator;
+    tinfo->allocators.deallocate = m_deallocator;
+    info->userdata = &tinfo->allocators;
     // check if font  has kerning tables to use, else disable kerning automatically.
     if(stbtt_KernTableCheck(info) == 0) {
         m_kerning = false; // disable kerning if font has no tables. 
@@ -88,7 +124,7 @@ gfx_result tt_font::initialize() {
     }
 
     set_size();
-    return gfx_result::success;
+    return load_preload();
 }
 void tt_font::size(float size, font_size_units units) {
     m_units = units;
@@ -102,8 +138,9 @@ bool tt_font::initialized() const {
     return m_info!=nullptr;
 }
 void tt_font::deinitialize() {
+    free_preload();
     if(m_info!=nullptr) {
-        STBTT_free(m_info,NULL);
+        m_deallocator(m_info);
         m_info = nullptr;
     }
 }
@@ -111,35 +148,65 @@ gfx_result tt_font::on_measure(int32_t codepoint1,int32_t codepoint2, font_glyph
     if(m_info==nullptr) {
         return gfx_result::invalid_state;
     }
-    uint32_t g1 = stbtt_FindGlyphIndex((stbtt_fontinfo*)m_info,codepoint1);
+    stbtt_fontinfo* info = (stbtt_fontinfo*)m_info;
+    const preload_glyph_t* pg1 = nullptr;
+    const preload_glyph_t* pg2 = nullptr;
+    if(m_preload_glyphs!=nullptr) {
+        if(codepoint1>=m_preload_first && codepoint1<=m_preload_last) {
+            pg1 = m_preload_glyphs+(codepoint1-m_preload_first);
+        }
+        if(codepoint2>=m_preload_first && codepoint2<=m_preload_last) {
+            pg2 = m_preload_glyphs+(codepoint2-m_preload_first);
+        }
+    }
+    uint32_t g1 = pg1!=nullptr?pg1->glyph:stbtt_FindGlyphIndex(info,codepoint1);
     if(g1==0) {
         return gfx_result::not_supported;
     }
     out_glyph_info->glyph_index1 = g1;
     uint32_t g2 = 0;
     if(codepoint2!=0) {
-        g2 = stbtt_FindGlyphIndex((stbtt_fontinfo*)m_info,codepoint2);
+        g2 = pg2!=nullptr?pg2->glyph:stbtt_FindGlyphIndex(info,codepoint2);
         if(g2==0) {
             return gfx_result::not_supported;
         }
         out_glyph_info->glyph_index2 = g2;
     }
     int x1, y1, x2, y2;
-    stbtt_GetGlyphBitmapBox((stbtt_fontinfo*)m_info, g1, m_scale, m_scale, &x1, &y1, &x2, &y2);
+    int advw=0;
+    int k = 0;
+    if(pg1!=nullptr) {
+        // same as stbtt_GetGlyphBitmapBox() but from the preloaded glyph box
+        x1 = STBTT_ifloor(pg1->x0 * m_scale);
+        y1 = STBTT_ifloor(-pg1->y1 * m_scale);
+        x2 = STBTT_iceil(pg1->x1 * m_scale);
+        y2 = STBTT_iceil(-pg1->y0 * m_scale);
+        advw = pg1->advance;
+        if(m_kerning) {
+            if(codepoint2==0 || pg2!=nullptr) {
+                k = preload_kern_find((g1<<16)|g2);
+            } else {
+                k = stbtt_GetGlyphKernAdvance(info, g1, g2);
+            }
+        }
+    } else {
+        stbtt_GetGlyphBitmapBox(info, g1, m_scale, m_scale, &x1, &y1, &x2, &y2);
+        int lsb=0;
+        stbtt_GetGlyphHMetrics(info,g1,&advw,&lsb);
+        if(m_kerning) {
+            k = stbtt_GetGlyphKernAdvance(info, g1, g2);
+        }
+    }
     //printf("(%d,%d)-(%d,%d) @ %d\n",x1,y1,x2,y2,(m_line_advance));
     out_glyph_info->dimensions.width = x2-x1+1;
     out_glyph_info->dimensions.height = y2-y1+1;
     out_glyph_info->offset.x = x1;
     out_glyph_info->offset.y = m_line_height+y1;
     //printf("offset (%d,%d)\n",(int)out_glyph_info->offset.x,(int)out_glyph_info->offset.y);
-    int advw=0;
-    int lsb=0;
-    stbtt_GetGlyphHMetrics((stbtt_fontinfo*)m_info,g1,&advw,&lsb);
     if(!m_kerning) {
         out_glyph_info->advance_width = (uint16_t)floor(((float)advw * m_scale) +
                                          0.5f); /*Horizontal space required by the glyph in [px]*/;
     } else {
-        int k = stbtt_GetGlyphKernAdvance((stbtt_fontinfo*)m_info, g1, g2);
         out_glyph_info->advance_width = (uint16_t)floor((((float)advw + (float)k) * m_scale) + 0.5f);
     }
     return gfx_result::success;
@@ -163,4 +230,209 @@ uint16_t tt_font::line_advance() const {
 uint16_t tt_font::base_line() const {
     return m_base_line;
 }
+float tt_font::scale() const {
+    return m_scale;
+}
+float tt_font::scale(float size, font_size_units units) const {
+    if(m_info==nullptr) {
+        return NAN;
+    }
+    if(units==font_size_units::px) {
+        return stbtt_ScaleForPixelHeight((stbtt_fontinfo*) m_info,size);
+    }
+    return stbtt_ScaleForMappingEmToPixels((stbtt_fontinfo*) m_info,size);
+}
+gfx_result tt_font::preload(int32_t first, int32_t last) {
+    m_preload_first = first;
+    m_preload_last = last;
+    if(m_info==nullptr) {
+        return gfx_result::success;
+    }
+    return load_preload();
+}
+size_t tt_font::preload_memory_size() const {
+    size_t result = 0;
+    if(m_preload_glyphs!=nullptr) {
+        result+=(m_preload_last-m_preload_first+1)*sizeof(preload_glyph_t);
+    }
+    return result+m_preload_kern_capacity*sizeof(preload_kern_t);
+}
+void tt_font::free_preload() {
+    if(m_preload_glyphs!=nullptr) {
+        m_deallocator(m_preload_glyphs);
+        m_preload_glyphs = nullptr;
+    }
+    if(m_preload_kerns!=nullptr) {
+        m_deallocator(m_preload_kerns);
+        m_preload_kerns = nullptr;
+    }
+    m_preload_kern_capacity = 0;
+    m_preload_kern_count = 0;
+}
+static size_t tt_font_kern_hash(uint32_t key, size_t capacity) {
+    // capacity is always a power of two
+    return (size_t)((key*2654435761u)^(key>>15))&(capacity-1);
+}
+bool tt_font::preload_kern_insert(uint32_t key, int16_t adjust) {
+    // keep the table at most half full. keys are never zero since glyph 0 is not kerned
+    if(m_preload_kerns==nullptr || m_preload_kern_capacity<2) {
+        m_preload_kerns = (preload_kern_t*)m_allocator(16*sizeof(preload_kern_t));
+        if(m_preload_kerns==nullptr) {
+            return false;
+        }
+        memset(m_preload_kerns,0,16*sizeof(preload_kern_t));
+        m_preload_kern_capacity = 16;
+    }
+    if((m_preload_kern_count+1)*2>m_preload_kern_capacity) {
+        const size_t cap = m_preload_kern_capacity*2;
+        preload_kern_t* table = (preload_kern_t*)m_allocator(cap*sizeof(preload_kern_t));
+        if(table==nullptr) {
+            return false;
+        }
+        memset(table,0,cap*sizeof(preload_kern_t));
+        for(size_t i = 0;i<m_preload_kern_capacity;++i) {
+            const preload_kern_t& e = m_preload_kerns[i];
+            if(e.key!=0) {
+                size_t j = tt_font_kern_hash(e.key,cap);
+                while(table[j].key!=0) {
+                    j=(j+1)&(cap-1);
+                }
+                table[j]=e;
+            }
+        }
+        m_deallocator(m_preload_kerns);
+        m_preload_kerns = table;
+        m_preload_kern_capacity = cap;
+    }
+    size_t j = tt_font_kern_hash(key,m_preload_kern_capacity);
+    while(m_preload_kerns[j].key!=0 && m_preload_kerns[j].key!=key) {
+        j=(j+1)&(m_preload_kern_capacity-1);
+    }
+    if(m_preload_kerns[j].key==0) {
+        ++m_preload_kern_count;
+    }
+    m_preload_kerns[j].key = key;
+    m_preload_kerns[j].adjust = adjust;
+    return true;
+}
+int16_t tt_font::preload_kern_find(uint32_t key) const {
+    if(m_preload_kerns==nullptr) {
+        return 0;
+    }
+    size_t j = tt_font_kern_hash(key,m_preload_kern_capacity);
+    while(m_preload_kerns[j].key!=0) {
+        if(m_preload_kerns[j].key==key) {
+            return m_preload_kerns[j].adjust;
+        }
+        j=(j+1)&(m_preload_kern_capacity-1);
+    }
+    return 0;
+}
+// indicates whether the glyph is covered as the first glyph of any GPOS pair adjustment.
+// walks the lookups the same way stbtt__GetGlyphGPOSInfoAdvance() does
+static bool tt_font_gpos_covers(const stbtt_fontinfo* info, int glyph) {
+    if(ttUSHORT(info->data, 0 + info->gpos) != 1) return false;
+    if(ttUSHORT(info->data, 2 + info->gpos) != 0) return false;
+    const stbtt_uint32 lookupList = ttUSHORT(info->data, 8 + info->gpos);
+    const stbtt_uint16 lookupCount = ttUSHORT(info->data, lookupList);
+    for(int i = 0; i < lookupCount; ++i) {
+        const stbtt_uint32 lookupTable = lookupList + ttUSHORT(info->data, lookupList + 2 + 2 * i);
+        if(ttUSHORT(info->data, lookupTable) != 2) {
+            continue;
+        }
+        const stbtt_uint16 subTableCount = ttUSHORT(info->data, lookupTable + 4);
+        for(int sti = 0; sti < subTableCount; ++sti) {
+            const stbtt_uint32 table = lookupTable + ttUSHORT(info->data, lookupTable + 6 + 2 * sti);
+            if(-1!=stbtt__GetCoverageIndex(info->data, table + ttUSHORT(info->data, table + 2), glyph)) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+gfx_result tt_font::load_preload() {
+    free_preload();
+    if(m_preload_last<m_preload_first) {
+        return gfx_result::success;
+    }
+    stbtt_fontinfo* info = (stbtt_fontinfo*)m_info;
+    const size_t count = m_preload_last-m_preload_first+1;
+    m_preload_glyphs = (preload_glyph_t*)m_allocator(count*sizeof(preload_glyph_t));
+    if(m_preload_glyphs==nullptr) {
+        return gfx_result::out_of_memory;
+    }
+    // marks which glyphs are in the preloaded range
+    const size_t set_size = (info->numGlyphs+7)/8;
+    uint8_t* set = (uint8_t*)m_allocator(set_size);
+    if(set==nullptr) {
+        free_preload();
+        return gfx_result::out_of_memory;
+    }
+    memset(set,0,set_size);
+    for(size_t i = 0;i<count;++i) {
+        preload_glyph_t& pg = m_preload_glyphs[i];
+        memset(&pg,0,sizeof(pg));
+        int g = stbtt_FindGlyphIndex(info,(int)(m_preload_first+i));
+        if(g<=0 || g>=info->numGlyphs) {
+            continue;
+        }
+        pg.glyph = (uint16_t)g;
+        set[g>>3]|=(1<<(g&7));
+        int advw = 0, lsb = 0;
+        stbtt_GetGlyphHMetrics(info,g,&advw,&lsb);
+        pg.advance = (int16_t)advw;
+        int x0=0,y0=0,x1=0,y1=0;
+        if(stbtt_GetGlyphBox(info,g,&x0,&y0,&x1,&y1)) {
+            pg.x0 = (int16_t)x0;
+            pg.y0 = (int16_t)y0;
+            pg.x1 = (int16_t)x1;
+            pg.y1 = (int16_t)y1;
+        }
+    }
+    gfx_result res = gfx_result::success;
+    if(m_kerning) {
+        if(info->gpos) {
+            // pair adjustments are stored by coverage and class so test each pair in the range
+            // whose first glyph has any
+            for(int g1 = 1;g1<info->numGlyphs && res==gfx_result::success;++g1) {
+                if(0==(set[g1>>3]&(1<<(g1&7))) || !tt_font_gpos_covers(info,g1)) {
+                    continue;
+                }
+                for(int g2 = 1;g2<info->numGlyphs;++g2) {
+                    if(0==(set[g2>>3]&(1<<(g2&7)))) {
+                        continue;
+                    }
+                    int k = stbtt__GetGlyphGPOSInfoAdvance(info,g1,g2);
+                    if(k!=0 && !preload_kern_insert((((uint32_t)g1)<<16)|g2,(int16_t)k)) {
+                        res = gfx_result::out_of_memory;
+                        break;
+                    }
+                }
+            }
+        } else {
+            // the kern table can be walked directly
+            const int length = stbtt_GetKerningTableLength(info);
+            for(int k = 0;k<length;++k) {
+                const stbtt_uint32 entry = info->kern + 18 + (k * 6);
+                const int g1 = ttUSHORT(info->data, entry);
+                const int g2 = ttUSHORT(info->data, entry + 2);
+                if(g1>=info->numGlyphs || g2>=info->numGlyphs ||
+                        0==(set[g1>>3]&(1<<(g1&7))) ||
+                        0==(set[g2>>3]&(1<<(g2&7)))) {
+                    continue;
+                }
+                const int16_t adv = ttSHORT(info->data, entry + 4);
+                if(adv!=0 && !preload_kern_insert((((uint32_t)g1)<<16)|g2,adv)) {
+                    res = gfx_result::out_of_memory;
+                    break;
+                }
+            }
+        }
+    }
+    m_deallocator(set);
+    if(res!=gfx_result::success) {
+        free_preload();
+    }
+    return res;
+}
 }
\ No newline at end of file
@@ -209,8 +209,17 @@ typedef struct {
     size_t size;
 } tvg_lines_t;
 
+// the read-ahead buffer, so the stream isn't read a byte at a time
+#define TVG_READ_BUFFER_SIZE 128
+// path segment counts up to this use no heap memory
+#define TVG_SIZES_INLINE 16
 typedef struct {
     ::gfx::stream* inp;
+    uint8_t read_buffer[TVG_READ_BUFFER_SIZE];
+    size_t read_pos;
+    size_t read_size;
+    // bytes read ahead can only be given back to a seekable stream, so others are read only as needed
+    bool read_ahead;
     ::gfx::canvas* cvs;
     uint8_t scale;
     uint8_t color_encoding;
@@ -222,11 +231,98 @@ typedef struct {
     ::gfx::gradient_stop grad_stops_fill[2];
     ::gfx::gradient grad_stroke;
     ::gfx::gradient_stop grad_stops_stroke[2];
-     
+    // scratch for path segment counts, reused by every command
+    uint32_t sizes_inline[TVG_SIZES_INLINE];
+    uint32_t* sizes;
+    size_t sizes_capacity;
+    void*(*allocator)(size_t);
+    void*(*reallocator)(void*,size_t);
+    void(*deallocator)(void*);
 } tvg_context_t;
 
 typedef gfx_result result_t;
 
+static void tvg_init_context(tvg_context_t* ctx, ::gfx::stream* inp, void*(*allocator)(size_t), void*(*reallocator)(void*,size_t), void(*deallocator)(void*)) {
+    ctx->inp = inp;
+    ctx->read_pos = 0;
+    ctx->read_size = 0;
+    ctx->read_ahead = inp->caps().seek!=0;
+    ctx->cvs = nullptr;
+    ctx->colors = nullptr;
+    ctx->colors_size = 0;
+    ctx->sizes = nullptr;
+    ctx->sizes_capacity = 0;
+    ctx->allocator = allocator;
+    ctx->reallocator = reallocator;
+    ctx->deallocator = deallocator;
+}
+static void tvg_delete_context(tvg_context_t* ctx) {
+    if(ctx->colors!=nullptr) {
+        ctx->deallocator(ctx->colors);
+        ctx->colors = nullptr;
+        ctx->colors_size = 0;
+    }
+    if(ctx->sizes!=nullptr) {
+        ctx->deallocator(ctx->sizes);
+        ctx->sizes = nullptr;
+        ctx->sizes_capacity = 0;
+    }
+}
+// gives back bytes read ahead but not consumed, where the stream allows it
+static void tvg_unread(tvg_context_t* ctx) {
+    if(ctx->read_pos<ctx->read_size && ctx->inp->caps().seek) {
+        ctx->inp->seek(-(long long)(ctx->read_size-ctx->read_pos),io::seek_origin::current);
+    }
+    ctx->read_pos = ctx->read_size = 0;
+}
+// refills the buffer, reading no more than size bytes unless the stream can be given the rest back
+static bool tvg_fill(tvg_context_t* ctx, size_t size) {
+    if(ctx->read_ahead || size>sizeof(ctx->read_buffer)) {
+        size = sizeof(ctx->read_buffer);
+    }
+    ctx->read_pos = 0;
+    ctx->read_size = ctx->inp->read(ctx->read_buffer,size);
+    return ctx->read_size>0;
+}
+static inline bool tvg_read_byte(tvg_context_t* ctx, uint8_t* out_value) {
+    if(ctx->read_pos==ctx->read_size && !tvg_fill(ctx,1)) {
+        return false;
+    }
+    *out_value = ctx->read_buffer[ctx->read_pos++];
+    return true;
+}
+static bool tvg_read_bytes(tvg_context_t* ctx, uint8_t* out_data, size_t size) {
+    while(size>0) {
+        if(ctx->read_pos==ctx->read_size && !tvg_fill(ctx,size)) {
+            return false;
+        }
+        size_t avail = ctx->read_size-ctx->read_pos;
+        if(avail>size) {
+            avail = size;
+        }
+        memcpy(out_data,ctx->read_buffer+ctx->read_pos,avail);
+        ctx->read_pos+=avail;
+        out_data+=avail;
+        size-=avail;
+    }
+    return true;
+}
+// returns room for size segment counts, valid until the next call
+static uint32_t* tvg_sizes(tvg_context_t* ctx, size_t size) {
+    if(size<=TVG_SIZES_INLINE) {
+        return ctx->sizes_inline;
+    }
+    if(size>ctx->sizes_capacity) {
+        uint32_t* sizes = (uint32_t*)(ctx->sizes==nullptr?ctx->allocator(size*sizeof(uint32_t)):ctx->reallocator(ctx->sizes,size*sizeof(uint32_t)));
+        if(sizes==nullptr) {
+            return nullptr;
+        }
+        ctx->sizes = sizes;
+        ctx->sizes_capacity = size;
+    }
+    return ctx->sizes;
+}
+
 static uint32_t tvg_map_zero_to_max(tvg_context_t* ctx,uint32_t value) {
     if(0==value) {
         switch(ctx->coord_range) {
@@ -240,42 +336,36 @@ static uint32_t tvg_map_zero_to_max(tvg_context_t* ctx,uint32_t value) {
     }
     return value;
 }
-static result_t tvg_read_coord(tvg_context_t* ctx,uint32_t* out_raw_value) {   
-    size_t read;
+static result_t tvg_read_coord(tvg_context_t* ctx,uint32_t* out_raw_value) {
+    uint8_t data[4];
     switch(ctx->coord_range) {
-        case TVG_RANGE_DEFAULT: {
-            uint16_t u16;
-            read = ctx->inp->read((uint8_t*)&u16,sizeof(uint16_t));
-            if(sizeof(uint16_t)>read) {
+        case TVG_RANGE_DEFAULT:
+            if(!tvg_read_bytes(ctx,data,2)) {
                 return TVG_E_IO_ERROR;
             }
-            *out_raw_value = u16;
+            *out_raw_value = data[0]|(uint32_t(data[1])<<8);
             return TVG_SUCCESS;
-        }
-        case TVG_RANGE_REDUCED: {
-            uint8_t u8;
-            read = ctx->inp->read((uint8_t*)&u8,sizeof(uint8_t));
-            if(sizeof(uint8_t)>read) {
+        case TVG_RANGE_REDUCED:
+            if(!tvg_read_byte(ctx,data)) {
                 return TVG_E_IO_ERROR;
             }
-            *out_raw_value = u8;
+            *out_raw_value = data[0];
             return TVG_SUCCESS;
-        }
-        default:
-            read = ctx->inp->read((uint8_t*)out_raw_value,sizeof(uint32_t));
-            if(sizeof(uint32_t)>read) {
+        case TVG_RANGE_ENHANCED:
+            if(!tvg_read_bytes(ctx,data,4)) {
                 return TVG_E_IO_ERROR;
             }
+            *out_raw_value = data[0]|(uint32_t(data[1])<<8)|(uint32_t(data[2])<<16)|(uint32_t(data[3])<<24);
             return TVG_SUCCESS;
+        default:
+            return TVG_E_INVALID_FORMAT;
     }
 }
 static result_t tvg_read_color(tvg_context_t* ctx,tvg_rgba_t* out_color) {   
-    size_t read;
     switch(ctx->color_encoding) {
         case TVG_COLOR_F32: {
             tvg_f32_pixel_t data;
-            read = ctx->inp->read((uint8_t*)&data,sizeof(data));
-            if(sizeof(data)>read) {
+            if(!tvg_read_bytes(ctx,(uint8_t*)&data,sizeof(data))) {
                 return TVG_E_IO_ERROR;
             }
             out_color->r = data.r;
@@ -285,11 +375,11 @@ static result_t tvg_read_color(tvg_context_t* ctx,tvg_rgba_t* out_color) {
             return TVG_SUCCESS;
         }
         case TVG_COLOR_U565: {
-            uint16_t data;
-            read = ctx->inp->read((uint8_t*)&data,sizeof(data));
-            if(sizeof(data)>read) {
+            uint8_t bytes[2];
+            if(!tvg_read_bytes(ctx,bytes,2)) {
                 return TVG_E_IO_ERROR;
             }
+            uint16_t data = bytes[0]|(uint16_t(bytes[1])<<8);
             out_color->r = ((float)TVG_RGB16_R(data))/15.0f;
             out_color->g = ((float)TVG_RGB16_G(data))/31.0f;
             out_color->b = ((float)TVG_RGB16_B(data))/15.0f;
@@ -298,20 +388,7 @@ static result_t tvg_read_color(tvg_context_t* ctx,tvg_rgba_t* out_color) {
         }
         case TVG_COLOR_U8888: {
             tvg_rgba32_t data;
-            read = ctx->inp->read((uint8_t*)&data.r,1);
-            if(1>read) {
-                return TVG_E_IO_ERROR;
-            }
-            read = ctx->inp->read((uint8_t*)&data.g,1);
-            if(1>read) {
-                return TVG_E_IO_ERROR;
-            }
-            read = ctx->inp->read((uint8_t*)&data.b,1);
-            if(1>read) {
-                return TVG_E_IO_ERROR;
-            }
-            read = ctx->inp->read((uint8_t*)&data.a,1);
-            if(1>read) {
+            if(!tvg_read_bytes(ctx,(uint8_t*)&data,4)) {
                 return TVG_E_IO_ERROR;
             }
             out_color->r = ((float)data.r)/255.0f;
@@ -327,7 +404,7 @@ static result_t tvg_read_color(tvg_context_t* ctx,tvg_rgba_t* out_color) {
     }
 }
 
-static float tvg_downscale_coord(tvg_context_t* ctx, uint32_t coord) {
+static float tvg_downscale_coord(tvg_context_t* ctx, int32_t coord) {
     uint16_t factor = (((uint16_t)1)<<ctx->scale);
     return (float)coord / (float)factor;
 }
@@ -337,7 +414,7 @@ static result_t tvg_read_u32(tvg_context_t* ctx,uint32_t *out_value) {
     uint32_t result = 0;
     uint8_t byte;
     while (true) {
-        if(1>ctx->inp->read(&byte,1)) {
+        if(!tvg_read_byte(ctx,&byte)) {
             return TVG_E_IO_ERROR;
         }
         const uint32_t val = ((uint32_t)(byte & 0x7F)) << (7 * count);
@@ -355,7 +432,20 @@ static result_t tvg_read_unit(tvg_context_t* ctx, float* out_value) {
     if(res!=TVG_SUCCESS) {
         return res;
     }
-    *out_value = tvg_downscale_coord(ctx,val);
+    // units are signed
+    int32_t ival;
+    switch(ctx->coord_range) {
+        case TVG_RANGE_DEFAULT:
+            ival = (int16_t)val;
+            break;
+        case TVG_RANGE_REDUCED:
+            ival = (int8_t)val;
+            break;
+        default:
+            ival = (int32_t)val;
+            break;
+    }
+    *out_value = tvg_downscale_coord(ctx,ival);
     return TVG_SUCCESS;
 }
 
@@ -376,25 +466,18 @@ static result_t tvg_read_point(tvg_context_t* ctx, tvg_point_t* out_point) {
 
 static result_t tvg_parse_header(tvg_context_t* ctx, int dim_only) {
     uint8_t data[4];
-    
-    if(2>ctx->inp->read((uint8_t*)data,2)) {
+    if(!tvg_read_bytes(ctx,data,4)) {
         return TVG_E_IO_ERROR;
     }
     if(data[0]!=0x72 || data[1]!=0x56) {
         return TVG_E_INVALID_FORMAT;
     }
-    if(1>ctx->inp->read(data,1)) {
-        return TVG_E_IO_ERROR;
-    }
-    if(data[0]!=1) {
+    if(data[2]!=1) {
         return TVG_E_NOT_SUPPORTED;
     }
-    if(1>ctx->inp->read(data,1)) {
-        return TVG_E_IO_ERROR;
-    }
-    ctx->scale = TVG_HEADER_DATA_SCALE(data[0]);
-    ctx->color_encoding =  TVG_HEADER_DATA_COLOR_ENC(data[0]);
-    ctx->coord_range =  TVG_HEADER_DATA_RANGE(data[0]);
+    ctx->scale = TVG_HEADER_DATA_SCALE(data[3]);
+    ctx->color_encoding =  TVG_HEADER_DATA_COLOR_ENC(data[3]);
+    ctx->coord_range =  TVG_HEADER_DATA_RANGE(data[3]);
     uint32_t tmp;
     result_t res = tvg_read_coord(ctx,&tmp);
     if(res!=TVG_SUCCESS) {
@@ -417,7 +500,7 @@ static result_t tvg_parse_header(tvg_context_t* ctx, int dim_only) {
     if(color_count==0) {
         return TVG_E_INVALID_FORMAT;
     }
-    ctx->colors = (tvg_rgba_t*)malloc(color_count*sizeof(tvg_rgba_t));
+    ctx->colors = (tvg_rgba_t*)ctx->allocator(color_count*sizeof(tvg_rgba_t));
     if(ctx->colors==NULL) {
         return TVG_E_OUT_OF_MEMORY;
     }
@@ -425,8 +508,6 @@ static result_t tvg_parse_header(tvg_context_t* ctx, int dim_only) {
     for(size_t i = 0;i<ctx->colors_size;++i) {
         res=tvg_read_color(ctx,&ctx->colors[i]);
         if(res!=TVG_SUCCESS) {
-            free(ctx->colors);
-            ctx->colors = NULL;
             return res;
         }
     }
@@ -441,11 +522,11 @@ static result_t tvg_parse_gradient(tvg_context_t* ctx, tvg_gradient_t* out_gradi
     out_gradient->point1 = pt;
     res = tvg_read_u32(ctx,&u32); if(res!=TVG_SUCCESS) { return res; }
     out_gradient->color0 = u32;
-    if(u32>ctx->colors_size) {
+    if(u32>=ctx->colors_size) {
         return TVG_E_INVALID_FORMAT;
     }
     res = tvg_read_u32(ctx,&u32); if(res!=TVG_SUCCESS) { return res; }
-    if(u32>ctx->colors_size) {
+    if(u32>=ctx->colors_size) {
         return TVG_E_INVALID_FORMAT;
     }
     out_gradient->color1 = u32;
@@ -462,6 +543,9 @@ static result_t tvg_parse_style(tvg_context_t* ctx,int kind, tvg_style_t* out_st
             if(res!=TVG_SUCCESS) {
                 return res;
             }
+            if(flat>=ctx->colors_size) {
+                return TVG_E_INVALID_FORMAT;
+            }
             out_style->flat = flat;
             break;
         case TVG_STYLE_LINEAR:
@@ -656,7 +740,7 @@ static result_t tvg_parse_fill_rectangles(tvg_context_t* ctx,size_t size, const
         res=tvg_read_unit(ctx,&w); if(res!=TVG_SUCCESS) return res;
         res=tvg_read_unit(ctx,&h); if(res!=TVG_SUCCESS) return res;
         res=ctx->cvs->rectangle({pt.x,pt.y,pt.x+w-1,pt.y+h-1}); if(res!=TVG_SUCCESS) return res;
-        ctx->cvs->render();
+        ctx->cvs->render(false,ctx->allocator,ctx->reallocator,ctx->deallocator);
     }
     return TVG_SUCCESS;
 }
@@ -674,7 +758,7 @@ static result_t tvg_parse_fill_polygon(tvg_context_t* ctx,size_t size, const tvg
         res = tvg_read_point(ctx,&pt); if(res!=TVG_SUCCESS) return res;
         res=ctx->cvs->line_to({pt.x,pt.y});if(res!=TVG_SUCCESS) return res;
     }
-    res = ctx->cvs->render();
+    res = ctx->cvs->render(false,ctx->allocator,ctx->reallocator,ctx->deallocator);
     return res;
 }
 static result_t tvg_parse_lines_header(tvg_context_t* ctx,int kind,tvg_lines_t* out_header) {
@@ -699,7 +783,7 @@ static result_t tvg_parse_lines_header(tvg_context_t* ctx,int kind,tvg_lines_t*
 static result_t tvg_parse_outline_fill_header(tvg_context_t* ctx,int kind,tvg_outline_fill_t* out_header) {
     //uint32_t u32;
     uint8_t d;
-    if(1>ctx->inp->read(&d,1)) {
+    if(!tvg_read_byte(ctx,&d)) {
         return TVG_E_IO_ERROR;
     }
     result_t res = TVG_SUCCESS;
@@ -733,7 +817,8 @@ static result_t tvg_parse_path(tvg_context_t* ctx, size_t size) {
     st = pt;
     cur = pt;
     for(size_t j=0;j<size;++j) {     
-        if(1>ctx->inp->read(&d,1)) {
+        if(!tvg_read_byte(ctx,&d)) {
+            res = TVG_E_IO_ERROR;
             goto error;
         }
         float line_width=0.0f;
@@ -780,7 +865,7 @@ static result_t tvg_parse_path(tvg_context_t* ctx, size_t size) {
             break;
             case TVG_PATH_ARC_CIRCLE: {
                 uint8_t d;
-                if(1>ctx->inp->read(&d,1)) {
+                if(!tvg_read_byte(ctx,&d)) {
                     res = TVG_E_IO_ERROR;
                     goto error;
                 }
@@ -799,7 +884,7 @@ static result_t tvg_parse_path(tvg_context_t* ctx, size_t size) {
             break;
             case TVG_PATH_ARC_ELLIPSE: {
                 uint8_t d;
-                if(1>ctx->inp->read(&d,1)) {
+                if(!tvg_read_byte(ctx,&d)) {
                     res = TVG_E_IO_ERROR;
                     goto error;
                 }
@@ -893,7 +978,7 @@ static result_t tvg_parse_polyline(tvg_context_t* ctx,size_t size, const tvg_sty
     }
     ctx->cvs->stroke_width(line_width);
     // render
-    res=ctx->cvs->render();
+    res=ctx->cvs->render(false,ctx->allocator,ctx->reallocator,ctx->deallocator);
     return res;
 }
 static result_t tvg_parse_lines(tvg_context_t* ctx,size_t size, const tvg_style_t* line_style, float line_width) {
@@ -930,14 +1015,14 @@ static result_t tvg_parse_lines(tvg_context_t* ctx,size_t size, const tvg_style_
     }
     ctx->cvs->stroke_width(line_width);
     // render
-    res=ctx->cvs->render();
+    res=ctx->cvs->render(false,ctx->allocator,ctx->reallocator,ctx->deallocator);
     return res;
 
 }
 static result_t tvg_parse_fill_paths(tvg_context_t* ctx, size_t size, const tvg_style_t* style) {
     result_t res=TVG_SUCCESS;
     size_t total = 0;
-    uint32_t* sizes = (uint32_t*)malloc(size*sizeof(uint32_t));
+    uint32_t* sizes = tvg_sizes(ctx,size);
     if(sizes==NULL) {
         return TVG_E_OUT_OF_MEMORY;
     }
@@ -963,15 +1048,14 @@ static result_t tvg_parse_fill_paths(tvg_context_t* ctx, size_t size, const tvg_
             goto error;
         }
     }
-    res=ctx->cvs->render();
+    res=ctx->cvs->render(false,ctx->allocator,ctx->reallocator,ctx->deallocator);
 error:
-    free(sizes);
     return res;
 }
 static result_t tvg_parse_line_paths(tvg_context_t* ctx, size_t size, const tvg_style_t* line_style, float line_width) {
     result_t res=TVG_SUCCESS;
     size_t total = 0;
-    uint32_t* sizes = (uint32_t*)malloc(size*sizeof(uint32_t));
+    uint32_t* sizes = tvg_sizes(ctx,size);
     if(sizes==NULL) {
         return TVG_E_OUT_OF_MEMORY;
     }
@@ -992,6 +1076,14 @@ static result_t tvg_parse_line_paths(tvg_context_t* ctx, size_t size, const tvg_
     if(res!=TVG_SUCCESS) {
         goto error;
     }
+    // line paths carry their width outside the style, so it has to be
+    // set here or the stroke keeps whatever width the last command left.
+    // tinyvg allows a width of 0, which the stroker would turn into an
+    // empty outline, so it is bumped to the thinnest usable width
+    if(line_width==0) {
+        line_width = .001;
+    }
+    ctx->cvs->stroke_width(line_width);
     // parse path
     for(size_t i = 0; i<size;++i) {
         res = tvg_parse_path(ctx,sizes[i]);
@@ -999,9 +1091,8 @@ static result_t tvg_parse_line_paths(tvg_context_t* ctx, size_t size, const tvg_
             goto error;
         }
     }
-    res=ctx->cvs->render();
+    res=ctx->cvs->render(false,ctx->allocator,ctx->reallocator,ctx->deallocator);
 error:
-    free(sizes);
     return res;
 }
 static result_t tvg_parse_outline_fill_polyline(tvg_context_t* ctx, size_t size, const tvg_style_t* fill_style,const tvg_style_t* line_style,float line_width, bool close) {    
@@ -1040,7 +1131,7 @@ static result_t tvg_parse_outline_fill_polyline(tvg_context_t* ctx, size_t size,
     if(res!=TVG_SUCCESS) {
         return res;
     }
-    ctx->cvs->render(true);
+    ctx->cvs->render(true,ctx->allocator,ctx->reallocator,ctx->deallocator);
     ctx->cvs->fill_rule(fill_rule::even_odd);
     ctx->cvs->stroke_paint_type(paint_type::none);
     ctx->cvs->fill_paint_type(paint_type::none);
@@ -1053,7 +1144,7 @@ static result_t tvg_parse_outline_fill_polyline(tvg_context_t* ctx, size_t size,
     }
     ctx->cvs->stroke_width(line_width);
     // render
-    res=ctx->cvs->render();
+    res=ctx->cvs->render(false,ctx->allocator,ctx->reallocator,ctx->deallocator);
     return res;
 }
 static result_t tvg_parse_outline_fill_rectangles(tvg_context_t* ctx,size_t size, const tvg_style_t* fill_style,const tvg_style_t* line_style,float line_width) {
@@ -1076,7 +1167,7 @@ static result_t tvg_parse_outline_fill_rectangles(tvg_context_t* ctx,size_t size
         if(res!=TVG_SUCCESS) return res;
         res=ctx->cvs->rectangle(rectf(pt,sizef(w,h)));
         if(res!=TVG_SUCCESS) return res;
-        res=ctx->cvs->render(true);
+        res=ctx->cvs->render(true,ctx->allocator,ctx->reallocator,ctx->deallocator);
         if(res!=TVG_SUCCESS) return res;
         ctx->cvs->stroke_paint_type(paint_type::none);
         ctx->cvs->fill_paint_type(paint_type::none);
@@ -1084,7 +1175,7 @@ static result_t tvg_parse_outline_fill_rectangles(tvg_context_t* ctx,size_t size
         res = tvg_apply_style(ctx,line_style,true);
         if(res!=TVG_SUCCESS) return res;
         // render
-        res=ctx->cvs->render();
+        res=ctx->cvs->render(false,ctx->allocator,ctx->reallocator,ctx->deallocator);
         if(res!=TVG_SUCCESS) return res;
     }
     return TVG_SUCCESS;
@@ -1093,7 +1184,7 @@ static result_t tvg_parse_outline_fill_rectangles(tvg_context_t* ctx,size_t size
 static result_t tvg_parse_outline_fill_paths(tvg_context_t* ctx, size_t size, const tvg_style_t* fill_style,const tvg_style_t* line_style,float line_width) {
     result_t res=TVG_SUCCESS;    
     size_t total = 0;
-    uint32_t* sizes = (uint32_t*)malloc(size*sizeof(uint32_t));
+    uint32_t* sizes = tvg_sizes(ctx,size);
     if(sizes==NULL) {
         return TVG_E_OUT_OF_MEMORY;
     }
@@ -1101,7 +1192,6 @@ static result_t tvg_parse_outline_fill_paths(tvg_context_t* ctx, size_t size, co
          res = tvg_read_u32(ctx,&sizes[i]);
          ++sizes[i];
          if(res!=TVG_SUCCESS) {
-            free(sizes);
             return res;
          }
          total += sizes[i];
@@ -1118,7 +1208,7 @@ static result_t tvg_parse_outline_fill_paths(tvg_context_t* ctx, size_t size, co
     ctx->cvs->stroke_paint_type(paint_type::none);
     ctx->cvs->fill_paint_type(paint_type::none);
     res = tvg_apply_style(ctx,fill_style,false);
-    res=ctx->cvs->render(true);
+    res=ctx->cvs->render(true,ctx->allocator,ctx->reallocator,ctx->deallocator);
     ctx->cvs->stroke_paint_type(paint_type::none);
     ctx->cvs->fill_paint_type(paint_type::none);
     res = tvg_apply_style(ctx,line_style,true);
@@ -1130,9 +1220,8 @@ static result_t tvg_parse_outline_fill_paths(tvg_context_t* ctx, size_t size, co
     }
     ctx->cvs->stroke_width(line_width);
     // render
-    res=ctx->cvs->render();
+    res=ctx->cvs->render(false,ctx->allocator,ctx->reallocator,ctx->deallocator);
 error:
-    free(sizes);
     return res;
 }
 
@@ -1140,7 +1229,7 @@ static result_t tvg_parse_commands(tvg_context_t* ctx) {
     result_t res = TVG_SUCCESS;
     uint8_t cmd = 255;
     while(cmd!=0) {
-        if(1>ctx->inp->read(&cmd,1)) {
+        if(!tvg_read_byte(ctx,&cmd)) {
             return TVG_E_IO_ERROR;
         }
         switch(TVG_CMD_INDEX(cmd)) {
@@ -1283,9 +1372,7 @@ static result_t tvg_document_dimensions(::gfx::stream& stm, sizef *out_dimension
     if(stm.caps().seek) {
         pos = stm.seek(0,io::seek_origin::current);
     }
-    ctx.inp = &stm;
-    ctx.colors = NULL;
-    ctx.colors_size = 0;
+    tvg_init_context(&ctx,&stm,::malloc,::realloc,::free);
     result_t res = tvg_parse_header(&ctx,1);
     if(res!=TVG_SUCCESS) {
         return res;
@@ -1297,16 +1384,13 @@ static result_t tvg_document_dimensions(::gfx::stream& stm, sizef *out_dimension
     }
     return res;
 }
-static result_t tvg_render_document(::gfx::stream& stm, ::gfx::canvas& canvas, const matrix& transform) {
+static result_t tvg_render_document(::gfx::stream& stm, ::gfx::canvas& canvas, const matrix& transform,void*(*allocator)(size_t),void*(*reallocator)(void*,size_t),void(*deallocator)(void*)) {
     tvg_context_t ctx;
-    ::gfx::matrix m;
     if(stm.caps().read==0) {
         return TVG_E_INVALID_ARG;
     }
-    ctx.inp = &stm;
+    tvg_init_context(&ctx,&stm,allocator,reallocator,deallocator);
     ctx.cvs = &canvas;
-    ctx.colors = NULL;
-    ctx.colors_size = 0;
     result_t res = tvg_parse_header(&ctx,0);
     if(res!=TVG_SUCCESS) {
         goto error;
@@ -1317,17 +1401,22 @@ static result_t tvg_render_document(::gfx::stream& stm, ::gfx::canvas& canvas, c
         goto error;
     }
 error:
-    if(ctx.colors!=NULL) {
-        free(ctx.colors);
-        ctx.colors = NULL;
-        ctx.colors_size = 0;
-    }
-        
+    tvg_unread(&ctx);
+    tvg_delete_context(&ctx);
     return res;
 }
 
 gfx_result canvas::render_tvg(stream& document, const matrix& transform,void*(*allocator)(size_t),void*(*reallocator)(void*,size_t),void(*deallocator)(void*)) {
-    return tvg_render_document(document,*this,transform);
+    if(allocator==nullptr) {
+        allocator = this->m_allocator;
+    }
+    if(reallocator==nullptr) {
+        reallocator = this->m_reallocator;
+    }
+    if(deallocator==nullptr) {
+        deallocator = this->m_deallocator;
+    }
+    return tvg_render_document(document,*this,transform,allocator,reallocator,deallocator);
 }
 gfx_result canvas::tvg_dimensions(stream& document, sizef* out_dimensions) {
     return tvg_document_dimensions(document,out_dimensions);
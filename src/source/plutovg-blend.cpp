@@ -4,6 +4,7 @@
 #include <gfx_core.hpp>
 #include <gfx_pixel.hpp>
 #include <gfx_positioning.hpp>
+#include <gfx_trace.hpp>
 
 #include "plutovg-private.h"
 #include "plutovg-utils.h"
@@ -1681,8 +1682,10 @@ static void plutovg_blend_texture(plutovg_canvas_t* canvas,
 
 bool plutovg_blend(plutovg_canvas_t* canvas,
                    const plutovg_span_buffer_t* span_buffer) {
-    if(span_buffer->spans.data==nullptr) return false;
+    HTCW_GFX_TRACE_SCOPE("canvas", "blend");
+    // nothing to blend. the buffer may never have been allocated
     if (span_buffer->spans.size == 0) return true;
+    if(span_buffer->spans.data==nullptr) return false;
     if (canvas->state->paint == NULL) {
         plutovg_blend_color(canvas, &canvas->state->color, span_buffer);
         return true;
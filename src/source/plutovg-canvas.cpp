@@ -808,16 +808,20 @@ float plutovg_canvas_add_text(plutovg_canvas_t* canvas, const ::gfx::text_handle
     if(state->font_face == NULL || state->font_size <= 0.f)
         return 0.f;
     float advance_width = 0.f;
-    int32_t cp;
+    int32_t cp[32];
     const uint8_t* data = (const uint8_t*)text;
     while(length) {
         size_t l = length;
-        if(::gfx::gfx_result::success!=encoding->to_utf32((::gfx::text_handle)data,&cp,&l)) {
-            return NAN;
-        }
+        size_t count = sizeof(cp)/sizeof(*cp);
+        ::gfx::gfx_result res = encoding->to_utf32_array((::gfx::text_handle)data,&l,cp,&count);
         data+=l;
         length-=l;
-        advance_width += plutovg_font_face_get_glyph_path(state->font_face, state->font_size, x + advance_width, y,(plutovg_codepoint_t)cp, canvas->path);
+        for(size_t i = 0;i<count;++i) {
+            advance_width += plutovg_font_face_get_glyph_path(state->font_face, state->font_size, x + advance_width, y,(plutovg_codepoint_t)cp[i], canvas->path);
+        }
+        if(res!=::gfx::gfx_result::success || count==0) {
+            return NAN;
+        }
     }
     return advance_width;
 }
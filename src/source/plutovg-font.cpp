@@ -10,13 +10,19 @@
 #define STBTT_HEAP_FACTOR_SIZE_32 50
 #define STBTT_HEAP_FACTOR_SIZE_128 20
 #define STBTT_HEAP_FACTOR_SIZE_DEFAULT 10
-#define STBTT_malloc(x, u) ((void)(u), malloc(x))
-#define STBTT_free(x, u) ((void)(u), free(x))
+// stbtt gets the face's allocators through the userdata of its font info
+#define STBTT_malloc(x, u) ((u)!=NULL?((plutovg_font_allocators_t*)(u))->allocator(x):malloc(x))
+#define STBTT_free(x, u) ((u)!=NULL?((plutovg_font_allocators_t*)(u))->deallocator(x):free(x))
 /* for stream support */
 #define STBTT_STREAM_TYPE void*
 #define STBTT_STREAM_SEEK(s, x) do { gfx::stream* stm = (gfx::stream*)(s); stm->seek((long long)(x)); } while(0);
 #define STBTT_STREAM_READ(s, x, y) do {gfx::stream* stm = (gfx::stream*)(s);stm->read((uint8_t*)(x),(y));} while(0);
 
+typedef struct {
+    void*(*allocator)(size_t);
+    void(*deallocator)(void*);
+} plutovg_font_allocators_t;
+
 #include "stb_rect_pack.h"
 #include "stb_truetype.h"
 
@@ -147,11 +153,12 @@ struct plutovg_font_face {
     int y2;
     stbtt_fontinfo info;
     glyph_t** glyphs[GLYPH_CACHE_SIZE];
+    plutovg_font_allocators_t allocators;
     plutovg_destroy_func_t destroy_func;
     void* closure;
 };
 
-plutovg_font_face_t* plutovg_font_face_load_from_stream(gfx::stream& stm, int ttcindex, plutovg_destroy_func_t destroy_func, void* closure)
+plutovg_font_face_t* plutovg_font_face_load_from_stream(gfx::stream& stm, int ttcindex, plutovg_destroy_func_t destroy_func, void* closure, void*(*allocator)(size_t), void(*deallocator)(void*))
 {
     stbtt_fontinfo info;
     
@@ -162,7 +169,7 @@ plutovg_font_face_t* plutovg_font_face_load_from_stream(gfx::stream& stm, int tt
         return NULL;
     }
 
-    plutovg_font_face_t* face = (plutovg_font_face_t*)malloc(sizeof(plutovg_font_face_t));
+    plutovg_font_face_t* face = (plutovg_font_face_t*)allocator(sizeof(plutovg_font_face_t));
     if(face==nullptr) {
         if(destroy_func)
             destroy_func(closure);
@@ -170,6 +177,9 @@ plutovg_font_face_t* plutovg_font_face_load_from_stream(gfx::stream& stm, int tt
     }
     face->ref_count = 1;
     face->info = info;
+    face->allocators.allocator = allocator;
+    face->allocators.deallocator = deallocator;
+    face->info.userdata = &face->allocators;
     stbtt_GetFontVMetrics(&face->info, &face->ascent, &face->descent, &face->line_gap);
     stbtt_GetFontBoundingBox(&face->info, &face->x1, &face->y1, &face->x2, &face->y2);
     memset(face->glyphs, 0, sizeof(face->glyphs));
@@ -199,15 +209,15 @@ void plutovg_font_face_destroy(plutovg_font_face_t* face)
                 if(glyph == NULL)
                     continue;
                 stbtt_FreeShape(&face->info, glyph->vertices);
-                free(glyph);
+                face->allocators.deallocator(glyph);
             }
 
-            free(face->glyphs[i]);
+            face->allocators.deallocator(face->glyphs[i]);
         }
 
         if(face->destroy_func)
             face->destroy_func(face->closure);
-        free(face);
+        face->allocators.deallocator(face);
     }
 }
 
@@ -241,7 +251,12 @@ static glyph_t* get_glyph(const plutovg_font_face_t* face, plutovg_codepoint_t c
 {
     unsigned int msb = (codepoint >> 8) & 0xFF;
     if(face->glyphs[msb] == NULL) {
-        ((plutovg_font_face_t*)face)->glyphs[msb] = (glyph_t**)calloc(GLYPH_CACHE_SIZE, sizeof(glyph_t*));
+        glyph_t** glyphs = (glyph_t**)face->allocators.allocator(GLYPH_CACHE_SIZE*sizeof(glyph_t*));
+        if(glyphs==nullptr) {
+            return nullptr;
+        }
+        memset(glyphs, 0, GLYPH_CACHE_SIZE*sizeof(glyph_t*));
+        ((plutovg_font_face_t*)face)->glyphs[msb] = glyphs;
     }
 
     unsigned int lsb = codepoint & 0xFF;
@@ -249,7 +264,7 @@ static glyph_t* get_glyph(const plutovg_font_face_t* face, plutovg_codepoint_t c
         return face->glyphs[msb][lsb];
     }
 
-    glyph_t* glyph = (glyph_t*)malloc(sizeof(glyph_t));
+    glyph_t* glyph = (glyph_t*)face->allocators.allocator(sizeof(glyph_t));
     if(glyph==nullptr) {
         return nullptr;
     }
@@ -265,6 +280,12 @@ void plutovg_font_face_get_glyph_metrics(const plutovg_font_face_t* face, float
 {
     float scale = plutovg_font_face_get_scale(face, size);
     glyph_t* glyph = get_glyph(face, codepoint);
+    if(glyph == NULL) {
+        if(advance_width) *advance_width = 0;
+        if(left_side_bearing) *left_side_bearing = 0;
+        if(extents) extents->x = extents->y = extents->w = extents->h = 0;
+        return;
+    }
     if(advance_width) *advance_width = glyph->advance_width * scale;
     if(left_side_bearing) *left_side_bearing = glyph->left_side_bearing * scale;
     if(extents) {
@@ -314,6 +335,8 @@ float plutovg_font_face_traverse_glyph_path(const plutovg_font_face_t* face, flo
     ::gfx::pointf points[3];
     ::gfx::pointf current_point(0, 0);
     glyph_t* glyph = get_glyph(face, codepoint);
+    if(glyph == NULL)
+        return 0;
     for(int i = 0; i < glyph->nvertices; i++) {
         switch(glyph->vertices[i].type) {
         case STBTT_vmove:
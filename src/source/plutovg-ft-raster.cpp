@@ -1654,10 +1654,13 @@ static int gray_convert_glyph( RAS_ARG )
               rendered_spans += -worker->skip_spans;
           worker->skip_spans = rendered_spans;
           length += PVG_FT_MINIMUM_POOL_SIZE;
-          memory = params->reallocator(memory, length);
-          if(memory==nullptr) {
+          void* new_memory = params->reallocator(memory, length);
+          if(new_memory==nullptr) {
+            params->deallocator(memory);
+            params->deallocator(worker);
             return false;
           }
+          memory = new_memory;
           error = gray_raster_render(worker, memory, length, params);
       }
       params->deallocator(memory);
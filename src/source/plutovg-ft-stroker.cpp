@@ -235,6 +235,8 @@ typedef struct PVG_FT_StrokeBorderRec_ {
     vector_bool_t    movable; /* TRUE for ends of lineto borders */
     vector_int_t     start;   /* index of current sub-path start point */
     vector_bool_t    valid;
+    void*(*reallocator)(void*,size_t);
+    void(*deallocator)(void*);
 
 } PVG_FT_StrokeBorderRec, *PVG_FT_StrokeBorder;
 
@@ -321,12 +323,14 @@ static vector_error_t ft_stroke_border_grow(PVG_FT_StrokeBorder border,
 
         while (cur_max < new_max) cur_max += (cur_max >> 1) + 16;
 
-        border->points = (vector_t*)realloc(border->points,
+        vector_t* points = (vector_t*)border->reallocator(border->points,
                                                 cur_max * sizeof(vector_t));
-        border->tags =
-            (vector_byte_t*)realloc(border->tags, cur_max * sizeof(vector_byte_t));
-
-        if (!border->points || !border->tags) goto Exit;
+        if (!points) { error = -1; goto Exit; }
+        border->points = points;
+        vector_byte_t* tags =
+            (vector_byte_t*)border->reallocator(border->tags, cur_max * sizeof(vector_byte_t));
+        if (!tags) { error = -1; goto Exit; }
+        border->tags = tags;
 
         border->max_points = cur_max;
     }
@@ -554,8 +558,12 @@ static vector_error_t ft_stroke_border_moveto(PVG_FT_StrokeBorder border,
     return ft_stroke_border_lineto(border, to, FALSE);
 }
 
-static void ft_stroke_border_init(PVG_FT_StrokeBorder border)
+static void ft_stroke_border_init(PVG_FT_StrokeBorder border,
+                                  void*(*reallocator)(void*,size_t),
+                                  void(*deallocator)(void*))
 {
+    border->reallocator = reallocator;
+    border->deallocator = deallocator;
     border->points = NULL;
     border->tags = NULL;
 
@@ -574,8 +582,10 @@ static void ft_stroke_border_reset(PVG_FT_StrokeBorder border)
 
 static void ft_stroke_border_done(PVG_FT_StrokeBorder border)
 {
-    free(border->points);
-    free(border->tags);
+    if (border->points) border->deallocator(border->points);
+    if (border->tags) border->deallocator(border->tags);
+    border->points = NULL;
+    border->tags = NULL;
 
     border->num_points = 0;
     border->max_points = 0;
@@ -697,19 +707,27 @@ typedef struct PVG_FT_StrokerRec_ {
     vector_fixed_t            radius;
 
     PVG_FT_StrokeBorderRec borders[2];
+    void(*deallocator)(void*);
 } PVG_FT_StrokerRec;
 
 /* documentation is in ftstroke.h */
 
-vector_error_t PVG_FT_Stroker_New(PVG_FT_Stroker* astroker)
+vector_error_t PVG_FT_Stroker_New(PVG_FT_Stroker* astroker,
+                                  void*(*allocator)(size_t),
+                                  void*(*reallocator)(void*,size_t),
+                                  void(*deallocator)(void*))
 {
     vector_error_t   error = 0; /* assigned in PVG_FT_NEW */
     PVG_FT_Stroker stroker = NULL;
 
-    stroker = (PVG_FT_StrokerRec*)calloc(1, sizeof(PVG_FT_StrokerRec));
+    stroker = (PVG_FT_StrokerRec*)allocator(sizeof(PVG_FT_StrokerRec));
     if (stroker) {
-        ft_stroke_border_init(&stroker->borders[0]);
-        ft_stroke_border_init(&stroker->borders[1]);
+        memset(stroker, 0, sizeof(PVG_FT_StrokerRec));
+        stroker->deallocator = deallocator;
+        ft_stroke_border_init(&stroker->borders[0], reallocator, deallocator);
+        ft_stroke_border_init(&stroker->borders[1], reallocator, deallocator);
+    } else {
+        error = -1;
     }
 
     *astroker = stroker;
@@ -755,7 +773,7 @@ void PVG_FT_Stroker_Done(PVG_FT_Stroker stroker)
         ft_stroke_border_done(&stroker->borders[0]);
         ft_stroke_border_done(&stroker->borders[1]);
 
-        free(stroker);
+        stroker->deallocator(stroker);
     }
 }
 
@@ -164,6 +164,9 @@ typedef enum  PVG_FT_StrokerBorder_
  *   library ::
  *     FreeType library handle.
  *
+ *   allocator, reallocator, deallocator ::
+ *     The functions used for the stroker and its border memory.
+ *
  * @output:
  *   astroker ::
  *     A new stroker object handle.  NULL in case of error.
@@ -172,7 +175,10 @@ typedef enum  PVG_FT_StrokerBorder_
  *    FreeType error code.  0~means success.
  */
 vector_error_t
-PVG_FT_Stroker_New( PVG_FT_Stroker  *astroker );
+PVG_FT_Stroker_New( PVG_FT_Stroker  *astroker,
+                    void*(*allocator)(size_t),
+                    void*(*reallocator)(void*,size_t),
+                    void(*deallocator)(void*) );
 
 
 /**************************************************************
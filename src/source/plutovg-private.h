@@ -165,6 +165,12 @@ bool plutovg_span_buffer_copy(plutovg_span_buffer_t* span_buffer, const plutovg_
 void plutovg_span_buffer_extents(plutovg_span_buffer_t* span_buffer, plutovg_rect_t* extents);
 bool plutovg_span_buffer_intersect(plutovg_span_buffer_t* span_buffer, const plutovg_span_buffer_t* a, const plutovg_span_buffer_t* b);
 
+/* rasterizes axis aligned rectangles, and axis aligned lines with butt or square caps, directly. */
+/* returns false when the path isn't one of them. the spans match plutovg_rasterize_outline()'s. */
+bool plutovg_rasterize_rect(plutovg_span_buffer_t* span_buffer, const plutovg_path_t* path, const ::gfx::matrix* matrix, const plutovg_rect_t* clip_rect, const plutovg_stroke_data_t* stroke_data, bool* out_result);
+/* rasterizes any path through the stroker and the cell rasterizer */
+bool plutovg_rasterize_outline(plutovg_span_buffer_t* span_buffer, const plutovg_path_t* path, const ::gfx::matrix* matrix, const plutovg_rect_t* clip_rect, const plutovg_stroke_data_t* stroke_data, plutovg_fill_rule_t winding,void*(*allocator)(size_t),void*(*reallocator)(void*,size_t),void(*deallocator)(void*));
+/* plutovg_rasterize_rect() when it applies, and plutovg_rasterize_outline() otherwise */
 bool plutovg_rasterize(plutovg_span_buffer_t* span_buffer, const plutovg_path_t* path, const ::gfx::matrix* matrix, const plutovg_rect_t* clip_rect, const plutovg_stroke_data_t* stroke_data, plutovg_fill_rule_t winding,void*(*allocator)(size_t),void*(*reallocator)(void*,size_t),void(*deallocator)(void*));
 bool plutovg_blend(plutovg_canvas_t* canvas, const plutovg_span_buffer_t* span_buffer);
 
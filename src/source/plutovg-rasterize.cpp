@@ -3,6 +3,7 @@
 
 #include "plutovg-ft-raster.h"
 #include "plutovg-ft-stroker.h"
+#include <gfx_trace.hpp>
 
 #include <limits.h>
 #include <memory.h>
@@ -244,12 +245,12 @@ static void ft_outline_end(PVG_FT_Outline* ft)
     }
 }
 
-static PVG_FT_Outline* ft_outline_convert_stroke(const plutovg_path_t* path, const ::gfx::matrix* matrix, const plutovg_stroke_data_t* stroke_data,void*(*allocator)(size_t),void*(*reallocator)(void*,size_t), void(*deallocator)(void*));
+static PVG_FT_Outline* ft_outline_convert_stroke(const plutovg_path_t* path, const ::gfx::matrix* matrix, const plutovg_stroke_data_t* stroke_data, const plutovg_rect_t* clip_rect,void*(*allocator)(size_t),void*(*reallocator)(void*,size_t), void(*deallocator)(void*));
 
-static PVG_FT_Outline* ft_outline_convert(const plutovg_path_t* path, const ::gfx::matrix* matrix, const plutovg_stroke_data_t* stroke_data,void*(*allocator)(size_t),void*(*reallocator)(void*,size_t),void(*deallocator)(void*))
+static PVG_FT_Outline* ft_outline_convert(const plutovg_path_t* path, const ::gfx::matrix* matrix, const plutovg_stroke_data_t* stroke_data, const plutovg_rect_t* clip_rect,void*(*allocator)(size_t),void*(*reallocator)(void*,size_t),void(*deallocator)(void*))
 {
     if(stroke_data != NULL) {
-        return ft_outline_convert_stroke(path, matrix, stroke_data,allocator,reallocator,deallocator);
+        return ft_outline_convert_stroke(path, matrix, stroke_data, clip_rect,allocator,reallocator,deallocator);
     }
 
     plutovg_path_iterator_t it;
@@ -286,15 +287,138 @@ static PVG_FT_Outline* ft_outline_convert(const plutovg_path_t* path, const ::gf
     return outline;
 }
 
+static bool ft_outline_segment_visible(const PVG_FT_Outline* outline, int from, int to, const PVG_FT_BBox* box)
+{
+    vector_pos_t x1 = outline->points[from].x, x2 = x1;
+    vector_pos_t y1 = outline->points[from].y, y2 = y1;
+    for(int i = from + 1; i <= to; ++i) {
+        const vector_t& pt = outline->points[i];
+        if(pt.x < x1) x1 = pt.x;
+        if(pt.x > x2) x2 = pt.x;
+        if(pt.y < y1) y1 = pt.y;
+        if(pt.y > y2) y2 = pt.y;
+    }
+    return x2 >= box->xMin && x1 <= box->xMax && y2 >= box->yMin && y1 <= box->yMax;
+}
+
+static bool ft_outline_line_visible(const vector_t* from, const vector_t* to, const PVG_FT_BBox* box)
+{
+    return plutovg_max(from->x, to->x) >= box->xMin && plutovg_min(from->x, to->x) <= box->xMax &&
+           plutovg_max(from->y, to->y) >= box->yMin && plutovg_min(from->y, to->y) <= box->yMax;
+}
+
+// the index of the on curve point that ends the segment starting at index
+static int ft_outline_segment_end(const PVG_FT_Outline* outline, int index, int last)
+{
+    ++index;
+    while(index < last && PVG_FT_CURVE_TAG(outline->tags[index]) != PVG_FT_CURVE_TAG_ON)
+        ++index;
+    return index;
+}
+
+// Replaces the segments of an outline about to be stroked that lie outside box,
+// which is the clip grown by the reach of the stroke, with straight lines, and
+// merges runs of them where the line stays outside box. Lines are much cheaper
+// for the stroker than the curves they replace. Segments next to one that
+// can be seen are kept as they are, since their joins decide where the borders
+// of the visible segment end, so the visible result is unchanged. Returns
+// outline itself when nothing can be simplified.
+static PVG_FT_Outline* ft_outline_cull(PVG_FT_Outline* outline, const PVG_FT_BBox* box,void*(*allocator)(size_t))
+{
+    if(outline->n_points == 0)
+        return outline;
+    PVG_FT_BBox cbox;
+    cbox.xMin = cbox.xMax = outline->points[0].x;
+    cbox.yMin = cbox.yMax = outline->points[0].y;
+    for(int i = 1; i < outline->n_points; ++i) {
+        const vector_t& pt = outline->points[i];
+        if(pt.x < cbox.xMin) cbox.xMin = pt.x;
+        if(pt.x > cbox.xMax) cbox.xMax = pt.x;
+        if(pt.y < cbox.yMin) cbox.yMin = pt.y;
+        if(pt.y > cbox.yMax) cbox.yMax = pt.y;
+    }
+    if(cbox.xMin >= box->xMin && cbox.xMax <= box->xMax && cbox.yMin >= box->yMin && cbox.yMax <= box->yMax)
+        return outline;
+    PVG_FT_Outline* result = ft_outline_create(outline->n_points, outline->n_points, allocator);
+    if(result == nullptr)
+        return nullptr;
+    int first = 0;
+    for(int n = 0; n < outline->n_contours; ++n) {
+        const int last = outline->contours[n];
+        const bool closed = outline->contours_flag[n] == 0;
+        result->points[result->n_points] = outline->points[first];
+        result->tags[result->n_points++] = outline->tags[first];
+        if(last > first) {
+            int i = first;
+            int end = ft_outline_segment_end(outline, i, last);
+            bool current = ft_outline_segment_visible(outline, i, end, box);
+            const bool first_visible = current;
+            // closed contours join their last segment to their first
+            bool previous = false;
+            if(closed) {
+                int j = first;
+                int k = end;
+                while(k < last) {
+                    j = k;
+                    k = ft_outline_segment_end(outline, j, last);
+                }
+                previous = ft_outline_segment_visible(outline, j, k, box);
+            }
+            // the start of the pending run of replaced segments, or -1
+            int run = -1;
+            for(;;) {
+                int next_end = last;
+                bool next = closed && first_visible;
+                if(end < last) {
+                    next_end = ft_outline_segment_end(outline, end, last);
+                    next = ft_outline_segment_visible(outline, end, next_end, box);
+                }
+                if(current || previous || next) {
+                    if(run != -1) {
+                        result->points[result->n_points] = outline->points[i];
+                        result->tags[result->n_points++] = PVG_FT_CURVE_TAG_ON;
+                        run = -1;
+                    }
+                    for(int j = i + 1; j <= end; ++j) {
+                        result->points[result->n_points] = outline->points[j];
+                        result->tags[result->n_points++] = outline->tags[j];
+                    }
+                } else if(run == -1) {
+                    run = i;
+                } else if(ft_outline_line_visible(&outline->points[run], &outline->points[end], box)) {
+                    // the merged line could cross the clip, so end the run here
+                    result->points[result->n_points] = outline->points[i];
+                    result->tags[result->n_points++] = PVG_FT_CURVE_TAG_ON;
+                    run = i;
+                }
+                if(end == last)
+                    break;
+                previous = current;
+                current = next;
+                i = end;
+                end = next_end;
+            }
+            if(run != -1) {
+                result->points[result->n_points] = outline->points[last];
+                result->tags[result->n_points++] = PVG_FT_CURVE_TAG_ON;
+            }
+        }
+        result->contours_flag[result->n_contours] = outline->contours_flag[n];
+        result->contours[result->n_contours++] = result->n_points - 1;
+        first = last + 1;
+    }
+    return result;
+}
+
 static PVG_FT_Outline* ft_outline_convert_dash(const plutovg_path_t* path, const ::gfx::matrix* matrix, const plutovg_stroke_dash_t* stroke_dash,void*(*allocator)(size_t),void*(*reallocator)(void*,size_t), void(*deallocator)(void*))
 {
     if(stroke_dash->array.size == 0)
-        return ft_outline_convert(path, matrix, NULL,allocator,reallocator,deallocator);
+        return ft_outline_convert(path, matrix, NULL, NULL,allocator,reallocator,deallocator);
     plutovg_path_t* dashed = plutovg_path_clone_dashed(path, stroke_dash->offset, stroke_dash->array.data, stroke_dash->array.size,allocator,reallocator,deallocator);
     if(dashed==nullptr) {
         return nullptr;
     }
-    PVG_FT_Outline* outline = ft_outline_convert(dashed, matrix, NULL,allocator,reallocator,deallocator);
+    PVG_FT_Outline* outline = ft_outline_convert(dashed, matrix, NULL, NULL,allocator,reallocator,deallocator);
     if(outline==nullptr) {
         plutovg_path_destroy(dashed,deallocator);
         return nullptr;
@@ -303,13 +427,18 @@ static PVG_FT_Outline* ft_outline_convert_dash(const plutovg_path_t* path, const
     return outline;
 }
 
-static PVG_FT_Outline* ft_outline_convert_stroke(const plutovg_path_t* path, const gfx::matrix* matrix, const plutovg_stroke_data_t* stroke_data,void*(*allocator)(size_t),void*(*reallocator)(void*,size_t), void(*deallocator)(void*))
+static double ft_stroke_width(const gfx::matrix* matrix, const plutovg_stroke_data_t* stroke_data)
 {
     double scale_x = sqrt(matrix->a * matrix->a + matrix->b * matrix->b);
     double scale_y = sqrt(matrix->c * matrix->c + matrix->d * matrix->d);
 
     double scale = hypot(scale_x, scale_y) / PLUTOVG_SQRT2;
-    double width = stroke_data->style.width * scale;
+    return stroke_data->style.width * scale;
+}
+
+static PVG_FT_Outline* ft_outline_convert_stroke(const plutovg_path_t* path, const gfx::matrix* matrix, const plutovg_stroke_data_t* stroke_data, const plutovg_rect_t* clip_rect,void*(*allocator)(size_t),void*(*reallocator)(void*,size_t), void(*deallocator)(void*))
+{
+    double width = ft_stroke_width(matrix, stroke_data);
 
     vector_fixed_t ftWidth = (vector_fixed_t)(width * 0.5 * (1 << 6));
     vector_fixed_t ftMiterLimit = (vector_fixed_t)(stroke_data->style.miter_limit * (1 << 16));
@@ -344,19 +473,47 @@ static PVG_FT_Outline* ft_outline_convert_stroke(const plutovg_path_t* path, con
     if(outline==nullptr) {
         return nullptr;
     }
+    if(clip_rect) {
+        // how far the stroke can reach from its centerline, plus a pixel for antialiasing
+        double factor = 1.0;
+        if(stroke_data->style.join == PLUTOVG_LINE_JOIN_MITER)
+            factor = plutovg_max(stroke_data->style.miter_limit, PLUTOVG_SQRT2);
+        else if(stroke_data->style.cap == PLUTOVG_LINE_CAP_SQUARE)
+            factor = PLUTOVG_SQRT2;
+        double reach = width * 0.5 * factor;
+        vector_pos_t margin = (vector_pos_t)((reach + 2.0) * 64.0);
+        PVG_FT_BBox box;
+        box.xMin = FT_COORD(clip_rect->x) - margin;
+        box.yMin = FT_COORD(clip_rect->y) - margin;
+        box.xMax = FT_COORD(clip_rect->x + clip_rect->w) + margin;
+        box.yMax = FT_COORD(clip_rect->y + clip_rect->h) + margin;
+        PVG_FT_Outline* culled = ft_outline_cull(outline, &box, allocator);
+        if(culled != outline) {
+            ft_outline_destroy(outline,deallocator);
+            if(culled == nullptr) {
+                return nullptr;
+            }
+            outline = culled;
+        }
+    }
     PVG_FT_Stroker stroker;
-    PVG_FT_Stroker_New(&stroker);
+    if(PVG_FT_Stroker_New(&stroker,allocator,reallocator,deallocator)!=0) {
+        ft_outline_destroy(outline,deallocator);
+        return nullptr;
+    }
     PVG_FT_Stroker_Set(stroker, ftWidth, ftCap, ftJoin, ftMiterLimit);
     PVG_FT_Stroker_ParseOutline(stroker, outline);
+    ft_outline_destroy(outline,deallocator);
 
     vector_uint_t points;
     vector_uint_t contours;
     PVG_FT_Stroker_GetCounts(stroker, &points, &contours);
 
     PVG_FT_Outline* stroke_outline = ft_outline_create(points, contours,allocator);
-    PVG_FT_Stroker_Export(stroker, stroke_outline);
+    if(stroke_outline!=nullptr) {
+        PVG_FT_Stroker_Export(stroker, stroke_outline);
+    }
     PVG_FT_Stroker_Done(stroker);
-    ft_outline_destroy(outline,deallocator);
     return stroke_outline;
 }
 
@@ -389,7 +546,261 @@ static bool spans_generation_callback(int count, const PVG_FT_Span* spans, pluto
     return true;
 }
 
-bool plutovg_rasterize(plutovg_span_buffer_t* span_buffer, const plutovg_path_t* path, const ::gfx::matrix* matrix, const plutovg_rect_t* clip_rect, const plutovg_stroke_data_t* stroke_data, plutovg_fill_rule_t winding,void*(*allocator)(size_t),void*(*reallocator)(void*,size_t),void(*deallocator)(void*))
+/* an axis aligned rectangle in 1/256 pixel units, less an optional axis aligned hole. round_up is set */
+/* when the outline winds the way that makes the rasterizer round partial coverage up rather than down */
+typedef struct {
+    int x1, y1, x2, y2;
+    int hx1, hy1, hx2, hy2;
+    bool round_up;
+} ft_rect_t;
+
+/* keeps the coordinates clear of overflow once they are scaled to 1/256 pixel units */
+#define FT_RECT_LIMIT (1 << 28)
+static inline int ft_rect_coord(vector_pos_t x)
+{
+    if(x < -FT_RECT_LIMIT) x = -FT_RECT_LIMIT;
+    if(x > FT_RECT_LIMIT) x = FT_RECT_LIMIT;
+    return (int)x * 4;
+}
+
+static void ft_rect_set(ft_rect_t* rect, vector_pos_t x1, vector_pos_t y1, vector_pos_t x2, vector_pos_t y2)
+{
+    rect->x1 = ft_rect_coord(x1);
+    rect->y1 = ft_rect_coord(y1);
+    rect->x2 = ft_rect_coord(x2);
+    rect->y2 = ft_rect_coord(y2);
+    rect->hx1 = rect->hy1 = rect->hx2 = rect->hy2 = 0;
+}
+
+/* reads a path made of a single run of lines as 26.6 device points, dropping repeats. fails on anything else */
+static bool ft_rect_points(const plutovg_path_t* path, const ::gfx::matrix* matrix, vector_t* points, int* count, bool* closed)
+{
+    if(path->num_contours != 1 || path->num_curves != 0 || path->num_points > 6)
+        return false;
+    plutovg_path_iterator_t it;
+    plutovg_path_iterator_init(&it, path);
+    ::gfx::pointf pts[3];
+    int n = 0;
+    *closed = false;
+    while(plutovg_path_iterator_has_next(&it)) {
+        plutovg_path_command_t command = plutovg_path_iterator_next(&it, pts);
+        if(*closed)
+            return false;
+        if(command == PLUTOVG_PATH_COMMAND_CLOSE) {
+            *closed = true;
+            continue;
+        }
+        if((command == PLUTOVG_PATH_COMMAND_MOVE_TO) != (n == 0) || command == PLUTOVG_PATH_COMMAND_CUBIC_TO)
+            return false;
+        matrix->map(pts[0].x, pts[0].y, &pts[0].x, &pts[0].y);
+        vector_t pt = {FT_COORD(pts[0].x), FT_COORD(pts[0].y)};
+        if(n > 0 && points[n - 1].x == pt.x && points[n - 1].y == pt.y)
+            continue;
+        if(n == 5)
+            return false;
+        points[n++] = pt;
+    }
+    *count = n;
+    return true;
+}
+
+/* finds the bounds and the winding of four points that trace an axis aligned rectangle */
+static bool ft_rect_bounds(const vector_t* p, PVG_FT_BBox* box, bool* clockwise)
+{
+    bool horizontal = p[0].y == p[1].y && p[1].x == p[2].x && p[2].y == p[3].y && p[3].x == p[0].x;
+    bool vertical = p[0].x == p[1].x && p[1].y == p[2].y && p[2].x == p[3].x && p[3].y == p[0].y;
+    if(!horizontal && !vertical)
+        return false;
+    /* the sign of the cross product of the first two edges */
+    if(horizontal)
+        *clockwise = (p[1].x > p[0].x) == (p[2].y > p[1].y);
+    else
+        *clockwise = (p[1].y > p[0].y) != (p[2].x > p[1].x);
+    box->xMin = plutovg_min(p[0].x, p[2].x);
+    box->xMax = plutovg_max(p[0].x, p[2].x);
+    box->yMin = plutovg_min(p[0].y, p[2].y);
+    box->yMax = plutovg_max(p[0].y, p[2].y);
+    return box->xMin < box->xMax && box->yMin < box->yMax;
+}
+
+/* recognizes filled and stroked axis aligned rectangles and stroked axis aligned lines. the geometry */
+/* matches what the stroker makes of them exactly, so the coverage matches the general path exactly   */
+static bool ft_rect_from_path(const plutovg_path_t* path, const ::gfx::matrix* matrix, const plutovg_stroke_data_t* stroke_data, ft_rect_t* rect)
+{
+    vector_t points[5];
+    int count;
+    bool closed;
+    if(!ft_rect_points(path, matrix, points, &count, &closed))
+        return false;
+    if(stroke_data == NULL || closed) {
+        if(count == 5 && points[4].x == points[0].x && points[4].y == points[0].y)
+            count = 4;
+    }
+    PVG_FT_BBox box;
+    bool clockwise;
+    if(stroke_data == NULL) {
+        if(count != 4 || !ft_rect_bounds(points, &box, &clockwise))
+            return false;
+        ft_rect_set(rect, box.xMin, box.yMin, box.xMax, box.yMax);
+        rect->round_up = clockwise;
+        return true;
+    }
+    if(stroke_data->dash.array.size != 0)
+        return false;
+    vector_pos_t r = (vector_pos_t)(ft_stroke_width(matrix, stroke_data) * 0.5 * (1 << 6));
+    if(r < 2)
+        return false;
+    if(closed) {
+        /* the corners are only square for miters that fit the limit */
+        if(count != 4 || stroke_data->style.join != PLUTOVG_LINE_JOIN_MITER || stroke_data->style.miter_limit * 0.70710678f < 1.0001f)
+            return false;
+        if(!ft_rect_bounds(points, &box, &clockwise) || box.xMax - box.xMin <= r * 2 || box.yMax - box.yMin <= r * 2)
+            return false;
+        ft_rect_set(rect, box.xMin - r, box.yMin - r, box.xMax + r, box.yMax + r);
+        /* the stroker winds the outer border against the path */
+        rect->round_up = !clockwise;
+        rect->hx1 = ft_rect_coord(box.xMin + r);
+        rect->hy1 = ft_rect_coord(box.yMin + r);
+        rect->hx2 = ft_rect_coord(box.xMax - r);
+        rect->hy2 = ft_rect_coord(box.yMax - r);
+        return true;
+    }
+    if(count != 2 || stroke_data->style.cap == PLUTOVG_LINE_CAP_ROUND)
+        return false;
+    vector_pos_t ext = stroke_data->style.cap == PLUTOVG_LINE_CAP_SQUARE ? r : 0;
+    vector_pos_t x1 = plutovg_min(points[0].x, points[1].x);
+    vector_pos_t x2 = plutovg_max(points[0].x, points[1].x);
+    vector_pos_t y1 = plutovg_min(points[0].y, points[1].y);
+    vector_pos_t y2 = plutovg_max(points[0].y, points[1].y);
+    if(y1 == y2) {
+        ft_rect_set(rect, x1 - ext, y1 - r, x2 + ext, y1 + r);
+    } else if(x1 == x2) {
+        ft_rect_set(rect, x1 - r, y1 - ext, x1 + r, y2 + ext);
+    } else {
+        return false;
+    }
+    /* the stroker winds the outline of an open line the same way whichever way the line runs */
+    rect->round_up = false;
+    return true;
+}
+
+/* the length of [from,to) that falls in pixel p, in 1/256 pixel units */
+static inline int ft_rect_overlap(int from, int to, int p)
+{
+    int lo = p * 256;
+    int hi = lo + 256;
+    if(from > lo) lo = from;
+    if(to < hi) hi = to;
+    return hi > lo ? hi - lo : 0;
+}
+
+/* rounds down toward negative infinity, like TRUNC() in the rasterizer */
+static inline int ft_rect_pixel(int x)
+{
+    return x >> 8;
+}
+
+/* the coverage the cell rasterizer would give pixel x when the row overlaps the rectangle by ay and the hole by hy */
+static inline int ft_rect_coverage(const ft_rect_t* rect, int x, int ay, int hy)
+{
+    int area = ft_rect_overlap(rect->x1, rect->x2, x) * ay;
+    if(hy)
+        area -= ft_rect_overlap(rect->hx1, rect->hx2, x) * hy;
+    int coverage = rect->round_up ? (area + 255) >> 8 : area >> 8;
+    return coverage >= 256 ? 255 : coverage;
+}
+
+#define FT_RECT_SPANS 32
+typedef struct {
+    PVG_FT_Span spans[FT_RECT_SPANS];
+    int count;
+    plutovg_span_buffer_t* span_buffer;
+} ft_rect_writer_t;
+
+static bool ft_rect_emit(ft_rect_writer_t* writer, int x, int y, int len, int coverage)
+{
+    if(coverage == 0 || len <= 0)
+        return true;
+    PVG_FT_Span* span = writer->spans + writer->count - 1;
+    if(writer->count > 0 && span->y == y && span->x + span->len == x && span->coverage == coverage) {
+        span->len += len;
+        return true;
+    }
+    if(writer->count == FT_RECT_SPANS) {
+        if(!spans_generation_callback(writer->count, writer->spans, writer->span_buffer))
+            return false;
+        writer->count = 0;
+    }
+    span = writer->spans + writer->count++;
+    span->x = x;
+    span->len = len;
+    span->y = y;
+    span->coverage = (unsigned char)coverage;
+    return true;
+}
+
+/* generates the spans of a rectangle directly. each row is a few partial pixels at the breaks around runs */
+/* of constant coverage, so there are no cells to build or sort                                          */
+static bool ft_rect_render(plutovg_span_buffer_t* span_buffer, const ft_rect_t* rect, const plutovg_rect_t* clip_rect)
+{
+    int cx1 = -(1 << 23), cy1 = -(1 << 23), cx2 = (1 << 23) - 1, cy2 = (1 << 23) - 1;
+    if(clip_rect) {
+        cx1 = (int)clip_rect->x;
+        cy1 = (int)clip_rect->y;
+        cx2 = (int)(clip_rect->x + clip_rect->w);
+        cy2 = (int)(clip_rect->y + clip_rect->h);
+    }
+    const bool hole = rect->hx1 < rect->hx2 && rect->hy1 < rect->hy2;
+    int breaks[4] = {ft_rect_pixel(rect->x1), ft_rect_pixel(rect->x2 - 1), 0, 0};
+    int num_breaks = 2;
+    if(hole) {
+        breaks[1] = ft_rect_pixel(rect->hx1);
+        breaks[2] = ft_rect_pixel(rect->hx2 - 1);
+        breaks[3] = ft_rect_pixel(rect->x2 - 1);
+        num_breaks = 4;
+    }
+    const int xs = plutovg_max(breaks[0], cx1);
+    const int xe = plutovg_min(breaks[num_breaks - 1] + 1, cx2);
+    const int ys = plutovg_max(ft_rect_pixel(rect->y1), cy1);
+    const int ye = plutovg_min(ft_rect_pixel(rect->y2 - 1) + 1, cy2);
+    ft_rect_writer_t writer;
+    writer.count = 0;
+    writer.span_buffer = span_buffer;
+    for(int y = ys; y < ye; ++y) {
+        const int ay = ft_rect_overlap(rect->y1, rect->y2, y);
+        const int hy = hole ? ft_rect_overlap(rect->hy1, rect->hy2, y) : 0;
+        int x = xs;
+        for(int i = 0; i < num_breaks && x < xe; ++i) {
+            /* the run up to the break has the coverage of its first pixel */
+            const int b = plutovg_min(breaks[i], xe);
+            if(x < b) {
+                if(!ft_rect_emit(&writer, x, y, b - x, ft_rect_coverage(rect, x, ay, hy)))
+                    return false;
+                x = b;
+            }
+            if(x == breaks[i] && x < xe) {
+                if(!ft_rect_emit(&writer, x, y, 1, ft_rect_coverage(rect, x, ay, hy)))
+                    return false;
+                ++x;
+            }
+        }
+    }
+    if(writer.count > 0)
+        return spans_generation_callback(writer.count, writer.spans, span_buffer);
+    return true;
+}
+
+bool plutovg_rasterize_rect(plutovg_span_buffer_t* span_buffer, const plutovg_path_t* path, const ::gfx::matrix* matrix, const plutovg_rect_t* clip_rect, const plutovg_stroke_data_t* stroke_data, bool* out_result)
+{
+    ft_rect_t rect;
+    if(!ft_rect_from_path(path, matrix, stroke_data, &rect))
+        return false;
+    plutovg_span_buffer_reset(span_buffer);
+    *out_result = ft_rect_render(span_buffer, &rect, clip_rect);
+    return true;
+}
+
+bool plutovg_rasterize_outline(plutovg_span_buffer_t* span_buffer, const plutovg_path_t* path, const ::gfx::matrix* matrix, const plutovg_rect_t* clip_rect, const plutovg_stroke_data_t* stroke_data, plutovg_fill_rule_t winding,void*(*allocator)(size_t),void*(*reallocator)(void*,size_t),void(*deallocator)(void*))
 {
     PVG_FT_Raster_Params params;
     params.flags = PVG_FT_RASTER_FLAG_DIRECT | PVG_FT_RASTER_FLAG_AA;
@@ -405,7 +816,7 @@ bool plutovg_rasterize(plutovg_span_buffer_t* span_buffer, const plutovg_path_t*
         params.clip_box.xMax = (vector_pos_t)(clip_rect->x + clip_rect->w);
         params.clip_box.yMax = (vector_pos_t)(clip_rect->y + clip_rect->h);
     }
-    PVG_FT_Outline* outline = ft_outline_convert(path, matrix, stroke_data,allocator,reallocator,deallocator);
+    PVG_FT_Outline* outline = ft_outline_convert(path, matrix, stroke_data, clip_rect,allocator,reallocator,deallocator);
     if(outline==nullptr) {
         return false;
     }
@@ -428,3 +839,12 @@ bool plutovg_rasterize(plutovg_span_buffer_t* span_buffer, const plutovg_path_t*
     ft_outline_destroy(outline,deallocator);
     return result;
 }
+
+bool plutovg_rasterize(plutovg_span_buffer_t* span_buffer, const plutovg_path_t* path, const ::gfx::matrix* matrix, const plutovg_rect_t* clip_rect, const plutovg_stroke_data_t* stroke_data, plutovg_fill_rule_t winding,void*(*allocator)(size_t),void*(*reallocator)(void*,size_t),void(*deallocator)(void*))
+{
+    HTCW_GFX_TRACE_SCOPE("canvas", "rasterize");
+    bool result;
+    if(plutovg_rasterize_rect(span_buffer, path, matrix, clip_rect, stroke_data, &result))
+        return result;
+    return plutovg_rasterize_outline(span_buffer, path, matrix, clip_rect, stroke_data, winding, allocator, reallocator, deallocator);
+}
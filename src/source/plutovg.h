@@ -638,7 +638,7 @@ typedef struct plutovg_font_face plutovg_font_face_t;
  * @param closure User-defined data passed to `destroy_func`.
  * @return A pointer to the loaded `plutovg_font_face_t` object, or `NULL` on failure.
  */
-PLUTOVG_API plutovg_font_face_t* plutovg_font_face_load_from_stream(gfx::stream& data, int ttcindex, plutovg_destroy_func_t destroy_func, void* closure);
+PLUTOVG_API plutovg_font_face_t* plutovg_font_face_load_from_stream(gfx::stream& data, int ttcindex, plutovg_destroy_func_t destroy_func, void* closure, void*(*allocator)(size_t), void(*deallocator)(void*));
 
 /**
  * @brief Increments the reference count of a font face.
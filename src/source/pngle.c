@@ -41,7 +41,7 @@
 #endif
 
 #define PNGLE_ERROR(s) (pngle->error = (s), pngle->state = PNGLE_STATE_ERROR, -1)
-#define PNGLE_CALLOC(a, b, name) (debug_printf("[pngle] Allocating %zu bytes for %s\n", (size_t)(a) * (size_t)(b), (name)), calloc((size_t)(a), (size_t)(b)))
+#define PNGLE_CALLOC(a, b, name) (debug_printf("[pngle] Allocating %zu bytes for %s\n", (size_t)(a) * (size_t)(b), (name)), pngle_calloc(pngle, (size_t)(a), (size_t)(b)))
 
 #define PNGLE_UNUSED(x) (void)(x)
 
@@ -112,6 +112,8 @@ struct _pngle_t {
 	// misc
 	const char *error;
 	void *user_data;
+	void *(*allocator)(size_t);
+	void (*deallocator)(void *);
 
 	// decompression state (reset on IHDR)
 	uint8_t *next_out; // NULL indicates IDAT hasn't been processed yet
@@ -141,6 +143,14 @@ static inline uint32_t read_uint32(const uint8_t *p)
 	;
 }
 
+static void *pngle_calloc(pngle_t *pngle, size_t a, size_t b)
+{
+	if (b != 0 && a > (size_t)-1 / b) return NULL;
+	void *result = pngle->allocator(a * b);
+	if (result) memset(result, 0, a * b);
+	return result;
+}
+
 static inline uint32_t U32_CLAMP_ADD(uint32_t a, uint32_t b, uint32_t top)
 {
 	uint32_t v = a + b;
@@ -157,11 +167,11 @@ void pngle_reset(pngle_t *pngle)
 	pngle->state = PNGLE_STATE_INITIAL;
 	pngle->error = "No error";
 
-	if (pngle->scanline_ringbuf) free(pngle->scanline_ringbuf);
-	if (pngle->palette) free(pngle->palette);
-	if (pngle->trans_palette) free(pngle->trans_palette);
+	if (pngle->scanline_ringbuf) pngle->deallocator(pngle->scanline_ringbuf);
+	if (pngle->palette) pngle->deallocator(pngle->palette);
+	if (pngle->trans_palette) pngle->deallocator(pngle->trans_palette);
 #ifndef PNGLE_NO_GAMMA_CORRECTION
-	if (pngle->gamma_table) free(pngle->gamma_table);
+	if (pngle->gamma_table) pngle->deallocator(pngle->gamma_table);
 #endif
 
 	pngle->scanline_ringbuf = NULL;
@@ -184,8 +194,19 @@ void pngle_reset(pngle_t *pngle)
 
 pngle_t *pngle_new()
 {
-	pngle_t *pngle = (pngle_t *)PNGLE_CALLOC(1, sizeof(pngle_t), "pngle_t");
+	return pngle_new_ex(malloc, free);
+}
+
+pngle_t *pngle_new_ex(void *(*allocator)(size_t), void (*deallocator)(void *))
+{
+	if (!allocator || !deallocator) return NULL;
+
+	debug_printf("[pngle] Allocating %zu bytes for %s\n", sizeof(pngle_t), "pngle_t");
+	pngle_t *pngle = (pngle_t *)allocator(sizeof(pngle_t));
 	if (!pngle) return NULL;
+	memset(pngle, 0, sizeof(pngle_t));
+	pngle->allocator = allocator;
+	pngle->deallocator = deallocator;
 
 	pngle_reset(pngle);
 
@@ -196,7 +217,7 @@ void pngle_destroy(pngle_t *pngle)
 {
 	if (pngle) {
 		pngle_reset(pngle);
-		free(pngle);
+		pngle->deallocator(pngle);
 	}
 }
 
@@ -374,7 +395,7 @@ static int set_interlace_pass(pngle_t *pngle, uint_fast8_t pass)
 
 	pngle->scanline_ringbuf_size = scanline_stride + bytes_per_pixel * 2; // 2 rooms for c/x and a
 
-	if (pngle->scanline_ringbuf) free(pngle->scanline_ringbuf);
+	if (pngle->scanline_ringbuf) pngle->deallocator(pngle->scanline_ringbuf);
 	if ((pngle->scanline_ringbuf = PNGLE_CALLOC(pngle->scanline_ringbuf_size, 1, "scanline ringbuf")) == NULL) return PNGLE_ERROR("Insufficient memory");
 	pngle->drawing_x = interlace_off_x[pngle->interlace_pass];
 	pngle->drawing_y = interlace_off_y[pngle->interlace_pass];
@@ -389,7 +410,7 @@ static int set_interlace_pass(pngle_t *pngle, uint_fast8_t pass)
 static int setup_gamma_table(pngle_t *pngle, uint32_t png_gamma)
 {
 #ifndef PNGLE_NO_GAMMA_CORRECTION
-	if (pngle->gamma_table) free(pngle->gamma_table);
+	if (pngle->gamma_table) pngle->deallocator(pngle->gamma_table);
 
 	if (pngle->display_gamma <= 0) return 0; // disable gamma correction
 	if (png_gamma == 0) return 0;
@@ -26,6 +26,7 @@
 #define __PNGLE_H__
 
 #include <stdint.h>
+#include <stddef.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -43,6 +44,7 @@ typedef void (*pngle_done_callback_t)(pngle_t *pngle);
 // Basic interfaces
 // ----------------
 pngle_t *pngle_new();
+pngle_t *pngle_new_ex(void *(*allocator)(size_t), void (*deallocator)(void *)); // every allocation goes through allocator and deallocator
 void pngle_destroy(pngle_t *pngle);
 void pngle_reset(pngle_t *pngle); // clear its internal state (not applied to pngle_set_* functions)
 const char *pngle_error(pngle_t *pngle);
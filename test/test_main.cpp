@@ -1,18 +1,1111 @@
+//////////////////////////////////
+// htcw_gfx_tests
+// Renders a fixed catalog of
+// scenes into bitmaps of each
+// pixel format and compares them
+// against reference images, and
+// reports how long each took. It
+// also checks routines whose
+// results are easier to test
+// directly
+//////////////////////////////////
+// usage: htcw_gfx_tests [--golden <dir>] [--update] [--strict] [--filter <text>] [--repeat <n>]
+//   --golden  where the reference images are (default HTCW_GFX_GOLDEN_DIR)
+//   --update  write the rendered images as the new references
+//   --strict  fail when a reference image is missing
+//   --filter  only run cases whose scene or format contains text. The checks' format is "check"
+//   --repeat  render each case this many times and report the average time
+
+#include <errno.h>
 #include <stdio.h>
 #include <stdlib.h>
-//#include <unity.h>
-#include <gfx_cpp14.hpp>
+#include <string.h>
+#include <chrono>
+#include <gfx.hpp>
+// the rectangle rasterizer is checked against the general one directly
+#include "source/plutovg-private.h"
+#ifdef _WIN32
+#include <direct.h>
+#else
+#include <sys/stat.h>
+#endif
+
+#ifndef PROGMEM
+#define PROGMEM
+#endif
+#define SHARETECH_REGULAR_TTF_IMPLEMENTATION
+#include "assets/ShareTech_Regular_ttf.h"
+#define VGA_8X8_IMPLEMENTATION
+#include "assets/vga_8x8.h"
+#define SVG_SVG_IMPLEMENTATION
+#include "assets/svg_svg.h"
+#define CAT_PNG_IMPLEMENTATION
+#include "assets/cat_png.h"
+#define BENCH_JPG_IMPLEMENTATION
+#include "assets/bench_jpg.h"
+
+#ifndef HTCW_GFX_GOLDEN_DIR
+#define HTCW_GFX_GOLDEN_DIR "golden"
+#endif
 
 using namespace gfx;
-void setUp() {
 
+// the size every scene is rendered at
+static const size16 test_size(128, 96);
+
+// the shared inputs, set up once
+typedef struct {
+    const_buffer_stream ttf_stream;
+    const_buffer_stream win_stream;
+    const_buffer_stream svg_stream;
+    const_buffer_stream tvg_stream;
+    const_buffer_stream png_stream;
+    const_buffer_stream jpg_stream;
+    tt_font ttf;
+    win_font win;
+    png_image png;
+    jpg_image jpg;
+    sizef svg_size;
+    sizef tvg_size;
+    bitmap<rgb_pixel<16>> source;
+    // the sources for copies between pixel formats
+    ega_palette<rgb_pixel<24>> ega;
+    bitmap<rgb_pixel<24>> source888;
+    bitmap<rgba_pixel<32>> source8888;
+    bitmap<gsc_pixel<8>> source_gsc8;
+    bitmap<indexed_pixel<4>, ega_palette<rgb_pixel<24>>> source_ega;
+    uint8_t* tvg_data;
+} test_assets_t;
+static test_assets_t assets;
+
+static gfx_result load_assets() {
+    assets.ttf_stream.set(ShareTech_Regular_ttf, sizeof(ShareTech_Regular_ttf));
+    assets.win_stream.set(vga_8x8, sizeof(vga_8x8));
+    assets.svg_stream.set(svg_svg, sizeof(svg_svg));
+    assets.png_stream.set(cat_png, sizeof(cat_png));
+    assets.jpg_stream.set(bench_jpg, sizeof(bench_jpg));
+    assets.ttf = tt_font(assets.ttf_stream, 18, font_size_units::px);
+    gfx_result res = assets.ttf.initialize();
+    if (res != gfx_result::success) {
+        return res;
+    }
+    assets.win = win_font(assets.win_stream);
+    res = assets.win.initialize();
+    if (res != gfx_result::success) {
+        return res;
+    }
+    res = canvas::svg_dimensions(assets.svg_stream, &assets.svg_size);
+    if (res != gfx_result::success) {
+        return res;
+    }
+    // the TVG is converted from the SVG
+    constexpr static const size_t tvg_capacity = 256 * 1024;
+    assets.tvg_data = (uint8_t*)::malloc(tvg_capacity);
+    if (assets.tvg_data == nullptr) {
+        return gfx_result::out_of_memory;
+    }
+    buffer_stream tvg_out(assets.tvg_data, tvg_capacity);
+    assets.svg_stream.seek(0);
+    res = svg_to_tvg(assets.svg_stream, tvg_out);
+    if (res != gfx_result::success) {
+        return res;
+    }
+    assets.tvg_stream.set(assets.tvg_data, (size_t)tvg_out.seek(0, seek_origin::current));
+    res = canvas::tvg_dimensions(assets.tvg_stream, &assets.tvg_size);
+    if (res != gfx_result::success) {
+        return res;
+    }
+    assets.png = png_image(assets.png_stream);
+    res = assets.png.initialize();
+    if (res != gfx_result::success) {
+        return res;
+    }
+    assets.jpg = jpg_image(assets.jpg_stream);
+    res = assets.jpg.initialize();
+    if (res != gfx_result::success) {
+        return res;
+    }
+    // the source for bitmap copies and resizes
+    const size16 source_size(64, 48);
+    assets.source = bitmap<rgb_pixel<16>>(source_size, ::malloc(bitmap<rgb_pixel<16>>::sizeof_buffer(source_size)));
+    if (assets.source.begin() == nullptr) {
+        return gfx_result::out_of_memory;
+    }
+    for (int y = 0; y < source_size.height; ++y) {
+        for (int x = 0; x < source_size.width; ++x) {
+            assets.source.point(point16(x, y), rgb_pixel<16>(x >> 1, x + y, y >> 1));
+        }
+    }
+    const size16 convert_size(32, 24);
+    assets.source888 = bitmap<rgb_pixel<24>>(convert_size, ::malloc(bitmap<rgb_pixel<24>>::sizeof_buffer(convert_size)));
+    assets.source8888 = bitmap<rgba_pixel<32>>(convert_size, ::malloc(bitmap<rgba_pixel<32>>::sizeof_buffer(convert_size)));
+    assets.source_gsc8 = bitmap<gsc_pixel<8>>(convert_size, ::malloc(bitmap<gsc_pixel<8>>::sizeof_buffer(convert_size)));
+    assets.source_ega = bitmap<indexed_pixel<4>, ega_palette<rgb_pixel<24>>>(convert_size, ::malloc(bitmap<indexed_pixel<4>, ega_palette<rgb_pixel<24>>>::sizeof_buffer(convert_size)), &assets.ega);
+    if (assets.source888.begin() == nullptr || assets.source8888.begin() == nullptr ||
+        assets.source_gsc8.begin() == nullptr || assets.source_ega.begin() == nullptr) {
+        return gfx_result::out_of_memory;
+    }
+    for (int y = 0; y < convert_size.height; ++y) {
+        for (int x = 0; x < convert_size.width; ++x) {
+            assets.source888.point(point16(x, y), rgb_pixel<24>(x * 8, y * 10, 255 - x * 4 - y * 3));
+            // the bottom rows fade out, so they're blended rather than converted
+            assets.source8888.point(point16(x, y), rgba_pixel<32>(255 - x * 8, x * 3 + y * 7, y * 10, y < 16 ? 255 : 255 - (y - 15) * 30));
+            assets.source_gsc8.point(point16(x, y), gsc_pixel<8>((x * 8) ^ (y * 10)));
+            assets.source_ega.point(point16(x, y), indexed_pixel<4>((x / 2 + y / 3) & 15));
+        }
+    }
+    return gfx_result::success;
 }
-void tearDown() {
-    
+static void free_assets() {
+    ::free(assets.source.begin());
+    ::free(assets.source888.begin());
+    ::free(assets.source8888.begin());
+    ::free(assets.source_gsc8.begin());
+    ::free(assets.source_ega.begin());
+    ::free(assets.tvg_data);
 }
-int main(int argc, char** argv) {
-   
-    //UNITY_END(); // stop unit testing
+
+// THE SCENES
+// each one draws the whole bitmap, and returns not_supported when it can't draw to the format
+using color_t = color<rgba_pixel<32>>;
+using vcolor_t = color<vector_pixel>;
+
+// a five pointed star filling rect
+static void make_star(const srect16& rect, spoint16* out_points) {
+    const spoint16 center((rect.x1 + rect.x2) / 2, (rect.y1 + rect.y2) / 2);
+    for (int i = 0; i < 10; ++i) {
+        const float radius = ((i & 1) ? .4f : 1.f) * rect.height() / 2;
+        const float angle = math::pi * 2 * i / 10 - math::pi / 2;
+        out_points[i] = spoint16(center.x + radius * cosf(angle), center.y + radius * sinf(angle));
+    }
+}
+template <typename Bitmap>
+static gfx_result scene_primitives(Bitmap& bmp) {
+    const srect16 full = (srect16)bmp.bounds();
+    gfx_result res = draw::filled_rectangle(bmp, full, color_t::dark_slate_gray);
+    if (res != gfx_result::success) {
+        return res;
+    }
+    spoint16 star[10];
+    make_star(srect16(4, 4, 60, 60), star);
+    res = draw::filled_polygon(bmp, spath16(10, star), color_t::gold);
+    if (res != gfx_result::success) {
+        return res;
+    }
+    res = draw::filled_ellipse(bmp, srect16(66, 4, 123, 44), color_t::red);
+    if (res != gfx_result::success) {
+        return res;
+    }
+    res = draw::ellipse(bmp, srect16(66, 4, 123, 44), color_t::white);
+    if (res != gfx_result::success) {
+        return res;
+    }
+    res = draw::filled_rounded_rectangle(bmp, srect16(66, 50, 123, 91), .25f, color_t::green);
+    if (res != gfx_result::success) {
+        return res;
+    }
+    res = draw::rectangle(bmp, srect16(4, 66, 60, 91), color_t::cyan);
+    if (res != gfx_result::success) {
+        return res;
+    }
+    res = draw::arc(bmp, srect16(8, 64, 56, 112), color_t::orange);
+    if (res != gfx_result::success) {
+        return res;
+    }
+    return draw::line(bmp, full, color_t::white);
+}
+template <typename Bitmap>
+static gfx_result scene_aa_primitives(Bitmap& bmp) {
+    const srect16 full = (srect16)bmp.bounds();
+    gfx_result res = draw::filled_rectangle(bmp, full, color_t::black);
+    if (res != gfx_result::success) {
+        return res;
+    }
+    spoint16 star[10];
+    make_star(srect16(4, 4, 60, 60), star);
+    const spath16 star_path(10, star);
+    res = draw::aa_filled_polygon(bmp, star_path, vcolor_t::gold);
+    if (res != gfx_result::success) {
+        return res;
+    }
+    res = draw::aa_polygon(bmp, star_path, vcolor_t::white, 2);
+    if (res != gfx_result::success) {
+        return res;
+    }
+    res = draw::aa_filled_rounded_rectangle(bmp, srect16(66, 4, 123, 44), vcolor_t::green, 10);
+    if (res != gfx_result::success) {
+        return res;
+    }
+    res = draw::aa_rounded_rectangle(bmp, srect16(66, 4, 123, 44), vcolor_t::white, 10, 2);
+    if (res != gfx_result::success) {
+        return res;
+    }
+    res = draw::aa_filled_arc(bmp, srect16(66, 50, 106, 90), vcolor_t::cyan, 30, 300);
+    if (res != gfx_result::success) {
+        return res;
+    }
+    res = draw::aa_arc(bmp, srect16(10, 62, 50, 94), vcolor_t::orange, 0, 270, 5, line_cap::round);
+    if (res != gfx_result::success) {
+        return res;
+    }
+    res = draw::filled_rectangle(bmp, srect16(40, 30, 100, 70), vcolor_t::red.opacity(.5f));
+    if (res != gfx_result::success) {
+        return res;
+    }
+    return draw::aa_line(bmp, full, vcolor_t::white, 3, line_cap::round);
+}
+template <typename Bitmap>
+static gfx_result scene_text(Bitmap& bmp) {
+    // text blends in the destination's pixel format, so it can't draw to indexed formats
+    if constexpr (Bitmap::pixel_type::template has_channel_names<channel_name::index>::value) {
+        return gfx_result::not_supported;
+    } else {
+        const srect16 full = (srect16)bmp.bounds();
+        gfx_result res = draw::filled_rectangle(bmp, full, color_t::navy);
+        if (res != gfx_result::success) {
+            return res;
+        }
+        res = draw::text(bmp, full.offset(2, 2), text_info("The quick brown\nfox jumps over\nthe lazy dog", assets.ttf), color_t::white);
+        if (res != gfx_result::success) {
+            return res;
+        }
+        return draw::text(bmp, full.offset(2, 70), text_info("0123456789 !@#$%", assets.win), color_t::yellow);
+    }
+}
+template <typename Bitmap>
+static gfx_result scene_bitmap(Bitmap& bmp) {
+    gfx_result res = draw::filled_rectangle(bmp, bmp.bounds(), color_t::black);
+    if (res != gfx_result::success) {
+        return res;
+    }
+    const rect16 src = assets.source.bounds();
+    res = draw::bitmap(bmp, srect16(0, 0, 63, 47), assets.source, src);
+    if (res != gfx_result::success) {
+        return res;
+    }
+    // a destination rectangle running right to left flips the copy
+    res = draw::bitmap(bmp, srect16(127, 0, 64, 47), assets.source, src);
+    if (res != gfx_result::success) {
+        return res;
+    }
+    res = draw::bitmap(bmp, srect16(0, 48, 95, 95), assets.source, src, bitmap_resize::resize_fast);
+    if (res != gfx_result::success) {
+        return res;
+    }
+    return draw::bitmap(bmp, srect16(96, 48, 127, 95), assets.source, src, bitmap_resize::resize_bilinear);
+}
+template <typename Bitmap>
+static gfx_result scene_convert(Bitmap& bmp) {
+    gfx_result res = draw::filled_rectangle(bmp, bmp.bounds(), color_t::dark_blue);
+    if (res != gfx_result::success) {
+        return res;
+    }
+    // straight copies from each format along the top
+    const rect16 src = assets.source888.bounds();
+    res = draw::bitmap(bmp, srect16(spoint16(0, 0), (ssize16)src.dimensions()), assets.source888, src);
+    if (res != gfx_result::success) {
+        return res;
+    }
+    res = draw::bitmap(bmp, srect16(spoint16(32, 0), (ssize16)src.dimensions()), assets.source8888, src);
+    if (res != gfx_result::success) {
+        return res;
+    }
+    res = draw::bitmap(bmp, srect16(spoint16(64, 0), (ssize16)src.dimensions()), assets.source_gsc8, src);
+    if (res != gfx_result::success) {
+        return res;
+    }
+    res = draw::bitmap(bmp, srect16(spoint16(96, 0), (ssize16)src.dimensions()), assets.source_ega, src);
+    if (res != gfx_result::success) {
+        return res;
+    }
+    // the same through copy_to, from part of each source
+    const rect16 part(4, 2, 27, 21);
+    res = assets.source888.copy_to(part, bmp, point16(0, 28));
+    if (res != gfx_result::success) {
+        return res;
+    }
+    res = assets.source8888.copy_to(part, bmp, point16(32, 28));
+    if (res != gfx_result::success) {
+        return res;
+    }
+    res = assets.source_gsc8.copy_to(part, bmp, point16(64, 28));
+    if (res != gfx_result::success) {
+        return res;
+    }
+    res = assets.source_ega.copy_to(part, bmp, point16(97, 28));
+    if (res != gfx_result::success) {
+        return res;
+    }
+    res = assets.source.copy_to(rect16(10, 10, 41, 33), bmp, point16(0, 52));
+    if (res != gfx_result::success) {
+        return res;
+    }
+    // clipped by the edges, and flipped
+    res = draw::bitmap(bmp, srect16(spoint16(-8, 76), (ssize16)src.dimensions()), assets.source888, src);
+    if (res != gfx_result::success) {
+        return res;
+    }
+    res = draw::bitmap(bmp, srect16(spoint16(112, 80), (ssize16)src.dimensions()), assets.source_gsc8, src);
+    if (res != gfx_result::success) {
+        return res;
+    }
+    res = draw::bitmap(bmp, srect16(63, 52, 32, 75), assets.source_ega, src);
+    if (res != gfx_result::success) {
+        return res;
+    }
+    const srect16 clip(70, 56, 127, 95);
+    res = draw::bitmap(bmp, srect16(64, 52, 95, 75), assets.source8888, src, bitmap_resize::crop, nullptr, &clip);
+    if (res != gfx_result::success) {
+        return res;
+    }
+    // and from the 16-bit source, which is a straight copy into RGB565
+    return draw::bitmap(bmp, srect16(96, 52, 127, 75), assets.source, rect16(20, 12, 51, 35));
+}
+template <typename Bitmap>
+static gfx_result scene_canvas(Bitmap& bmp) {
+    gfx_result res = draw::filled_rectangle(bmp, bmp.bounds(), color_t::white);
+    if (res != gfx_result::success) {
+        return res;
+    }
+    canvas cvs((size16)bmp.dimensions());
+    res = cvs.initialize();
+    if (res != gfx_result::success) {
+        return res;
+    }
+    res = draw::canvas(bmp, cvs);
+    if (res != gfx_result::success) {
+        return res;
+    }
+    cvs.fill_paint_type(paint_type::solid);
+    cvs.stroke_paint_type(paint_type::none);
+    cvs.fill_color(vcolor_t::purple.opacity(.8f));
+    cvs.ellipse({32, 48}, {28, 40});
+    res = cvs.render();
+    if (res != gfx_result::success) {
+        return res;
+    }
+    cvs.fill_paint_type(paint_type::none);
+    cvs.stroke_paint_type(paint_type::solid);
+    cvs.stroke_color(vcolor_t::orange);
+    cvs.stroke_width(5);
+    cvs.stroke_line_join(line_join::round);
+    cvs.rounded_rectangle({40, 8, 120, 56}, {12, 12});
+    res = cvs.render();
+    if (res != gfx_result::success) {
+        return res;
+    }
+    gradient_stop stops[] = {{0, vcolor_t::red}, {.5f, vcolor_t::yellow}, {1, vcolor_t::blue}};
+    gradient grad;
+    grad.type = gradient_type::linear;
+    grad.spread = spread_method::pad;
+    grad.transform = matrix::create_identity();
+    grad.linear.x1 = 64;
+    grad.linear.y1 = 64;
+    grad.linear.x2 = 124;
+    grad.linear.y2 = 92;
+    grad.stops = stops;
+    grad.stops_size = 3;
+    cvs.fill_paint_type(paint_type::gradient);
+    cvs.stroke_paint_type(paint_type::none);
+    cvs.fill_gradient(grad);
+    cvs.rectangle({64, 64, 124, 92});
+    return cvs.render();
+}
+static gfx_result render_document(canvas& cvs, stream& document, sizef document_size, bool tvg) {
+    const sizef dim = (sizef)cvs.dimensions();
+    const float scale = math::min_(dim.width / document_size.width, dim.height / document_size.height);
+    const matrix transform = matrix::create_scale(scale, scale);
+    document.seek(0);
+    if (tvg) {
+        return cvs.render_tvg(document, transform);
+    }
+    return cvs.render_svg(document, transform);
+}
+template <typename Bitmap>
+static gfx_result scene_document(Bitmap& bmp, stream& document, sizef document_size, bool tvg) {
+    gfx_result res = draw::filled_rectangle(bmp, bmp.bounds(), color_t::white);
+    if (res != gfx_result::success) {
+        return res;
+    }
+    canvas cvs((size16)bmp.dimensions());
+    res = cvs.initialize();
+    if (res != gfx_result::success) {
+        return res;
+    }
+    res = draw::canvas(bmp, cvs);
+    if (res != gfx_result::success) {
+        return res;
+    }
+    return render_document(cvs, document, document_size, tvg);
+}
+template <typename Bitmap>
+static gfx_result scene_svg(Bitmap& bmp) {
+    return scene_document(bmp, assets.svg_stream, assets.svg_size, false);
+}
+template <typename Bitmap>
+static gfx_result scene_tvg(Bitmap& bmp) {
+    return scene_document(bmp, assets.tvg_stream, assets.tvg_size, true);
+}
+template <typename Bitmap>
+static gfx_result scene_png(Bitmap& bmp) {
+    gfx_result res = draw::filled_rectangle(bmp, bmp.bounds(), color_t::black);
+    if (res != gfx_result::success) {
+        return res;
+    }
+    assets.png_stream.seek(0);
+    return draw::image(bmp, (srect16)bmp.bounds(), assets.png);
+}
+template <typename Bitmap>
+static gfx_result scene_jpg(Bitmap& bmp) {
+    gfx_result res = draw::filled_rectangle(bmp, bmp.bounds(), color_t::black);
+    if (res != gfx_result::success) {
+        return res;
+    }
+    assets.jpg_stream.seek(0);
+    return draw::image(bmp, (srect16)bmp.bounds(), assets.jpg);
+}
+
+// THE CHECKS
+// each one tests a routine directly, rather than through a rendering, and returns
+// false after reporting the first thing that isn't as expected
+#define TEST_CHECK(condition)                                                  \
+    do {                                                                       \
+        if (!(condition)) {                                                    \
+            printf("FAILED   line %d: %s\n", (int)__LINE__, #condition);      \
+            return false;                                                      \
+        }                                                                      \
+    } while (0)
+
+// the VGA font is 8 pixels wide, so the positions are easy to predict
+static bool check_text_layout_tabs() {
+    text_layout layout;
+    TEST_CHECK(gfx_result::success == layout.initialize(320, text_info("a\tb", assets.win, 4)));
+    TEST_CHECK(layout.glyphs() == 2);
+    TEST_CHECK(layout.glyph(1).location.x - layout.glyph(0).location.x == 32);
+    TEST_CHECK(gfx_result::success == layout.initialize(320, text_info("abcde\tf", assets.win, 2)));
+    TEST_CHECK(layout.glyph(5).location.x - layout.glyph(0).location.x == 48);
+    // a tab width of 0 takes no space
+    TEST_CHECK(gfx_result::success == layout.initialize(320, text_info("a\tb", assets.win, 0)));
+    TEST_CHECK(layout.glyph(1).location.x - layout.glyph(0).location.x == 8);
+    size16 area;
+    TEST_CHECK(gfx_result::success == assets.win.measure(320, text_info("a\tb", assets.win, 0), &area));
+    TEST_CHECK(area.width == layout.dimensions().width);
+    return true;
+}
+static bool check_text_layout_wrap() {
+    text_layout layout;
+    const uint16_t line_advance = assets.win.line_advance();
+    TEST_CHECK(gfx_result::success == layout.initialize(320, text_info("ab\ncd", assets.win)));
+    TEST_CHECK(layout.lines() == 2);
+    TEST_CHECK(layout.line(0).first_glyph == 0 && layout.line(0).glyph_count == 2);
+    TEST_CHECK(layout.line(1).first_glyph == 2 && layout.line(1).glyph_count == 2);
+    TEST_CHECK(layout.line(1).y == line_advance);
+    TEST_CHECK(layout.glyph(2).location.y - layout.glyph(0).location.y == line_advance);
+    const char* text = "The quick brown fox jumps over the lazy dog";
+    TEST_CHECK(gfx_result::success == layout.initialize(100, text_info(text, assets.ttf)));
+    TEST_CHECK(layout.lines() > 1);
+    TEST_CHECK(layout.dimensions().width <= 100);
+    TEST_CHECK(layout.dimensions().height == layout.lines() * assets.ttf.line_advance());
+    for (size_t i = 1; i < layout.lines(); ++i) {
+        TEST_CHECK(layout.line(i).y == layout.line(i - 1).y + assets.ttf.line_advance());
+        TEST_CHECK(layout.line(i).first_glyph == layout.line(i - 1).first_glyph + layout.line(i - 1).glyph_count);
+    }
+    // drawing the layout draws what drawing the text does
+    using bmp_t = bitmap<gsc_pixel<8>>;
+    const size16 size(100, 64);
+    uint8_t expected_buffer[bmp_t::sizeof_buffer(size)];
+    uint8_t actual_buffer[bmp_t::sizeof_buffer(size)];
+    bmp_t expected(size, expected_buffer), actual(size, actual_buffer);
+    expected.clear(expected.bounds());
+    actual.clear(actual.bounds());
+    TEST_CHECK(gfx_result::success == draw::text(expected, (srect16)expected.bounds(), text_info(text, assets.ttf), color<gsc_pixel<8>>::white));
+    TEST_CHECK(gfx_result::success == draw::text(actual, (srect16)actual.bounds(), layout, color<gsc_pixel<8>>::white));
+    TEST_CHECK(0 == memcmp(expected_buffer, actual_buffer, sizeof(expected_buffer)));
+    return true;
+}
+static bool check_text_layout_cache() {
+    text_layout_cache cache;
+    TEST_CHECK(gfx_result::success == cache.initialize());
+    char text[] = "hello world";
+    const text_layout* first;
+    TEST_CHECK(gfx_result::success == cache.layout(100, text_info(text, assets.win), &first));
+    TEST_CHECK(cache.entries() == 1 && first->glyphs() == 11);
+    // the key is the text itself, not where it is
+    char copy[sizeof(text)];
+    memcpy(copy, text, sizeof(text));
+    const text_layout* found;
+    TEST_CHECK(gfx_result::success == cache.layout(100, text_info(copy, assets.win), &found));
+    TEST_CHECK(found == first && cache.entries() == 1);
+    // and everything that changes the layout
+    TEST_CHECK(gfx_result::canceled == cache.find(101, text_info(text, assets.win), &found));
+    TEST_CHECK(gfx_result::canceled == cache.find(100, text_info(text, assets.win, 8), &found));
+    TEST_CHECK(gfx_result::canceled == cache.find(100, text_info(text, assets.ttf), &found));
+    TEST_CHECK(gfx_result::canceled == cache.find(100, text_info(text, strlen(text) - 1, assets.win), &found));
+    copy[0] = 'j';
+    TEST_CHECK(gfx_result::canceled == cache.find(100, text_info(copy, assets.win), &found));
+    const text_layout* second;
+    TEST_CHECK(gfx_result::success == cache.layout(100, text_info(copy, assets.win), &second));
+    TEST_CHECK(second != first && cache.entries() == 2);
+    // the least recently used one goes first
+    cache.max_entries(2);
+    TEST_CHECK(gfx_result::success == cache.find(100, text_info(text, assets.win), &found));
+    const text_layout* third;
+    TEST_CHECK(gfx_result::success == cache.layout(200, text_info(text, assets.win), &third));
+    TEST_CHECK(cache.entries() == 2);
+    TEST_CHECK(gfx_result::success == cache.find(100, text_info(text, assets.win), &found) && found == first);
+    TEST_CHECK(gfx_result::canceled == cache.find(100, text_info(copy, assets.win), &found));
+    cache.clear();
+    TEST_CHECK(cache.entries() == 0 && cache.memory_size() == 0);
+    return true;
+}
+// a cached layout doesn't hold on to a draw cache, and resizing its font misses
+static bool check_text_layout_cache_font() {
+    text_layout_cache cache;
+    TEST_CHECK(gfx_result::success == cache.initialize());
+    const char* text = "hello world";
+    const text_layout* layout;
+    {
+        font_draw_cache first_draw_cache;
+        TEST_CHECK(gfx_result::success == first_draw_cache.initialize());
+        text_info ti(text, assets.win);
+        ti.draw_cache = &first_draw_cache;
+        TEST_CHECK(gfx_result::success == cache.layout(100, ti, &layout));
+    }
+    // drawing after the first caller's draw cache is gone uses the one given
+    using bmp_t = bitmap<gsc_pixel<8>>;
+    constexpr static const size16 size(100, 16);
+    uint8_t buffer[bmp_t::sizeof_buffer(size)];
+    bmp_t bmp(size, buffer);
+    font_draw_cache draw_cache;
+    TEST_CHECK(gfx_result::success == draw_cache.initialize());
+    TEST_CHECK(gfx_result::success == draw::text(bmp, (srect16)bmp.bounds(), *layout, color<gsc_pixel<8>>::white, nullptr, &draw_cache));
+    TEST_CHECK(draw_cache.entries() > 0);
+    const text_layout* found;
+    TEST_CHECK(gfx_result::success == cache.layout(100, text_info(text, assets.ttf), &layout));
+    const uint16_t line_height = assets.ttf.line_height();
+    assets.ttf.size(line_height * 2, font_size_units::px);
+    const bool resized_missed = gfx_result::canceled == cache.find(100, text_info(text, assets.ttf), &found);
+    assets.ttf.size(18, font_size_units::px);
+    TEST_CHECK(resized_missed);
+    TEST_CHECK(gfx_result::success == cache.find(100, text_info(text, assets.ttf), &found) && found == layout);
+    return true;
 }
+// reads another stream, but can't seek, like a socket or a serial port
+class test_forward_stream final : public stream {
+    stream& m_inner;
 
+   public:
+    test_forward_stream(stream& inner) : m_inner(inner) {
+    }
+    virtual int getch() override {
+        return m_inner.getch();
+    }
+    virtual size_t read(uint8_t* destination, size_t size) override {
+        return m_inner.read(destination, size);
+    }
+    virtual int putch(int) override {
+        return -1;
+    }
+    virtual size_t write(const uint8_t*, size_t) override {
+        return 0;
+    }
+    virtual unsigned long long seek(long long, seek_origin) override {
+        return 0;
+    }
+    virtual stream_caps caps() const override {
+        stream_caps result = m_inner.caps();
+        result.write = 0;
+        result.seek = 0;
+        return result;
+    }
+};
+// a TinyVG document on a stream that can't seek is read no further than it needs to be
+static bool check_tvg_forward_stream() {
+    const size_t size = assets.tvg_stream.size();
+    uint8_t* data = (uint8_t*)::malloc(size + 4);
+    TEST_CHECK(data != nullptr);
+    memcpy(data, assets.tvg_stream.handle(), size);
+    memcpy(data + size, "NEXT", 4);
+    const_buffer_stream inner(data, size + 4);
+    test_forward_stream document(inner);
+    sizef dimensions;
+    bool result = gfx_result::success == canvas::tvg_dimensions(document, &dimensions) &&
+                  dimensions.width == assets.tvg_size.width && dimensions.height == assets.tvg_size.height &&
+                  inner.seek(0, seek_origin::current) < 32;
+    if (result) {
+        inner.seek(0);
+        canvas cvs(size16(64, 48));
+        uint8_t next[4];
+        result = gfx_result::success == cvs.initialize() &&
+                 gfx_result::success == cvs.render_tvg(document, matrix::create_identity()) &&
+                 4 == document.read(next, 4) && 0 == memcmp(next, "NEXT", 4);
+    }
+    ::free(data);
+    TEST_CHECK(result);
+    return true;
+}
+
+// every allocation a PNG decode makes goes through the image's allocators
+static bool check_allocation_tracker_png() {
+    allocation_tracker::reset(allocation_tag::image);
+    const allocation_stats before = allocation_tracker::stats(allocation_tag::image);
+    TEST_CHECK(before.current == 0);
+    png_image png(assets.png_stream, false,
+                  allocation_tracker::allocator(allocation_tag::image),
+                  allocation_tracker::reallocator(allocation_tag::image),
+                  allocation_tracker::deallocator(allocation_tag::image));
+    TEST_CHECK(gfx_result::success == png.initialize());
+    using bmp_t = bitmap<rgb_pixel<16>>;
+    constexpr static const size16 size(64, 48);
+    uint8_t buffer[bmp_t::sizeof_buffer(size)];
+    bmp_t bmp(size, buffer);
+    assets.png_stream.seek(0);
+    TEST_CHECK(gfx_result::success == draw::image(bmp, (srect16)bmp.bounds(), png));
+    const allocation_stats after = allocation_tracker::stats(allocation_tag::image);
+    // at least the decoder, which holds the inflate window, and a scanline buffer
+    TEST_CHECK(after.allocations >= 2);
+    TEST_CHECK(after.peak > 32768);
+    TEST_CHECK(after.deallocations == after.allocations && after.current == 0);
+    return true;
+}
+// rasterizes the path with the rectangle fast path and with the outline, and compares the spans
+static bool check_rasterize_rect_case(const plutovg_path_t* path, const matrix& transform, const plutovg_rect_t* clip, const plutovg_stroke_data_t* stroke) {
+    plutovg_span_buffer_t fast, outline;
+    plutovg_span_buffer_init(&fast, ::malloc, ::realloc, ::free);
+    plutovg_span_buffer_init(&outline, ::malloc, ::realloc, ::free);
+    bool fast_result = false;
+    const bool applied = plutovg_rasterize_rect(&fast, path, &transform, clip, stroke, &fast_result);
+    const bool outline_result = plutovg_rasterize_outline(&outline, path, &transform, clip, stroke, PLUTOVG_FILL_RULE_NON_ZERO, ::malloc, ::realloc, ::free);
+    bool same = fast.spans.size == outline.spans.size;
+    for (size_t i = 0; same && i < fast.spans.size; ++i) {
+        const plutovg_span_t& a = fast.spans.data[i];
+        const plutovg_span_t& b = outline.spans.data[i];
+        same = a.x == b.x && a.y == b.y && a.len == b.len && a.coverage == b.coverage;
+    }
+    plutovg_span_buffer_destroy(&fast);
+    plutovg_span_buffer_destroy(&outline);
+    // every case is one the fast path is meant to take
+    TEST_CHECK(applied);
+    TEST_CHECK(fast_result && outline_result);
+    TEST_CHECK(same);
+    return true;
+}
+// filled and stroked axis aligned rectangles and lines, at fractional
+// positions, widths under 2 pixels and crossing the clip, rasterize the same
+// through the rectangle fast path as through the stroker and cell rasterizer
+static bool check_rasterize_rect() {
+    static const float offsets[] = {0, .25f, .5f, 3.3f, -2.5f};
+    static const float extents[] = {.5f, 1, 1.5f, 2, 7.75f, 30};
+    static const float widths[] = {.25f, .5f, 1, 1.5f, 2, 3};
+    static const plutovg_line_cap_t caps[] = {PLUTOVG_LINE_CAP_BUTT, PLUTOVG_LINE_CAP_SQUARE};
+    const plutovg_rect_t clip(2, 3, 20, 17);
+    const plutovg_rect_t* clips[] = {nullptr, &clip};
+    const matrix transforms[] = {matrix::create_identity(), matrix::create_scale(1.5f, .75f)};
+    plutovg_path_t* path = plutovg_path_create(::malloc, ::realloc, ::free);
+    TEST_CHECK(path != nullptr);
+    plutovg_stroke_data_t stroke;
+    memset(&stroke, 0, sizeof(stroke));
+    stroke.style.join = PLUTOVG_LINE_JOIN_MITER;
+    stroke.style.miter_limit = 4;
+    bool result = true;
+    for (const matrix& transform : transforms) {
+        for (const plutovg_rect_t* c : clips) {
+            for (float x : offsets) {
+                for (float y : offsets) {
+                    for (float w : extents) {
+                        for (float h : extents) {
+                            // filled, wound both ways
+                            plutovg_path_reset(path);
+                            plutovg_path_add_rect(path, x, y, w, h);
+                            result = result && check_rasterize_rect_case(path, transform, c, nullptr);
+                            plutovg_path_reset(path);
+                            plutovg_path_add_rect(path, x + w, y, -w, h);
+                            result = result && check_rasterize_rect_case(path, transform, c, nullptr);
+                            // stroked with miter joins, where the hole stays open
+                            for (float sw : widths) {
+                                if (w <= sw * 1.5f || h <= sw * 1.5f) {
+                                    continue;
+                                }
+                                stroke.style.width = sw;
+                                plutovg_path_reset(path);
+                                plutovg_path_add_rect(path, x, y, w, h);
+                                result = result && check_rasterize_rect_case(path, transform, c, &stroke);
+                            }
+                        }
+                        // horizontal and vertical lines, with butt and square caps
+                        for (float sw : widths) {
+                            stroke.style.width = sw;
+                            for (plutovg_line_cap_t cap : caps) {
+                                stroke.style.cap = cap;
+                                plutovg_path_reset(path);
+                                plutovg_path_move_to(path, x, y);
+                                plutovg_path_line_to(path, x + w, y);
+                                result = result && check_rasterize_rect_case(path, transform, c, &stroke);
+                                plutovg_path_reset(path);
+                                plutovg_path_move_to(path, x, y + w);
+                                plutovg_path_line_to(path, x, y);
+                                result = result && check_rasterize_rect_case(path, transform, c, &stroke);
+                            }
+                        }
+                        stroke.style.cap = PLUTOVG_LINE_CAP_BUTT;
+                    }
+                }
+            }
+        }
+    }
+    plutovg_path_destroy(path, ::free);
+    return result;
+}
+// converts every value of the source with convert_span() and convert() and
+// compares the bytes. The source starts one byte in, so it isn't aligned
+template <typename SrcPixel, typename DstPixel>
+static bool check_convert_span_pair(uint32_t values, SrcPixel (*source)(uint32_t), SrcPixel (*reference)(uint32_t)) {
+    constexpr static const size_t chunk = 4096;
+    static uint8_t src[chunk * SrcPixel::packed_size + 1];
+    static uint8_t dst[chunk * DstPixel::packed_size];
+    static uint8_t expected[chunk * DstPixel::packed_size];
+    for (uint32_t first = 0; first < values; first += chunk) {
+        const size_t count = values - first < chunk ? values - first : chunk;
+        for (size_t i = 0; i < count; ++i) {
+            helpers::span_store(src + 1 + i * SrcPixel::packed_size, source(first + i));
+            DstPixel px;
+            TEST_CHECK(gfx_result::success == convert(reference(first + i), &px));
+            helpers::span_store(expected + i * DstPixel::packed_size, px);
+        }
+        convert_span<SrcPixel, DstPixel>(src + 1, dst, count);
+        TEST_CHECK(0 == memcmp(dst, expected, count * DstPixel::packed_size));
+    }
+    return true;
+}
+template <typename PixelType>
+static PixelType check_native_pixel(uint32_t value) {
+    return PixelType(typename PixelType::int_type(value), true);
+}
+// the red, green and blue of value with an alpha that varies along the run
+static rgba_pixel<32> check_rgba_pixel(uint32_t value) {
+    return rgba_pixel<32>(value >> 16, (value >> 8) & 255, value & 255, (value * 7) & 255);
+}
+// convert_span() drops the alpha, so the result is the opaque color
+static rgba_pixel<32> check_rgba_opaque(uint32_t value) {
+    return rgba_pixel<32>(value >> 16, (value >> 8) & 255, value & 255, 255);
+}
+// the specializations give the same result as convert() for every source value
+static bool check_convert_span() {
+    TEST_CHECK((check_convert_span_pair<rgb_pixel<24>, rgb_pixel<16>>(1 << 24, check_native_pixel<rgb_pixel<24>>, check_native_pixel<rgb_pixel<24>>)));
+    TEST_CHECK((check_convert_span_pair<rgba_pixel<32>, rgb_pixel<16>>(1 << 24, check_rgba_pixel, check_rgba_opaque)));
+    TEST_CHECK((check_convert_span_pair<rgb_pixel<16>, rgb_pixel<24>>(1 << 16, check_native_pixel<rgb_pixel<16>>, check_native_pixel<rgb_pixel<16>>)));
+    TEST_CHECK((check_convert_span_pair<gsc_pixel<8>, rgb_pixel<16>>(1 << 8, check_native_pixel<gsc_pixel<8>>, check_native_pixel<gsc_pixel<8>>)));
+    TEST_CHECK((check_convert_span_pair<rgb_pixel<16>, gsc_pixel<8>>(1 << 16, check_native_pixel<rgb_pixel<16>>, check_native_pixel<rgb_pixel<16>>)));
+    // and the generic one, to a type without a specialization
+    TEST_CHECK((check_convert_span_pair<rgb_pixel<16>, rgba_pixel<32>>(1 << 16, check_native_pixel<rgb_pixel<16>>, check_native_pixel<rgb_pixel<16>>)));
+    return true;
+}
+// looks up every run of an indexed row that starts at each pixel, including
+// ones in the middle of a byte, and checks nothing past the run is written
+template <typename SrcPixel>
+static bool check_convert_span_lut_run() {
+    using bmp_t = bitmap<SrcPixel>;
+    constexpr static const size16 size(37, 1);
+    uint8_t buffer[bmp_t::sizeof_buffer(size)];
+    bmp_t bmp(size, buffer);
+    const uint32_t mask = (1 << SrcPixel::bit_depth) - 1;
+    for (int x = 0; x < size.width; ++x) {
+        TEST_CHECK(gfx_result::success == bmp.point(point16(x, 0), SrcPixel((x * 5 + x / 3) & mask)));
+    }
+    rgb_pixel<16> lut[1 << SrcPixel::bit_depth];
+    for (size_t i = 0; i <= mask; ++i) {
+        lut[i] = rgb_pixel<16>(uint16_t(0x1234 * (i + 1)), true);
+    }
+    uint8_t dst[(size.width + 1) * 2];
+    for (size_t offset = 0; offset < size.width; ++offset) {
+        for (size_t count = 1; offset + count <= size.width; ++count) {
+            memset(dst, 0xAA, sizeof(dst));
+            convert_span<SrcPixel, rgb_pixel<16>>(buffer, dst, count, lut, offset);
+            for (size_t i = 0; i < count; ++i) {
+                SrcPixel px;
+                TEST_CHECK(gfx_result::success == bmp.point(point16(offset + i, 0), &px));
+                TEST_CHECK(helpers::span_load<rgb_pixel<16>>(dst + i * 2) == lut[px.template channel<0>()]);
+            }
+            TEST_CHECK(dst[count * 2] == 0xAA && dst[count * 2 + 1] == 0xAA);
+        }
+    }
+    return true;
+}
+static bool check_convert_span_lut() {
+    TEST_CHECK(check_convert_span_lut_run<indexed_pixel<1>>());
+    TEST_CHECK(check_convert_span_lut_run<indexed_pixel<2>>());
+    TEST_CHECK(check_convert_span_lut_run<indexed_pixel<4>>());
+    TEST_CHECK(check_convert_span_lut_run<indexed_pixel<8>>());
+    return true;
+}
+
+// THE HARNESS
+// how far a rendering may stray from its reference. Each channel is
+// compared at 8 bits, so a pixel differs when any channel is off by more than
+// channel_delta. The case fails when more than max_differing of the pixels
+// differ. Lossy formats need some slack for rounding, since float math is
+// not bit exact across compilers and platforms
+typedef struct {
+    int channel_delta;
+    float max_differing;
+} test_tolerance_t;
 
+static const char* test_golden = HTCW_GFX_GOLDEN_DIR;
+static const char* test_filter = nullptr;
+static bool test_update = false;
+static bool test_strict = false;
+static int test_repeat = 1;
+static size_t test_passed = 0;
+static size_t test_failed = 0;
+static size_t test_missing = 0;
+static size_t test_skipped = 0;
+
+static double now_ms() {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+// FNV-1a
+static uint64_t hash_buffer(const uint8_t* data, size_t size) {
+    uint64_t result = 14695981039346656037ULL;
+    while (size--) {
+        result = (result ^ *data++) * 1099511628211ULL;
+    }
+    return result;
+}
+static void make_golden_path(const char* scene, const char* format, char* out_path, size_t size) {
+    snprintf(out_path, size, "%s/%s_%s.gold", test_golden, scene, format);
+}
+// a reference image is a 16 byte header followed by the bitmap's buffer:
+// "GFXG", then the width, height and bit depth as little endian 16-bit values,
+// two reserved bytes, and the size of the buffer as a little endian 32-bit value
+static bool write_golden(const char* path, size16 dimensions, size_t bit_depth, const void* data, size_t size) {
+    uint8_t header[16] = {'G', 'F', 'X', 'G'};
+    header[4] = (uint8_t)dimensions.width;
+    header[5] = (uint8_t)(dimensions.width >> 8);
+    header[6] = (uint8_t)dimensions.height;
+    header[7] = (uint8_t)(dimensions.height >> 8);
+    header[8] = (uint8_t)bit_depth;
+    header[9] = (uint8_t)(bit_depth >> 8);
+    for (int i = 0; i < 4; ++i) {
+        header[12 + i] = (uint8_t)(size >> (i * 8));
+    }
+    FILE* file = fopen(path, "wb");
+    if (file == nullptr) {
+        return false;
+    }
+    const bool result = fwrite(header, 1, sizeof(header), file) == sizeof(header) && fwrite(data, 1, size, file) == size;
+    fclose(file);
+    return result;
+}
+// returns the buffer, which the caller frees, or nullptr if there's no usable reference
+static uint8_t* read_golden(const char* path, size16 dimensions, size_t bit_depth, size_t size) {
+    FILE* file = fopen(path, "rb");
+    if (file == nullptr) {
+        return nullptr;
+    }
+    uint8_t header[16];
+    uint8_t* result = nullptr;
+    if (fread(header, 1, sizeof(header), file) == sizeof(header) && 0 == memcmp(header, "GFXG", 4) &&
+        (header[4] | (header[5] << 8)) == dimensions.width && (header[6] | (header[7] << 8)) == dimensions.height &&
+        (size_t)(header[8] | (header[9] << 8)) == bit_depth &&
+        (size_t)(header[12] | (header[13] << 8) | (header[14] << 16) | ((uint32_t)header[15] << 24)) == size) {
+        result = (uint8_t*)::malloc(size);
+        if (result != nullptr && fread(result, 1, size, file) != size) {
+            ::free(result);
+            result = nullptr;
+        }
+    }
+    fclose(file);
+    return result;
+}
+// counts the pixels of actual that are further than tolerance allows from expected
+template <typename Bitmap>
+static size_t count_differing(const Bitmap& actual, const Bitmap& expected, int channel_delta, int* out_worst) {
+    size_t result = 0;
+    *out_worst = 0;
+    for (int y = 0; y < actual.dimensions().height; ++y) {
+        for (int x = 0; x < actual.dimensions().width; ++x) {
+            typename Bitmap::pixel_type lhs, rhs;
+            actual.point(point16(x, y), &lhs);
+            expected.point(point16(x, y), &rhs);
+            rgba_pixel<32> lhs_rgba, rhs_rgba;
+            convert_palette_to(actual, lhs, &lhs_rgba);
+            convert_palette_to(expected, rhs, &rhs_rgba);
+            int worst = 0;
+            for (int i = 0; i < 4; ++i) {
+                const int shift = i * 8;
+                int d = (int)((lhs_rgba.native_value >> shift) & 0xFF) - (int)((rhs_rgba.native_value >> shift) & 0xFF);
+                if (d < 0) {
+                    d = -d;
+                }
+                if (d > worst) {
+                    worst = d;
+                }
+            }
+            if (worst > *out_worst) {
+                *out_worst = worst;
+            }
+            if (worst > channel_delta) {
+                ++result;
+            }
+        }
+    }
+    return result;
+}
+template <typename Bitmap>
+static void run(const char* scene, const char* format, Bitmap& bmp, gfx_result (*render)(Bitmap& bmp), const test_tolerance_t& tolerance) {
+    if (test_filter != nullptr && strstr(scene, test_filter) == nullptr && strstr(format, test_filter) == nullptr) {
+        return;
+    }
+    printf("%-14s %-14s ", scene, format);
+    gfx_result res = gfx_result::success;
+    const double start = now_ms();
+    for (int i = 0; res == gfx_result::success && i < test_repeat; ++i) {
+        bmp.clear(bmp.bounds());
+        res = render(bmp);
+    }
+    const double ms = (now_ms() - start) / test_repeat;
+    if (res == gfx_result::not_supported) {
+        ++test_skipped;
+        puts("skipped");
+        return;
+    }
+    if (res != gfx_result::success) {
+        ++test_failed;
+        printf("FAILED   render error %d\n", (int)res);
+        return;
+    }
+    const size_t size = Bitmap::sizeof_buffer(bmp.dimensions());
+    const size_t bit_depth = Bitmap::pixel_type::bit_depth;
+    printf("%9.3f ms  %016llx  ", ms, (unsigned long long)hash_buffer(bmp.begin(), size));
+    char path[1024];
+    make_golden_path(scene, format, path, sizeof(path));
+    if (test_update) {
+        if (!write_golden(path, bmp.dimensions(), bit_depth, bmp.begin(), size)) {
+            ++test_failed;
+            printf("FAILED   unable to write %s\n", path);
+            return;
+        }
+        ++test_passed;
+        puts("updated");
+        return;
+    }
+    uint8_t* reference = read_golden(path, bmp.dimensions(), bit_depth, size);
+    if (reference == nullptr) {
+        ++test_missing;
+        puts(test_strict ? "FAILED   no reference" : "no reference");
+        return;
+    }
+    if (0 == memcmp(reference, bmp.begin(), size)) {
+        ::free(reference);
+        ++test_passed;
+        puts("identical");
+        return;
+    }
+    const Bitmap expected(bmp.dimensions(), reference, bmp.palette());
+    int worst;
+    const size_t differing = count_differing(bmp, expected, tolerance.channel_delta, &worst);
+    ::free(reference);
+    const size_t allowed = (size_t)(tolerance.max_differing * bmp.dimensions().area());
+    const bool passed = differing <= allowed;
+    if (passed) {
+        ++test_passed;
+    } else {
+        ++test_failed;
+    }
+    printf("%s %d pixels differ, at most by %d\n", passed ? "close   " : "FAILED  ", (int)differing, worst);
+}
+static void check(const char* name, bool (*test)()) {
+    if (test_filter != nullptr && strstr(name, test_filter) == nullptr && strstr("check", test_filter) == nullptr) {
+        return;
+    }
+    printf("%-14s %-14s %12s  %-16s  ", name, "check", "", "");
+    if (test()) {
+        ++test_passed;
+        puts("passed");
+    } else {
+        ++test_failed;
+    }
+}
+template <typename PixelType, typename PaletteType = palette<PixelType, PixelType>>
+static void test_format(const char* format, const test_tolerance_t& tolerance, const PaletteType* pal = nullptr) {
+    using bmp_t = bitmap<PixelType, PaletteType>;
+    bmp_t bmp(test_size, ::malloc(bmp_t::sizeof_buffer(test_size)), pal);
+    if (bmp.begin() == nullptr) {
+        ++test_failed;
+        fprintf(stderr, "Out of memory for %s\n", format);
+        return;
+    }
+    run("primitives", format, bmp, scene_primitives<bmp_t>, tolerance);
+    run("aa_primitives", format, bmp, scene_aa_primitives<bmp_t>, tolerance);
+    run("text", format, bmp, scene_text<bmp_t>, tolerance);
+    run("bitmap", format, bmp, scene_bitmap<bmp_t>, tolerance);
+    run("convert", format, bmp, scene_convert<bmp_t>, tolerance);
+    run("canvas", format, bmp, scene_canvas<bmp_t>, tolerance);
+    run("svg", format, bmp, scene_svg<bmp_t>, tolerance);
+    run("tvg", format, bmp, scene_tvg<bmp_t>, tolerance);
+    run("png", format, bmp, scene_png<bmp_t>, tolerance);
+    run("jpg", format, bmp, scene_jpg<bmp_t>, tolerance);
+    ::free(bmp.begin());
+}
+static bool make_directory(const char* path) {
+#ifdef _WIN32
+    return _mkdir(path) == 0 || errno == EEXIST;
+#else
+    return mkdir(path, 0777) == 0 || errno == EEXIST;
+#endif
+}
+int main(int argc, char** argv) {
+    for (int i = 1; i < argc; ++i) {
+        if (0 == strcmp(argv[i], "--golden") && i + 1 < argc) {
+            test_golden = argv[++i];
+        } else if (0 == strcmp(argv[i], "--update")) {
+            test_update = true;
+        } else if (0 == strcmp(argv[i], "--strict")) {
+            test_strict = true;
+        } else if (0 == strcmp(argv[i], "--filter") && i + 1 < argc) {
+            test_filter = argv[++i];
+        } else if (0 == strcmp(argv[i], "--repeat") && i + 1 < argc) {
+            test_repeat = atoi(argv[++i]);
+            if (test_repeat < 1) {
+                test_repeat = 1;
+            }
+        } else {
+            fprintf(stderr, "Usage: %s [--golden <dir>] [--update] [--strict] [--filter <text>] [--repeat <n>]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (test_update && !make_directory(test_golden)) {
+        fprintf(stderr, "Unable to create %s\n", test_golden);
+        return 1;
+    }
+    const gfx_result res = load_assets();
+    if (res != gfx_result::success) {
+        fprintf(stderr, "Unable to load the assets (%d)\n", (int)res);
+        return 1;
+    }
+    printf("%-14s %-14s %12s  %-16s  %s\n", "scene", "format", "time", "hash", "result");
+    check("text_tabs", check_text_layout_tabs);
+    check("text_wrap", check_text_layout_wrap);
+    check("text_cache", check_text_layout_cache);
+    check("layout_font", check_text_layout_cache_font);
+    check("tvg_forward", check_tvg_forward_stream);
+    check("rect_raster", check_rasterize_rect);
+    check("convert_span", check_convert_span);
+    check("convert_lut", check_convert_span_lut);
+    check("png_alloc", check_allocation_tracker_png);
+    // one step of a 5 or 6 bit channel is 8 or 4 at 8 bits
+    test_format<rgb_pixel<16>>("rgb565", {8, .002f});
+    test_format<rgb_pixel<24>>("rgb888", {2, .002f});
+    test_format<rgba_pixel<32>>("rgba8888", {2, .002f});
+    test_format<gsc_pixel<8>>("gsc8", {2, .002f});
+    // these have so few levels a rounding difference changes the color outright, so only a few pixels may differ
+    const ega_palette<rgb_pixel<24>> ega;
+    test_format<indexed_pixel<4>>("indexed4_ega", {0, .005f}, &ega);
+    test_format<gsc_pixel<1>>("mono", {0, .005f});
+    free_assets();
+    printf("\n%d passed, %d failed, %d without a reference, %d skipped\n", (int)test_passed, (int)test_failed, (int)test_missing, (int)test_skipped);
+    if (test_missing != 0 && !test_update) {
+        printf("Run with --update on a known good build to write the missing references to %s\n", test_golden);
+    }
+    return (test_failed == 0 && (!test_strict || test_missing == 0)) ? 0 : 2;
+}